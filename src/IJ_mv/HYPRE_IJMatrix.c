@@ -53,6 +53,8 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixThreadStash(ijmatrix)    = 0;
+   hypre_IJMatrixPattern(ijmatrix)        = NULL;
 
    hypre_MPI_Comm_size(comm,&num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -547,6 +549,7 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
    {
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
+      hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(ijmatrix);
 
       if (!ncols_tmp)
       {
@@ -564,7 +567,15 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
          hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes_tmp);
       }
 
-      if (hypre_IJMatrixOMPFlag(ijmatrix))
+      if (hypre_IJMatrixPattern(ijmatrix))
+      {
+         hypre_IJMatrixSetValuesPatternParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values, "set");
+      }
+      else if (aux_matrix && hypre_AuxParCSRMatrixNumStashes(aux_matrix))
+      {
+         hypre_IJMatrixStashValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values, "set");
+      }
+      else if (hypre_IJMatrixOMPFlag(ijmatrix))
       {
          hypre_IJMatrixSetValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
       }
@@ -754,6 +765,7 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
    {
       HYPRE_Int *row_indexes_tmp = (HYPRE_Int *) row_indexes;
       HYPRE_Int *ncols_tmp = ncols;
+      hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(ijmatrix);
 
       if (!ncols_tmp)
       {
@@ -771,7 +783,15 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
          hypre_PrefixSumInt(nrows, ncols_tmp, row_indexes_tmp);
       }
 
-      if (hypre_IJMatrixOMPFlag(ijmatrix))
+      if (hypre_IJMatrixPattern(ijmatrix))
+      {
+         hypre_IJMatrixSetValuesPatternParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values, "add");
+      }
+      else if (aux_matrix && hypre_AuxParCSRMatrixNumStashes(aux_matrix))
+      {
+         hypre_IJMatrixStashValuesParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values, "add");
+      }
+      else if (hypre_IJMatrixOMPFlag(ijmatrix))
       {
          hypre_IJMatrixAddToValuesOMPParCSR(ijmatrix, nrows, ncols_tmp, rows, row_indexes_tmp, cols, values);
       }
@@ -1332,3 +1352,54 @@ HYPRE_IJMatrixSetOMPFlag( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetThreadStash( HYPRE_IJMatrix matrix,
+                              HYPRE_Int      thread_stash )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixThreadStash(ijmatrix) = thread_stash;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixFreezePattern( HYPRE_IJMatrix matrix )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_GetExecPolicy1(hypre_IJMatrixMemoryLocation(ijmatrix)) != HYPRE_EXEC_HOST )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixFreezePatternParCSR(ijmatrix);
+
+   return hypre_error_flag;
+}
+
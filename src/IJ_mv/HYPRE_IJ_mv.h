@@ -323,6 +323,54 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel(HYPRE_IJMatrix matrix,
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag(HYPRE_IJMatrix matrix,
                                    HYPRE_Int      omp_flag);
 
+/**
+ * (Optional) if set to a value != 0 before HYPRE_IJMatrixInitialize,
+ * HYPRE_IJMatrixSetValues and HYPRE_IJMatrixAddToValues only append the
+ * given coefficients to a stash owned by the calling thread, and
+ * HYPRE_IJMatrixAssemble sorts and combines them into the matrix.  The
+ * stashes are not locked, so different threads of an OpenMP parallel region
+ * may set or add values concurrently, also to the same rows.
+ *
+ * The stashes are combined in the order of the thread numbers, not in the
+ * order in which the calls were made.  If several threads set the same
+ * coefficient, the value of the thread with the highest number is kept,
+ * and values added to it by threads with a lower number are discarded.
+ * For a result that does not depend on the thread numbers, set each
+ * coefficient from one thread only, or only add values.  Values added to
+ * rows of other processors are added after all values of the owner.
+ *
+ * The number of threads must not exceed the number of threads available at
+ * HYPRE_IJMatrixInitialize.  This option is ignored for matrices assembled on
+ * the device, and for a matrix that is re-initialized after assembly.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetThreadStash(HYPRE_IJMatrix matrix,
+                                       HYPRE_Int      thread_stash);
+
+/**
+ * (Optional) Freezes the nonzero pattern of an assembled matrix for repeated
+ * re-assembly with the same sequence of coefficients, e.g., once per time
+ * step.  The coefficients passed to HYPRE_IJMatrixSetValues and
+ * HYPRE_IJMatrixAddToValues up to the next HYPRE_IJMatrixAssemble are
+ * located in the matrix as usual, and their positions are recorded together
+ * with a plan for the exchange of the values added to rows of other
+ * processors.  In all following assemblies, the k-th coefficient is stored
+ * directly at the k-th recorded position, without searching rows or
+ * translating column indices.
+ *
+ * The calls to HYPRE_IJMatrixSetValues and HYPRE_IJMatrixAddToValues must
+ * then pass the same rows and columns in the same order in each assembly;
+ * only the values may change.  All coefficients must belong to the pattern
+ * of the assembled matrix.  HYPRE_IJMatrixAddToValues may add to rows of
+ * other processors, but HYPRE_IJMatrixSetValues may only set values in rows
+ * owned by the calling processor (an error is raised otherwise).  Values are
+ * not reset, so HYPRE_IJMatrixSetConstantValues should be used before adding
+ * values.  Calling this routine again records
+ * a new sequence.  This option is only available for matrices on the host.
+ *
+ * Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixFreezePattern(HYPRE_IJMatrix matrix);
+
 /**
  * Read the matrix from file.  This is mainly for debugging purposes.
  **/
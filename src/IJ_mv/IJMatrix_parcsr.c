@@ -357,6 +357,13 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          hypre_IJMatrixTranslator(matrix) = aux_matrix;
       }
 
+      if (hypre_IJMatrixThreadStash(matrix) && memory_location_aux == HYPRE_MEMORY_HOST)
+      {
+         /* one stash per thread, and a last one for the values received
+            from other processors, which are combined after all others */
+         hypre_AuxParCSRMatrixNumStashes(aux_matrix) = hypre_NumThreads() + 1;
+      }
+
       hypre_ParCSRMatrixInitialize_v2(par_matrix, memory_location);
       hypre_AuxParCSRMatrixInitialize_v2(aux_matrix, memory_location_aux);
 
@@ -383,7 +390,7 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
          }
       }
 
-      if (!hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+      if (!hypre_AuxParCSRMatrixNeedAux(aux_matrix) && !hypre_AuxParCSRMatrixNumStashes(aux_matrix))
       {
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
@@ -400,7 +407,8 @@ hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation m
       /* AB 4/06 - the assemble routine destroys the aux matrix - so we need
          to recreate if initialize is called again
       */
-      if (!aux_matrix)
+      /* a frozen pattern needs no aux matrix */
+      if (!aux_matrix && !hypre_IJMatrixPattern(matrix))
       {
          hypre_AuxParCSRMatrixCreate(&aux_matrix, hypre_ParCSRMatrixNumRows(par_matrix),
                                      hypre_ParCSRMatrixNumCols(par_matrix), NULL);
@@ -775,6 +783,11 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
       HYPRE_Int j_offd;
+
+      /* the values are changed in place: drop the SELL copies */
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixOffd(par_matrix));
+
       for (ii=0; ii < nrows; ii++)
       {
          row = rows[ii];
@@ -1164,7 +1177,11 @@ hypre_IJMatrixSetConstantValuesParCSR( hypre_IJMatrix *matrix,
       else
 #endif
       {
+         hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+
          hypre_IJMatrixSetConstantValuesParCSRHost(matrix, value);
+         hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixDiag(par_matrix));
+         hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixOffd(par_matrix));
       }
    }
    else
@@ -1257,6 +1274,10 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int j_offd;
 
+      /* the values are changed in place: drop the SELL copies */
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixOffd(par_matrix));
+
       /* AB - 4/06 - need to get this object*/
       aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
 
@@ -1721,6 +1742,7 @@ hypre_IJMatrixDestroyParCSR(hypre_IJMatrix *matrix)
 {
    hypre_ParCSRMatrixDestroy((hypre_ParCSRMatrix *)hypre_IJMatrixObject(matrix));
    hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix*)hypre_IJMatrixTranslator(matrix));
+   hypre_IJParCSRPatternDestroy((hypre_IJParCSRPattern*)hypre_IJMatrixPattern(matrix));
 
    return hypre_error_flag;
 }
@@ -1748,6 +1770,7 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
                                          HYPRE_Complex        *off_proc_data )
 {
    MPI_Comm comm = hypre_IJMatrixComm(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
    hypre_MPI_Request *requests = NULL;
    hypre_MPI_Status *status = NULL;
    HYPRE_Int i, ii, j, j2, jj, n, row_index = 0;
@@ -1999,8 +2022,17 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       {
          row = recv_i[j];
          HYPRE_Int rcvi = (HYPRE_Int) recv_i[j+1];
-         hypre_IJMatrixAddToValuesParCSR(matrix,1,&rcvi,&row,&row_index,
-                                         &recv_i[j+2],&recv_data[j2]);
+         if (hypre_AuxParCSRMatrixNumStashes(aux_matrix))
+         {
+            hypre_IJMatrixStashAppendParCSR(matrix,hypre_AuxParCSRMatrixNumStashes(aux_matrix)-1,
+                                            1,&rcvi,&row,&row_index,
+                                            &recv_i[j+2],&recv_data[j2],0);
+         }
+         else
+         {
+            hypre_IJMatrixAddToValuesParCSR(matrix,1,&rcvi,&row,&row_index,
+                                            &recv_i[j+2],&recv_data[j2]);
+         }
          j2 += recv_i[j+1];
          j += recv_i[j+1]+2;
       }
@@ -2027,6 +2059,7 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
                                          HYPRE_Complex        *off_proc_data )
 {
    MPI_Comm comm = hypre_IJMatrixComm(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
 
    HYPRE_Int i, j, k, in_i;
    HYPRE_Int myid;
@@ -2569,7 +2602,12 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
          }
 
-         if (memory_location == HYPRE_MEMORY_HOST)
+         if (memory_location == HYPRE_MEMORY_HOST && hypre_AuxParCSRMatrixNumStashes(aux_matrix))
+         {
+            hypre_IJMatrixStashAppendParCSR(matrix, hypre_AuxParCSRMatrixNumStashes(aux_matrix)-1,
+                                            1, &num_elements, &row, &row_index, col_ptr, col_data_ptr, 0);
+         }
+         else if (memory_location == HYPRE_MEMORY_HOST)
          {
             hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
          }
@@ -2823,6 +2861,20 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    HYPRE_Int max_num_threads;
    HYPRE_Int aux_flag, aux_flag_global;
 
+   if (hypre_IJMatrixPattern(matrix))
+   {
+      return hypre_IJMatrixAssemblePatternParCSR(matrix);
+   }
+
+   /* the values of diag and offd may have changed in place: drop their SELL
+      copies, the next matvec rebuilds them */
+   hypre_CSRMatrixSELLInvalidate(diag);
+   hypre_CSRMatrixSELLInvalidate(offd);
+
+   /* the pattern of diag may change: drop the stored multicolor ordering */
+   hypre_TFree(hypre_ParCSRMatrixColorOffsets(par_matrix), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParCSRMatrixColorRows(par_matrix), HYPRE_MEMORY_HOST);
+
    max_num_threads = hypre_NumThreads();
 
    /* first find out if anyone has an aux_matrix, and create one if you don't
@@ -2889,6 +2941,11 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
          hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix) = new_off_proc_i_indx;
          hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = current_num_elmts;
       }*/
+      if (hypre_AuxParCSRMatrixNumStashes(aux_matrix))
+      {
+         /* values for rows of other processors go the usual way */
+         hypre_IJMatrixAssembleStashOffProcParCSR(matrix);
+      }
       off_proc_i_indx = hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix);
       hypre_MPI_Allreduce(&off_proc_i_indx, &offd_proc_elmts, 1, HYPRE_MPI_INT,
                           hypre_MPI_SUM, comm);
@@ -2920,7 +2977,13 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
       col_n = col_partitioning[my_id+1]-1;
 #endif
       /* move data into ParCSRMatrix if not there already */
-      if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
+      if (hypre_AuxParCSRMatrixNumStashes(aux_matrix))
+      {
+         hypre_IJMatrixAssembleStashParCSR(matrix);
+         offd_j = hypre_CSRMatrixJ(offd);
+         big_offd_j = hypre_CSRMatrixBigJ(offd);
+      }
+      else if (hypre_AuxParCSRMatrixNeedAux(aux_matrix))
       {
          HYPRE_Int *diag_array, *offd_array;
          diag_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
@@ -3156,6 +3219,1195 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixStashValuesParCSR
+ *
+ * Appends the given values to the stash of the calling thread.  action is
+ * "set" or "add"; values set in rows of other processors are ignored, as in
+ * hypre_IJMatrixSetValuesParCSR.  No locks are needed, since every thread
+ * owns its stash.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixStashValuesParCSR( hypre_IJMatrix       *matrix,
+                                 HYPRE_Int             nrows,
+                                 HYPRE_Int            *ncols,
+                                 const HYPRE_BigInt   *rows,
+                                 const HYPRE_Int      *row_indexes,
+                                 const HYPRE_BigInt   *cols,
+                                 const HYPRE_Complex  *values,
+                                 const char           *action )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              my_thread_num = hypre_GetThreadNum();
+
+   /* the last stash is reserved for the values received from other
+      processors */
+   if (my_thread_num >= hypre_AuxParCSRMatrixNumStashes(aux_matrix) - 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "More threads than stashes allocated at IJMatrixInitialize!\n");
+      return hypre_error_flag;
+   }
+
+   return hypre_IJMatrixStashAppendParCSR(matrix, my_thread_num, nrows, ncols, rows,
+                                          row_indexes, cols, values, action[0] == 's');
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixStashAppendParCSR
+ *
+ * Appends the given values to stash stash_num, as values set (sora = 1) or
+ * added (sora = 0).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixStashAppendParCSR( hypre_IJMatrix       *matrix,
+                                 HYPRE_Int             stash_num,
+                                 HYPRE_Int             nrows,
+                                 HYPRE_Int            *ncols,
+                                 const HYPRE_BigInt   *rows,
+                                 const HYPRE_Int      *row_indexes,
+                                 const HYPRE_BigInt   *cols,
+                                 const HYPRE_Complex  *values,
+                                 char                  sora )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+
+   hypre_AuxParCSRStash  *stash;
+   HYPRE_BigInt          *stash_i, *stash_j;
+   HYPRE_Complex         *stash_data;
+   char                  *stash_sora;
+   HYPRE_BigInt           row, row_0, row_n;
+   HYPRE_Int              ii, j, n, indx, cnt, max_elmts;
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   row_0 = row_partitioning[0];
+   row_n = row_partitioning[1];
+#else
+   HYPRE_Int my_id;
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+   row_0 = row_partitioning[my_id];
+   row_n = row_partitioning[my_id+1];
+#endif
+
+   stash = hypre_AuxParCSRMatrixStashes(aux_matrix)[stash_num];
+   if (!stash)
+   {
+      stash = hypre_CTAlloc(hypre_AuxParCSRStash, 1, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRMatrixStashes(aux_matrix)[stash_num] = stash;
+   }
+
+   n = 0;
+   for (ii = 0; ii < nrows; ii++)
+   {
+      n += ncols[ii];
+   }
+
+   cnt = hypre_AuxParCSRStashNumElmts(stash);
+   max_elmts = hypre_AuxParCSRStashMaxElmts(stash);
+   if (cnt + n > max_elmts)
+   {
+      max_elmts = hypre_max(2*max_elmts, hypre_max(cnt + n, 1000));
+      hypre_AuxParCSRStashI(stash) =
+         hypre_TReAlloc(hypre_AuxParCSRStashI(stash), HYPRE_BigInt, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashJ(stash) =
+         hypre_TReAlloc(hypre_AuxParCSRStashJ(stash), HYPRE_BigInt, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashData(stash) =
+         hypre_TReAlloc(hypre_AuxParCSRStashData(stash), HYPRE_Complex, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashSorA(stash) =
+         hypre_TReAlloc(hypre_AuxParCSRStashSorA(stash), char, max_elmts, HYPRE_MEMORY_HOST);
+      hypre_AuxParCSRStashMaxElmts(stash) = max_elmts;
+   }
+
+   stash_i    = hypre_AuxParCSRStashI(stash);
+   stash_j    = hypre_AuxParCSRStashJ(stash);
+   stash_data = hypre_AuxParCSRStashData(stash);
+   stash_sora = hypre_AuxParCSRStashSorA(stash);
+
+   for (ii = 0; ii < nrows; ii++)
+   {
+      row = rows[ii];
+      if (sora && (row < row_0 || row >= row_n))
+      {
+         continue;
+      }
+
+      indx = row_indexes[ii];
+      for (j = 0; j < ncols[ii]; j++)
+      {
+         stash_i[cnt]    = row;
+         stash_j[cnt]    = cols[indx];
+         stash_data[cnt] = values[indx++];
+         stash_sora[cnt] = sora;
+         cnt++;
+      }
+   }
+   hypre_AuxParCSRStashNumElmts(stash) = cnt;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleStashOffProcParCSR
+ *
+ * Moves the stashed values for rows of other processors into the off
+ * processor stash of the aux matrix, in the (row, no. of elements) format
+ * used by hypre_IJMatrixAssembleOffProcValsParCSR.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleStashOffProcParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_Int              num_stashes = hypre_AuxParCSRMatrixNumStashes(aux_matrix);
+   hypre_AuxParCSRStash **stashes = hypre_AuxParCSRMatrixStashes(aux_matrix);
+
+   HYPRE_Int             *elmt_start, *pair_start;
+   HYPRE_BigInt          *off_proc_i, *off_proc_j;
+   HYPRE_Complex         *off_proc_data;
+   HYPRE_BigInt           row_0, row_n;
+   HYPRE_Int              s;
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   row_0 = row_partitioning[0];
+   row_n = row_partitioning[1];
+#else
+   HYPRE_Int my_id;
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+   row_0 = row_partitioning[my_id];
+   row_n = row_partitioning[my_id+1];
+#endif
+
+   elmt_start = hypre_CTAlloc(HYPRE_Int, num_stashes+1, HYPRE_MEMORY_HOST);
+   pair_start = hypre_CTAlloc(HYPRE_Int, num_stashes+1, HYPRE_MEMORY_HOST);
+
+   /* count off processor elements and row segments of every stash */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(s) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_stashes; s++)
+   {
+      HYPRE_BigInt *stash_i, prev = -1;
+      HYPRE_Int     k, num_elmts = 0, num_pairs = 0;
+
+      if (stashes[s])
+      {
+         stash_i = hypre_AuxParCSRStashI(stashes[s]);
+         for (k = 0; k < hypre_AuxParCSRStashNumElmts(stashes[s]); k++)
+         {
+            if (stash_i[k] < row_0 || stash_i[k] >= row_n)
+            {
+               if (!num_elmts || stash_i[k] != prev)
+               {
+                  num_pairs++;
+               }
+               num_elmts++;
+            }
+            prev = stash_i[k];
+         }
+      }
+      elmt_start[s+1] = num_elmts;
+      pair_start[s+1] = num_pairs;
+   }
+
+   for (s = 0; s < num_stashes; s++)
+   {
+      elmt_start[s+1] += elmt_start[s];
+      pair_start[s+1] += pair_start[s];
+   }
+
+   hypre_TFree(hypre_AuxParCSRMatrixOffProcI(aux_matrix),    HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(aux_matrix),    HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_AuxParCSRMatrixOffProcData(aux_matrix), HYPRE_MEMORY_HOST);
+
+   off_proc_i    = hypre_TAlloc(HYPRE_BigInt,  2*pair_start[num_stashes], HYPRE_MEMORY_HOST);
+   off_proc_j    = hypre_TAlloc(HYPRE_BigInt,  elmt_start[num_stashes],   HYPRE_MEMORY_HOST);
+   off_proc_data = hypre_TAlloc(HYPRE_Complex, elmt_start[num_stashes],   HYPRE_MEMORY_HOST);
+
+   /* copy them, and keep the local elements in the stash */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(s) HYPRE_SMP_SCHEDULE
+#endif
+   for (s = 0; s < num_stashes; s++)
+   {
+      HYPRE_BigInt  *stash_i, *stash_j;
+      HYPRE_Complex *stash_data;
+      char          *stash_sora;
+      HYPRE_Int      k, cnt = 0;
+      HYPRE_Int      i_indx = 2*pair_start[s] - 2;
+      HYPRE_Int      j_indx = elmt_start[s];
+
+      if (!stashes[s])
+      {
+         continue;
+      }
+
+      stash_i    = hypre_AuxParCSRStashI(stashes[s]);
+      stash_j    = hypre_AuxParCSRStashJ(stashes[s]);
+      stash_data = hypre_AuxParCSRStashData(stashes[s]);
+      stash_sora = hypre_AuxParCSRStashSorA(stashes[s]);
+
+      for (k = 0; k < hypre_AuxParCSRStashNumElmts(stashes[s]); k++)
+      {
+         if (stash_i[k] < row_0 || stash_i[k] >= row_n)
+         {
+            if (j_indx == elmt_start[s] || stash_i[k] != off_proc_i[i_indx])
+            {
+               i_indx += 2;
+               off_proc_i[i_indx]   = stash_i[k];
+               off_proc_i[i_indx+1] = 0;
+            }
+            off_proc_i[i_indx+1]++;
+            off_proc_j[j_indx]      = stash_j[k];
+            off_proc_data[j_indx++] = stash_data[k];
+         }
+         else
+         {
+            stash_i[cnt]    = stash_i[k];
+            stash_j[cnt]    = stash_j[k];
+            stash_data[cnt] = stash_data[k];
+            stash_sora[cnt] = stash_sora[k];
+            cnt++;
+         }
+      }
+      hypre_AuxParCSRStashNumElmts(stashes[s]) = cnt;
+   }
+
+   hypre_AuxParCSRMatrixMaxOffProcElmts(aux_matrix)     = elmt_start[num_stashes];
+   hypre_AuxParCSRMatrixCurrentOffProcElmts(aux_matrix) = elmt_start[num_stashes];
+   hypre_AuxParCSRMatrixOffProcIIndx(aux_matrix)        = 2*pair_start[num_stashes];
+   hypre_AuxParCSRMatrixOffProcI(aux_matrix)            = off_proc_i;
+   hypre_AuxParCSRMatrixOffProcJ(aux_matrix)            = off_proc_j;
+   hypre_AuxParCSRMatrixOffProcData(aux_matrix)         = off_proc_data;
+
+   hypre_TFree(elmt_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(pair_start, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssembleStashParCSR
+ *
+ * Builds diag and offd of the ParCSR matrix from the thread stashes, which
+ * only contain local rows at this point.  The rows are split into one
+ * block per thread.  The elements are first distributed to the blocks, then
+ * every thread sorts its rows by column and combines duplicates: the last
+ * value set (in the order of the stashes) plus all values added after it.
+ * The order of the stashes is the thread number, so the relative order of
+ * calls from different threads is not taken into account.  The values
+ * received from other processors are in the last stash, so they are added
+ * after all local values have been combined.  offd is returned with global
+ * column numbers in big_j.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssembleStashParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix*) hypre_IJMatrixObject(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix = (hypre_AuxParCSRMatrix*) hypre_IJMatrixTranslator(matrix);
+   HYPRE_Int              num_stashes = hypre_AuxParCSRMatrixNumStashes(aux_matrix);
+   hypre_AuxParCSRStash **stashes = hypre_AuxParCSRMatrixStashes(aux_matrix);
+
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int       *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int       *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int       *diag_j = NULL;
+   HYPRE_Int       *offd_j = NULL;
+   HYPRE_BigInt    *big_offd_j = NULL;
+   HYPRE_Complex   *diag_data = NULL;
+   HYPRE_Complex   *offd_data = NULL;
+   HYPRE_Int        num_rows = hypre_ParCSRMatrixNumRows(par_matrix);
+   HYPRE_BigInt    *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt    *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt     row_0, col_0, col_n;
+
+   HYPRE_Int        max_num_threads = hypre_NumThreads();
+   HYPRE_Int       *blk_cnt, *diag_array, *offd_array;
+   HYPRE_Int       *row_start, *row_end;
+   HYPRE_Int       *elmt_row = NULL, *sort_pos = NULL;
+   HYPRE_BigInt    *elmt_col = NULL, *sort_col = NULL;
+   HYPRE_Complex   *elmt_data = NULL, *sort_data = NULL;
+   char            *elmt_sora = NULL;
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   row_0 = row_partitioning[0];
+   col_0 = col_partitioning[0];
+   col_n = col_partitioning[1]-1;
+#else
+   HYPRE_Int my_id;
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+   row_0 = row_partitioning[my_id];
+   col_0 = col_partitioning[my_id];
+   col_n = col_partitioning[my_id+1]-1;
+#endif
+
+   blk_cnt    = hypre_CTAlloc(HYPRE_Int, num_stashes*max_num_threads+1, HYPRE_MEMORY_HOST);
+   diag_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+   offd_array = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+   row_start  = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   row_end    = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel
+#endif
+   {
+      HYPRE_BigInt  *stash_i, *stash_j, col;
+      HYPRE_Complex *stash_data, val;
+      char          *stash_sora;
+      HYPRE_Int      num_threads, my_thread_num;
+      HYPRE_Int      rest, size, ns, ne, b, s, i, k, p, q, qe, cnt, last_set;
+      HYPRE_Int      i_diag, i_offd, diag_pos;
+
+      num_threads = hypre_NumActiveThreads();
+      my_thread_num = hypre_GetThreadNum();
+
+      size = num_rows/num_threads;
+      rest = num_rows - size*num_threads;
+
+      if (my_thread_num < rest)
+      {
+         ns = my_thread_num*(size + 1);
+         ne = (my_thread_num+1)*(size + 1);
+      }
+      else
+      {
+         ns = my_thread_num*size + rest;
+         ne = (my_thread_num+1)*size + rest;
+      }
+
+      /* number of elements of stash s in the row block b of each thread,
+         stored at blk_cnt[b*num_stashes+s] */
+      for (s = my_thread_num; s < num_stashes; s += num_threads)
+      {
+         if (!stashes[s])
+         {
+            continue;
+         }
+         stash_i = hypre_AuxParCSRStashI(stashes[s]);
+         for (k = 0; k < hypre_AuxParCSRStashNumElmts(stashes[s]); k++)
+         {
+            i = (HYPRE_Int)(stash_i[k] - row_0);
+            b = (i < rest*(size+1)) ? i/(size+1) : rest + (i - rest*(size+1))/size;
+            blk_cnt[b*num_stashes+s]++;
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         cnt = 0;
+         for (k = 0; k < num_threads*num_stashes; k++)
+         {
+            p = blk_cnt[k];
+            blk_cnt[k] = cnt;
+            cnt += p;
+         }
+         blk_cnt[num_threads*num_stashes] = cnt;
+
+         elmt_row  = hypre_TAlloc(HYPRE_Int,     cnt, HYPRE_MEMORY_HOST);
+         elmt_col  = hypre_TAlloc(HYPRE_BigInt,  cnt, HYPRE_MEMORY_HOST);
+         elmt_data = hypre_TAlloc(HYPRE_Complex, cnt, HYPRE_MEMORY_HOST);
+         elmt_sora = hypre_TAlloc(char,          cnt, HYPRE_MEMORY_HOST);
+         sort_pos  = hypre_TAlloc(HYPRE_Int,     cnt, HYPRE_MEMORY_HOST);
+         sort_col  = hypre_TAlloc(HYPRE_BigInt,  cnt, HYPRE_MEMORY_HOST);
+         sort_data = hypre_TAlloc(HYPRE_Complex, cnt, HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      /* distribute the elements to the blocks, keeping the order of each
+         stash; afterwards blk_cnt[b*num_stashes+s] is the end of the
+         elements of stash s in block b */
+      for (s = my_thread_num; s < num_stashes; s += num_threads)
+      {
+         if (!stashes[s])
+         {
+            continue;
+         }
+         stash_i    = hypre_AuxParCSRStashI(stashes[s]);
+         stash_j    = hypre_AuxParCSRStashJ(stashes[s]);
+         stash_data = hypre_AuxParCSRStashData(stashes[s]);
+         stash_sora = hypre_AuxParCSRStashSorA(stashes[s]);
+         for (k = 0; k < hypre_AuxParCSRStashNumElmts(stashes[s]); k++)
+         {
+            i = (HYPRE_Int)(stash_i[k] - row_0);
+            b = (i < rest*(size+1)) ? i/(size+1) : rest + (i - rest*(size+1))/size;
+            p = blk_cnt[b*num_stashes+s]++;
+            elmt_row[p]  = i;
+            elmt_col[p]  = stash_j[k];
+            elmt_data[p] = stash_data[k];
+            elmt_sora[p] = stash_sora[k];
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      /* counting sort of the own block by rows */
+      p  = my_thread_num ? blk_cnt[my_thread_num*num_stashes-1] : 0;
+      qe = blk_cnt[(my_thread_num+1)*num_stashes-1];
+      for (k = p; k < qe; k++)
+      {
+         row_end[elmt_row[k]]++;
+      }
+      cnt = p;
+      for (i = ns; i < ne; i++)
+      {
+         row_start[i] = cnt;
+         cnt += row_end[i];
+         row_end[i] = row_start[i];
+      }
+      for (k = p; k < qe; k++)
+      {
+         q = row_end[elmt_row[k]]++;
+         sort_col[q] = elmt_col[k];
+         sort_pos[q] = k;
+      }
+
+      /* sort every row by columns and combine the duplicates */
+      i_diag = 0;
+      i_offd = 0;
+      for (i = ns; i < ne; i++)
+      {
+         hypre_BigQsortbi(sort_col, sort_pos, row_start[i], row_end[i]-1);
+
+         cnt = row_start[i];
+         for (q = row_start[i]; q < row_end[i]; q = qe)
+         {
+            col = sort_col[q];
+            last_set = -1;
+            for (qe = q; qe < row_end[i] && sort_col[qe] == col; qe++)
+            {
+               if (elmt_sora[sort_pos[qe]] && sort_pos[qe] > last_set)
+               {
+                  last_set = sort_pos[qe];
+               }
+            }
+            val = (last_set > -1) ? elmt_data[last_set] : 0.0;
+            for (k = q; k < qe; k++)
+            {
+               if (!elmt_sora[sort_pos[k]] && sort_pos[k] > last_set)
+               {
+                  val += elmt_data[sort_pos[k]];
+               }
+            }
+            sort_col[cnt]  = col;
+            sort_data[cnt] = val;
+            cnt++;
+
+            if (col < col_0 || col > col_n)
+            {
+               i_offd++;
+            }
+            else
+            {
+               i_diag++;
+            }
+         }
+         row_end[i] = cnt;
+      }
+      diag_array[my_thread_num] = i_diag;
+      offd_array[my_thread_num] = i_offd;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         i_diag = 0;
+         i_offd = 0;
+         for (i = 0; i < num_threads; i++)
+         {
+            i_diag += diag_array[i];
+            i_offd += offd_array[i];
+            diag_array[i] = i_diag;
+            offd_array[i] = i_offd;
+         }
+         diag_i[num_rows] = i_diag;
+         offd_i[num_rows] = i_offd;
+
+         hypre_TFree(hypre_CSRMatrixJ(diag),    hypre_CSRMatrixMemoryLocation(diag));
+         hypre_TFree(hypre_CSRMatrixData(diag), hypre_CSRMatrixMemoryLocation(diag));
+         hypre_TFree(hypre_CSRMatrixJ(offd),    hypre_CSRMatrixMemoryLocation(offd));
+         hypre_TFree(hypre_CSRMatrixData(offd), hypre_CSRMatrixMemoryLocation(offd));
+         hypre_TFree(hypre_CSRMatrixBigJ(offd), hypre_CSRMatrixMemoryLocation(offd));
+
+         diag_j     = hypre_CTAlloc(HYPRE_Int,     i_diag, hypre_CSRMatrixMemoryLocation(diag));
+         diag_data  = hypre_CTAlloc(HYPRE_Complex, i_diag, hypre_CSRMatrixMemoryLocation(diag));
+         offd_j     = hypre_CTAlloc(HYPRE_Int,     i_offd, hypre_CSRMatrixMemoryLocation(offd));
+         offd_data  = hypre_CTAlloc(HYPRE_Complex, i_offd, hypre_CSRMatrixMemoryLocation(offd));
+         big_offd_j = hypre_CTAlloc(HYPRE_BigInt,  i_offd, hypre_CSRMatrixMemoryLocation(offd));
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+      /* copy into diag (diagonal element first) and offd */
+      i_diag = my_thread_num ? diag_array[my_thread_num-1] : 0;
+      i_offd = my_thread_num ? offd_array[my_thread_num-1] : 0;
+      for (i = ns; i < ne; i++)
+      {
+         diag_i[i] = i_diag;
+         offd_i[i] = i_offd;
+         diag_pos = -1;
+         for (q = row_start[i]; q < row_end[i]; q++)
+         {
+            if (sort_col[q] == col_0 + i && sort_col[q] <= col_n)
+            {
+               diag_pos = q;
+               diag_j[i_diag] = i;
+               diag_data[i_diag++] = sort_data[q];
+               break;
+            }
+         }
+         for (q = row_start[i]; q < row_end[i]; q++)
+         {
+            if (sort_col[q] < col_0 || sort_col[q] > col_n)
+            {
+               big_offd_j[i_offd] = sort_col[q];
+               offd_data[i_offd++] = sort_data[q];
+            }
+            else if (q != diag_pos)
+            {
+               diag_j[i_diag] = (HYPRE_Int)(sort_col[q] - col_0);
+               diag_data[i_diag++] = sort_data[q];
+            }
+         }
+      }
+   } /* end parallel region */
+
+   hypre_CSRMatrixJ(diag) = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = diag_i[num_rows];
+   if (offd_i[num_rows] > 0)
+   {
+      hypre_CSRMatrixJ(offd) = offd_j;
+      hypre_CSRMatrixBigJ(offd) = big_offd_j;
+      hypre_CSRMatrixData(offd) = offd_data;
+   }
+   else
+   {
+      hypre_TFree(offd_j,     hypre_CSRMatrixMemoryLocation(offd));
+      hypre_TFree(big_offd_j, hypre_CSRMatrixMemoryLocation(offd));
+      hypre_TFree(offd_data,  hypre_CSRMatrixMemoryLocation(offd));
+   }
+   hypre_CSRMatrixNumNonzeros(offd) = offd_i[num_rows];
+
+   hypre_TFree(blk_cnt,    HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_start,  HYPRE_MEMORY_HOST);
+   hypre_TFree(row_end,    HYPRE_MEMORY_HOST);
+   hypre_TFree(elmt_row,   HYPRE_MEMORY_HOST);
+   hypre_TFree(elmt_col,   HYPRE_MEMORY_HOST);
+   hypre_TFree(elmt_data,  HYPRE_MEMORY_HOST);
+   hypre_TFree(elmt_sora,  HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_pos,   HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_col,   HYPRE_MEMORY_HOST);
+   hypre_TFree(sort_data,  HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixFreezePatternParCSR
+ *
+ * Starts recording the positions of the coefficients passed to SetValues
+ * and AddToValues until the next assembly, see HYPRE_IJMatrixFreezePattern.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixFreezePatternParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_IJParCSRPattern *pattern;
+   HYPRE_Int              num_rows;
+
+   if (!hypre_IJMatrixAssembleFlag(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "The pattern of a matrix can only be frozen after assembly!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_IJParCSRPatternDestroy((hypre_IJParCSRPattern *) hypre_IJMatrixPattern(matrix));
+   hypre_IJParCSRPatternCreate(&pattern);
+
+   num_rows = hypre_ParCSRMatrixNumRows(par_matrix);
+   hypre_IJParCSRPatternNnzDiag(pattern) =
+      hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(par_matrix))[num_rows];
+   hypre_IJParCSRPatternNnzOffd(pattern) =
+      hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(par_matrix))[num_rows];
+
+   hypre_IJMatrixPattern(matrix) = pattern;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixFindSlotParCSR
+ *
+ * Returns the position of coefficient (row_local, col) of an assembled
+ * matrix: an index into diag data, or the number of nonzeros of diag plus
+ * an index into offd data.  Returns -1 if the coefficient is not in the
+ * pattern.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixFindSlotParCSR( hypre_IJMatrix *matrix,
+                              HYPRE_Int       row_local,
+                              HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   hypre_CSRMatrix    *diag = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j = hypre_CSRMatrixJ(offd);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int           num_rows = hypre_CSRMatrixNumRows(diag);
+   HYPRE_BigInt        col_0, col_n, first;
+   HYPRE_Int           j, j_col;
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   col_0 = col_partitioning[0];
+   col_n = col_partitioning[1]-1;
+   first = hypre_IJMatrixGlobalFirstCol(matrix);
+#else
+   HYPRE_Int my_id;
+   hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+   col_0 = col_partitioning[my_id];
+   col_n = col_partitioning[my_id+1]-1;
+   first = col_partitioning[0];
+#endif
+
+   if (col < col_0 || col > col_n)
+   {
+      if (!num_cols_offd)
+      {
+         return -1;
+      }
+      j_col = hypre_BigBinarySearch(hypre_ParCSRMatrixColMapOffd(par_matrix), col-first,
+                                    num_cols_offd);
+      if (j_col == -1)
+      {
+         return -1;
+      }
+      for (j = offd_i[row_local]; j < offd_i[row_local+1]; j++)
+      {
+         if (offd_j[j] == j_col)
+         {
+            return diag_i[num_rows] + j;
+         }
+      }
+   }
+   else
+   {
+      j_col = (HYPRE_Int)(col - col_0);
+      for (j = diag_i[row_local]; j < diag_i[row_local+1]; j++)
+      {
+         if (diag_j[j] == j_col)
+         {
+            return j;
+         }
+      }
+   }
+
+   return -1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixSetValuesPatternParCSR
+ *
+ * SetValues (action "set") and AddToValues (action "add") for a matrix with
+ * a frozen pattern.  While recording, the position of every coefficient is
+ * searched and saved, and values added to rows of other processors are
+ * collected.  Afterwards, the k-th coefficient is stored at the k-th saved
+ * position.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixSetValuesPatternParCSR( hypre_IJMatrix       *matrix,
+                                      HYPRE_Int             nrows,
+                                      HYPRE_Int            *ncols,
+                                      const HYPRE_BigInt   *rows,
+                                      const HYPRE_Int      *row_indexes,
+                                      const HYPRE_BigInt   *cols,
+                                      const HYPRE_Complex  *values,
+                                      const char           *action )
+{
+   hypre_IJParCSRPattern *pattern    = (hypre_IJParCSRPattern *) hypre_IJMatrixPattern(matrix);
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_Complex         *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex         *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Complex         *send_data  = hypre_IJParCSRPatternSendData(pattern);
+   HYPRE_Int              nnz_diag   = hypre_IJParCSRPatternNnzDiag(pattern);
+   HYPRE_Int              nnz_local  = nnz_diag + hypre_IJParCSRPatternNnzOffd(pattern);
+   HYPRE_Int              num_slots  = hypre_IJParCSRPatternNumSlots(pattern);
+   HYPRE_Int             *slots      = hypre_IJParCSRPatternSlots(pattern);
+   HYPRE_Int              add        = (action[0] == 'a');
+   HYPRE_Int              print_level = hypre_IJMatrixPrintLevel(matrix);
+   HYPRE_Int              ii, i, n, indx, slot, cursor;
+   HYPRE_Int              dropped = 0;
+   HYPRE_Complex          value;
+
+   if (hypre_IJParCSRPatternRecording(pattern))
+   {
+      HYPRE_BigInt *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+      HYPRE_BigInt  row, row_0, row_n;
+      HYPRE_Int     k, size;
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+      row_0 = row_partitioning[0];
+      row_n = row_partitioning[1];
+#else
+      HYPRE_Int my_id;
+      hypre_MPI_Comm_rank(hypre_IJMatrixComm(matrix), &my_id);
+      row_0 = row_partitioning[my_id];
+      row_n = row_partitioning[my_id+1];
+#endif
+
+      for (ii = 0; ii < nrows; ii++)
+      {
+         row  = rows[ii];
+         n    = ncols[ii];
+         indx = row_indexes[ii];
+
+         if (num_slots + n > hypre_IJParCSRPatternMaxSlots(pattern))
+         {
+            size = hypre_max(2*hypre_IJParCSRPatternMaxSlots(pattern), num_slots + n);
+            size = hypre_max(size, 1000);
+            slots = hypre_TReAlloc(slots, HYPRE_Int, size, HYPRE_MEMORY_HOST);
+            hypre_IJParCSRPatternSlots(pattern) = slots;
+            hypre_IJParCSRPatternMaxSlots(pattern) = size;
+         }
+
+         if (row >= row_0 && row < row_n)
+         {
+            for (i = 0; i < n; i++)
+            {
+               slot = hypre_IJMatrixFindSlotParCSR(matrix, (HYPRE_Int)(row - row_0), cols[indx]);
+               if (slot == -1)
+               {
+                  hypre_error(HYPRE_ERROR_GENERIC);
+                  if (print_level)
+                  {
+                     hypre_printf (" Error, element %b %b does not exist\n", row, cols[indx]);
+                  }
+               }
+               else if (slot < nnz_diag)
+               {
+                  diag_data[slot] = add ? diag_data[slot] + values[indx] : values[indx];
+               }
+               else
+               {
+                  offd_data[slot-nnz_diag] = add ? offd_data[slot-nnz_diag] + values[indx] :
+                                                   values[indx];
+               }
+               slots[num_slots++] = slot;
+               indx++;
+            }
+         }
+         else if (add)
+         {
+            /* off-processor values are sent at assembly */
+            k = hypre_IJParCSRPatternNumOffProcElmts(pattern);
+            if (k + n > hypre_IJParCSRPatternMaxOffProcElmts(pattern))
+            {
+               size = hypre_max(2*hypre_IJParCSRPatternMaxOffProcElmts(pattern), k + n);
+               size = hypre_max(size, 100);
+               hypre_IJParCSRPatternOffProcI(pattern) =
+                  hypre_TReAlloc(hypre_IJParCSRPatternOffProcI(pattern), HYPRE_BigInt, size,
+                                 HYPRE_MEMORY_HOST);
+               hypre_IJParCSRPatternOffProcJ(pattern) =
+                  hypre_TReAlloc(hypre_IJParCSRPatternOffProcJ(pattern), HYPRE_BigInt, size,
+                                 HYPRE_MEMORY_HOST);
+               hypre_IJParCSRPatternOffProcData(pattern) =
+                  hypre_TReAlloc(hypre_IJParCSRPatternOffProcData(pattern), HYPRE_Complex, size,
+                                 HYPRE_MEMORY_HOST);
+               hypre_IJParCSRPatternMaxOffProcElmts(pattern) = size;
+            }
+            for (i = 0; i < n; i++)
+            {
+               hypre_IJParCSRPatternOffProcI(pattern)[k]    = row;
+               hypre_IJParCSRPatternOffProcJ(pattern)[k]    = cols[indx];
+               hypre_IJParCSRPatternOffProcData(pattern)[k] = values[indx];
+               slots[num_slots++] = nnz_local + k;
+               k++;
+               indx++;
+            }
+            hypre_IJParCSRPatternNumOffProcElmts(pattern) = k;
+         }
+         else
+         {
+            /* values cannot be set on other processors; the slots keep the
+               sequence of coefficients aligned */
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "Values of a frozen pattern can only be set in local rows!\n");
+            if (print_level)
+            {
+               hypre_printf (" Error, row %b is not on this processor\n", row);
+            }
+            for (i = 0; i < n; i++)
+            {
+               slots[num_slots++] = -1;
+            }
+         }
+      }
+      hypre_IJParCSRPatternNumSlots(pattern) = num_slots;
+
+      return hypre_error_flag;
+   }
+
+   cursor = hypre_IJParCSRPatternCursor(pattern);
+   for (ii = 0; ii < nrows; ii++)
+   {
+      n    = ncols[ii];
+      indx = row_indexes[ii];
+
+      if (cursor + n > num_slots)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "More coefficients than recorded for the frozen pattern!\n");
+         break;
+      }
+
+      for (i = 0; i < n; i++)
+      {
+         slot  = slots[cursor++];
+         value = values[indx++];
+         if (slot < 0)
+         {
+            /* reported in detail when recording */
+            dropped = 1;
+            continue;
+         }
+         else if (slot < nnz_diag)
+         {
+            diag_data[slot] = add ? diag_data[slot] + value : value;
+         }
+         else if (slot < nnz_local)
+         {
+            offd_data[slot-nnz_diag] = add ? offd_data[slot-nnz_diag] + value : value;
+         }
+         else
+         {
+            send_data[slot-nnz_local] += value;
+         }
+      }
+   }
+   hypre_IJParCSRPatternCursor(pattern) = cursor;
+
+   if (dropped)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficients outside of the frozen pattern were dropped!\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixAssemblePatternParCSR
+ *
+ * Assembly of a matrix with a frozen pattern.  The first assembly after
+ * freezing builds the exchange plan: the collected off-processor
+ * coefficients are sorted by row and column and merged, the owners of the
+ * rows are found with an extended comm package, and the owners locate the
+ * coefficients in their rows once.  In every assembly, the added values are
+ * then sent directly to the saved positions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixAssemblePatternParCSR( hypre_IJMatrix *matrix )
+{
+   MPI_Comm               comm       = hypre_IJMatrixComm(matrix);
+   hypre_IJParCSRPattern *pattern    = (hypre_IJParCSRPattern *) hypre_IJMatrixPattern(matrix);
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_Complex         *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex         *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int              nnz_diag   = hypre_IJParCSRPatternNnzDiag(pattern);
+   HYPRE_Int              nnz_local  = nnz_diag + hypre_IJParCSRPatternNnzOffd(pattern);
+
+   HYPRE_Int              num_sends, num_recvs;
+   HYPRE_Int             *send_procs, *send_starts, *recv_procs, *recv_starts, *recv_slots;
+   HYPRE_Complex         *send_data, *recv_data;
+   hypre_MPI_Request     *requests;
+   hypre_MPI_Status      *status;
+   HYPRE_Int              i, j, k, slot;
+
+   if (hypre_IJParCSRPatternRecording(pattern))
+   {
+      HYPRE_Int      num_off    = hypre_IJParCSRPatternNumOffProcElmts(pattern);
+      HYPRE_BigInt  *off_proc_i = hypre_IJParCSRPatternOffProcI(pattern);
+      HYPRE_BigInt  *off_proc_j = hypre_IJParCSRPatternOffProcJ(pattern);
+      HYPRE_Complex *off_data   = hypre_IJParCSRPatternOffProcData(pattern);
+      HYPRE_Int     *slots      = hypre_IJParCSRPatternSlots(pattern);
+      HYPRE_Int      num_slots  = hypre_IJParCSRPatternNumSlots(pattern);
+      HYPRE_BigInt   first_row  = hypre_ParCSRMatrixFirstRowIndex(par_matrix);
+      HYPRE_Int      num_rows   = hypre_ParCSRMatrixNumRows(par_matrix);
+      hypre_IJAssumedPart *apart = NULL;
+
+      hypre_ParCSRCommPkg    *comm_pkg;
+      hypre_ParCSRCommHandle *comm_handle;
+      HYPRE_Int     *order, *entry, *row_cnt, *row_start, *cnt_recv, *send_map_elmts;
+      HYPRE_BigInt  *sorted_i, *sorted_j, *entry_rows, *entry_cols, *recv_cols;
+      HYPRE_Int      num_entries, num_entry_rows, lo, hi, row_local;
+
+      /* sort the off-processor coefficients by row and column */
+      order    = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+      entry    = hypre_TAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+      sorted_i = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+      sorted_j = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+      for (k = 0; k < num_off; k++)
+      {
+         order[k]    = k;
+         sorted_i[k] = off_proc_i[k];
+      }
+      hypre_BigQsortbi(sorted_i, order, 0, num_off-1);
+      for (k = 0; k < num_off; k++)
+      {
+         sorted_j[k] = off_proc_j[order[k]];
+      }
+      for (lo = 0; lo < num_off; lo = hi)
+      {
+         for (hi = lo+1; hi < num_off && sorted_i[hi] == sorted_i[lo]; hi++);
+         hypre_BigQsortbi(sorted_j, order, lo, hi-1);
+      }
+
+      /* merge duplicates; entry[k] is the position of coefficient k in send_data */
+      entry_rows = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+      entry_cols = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+      row_cnt    = hypre_CTAlloc(HYPRE_Int, num_off, HYPRE_MEMORY_HOST);
+      row_start  = hypre_CTAlloc(HYPRE_Int, num_off+1, HYPRE_MEMORY_HOST);
+      num_entries = 0;
+      num_entry_rows = 0;
+      for (k = 0; k < num_off; k++)
+      {
+         if (k == 0 || sorted_i[k] != sorted_i[k-1])
+         {
+            /* the comm package expects 0-based global rows */
+            entry_rows[num_entry_rows] = sorted_i[k] - hypre_IJMatrixGlobalFirstRow(matrix);
+            row_start[num_entry_rows++] = num_entries;
+            entry_cols[num_entries++] = sorted_j[k];
+         }
+         else if (sorted_j[k] != sorted_j[k-1])
+         {
+            entry_cols[num_entries++] = sorted_j[k];
+         }
+         row_cnt[num_entry_rows-1] = num_entries - row_start[num_entry_rows-1];
+         entry[order[k]] = num_entries-1;
+      }
+      row_start[num_entry_rows] = num_entries;
+      hypre_TFree(sorted_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(sorted_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(order, HYPRE_MEMORY_HOST);
+
+      /* find the owners of the rows; values are sent from the receiving side
+         of the comm package to its sending side */
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+      apart = hypre_AssumedPartitionCreate(comm, hypre_ParCSRMatrixGlobalNumRows(par_matrix),
+                                           first_row, first_row + num_rows - 1);
+#endif
+      hypre_ParCSRFindExtendCommPkg(comm, hypre_ParCSRMatrixGlobalNumRows(par_matrix),
+                                    first_row, num_rows,
+                                    hypre_ParCSRMatrixRowStarts(par_matrix), apart,
+                                    num_entry_rows, entry_rows, &comm_pkg);
+
+      send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+      cnt_recv = hypre_CTAlloc(HYPRE_Int,
+                               hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                               hypre_ParCSRCommPkgNumSends(comm_pkg)),
+                               HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg, row_cnt, cnt_recv);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      num_sends   = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      send_procs  = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      send_starts = hypre_TAlloc(HYPRE_Int, num_sends+1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_sends; i++)
+      {
+         send_procs[i]  = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+         send_starts[i] = row_start[hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i)];
+      }
+      send_starts[num_sends] = num_entries;
+
+      num_recvs   = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs+1, HYPRE_MEMORY_HOST);
+      recv_starts[0] = 0;
+      for (i = 0; i < num_recvs; i++)
+      {
+         recv_procs[i] = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+         recv_starts[i+1] = recv_starts[i];
+         for (j = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+              j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+         {
+            recv_starts[i+1] += cnt_recv[j];
+         }
+      }
+
+      /* the owners locate the coefficients in their rows */
+      recv_cols = hypre_TAlloc(HYPRE_BigInt, recv_starts[num_recvs], HYPRE_MEMORY_HOST);
+      requests  = hypre_CTAlloc(hypre_MPI_Request, num_sends+num_recvs, HYPRE_MEMORY_HOST);
+      status    = hypre_CTAlloc(hypre_MPI_Status, num_sends+num_recvs, HYPRE_MEMORY_HOST);
+      j = 0;
+      for (i = 0; i < num_recvs; i++)
+      {
+         hypre_MPI_Irecv(&recv_cols[recv_starts[i]], recv_starts[i+1]-recv_starts[i],
+                         HYPRE_MPI_BIG_INT, recv_procs[i], 0, comm, &requests[j++]);
+      }
+      for (i = 0; i < num_sends; i++)
+      {
+         hypre_MPI_Isend(&entry_cols[send_starts[i]], send_starts[i+1]-send_starts[i],
+                         HYPRE_MPI_BIG_INT, send_procs[i], 0, comm, &requests[j++]);
+      }
+      hypre_MPI_Waitall(j, requests, status);
+
+      recv_slots = hypre_TAlloc(HYPRE_Int, recv_starts[num_recvs], HYPRE_MEMORY_HOST);
+      k = 0;
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_recvs); i++)
+      {
+         row_local = send_map_elmts[i];
+         for (j = 0; j < cnt_recv[i]; j++)
+         {
+            recv_slots[k] = hypre_IJMatrixFindSlotParCSR(matrix, row_local, recv_cols[k]);
+            if (recv_slots[k] == -1)
+            {
+               hypre_error(HYPRE_ERROR_GENERIC);
+               if (hypre_IJMatrixPrintLevel(matrix))
+               {
+                  hypre_printf (" Error, element %b %b does not exist\n",
+                                first_row + row_local + hypre_IJMatrixGlobalFirstRow(matrix),
+                                recv_cols[k]);
+               }
+            }
+            k++;
+         }
+      }
+
+      /* values of this assembly, and positions for the following ones */
+      send_data = hypre_CTAlloc(HYPRE_Complex, num_entries, HYPRE_MEMORY_HOST);
+      for (k = 0; k < num_off; k++)
+      {
+         send_data[entry[k]] += off_data[k];
+      }
+      for (i = 0; i < num_slots; i++)
+      {
+         if (slots[i] >= nnz_local)
+         {
+            slots[i] = nnz_local + entry[slots[i] - nnz_local];
+         }
+      }
+
+      hypre_IJParCSRPatternNumSends(pattern)   = num_sends;
+      hypre_IJParCSRPatternSendProcs(pattern)  = send_procs;
+      hypre_IJParCSRPatternSendStarts(pattern) = send_starts;
+      hypre_IJParCSRPatternSendData(pattern)   = send_data;
+      hypre_IJParCSRPatternNumRecvs(pattern)   = num_recvs;
+      hypre_IJParCSRPatternRecvProcs(pattern)  = recv_procs;
+      hypre_IJParCSRPatternRecvStarts(pattern) = recv_starts;
+      hypre_IJParCSRPatternRecvSlots(pattern)  = recv_slots;
+      hypre_IJParCSRPatternRecvData(pattern)   =
+         hypre_CTAlloc(HYPRE_Complex, recv_starts[num_recvs], HYPRE_MEMORY_HOST);
+
+      hypre_TFree(hypre_IJParCSRPatternOffProcI(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternOffProcJ(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternOffProcData(pattern), HYPRE_MEMORY_HOST);
+      hypre_IJParCSRPatternNumOffProcElmts(pattern) = 0;
+      hypre_IJParCSRPatternMaxOffProcElmts(pattern) = 0;
+      hypre_IJParCSRPatternRecording(pattern) = 0;
+
+      hypre_TFree(requests, HYPRE_MEMORY_HOST);
+      hypre_TFree(status, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(cnt_recv, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_cnt, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_start, HYPRE_MEMORY_HOST);
+      hypre_MatvecCommPkgDestroy(comm_pkg);
+      if (apart)
+      {
+         hypre_AssumedPartitionDestroy(apart);
+      }
+   }
+   else if (hypre_IJParCSRPatternCursor(pattern) != hypre_IJParCSRPatternNumSlots(pattern))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Fewer coefficients than recorded for the frozen pattern!\n");
+   }
+
+   /*-----------------------------------------------------------------------
+    * Send the values added to rows of other processors
+    *-----------------------------------------------------------------------*/
+
+   num_sends   = hypre_IJParCSRPatternNumSends(pattern);
+   send_procs  = hypre_IJParCSRPatternSendProcs(pattern);
+   send_starts = hypre_IJParCSRPatternSendStarts(pattern);
+   send_data   = hypre_IJParCSRPatternSendData(pattern);
+   num_recvs   = hypre_IJParCSRPatternNumRecvs(pattern);
+   recv_procs  = hypre_IJParCSRPatternRecvProcs(pattern);
+   recv_starts = hypre_IJParCSRPatternRecvStarts(pattern);
+   recv_slots  = hypre_IJParCSRPatternRecvSlots(pattern);
+   recv_data   = hypre_IJParCSRPatternRecvData(pattern);
+
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_sends+num_recvs, HYPRE_MEMORY_HOST);
+   status   = hypre_CTAlloc(hypre_MPI_Status, num_sends+num_recvs, HYPRE_MEMORY_HOST);
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_MPI_Irecv(&recv_data[recv_starts[i]], recv_starts[i+1]-recv_starts[i],
+                      HYPRE_MPI_COMPLEX, recv_procs[i], 0, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_MPI_Isend(&send_data[send_starts[i]], send_starts[i+1]-send_starts[i],
+                      HYPRE_MPI_COMPLEX, send_procs[i], 0, comm, &requests[j++]);
+   }
+   hypre_MPI_Waitall(j, requests, status);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < recv_starts[num_recvs]; k++)
+   {
+      slot = recv_slots[k];
+      if (slot < 0)
+      {
+         continue;
+      }
+      else if (slot < nnz_diag)
+      {
+         diag_data[slot] += recv_data[k];
+      }
+      else
+      {
+         offd_data[slot-nnz_diag] += recv_data[k];
+      }
+   }
+
+   for (k = 0; k < send_starts[num_sends]; k++)
+   {
+      send_data[k] = 0.0;
+   }
+   hypre_IJParCSRPatternCursor(pattern) = 0;
+
+   /* the values of diag and offd changed in place */
+   hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixOffd(par_matrix));
+
+   hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix));
+   hypre_IJMatrixTranslator(matrix) = NULL;
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * IJMatrix_ParCSR interface
@@ -3255,6 +4507,10 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
       HYPRE_BigInt *col_map_offd;
       HYPRE_Int num_cols_offd;
 
+      /* the values are changed in place: drop the SELL copies */
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixOffd(par_matrix));
+
       diag = hypre_ParCSRMatrixDiag(par_matrix);
       diag_i = hypre_CSRMatrixI(diag);
       diag_j = hypre_CSRMatrixJ(diag);
@@ -3891,6 +5147,10 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
       HYPRE_Int num_cols_offd;
       HYPRE_BigInt *col_map_offd;
 
+      /* the values are changed in place: drop the SELL copies */
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixSELLInvalidate(hypre_ParCSRMatrixOffd(par_matrix));
+
       diag = hypre_ParCSRMatrixDiag(par_matrix);
       diag_i = hypre_CSRMatrixI(diag);
       diag_j = hypre_CSRMatrixJ(diag);
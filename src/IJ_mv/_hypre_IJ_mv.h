@@ -32,6 +32,27 @@ extern "C" {
 #ifndef hypre_AUX_PARCSR_MATRIX_HEADER
 #define hypre_AUX_PARCSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * Thread-local stash of (row, col, value) triples, see HYPRE_IJMatrixSetThreadStash
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            num_elmts;               /* current no. of elements stored in stash */
+   HYPRE_Int            max_elmts;               /* allocated length of the stash */
+   HYPRE_BigInt        *i;                       /* global row no. */
+   HYPRE_BigInt        *j;                       /* global col no. */
+   HYPRE_Complex       *data;
+   char                *sora;                    /* Set (1) or Add (0) */
+} hypre_AuxParCSRStash;
+
+#define hypre_AuxParCSRStashNumElmts(stash)               ((stash) -> num_elmts)
+#define hypre_AuxParCSRStashMaxElmts(stash)               ((stash) -> max_elmts)
+#define hypre_AuxParCSRStashI(stash)                      ((stash) -> i)
+#define hypre_AuxParCSRStashJ(stash)                      ((stash) -> j)
+#define hypre_AuxParCSRStashData(stash)                   ((stash) -> data)
+#define hypre_AuxParCSRStashSorA(stash)                   ((stash) -> sora)
+
 /*--------------------------------------------------------------------------
  * Auxiliary Parallel CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -79,6 +100,11 @@ typedef struct
 
    HYPRE_MemoryLocation memory_location;
 
+   HYPRE_Int            num_stashes;             /* if > 0, values are collected in one stash per
+                                                    thread and sorted into CSR at assembly; the
+                                                    last stash holds received off proc. values */
+   hypre_AuxParCSRStash **stashes;               /* allocated by the owning thread on first use */
+
 #if defined(HYPRE_USING_CUDA)
    HYPRE_Int            max_stack_elmts;
    HYPRE_Int            current_stack_elmts;
@@ -121,6 +147,9 @@ typedef struct
 
 #define hypre_AuxParCSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
 
+#define hypre_AuxParCSRMatrixNumStashes(matrix)           ((matrix) -> num_stashes)
+#define hypre_AuxParCSRMatrixStashes(matrix)              ((matrix) -> stashes)
+
 #if defined(HYPRE_USING_CUDA)
 #define hypre_AuxParCSRMatrixMaxStackElmts(matrix)        ((matrix) -> max_stack_elmts)
 #define hypre_AuxParCSRMatrixCurrentStackElmts(matrix)    ((matrix) -> current_stack_elmts)
@@ -134,6 +163,65 @@ typedef struct
 #define hypre_AuxParCSRMatrixGrowFactor(matrix)           ((matrix) -> grow_factor)
 #endif
 
+/*--------------------------------------------------------------------------
+ * Frozen pattern of an assembled ParCSR matrix, see HYPRE_IJMatrixFreezePattern
+ *
+ * slots[k] is the destination of the k-th coefficient passed to SetValues or
+ * AddToValues: an index into diag data if < nnz_diag, an index into offd data
+ * if < nnz_diag + nnz_offd, otherwise (minus nnz_diag + nnz_offd) an index
+ * into send_data.  -1 means that the coefficient is ignored.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int            recording;               /* 1 until the first assembly after freezing */
+   HYPRE_Int            num_slots;               /* no. of coefficients per assembly */
+   HYPRE_Int            max_slots;
+   HYPRE_Int           *slots;
+   HYPRE_Int            cursor;                  /* next coefficient of the current assembly */
+   HYPRE_Int            nnz_diag;
+   HYPRE_Int            nnz_offd;
+
+   HYPRE_Int            num_off_proc_elmts;      /* off-processor coefficients collected while */
+   HYPRE_Int            max_off_proc_elmts;      /* recording, replaced by the exchange plan */
+   HYPRE_BigInt        *off_proc_i;
+   HYPRE_BigInt        *off_proc_j;
+   HYPRE_Complex       *off_proc_data;
+
+   HYPRE_Int            num_sends;               /* values added to rows of other processors */
+   HYPRE_Int           *send_procs;
+   HYPRE_Int           *send_starts;
+   HYPRE_Complex       *send_data;
+
+   HYPRE_Int            num_recvs;               /* values added to my rows by other processors */
+   HYPRE_Int           *recv_procs;
+   HYPRE_Int           *recv_starts;
+   HYPRE_Int           *recv_slots;              /* index into diag data, or nnz_diag + offd index */
+   HYPRE_Complex       *recv_data;
+} hypre_IJParCSRPattern;
+
+#define hypre_IJParCSRPatternRecording(pattern)           ((pattern) -> recording)
+#define hypre_IJParCSRPatternNumSlots(pattern)            ((pattern) -> num_slots)
+#define hypre_IJParCSRPatternMaxSlots(pattern)            ((pattern) -> max_slots)
+#define hypre_IJParCSRPatternSlots(pattern)               ((pattern) -> slots)
+#define hypre_IJParCSRPatternCursor(pattern)              ((pattern) -> cursor)
+#define hypre_IJParCSRPatternNnzDiag(pattern)             ((pattern) -> nnz_diag)
+#define hypre_IJParCSRPatternNnzOffd(pattern)             ((pattern) -> nnz_offd)
+#define hypre_IJParCSRPatternNumOffProcElmts(pattern)     ((pattern) -> num_off_proc_elmts)
+#define hypre_IJParCSRPatternMaxOffProcElmts(pattern)     ((pattern) -> max_off_proc_elmts)
+#define hypre_IJParCSRPatternOffProcI(pattern)            ((pattern) -> off_proc_i)
+#define hypre_IJParCSRPatternOffProcJ(pattern)            ((pattern) -> off_proc_j)
+#define hypre_IJParCSRPatternOffProcData(pattern)         ((pattern) -> off_proc_data)
+#define hypre_IJParCSRPatternNumSends(pattern)            ((pattern) -> num_sends)
+#define hypre_IJParCSRPatternSendProcs(pattern)           ((pattern) -> send_procs)
+#define hypre_IJParCSRPatternSendStarts(pattern)          ((pattern) -> send_starts)
+#define hypre_IJParCSRPatternSendData(pattern)            ((pattern) -> send_data)
+#define hypre_IJParCSRPatternNumRecvs(pattern)            ((pattern) -> num_recvs)
+#define hypre_IJParCSRPatternRecvProcs(pattern)           ((pattern) -> recv_procs)
+#define hypre_IJParCSRPatternRecvStarts(pattern)          ((pattern) -> recv_starts)
+#define hypre_IJParCSRPatternRecvSlots(pattern)           ((pattern) -> recv_slots)
+#define hypre_IJParCSRPatternRecvData(pattern)            ((pattern) -> recv_data)
+
 #endif
 /******************************************************************************
  *
@@ -228,6 +316,8 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_rows;     /* global partition */
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
+   HYPRE_Int     thread_stash;        /* collect values in thread-local stashes */
+   void         *pattern;             /* frozen pattern, see HYPRE_IJMatrixFreezePattern */
    HYPRE_Int     print_level;
 
 } hypre_IJMatrix;
@@ -252,6 +342,8 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumRows(matrix)    ((matrix) -> global_num_rows)
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
+#define hypre_IJMatrixThreadStash(matrix)      ((matrix) -> thread_stash)
+#define hypre_IJMatrixPattern(matrix)          ((matrix) -> pattern)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
 
 static inline HYPRE_MemoryLocation
@@ -354,6 +446,8 @@ HYPRE_Int hypre_AuxParCSRMatrixCreate ( hypre_AuxParCSRMatrix **aux_matrix , HYP
 HYPRE_Int hypre_AuxParCSRMatrixDestroy ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize ( hypre_AuxParCSRMatrix *matrix );
 HYPRE_Int hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix, HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_IJParCSRPatternCreate ( hypre_IJParCSRPattern **pattern );
+HYPRE_Int hypre_IJParCSRPatternDestroy ( hypre_IJParCSRPattern *pattern );
 
 /* aux_par_vector.c */
 HYPRE_Int hypre_AuxParVectorCreate ( hypre_AuxParVector **aux_vector );
@@ -406,6 +500,14 @@ HYPRE_Int hypre_FindProc ( HYPRE_BigInt *list , HYPRE_BigInt value , HYPRE_Int l
 HYPRE_Int hypre_IJMatrixAssembleParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetValuesOMPParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
 HYPRE_Int hypre_IJMatrixAddToValuesOMPParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
+HYPRE_Int hypre_IJMatrixStashValuesParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values , const char *action );
+HYPRE_Int hypre_IJMatrixStashAppendParCSR ( hypre_IJMatrix *matrix , HYPRE_Int stash_num , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values , char sora );
+HYPRE_Int hypre_IJMatrixAssembleStashOffProcParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixAssembleStashParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixFreezePatternParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixFindSlotParCSR ( hypre_IJMatrix *matrix , HYPRE_Int row_local , HYPRE_BigInt col );
+HYPRE_Int hypre_IJMatrixSetValuesPatternParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_Int *row_indexes , const HYPRE_BigInt *cols , const HYPRE_Complex *values , const char *action );
+HYPRE_Int hypre_IJMatrixAssemblePatternParCSR ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixAssembleParCSRDevice(hypre_IJMatrix *matrix);
 HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix, HYPRE_Complex value );
@@ -468,6 +570,8 @@ HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix , HYPRE_Int m
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename , MPI_Comm comm , HYPRE_Int type , HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix , const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix , HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetThreadStash ( HYPRE_IJMatrix matrix , HYPRE_Int thread_stash );
+HYPRE_Int HYPRE_IJMatrixFreezePattern ( HYPRE_IJMatrix matrix );
 
 /* HYPRE_IJVector.c */
 HYPRE_Int HYPRE_IJVectorCreate ( MPI_Comm comm , HYPRE_BigInt jlower , HYPRE_BigInt jupper , HYPRE_IJVector *vector );
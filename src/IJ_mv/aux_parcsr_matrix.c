@@ -50,6 +50,9 @@ hypre_AuxParCSRMatrixCreate( hypre_AuxParCSRMatrix **aux_matrix,
    hypre_AuxParCSRMatrixOffProcJ(matrix) = NULL;
    hypre_AuxParCSRMatrixOffProcData(matrix) = NULL;
    hypre_AuxParCSRMatrixMemoryLocation(matrix) = HYPRE_MEMORY_HOST;
+   /* thread-local stashes */
+   hypre_AuxParCSRMatrixNumStashes(matrix) = 0;
+   hypre_AuxParCSRMatrixStashes(matrix) = NULL;
 #if defined(HYPRE_USING_CUDA)
    hypre_AuxParCSRMatrixMaxStackElmts(matrix) = 0;
    hypre_AuxParCSRMatrixCurrentStackElmts(matrix) = 0;
@@ -112,6 +115,25 @@ hypre_AuxParCSRMatrixDestroy( hypre_AuxParCSRMatrix *matrix )
       hypre_TFree(hypre_AuxParCSRMatrixOffProcJ(matrix),    HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_AuxParCSRMatrixOffProcData(matrix), HYPRE_MEMORY_HOST);
 
+      if (hypre_AuxParCSRMatrixStashes(matrix))
+      {
+         hypre_AuxParCSRStash *stash;
+
+         for (i = 0; i < hypre_AuxParCSRMatrixNumStashes(matrix); i++)
+         {
+            stash = hypre_AuxParCSRMatrixStashes(matrix)[i];
+            if (stash)
+            {
+               hypre_TFree(hypre_AuxParCSRStashI(stash),    HYPRE_MEMORY_HOST);
+               hypre_TFree(hypre_AuxParCSRStashJ(stash),    HYPRE_MEMORY_HOST);
+               hypre_TFree(hypre_AuxParCSRStashData(stash), HYPRE_MEMORY_HOST);
+               hypre_TFree(hypre_AuxParCSRStashSorA(stash), HYPRE_MEMORY_HOST);
+               hypre_TFree(stash, HYPRE_MEMORY_HOST);
+            }
+         }
+         hypre_TFree(hypre_AuxParCSRMatrixStashes(matrix), HYPRE_MEMORY_HOST);
+      }
+
 #if defined(HYPRE_USING_CUDA)
       hypre_TFree(hypre_AuxParCSRMatrixStackI(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
       hypre_TFree(hypre_AuxParCSRMatrixStackJ(matrix),    hypre_AuxParCSRMatrixMemoryLocation(matrix));
@@ -141,6 +163,19 @@ hypre_AuxParCSRMatrixInitialize_v2( hypre_AuxParCSRMatrix *matrix, HYPRE_MemoryL
       return -1;
    }
 
+   if (hypre_AuxParCSRMatrixNumStashes(matrix) && memory_location == HYPRE_MEMORY_HOST)
+   {
+      /* CPU assembly from thread-local stashes: the stashes are allocated by
+         their threads on first use, also if there are no local rows */
+      if (!hypre_AuxParCSRMatrixStashes(matrix))
+      {
+         hypre_AuxParCSRMatrixStashes(matrix) =
+            hypre_CTAlloc(hypre_AuxParCSRStash *, hypre_AuxParCSRMatrixNumStashes(matrix),
+                          HYPRE_MEMORY_HOST);
+      }
+      return 0;
+   }
+
    if (local_num_rows == 0)
    {
       return 0;
@@ -217,3 +252,67 @@ hypre_AuxParCSRMatrixInitialize(hypre_AuxParCSRMatrix *matrix)
    return -2;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_IJParCSRPatternCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJParCSRPatternCreate( hypre_IJParCSRPattern **pattern )
+{
+   hypre_IJParCSRPattern  *frozen;
+
+   frozen = hypre_CTAlloc(hypre_IJParCSRPattern, 1, HYPRE_MEMORY_HOST);
+
+   hypre_IJParCSRPatternRecording(frozen) = 1;
+   hypre_IJParCSRPatternNumSlots(frozen) = 0;
+   hypre_IJParCSRPatternMaxSlots(frozen) = 0;
+   hypre_IJParCSRPatternSlots(frozen) = NULL;
+   hypre_IJParCSRPatternCursor(frozen) = 0;
+   hypre_IJParCSRPatternNnzDiag(frozen) = 0;
+   hypre_IJParCSRPatternNnzOffd(frozen) = 0;
+   hypre_IJParCSRPatternNumOffProcElmts(frozen) = 0;
+   hypre_IJParCSRPatternMaxOffProcElmts(frozen) = 0;
+   hypre_IJParCSRPatternOffProcI(frozen) = NULL;
+   hypre_IJParCSRPatternOffProcJ(frozen) = NULL;
+   hypre_IJParCSRPatternOffProcData(frozen) = NULL;
+   hypre_IJParCSRPatternNumSends(frozen) = 0;
+   hypre_IJParCSRPatternSendProcs(frozen) = NULL;
+   hypre_IJParCSRPatternSendStarts(frozen) = NULL;
+   hypre_IJParCSRPatternSendData(frozen) = NULL;
+   hypre_IJParCSRPatternNumRecvs(frozen) = 0;
+   hypre_IJParCSRPatternRecvProcs(frozen) = NULL;
+   hypre_IJParCSRPatternRecvStarts(frozen) = NULL;
+   hypre_IJParCSRPatternRecvSlots(frozen) = NULL;
+   hypre_IJParCSRPatternRecvData(frozen) = NULL;
+
+   *pattern = frozen;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJParCSRPatternDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJParCSRPatternDestroy( hypre_IJParCSRPattern *pattern )
+{
+   if (pattern)
+   {
+      hypre_TFree(hypre_IJParCSRPatternSlots(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternOffProcI(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternOffProcJ(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternOffProcData(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternSendProcs(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternSendStarts(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternSendData(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternRecvProcs(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternRecvStarts(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternRecvSlots(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_IJParCSRPatternRecvData(pattern), HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
+   }
+
+   return 0;
+}
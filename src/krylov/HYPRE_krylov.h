@@ -286,6 +286,163 @@ HYPRE_Int HYPRE_PCGGetConverged(HYPRE_Solver  solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Pipelined PCG Solver
+ *
+ * Communication-hiding preconditioned conjugate gradient (Ghysels and
+ * Vanroose).  Each iteration performs a single non-blocking global
+ * reduction that is overlapped with one preconditioner application and one
+ * matrix-vector product, instead of the two blocking reductions of PCG.  It
+ * needs four more work vectors than PCG, and its recursively updated
+ * residual is more sensitive to rounding errors (see
+ * HYPRE\_PipelinedPCGSetResidualReplacement).  The preconditioner must be
+ * symmetric positive definite.
+ *
+ * @{
+ **/
+
+/**
+ * Prepare to solve the system.  The coefficient data in \e b and \e x is
+ * ignored here, but information about the layout of the data may be used.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetup(HYPRE_Solver solver,
+                                  HYPRE_Matrix A,
+                                  HYPRE_Vector b,
+                                  HYPRE_Vector x);
+
+/**
+ * Solve the system.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSolve(HYPRE_Solver solver,
+                                  HYPRE_Matrix A,
+                                  HYPRE_Vector b,
+                                  HYPRE_Vector x);
+
+/**
+ * (Optional) Set the relative convergence tolerance.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetTol(HYPRE_Solver solver,
+                                   HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).  The
+ * convergence test is the same as for PCG.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetAbsoluteTol(HYPRE_Solver solver,
+                                           HYPRE_Real   a_tol);
+
+/**
+ * (Optional) Set maximum number of iterations.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetMaxIter(HYPRE_Solver solver,
+                                       HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Use the two-norm in stopping criteria.  This adds one value to
+ * the reduction of each iteration, but no additional synchronization.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetTwoNorm(HYPRE_Solver solver,
+                                       HYPRE_Int    two_norm);
+
+/**
+ * (Optional) Every \e replace_period iterations, recompute the residual
+ * \f$r = b - Ax\f$ and the auxiliary vectors of the pipelined recurrences
+ * from their definitions (residual replacement).  This keeps the method
+ * accurate for tight tolerances and ill-conditioned problems, at the cost of
+ * two preconditioner applications and three matrix-vector products per
+ * replacement.  The default is 0 (no replacement).
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetResidualReplacement(HYPRE_Solver solver,
+                                                   HYPRE_Int    replace_period);
+
+/**
+ * (Optional) Set the preconditioner to use.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetPrecond(HYPRE_Solver         solver,
+                                       HYPRE_PtrToSolverFcn precond,
+                                       HYPRE_PtrToSolverFcn precond_setup,
+                                       HYPRE_Solver         precond_solver);
+
+/**
+ * (Optional) Set the amount of logging to do.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetLogging(HYPRE_Solver solver,
+                                       HYPRE_Int    logging);
+
+/**
+ * (Optional) Set the amount of printing to do to the screen.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGSetPrintLevel(HYPRE_Solver solver,
+                                          HYPRE_Int    level);
+
+/**
+ * Return the number of iterations taken.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetNumIterations(HYPRE_Solver  solver,
+                                             HYPRE_Int    *num_iterations);
+
+/**
+ * Return the norm of the final relative residual.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                         HYPRE_Real   *norm);
+
+/**
+ * Return the residual.
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetResidual(HYPRE_Solver  solver,
+                                        void         *residual);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetTol(HYPRE_Solver  solver,
+                                   HYPRE_Real   *tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetAbsoluteTol(HYPRE_Solver  solver,
+                                           HYPRE_Real   *a_tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetMaxIter(HYPRE_Solver  solver,
+                                       HYPRE_Int    *max_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetTwoNorm(HYPRE_Solver  solver,
+                                       HYPRE_Int    *two_norm);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetResidualReplacement(HYPRE_Solver  solver,
+                                                   HYPRE_Int    *replace_period);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetPrecond(HYPRE_Solver  solver,
+                                       HYPRE_Solver *precond_data_ptr);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetLogging(HYPRE_Solver  solver,
+                                       HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetPrintLevel(HYPRE_Solver  solver,
+                                          HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_PipelinedPCGGetConverged(HYPRE_Solver  solver,
+                                         HYPRE_Int    *converged);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -896,6 +1053,16 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) Use the s-step (communication-avoiding) variant, which builds
+ * s basis vectors at a time and orthogonalizes them with one global
+ * reduction per block (or two with cgs = 2).  The basis uses Chebyshev
+ * polynomials whose interval is estimated from the first s Arnoldi steps.
+ * Default: 1 (the standard variant).
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -977,6 +1144,11 @@ HYPRE_Int HYPRE_COGMRESGetUnroll(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_COGMRESGetCGS(HYPRE_Solver  solver,
                               HYPRE_Int    *cgs);
 
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
 /**
  **/
 HYPRE_Int HYPRE_COGMRESGetPrecond(HYPRE_Solver  solver,
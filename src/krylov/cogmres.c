@@ -71,6 +71,24 @@ hypre_COGMRESFunctionsCreate(
    return cogmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESFunctionsSetSStepOps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetSStepOps(
+   hypre_COGMRESFunctions *cogmres_functions,
+   HYPRE_Int    (*MassInnerProdLocal) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result ),
+   HYPRE_Int    (*Allreduce)     ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count )
+   )
+{
+   cogmres_functions->MassInnerProdLocal = MassInnerProdLocal;
+   cogmres_functions->Allreduce          = Allreduce;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -107,6 +125,10 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    (cogmres_data -> norms)          = NULL;
    (cogmres_data -> log_file_name)  = NULL;
    (cogmres_data -> unroll)         = 0;
+   (cogmres_data -> s_step)         = 1; /* > 1 uses the s-step variant */
+   (cogmres_data -> have_spectrum)  = 0;
+   (cogmres_data -> cheb_center)    = 0.0;
+   (cogmres_data -> cheb_width)     = 1.0;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -222,6 +244,9 @@ hypre_COGMRESSetup( void *cogmres_vdata,
 
    precond_setup(precond_data, A, b, x);
 
+   /* the spectral estimate of the s-step basis is redone for a new operator */
+   (cogmres_data -> have_spectrum) = 0;
+
    /*-----------------------------------------------------
     * Allocate space for log info
     *-----------------------------------------------------*/
@@ -241,6 +266,388 @@ hypre_COGMRESSetup( void *cogmres_vdata,
 
    return hypre_error_flag;
 }
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepSpectrum
+ *
+ * Estimates the interval of the Chebyshev basis used by the s-step variant
+ * from the eigenvalues of the symmetric part of the leading n x n block of
+ * the (unrotated) Hessenberg matrix hu, computed with cyclic Jacobi sweeps.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSStepSpectrum( hypre_COGMRESData *cogmres_data,
+                            HYPRE_Real        *hu,
+                            HYPRE_Int          n )
+{
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int   ld = (cogmres_data -> k_dim) + 1;
+   HYPRE_Real *a;
+   HYPRE_Real  apq, app, aqq, akp, akq, theta, t, cs, sn, off, nrm;
+   HYPRE_Real  lmin, lmax, center, width;
+   HYPRE_Int   i, k, ip, iq, sweep;
+
+   a = hypre_CTAllocF(HYPRE_Real, n*n, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   nrm = 0.0;
+   for (iq = 0; iq < n; iq++)
+   {
+      for (ip = 0; ip < n; ip++)
+      {
+         a[iq*n+ip] = 0.5*(hu[iq*ld+ip] + hu[ip*ld+iq]);
+         nrm += a[iq*n+ip]*a[iq*n+ip];
+      }
+   }
+
+   for (sweep = 0; sweep < 50; sweep++)
+   {
+      off = 0.0;
+      for (iq = 1; iq < n; iq++)
+      {
+         for (ip = 0; ip < iq; ip++)
+         {
+            off += a[iq*n+ip]*a[iq*n+ip];
+         }
+      }
+      if (off <= 1.0e-24*nrm)
+      {
+         break;
+      }
+
+      for (ip = 0; ip < n-1; ip++)
+      {
+         for (iq = ip+1; iq < n; iq++)
+         {
+            apq = a[iq*n+ip];
+            if (apq == 0.0)
+            {
+               continue;
+            }
+            app = a[ip*n+ip];
+            aqq = a[iq*n+iq];
+            theta = (aqq - app)/(2.0*apq);
+            t = 1.0/(fabs(theta) + sqrt(theta*theta + 1.0));
+            if (theta < 0.0)
+            {
+               t = -t;
+            }
+            cs = 1.0/sqrt(t*t + 1.0);
+            sn = t*cs;
+
+            /* a = J^T a J, columns first, then rows */
+            for (k = 0; k < n; k++)
+            {
+               akp = a[ip*n+k];
+               akq = a[iq*n+k];
+               a[ip*n+k] = cs*akp - sn*akq;
+               a[iq*n+k] = sn*akp + cs*akq;
+            }
+            for (k = 0; k < n; k++)
+            {
+               akp = a[k*n+ip];
+               akq = a[k*n+iq];
+               a[k*n+ip] = cs*akp - sn*akq;
+               a[k*n+iq] = sn*akp + cs*akq;
+            }
+         }
+      }
+   }
+
+   lmin = lmax = a[0];
+   for (i = 1; i < n; i++)
+   {
+      lmin = hypre_min(lmin, a[i*n+i]);
+      lmax = hypre_max(lmax, a[i*n+i]);
+   }
+   hypre_TFreeF(a, cogmres_functions);
+
+   center = 0.5*(lmax + lmin);
+   width  = 0.5*(lmax - lmin);
+   if (width <= 1.0e-8*fabs(center))
+   {
+      /* (nearly) a single Ritz value; any nonzero width gives a valid basis */
+      width = hypre_max(fabs(center), 1.0);
+   }
+
+   (cogmres_data -> cheb_center)   = center;
+   (cogmres_data -> cheb_width)    = width;
+   (cogmres_data -> have_spectrum) = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepBlock
+ *
+ * Extends the orthonormal basis p[0..j] by up to sk vectors at once.  The
+ * vectors of a Chebyshev basis with center c and half width d,
+ *
+ *    v_0 = p[j],  v_1 = (A M^{-1} v_0 - c v_0)/d,
+ *    v_i = 2 (A M^{-1} v_{i-1} - c v_{i-1})/d - v_{i-2},
+ *
+ * are generated without global communication and stored in p[j+1..j+sk].
+ * They are orthogonalized against p[0..j] with block classical Gram-Schmidt
+ * and among themselves with a Cholesky QR.  All inner products of a pass go
+ * into one reduction; a second pass is made if cgs > 1 or if the Cholesky
+ * factorization breaks down.  Vectors that remain numerically dependent are
+ * dropped from the end of the block.
+ *
+ * The columns j..j+nk-1 of the unrotated Hessenberg matrix are returned in
+ * hu, where nk >= 1 is the number of vectors kept.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSStepBlock( hypre_COGMRESData *cogmres_data,
+                         void              *A,
+                         HYPRE_Int          j,
+                         HYPRE_Int          sk,
+                         HYPRE_Real        *hu )
+{
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int     k_dim        = (cogmres_data -> k_dim);
+   HYPRE_Int     unroll       = (cogmres_data -> unroll);
+   HYPRE_Int     cgs          = (cogmres_data -> cgs);
+   HYPRE_Real    cc           = (cogmres_data -> cheb_center);
+   HYPRE_Real    dd           = (cogmres_data -> cheb_width);
+   void         *matvec_data  = (cogmres_data -> matvec_data);
+   void         *precond_data = (cogmres_data -> precond_data);
+   void         *r            = (cogmres_data -> r);
+   void        **p            = (cogmres_data -> p);
+   void        **q            = p + j + 1;
+
+   HYPRE_Int (*precond)(void*,void*,void*,void*) = (cogmres_functions -> precond);
+
+   HYPRE_Int     ld = k_dim + 1;
+   HYPRE_Int     nq = j + 1;
+   HYPRE_Int     nb = nq + sk;
+   HYPRE_Real    dep_tol = 1.0e-12;
+   HYPRE_Real   *local, *sums, *C, *Cp, *G, *R, *w0, *Rh, *T, *alpha;
+   HYPRE_Real    t;
+   HYPRE_Int     i, k, l, m, pass, nk = 0;
+
+   if (!(cogmres_data -> have_spectrum))
+   {
+      /* monomial basis, i.e. plain Arnoldi steps */
+      cc = 0.0;
+      dd = 1.0;
+   }
+
+   local = hypre_CTAllocF(HYPRE_Real, nb*sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   sums  = hypre_CTAllocF(HYPRE_Real, nb*sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   C     = hypre_CTAllocF(HYPRE_Real, nq*sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   Cp    = hypre_CTAllocF(HYPRE_Real, nq*sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   G     = hypre_CTAllocF(HYPRE_Real, sk*sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   R     = hypre_CTAllocF(HYPRE_Real, sk*sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   w0    = hypre_CTAllocF(HYPRE_Real, sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   Rh    = hypre_CTAllocF(HYPRE_Real, ld*(sk+1), cogmres_functions, HYPRE_MEMORY_HOST);
+   T     = hypre_CTAllocF(HYPRE_Real, ld*sk, cogmres_functions, HYPRE_MEMORY_HOST);
+   alpha = hypre_CTAllocF(HYPRE_Real, hypre_max(nq, sk), cogmres_functions, HYPRE_MEMORY_HOST);
+
+   /* basis vectors, no global communication */
+   for (i = 0; i < sk; i++)
+   {
+      (*(cogmres_functions->ClearVector))(r);
+      precond(precond_data, A, p[j+i], r);
+      if (i == 0)
+      {
+         (*(cogmres_functions->Matvec))(matvec_data, 1.0/dd, A, r, 0.0, q[0]);
+         if (cc != 0.0)
+            (*(cogmres_functions->Axpy))(-cc/dd, p[j], q[0]);
+      }
+      else
+      {
+         (*(cogmres_functions->CopyVector))(p[j+i-1], q[i]);
+         (*(cogmres_functions->Matvec))(matvec_data, 2.0/dd, A, r, -1.0, q[i]);
+         if (cc != 0.0)
+            (*(cogmres_functions->Axpy))(-2.0*cc/dd, p[j+i], q[i]);
+      }
+   }
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      /* sums[i*nb + l] = <q_i, p_l>, sums[i*nb + nq + l] = <q_i, q_l>, l <= i */
+      if (cogmres_functions->MassInnerProdLocal && cogmres_functions->Allreduce)
+      {
+         for (i = 0; i < sk; i++)
+         {
+            (*(cogmres_functions->MassInnerProdLocal))(q[i], p, nq, unroll, &local[i*nb]);
+            (*(cogmres_functions->MassInnerProdLocal))(q[i], q, i+1, unroll, &local[i*nb+nq]);
+         }
+         (*(cogmres_functions->Allreduce))(A, local, sums, nb*sk);
+      }
+      else
+      {
+         for (i = 0; i < sk; i++)
+         {
+            (*(cogmres_functions->MassInnerProd))(q[i], p, nq, unroll, &sums[i*nb]);
+            (*(cogmres_functions->MassInnerProd))(q[i], q, i+1, unroll, &sums[i*nb+nq]);
+         }
+      }
+
+      /* project out p[0..j] */
+      for (i = 0; i < sk; i++)
+      {
+         for (l = 0; l < nq; l++)
+         {
+            Cp[i*nq+l] = sums[i*nb+l];
+            C[i*nq+l] += Cp[i*nq+l];
+            alpha[l]   = -Cp[i*nq+l];
+         }
+         (*(cogmres_functions->MassAxpy))(alpha, p, q[i], nq, unroll);
+      }
+
+      /* Gram matrix of the projected block */
+      for (i = 0; i < sk; i++)
+      {
+         if (pass == 0)
+         {
+            w0[i] = sums[i*nb+nq+i];
+         }
+         for (l = 0; l <= i; l++)
+         {
+            t = sums[i*nb+nq+l];
+            for (m = 0; m < nq; m++)
+            {
+               t -= Cp[l*nq+m]*Cp[i*nq+m];
+            }
+            G[i*sk+l] = t;
+         }
+      }
+
+      /* Cholesky factorization G = R^T R, stopping at the first column that
+         depends on the previous ones.  The first column is always kept on the
+         last pass (a zero diagonal is a breakdown of the Arnoldi process). */
+      nk = 0;
+      for (i = 0; i < sk; i++)
+      {
+         for (l = 0; l < i; l++)
+         {
+            t = G[i*sk+l];
+            for (m = 0; m < l; m++)
+            {
+               t -= R[l*sk+m]*R[i*sk+m];
+            }
+            R[i*sk+l] = t/R[l*sk+l];
+         }
+         t = G[i*sk+i];
+         for (m = 0; m < i; m++)
+         {
+            t -= R[i*sk+m]*R[i*sk+m];
+         }
+         if (!(t > dep_tol*w0[i]))
+         {
+            if (i == 0 && pass == 1)
+            {
+               R[0] = (t > 0.0) ? sqrt(t) : 0.0;
+               nk = 1;
+            }
+            break;
+         }
+         R[i*sk+i] = sqrt(t);
+         nk++;
+      }
+
+      if (nk == sk && cgs < 2)
+      {
+         break;
+      }
+   }
+
+   /* q_i = (q_i - sum_{l<i} R(l,i) q_l)/R(i,i) */
+   for (i = 0; i < nk; i++)
+   {
+      if (i > 0)
+      {
+         for (l = 0; l < i; l++)
+         {
+            alpha[l] = -R[i*sk+l];
+         }
+         (*(cogmres_functions->MassAxpy))(alpha, q, q[i], i, unroll);
+      }
+      if (R[i*sk+i] != 0.0)
+      {
+         (*(cogmres_functions->ScaleVector))(1.0/R[i*sk+i], q[i]);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * With V = [v_0 .. v_nk] = P Rh and A M^{-1} V(:,0:nk-1) = V B, where B
+    * holds the three-term recurrence above, the new Hessenberg columns
+    * H(:,j:j+nk-1) solve
+    *
+    *    H(:,j:j+nk-1) Rh(j:j+nk-1,0:nk-1) = Rh B - H(:,0:j-1) Rh(0:j-1,0:nk-1)
+    *-----------------------------------------------------------------------*/
+
+   Rh[j] = 1.0;
+   for (i = 1; i <= nk; i++)
+   {
+      for (l = 0; l < nq; l++)
+      {
+         Rh[i*ld+l] = C[(i-1)*nq+l];
+      }
+      for (l = 0; l < i; l++)
+      {
+         Rh[i*ld+nq+l] = R[(i-1)*sk+l];
+      }
+   }
+
+   for (k = 0; k < nk; k++)
+   {
+      for (l = 0; l <= j+nk; l++)
+      {
+         if (k == 0)
+         {
+            t = cc*Rh[l] + dd*Rh[ld+l];
+         }
+         else
+         {
+            t = 0.5*dd*(Rh[(k-1)*ld+l] + Rh[(k+1)*ld+l]) + cc*Rh[k*ld+l];
+         }
+         T[k*ld+l] = t;
+      }
+      for (m = 0; m < j; m++)
+      {
+         t = Rh[k*ld+m];
+         if (t != 0.0)
+         {
+            for (l = 0; l <= m+1; l++)
+            {
+               T[k*ld+l] -= hu[m*ld+l]*t;
+            }
+         }
+      }
+   }
+
+   for (k = 0; k < nk; k++)
+   {
+      for (l = 0; l <= j+k+1; l++)
+      {
+         t = T[k*ld+l];
+         for (m = 0; m < k; m++)
+         {
+            t -= hu[(j+m)*ld+l]*Rh[k*ld+j+m];
+         }
+         hu[(j+k)*ld+l] = t/Rh[k*ld+j+k];
+      }
+      for (l = j+k+2; l < ld; l++)
+      {
+         hu[(j+k)*ld+l] = 0.0;
+      }
+   }
+
+   hypre_TFreeF(local, cogmres_functions);
+   hypre_TFreeF(sums, cogmres_functions);
+   hypre_TFreeF(C, cogmres_functions);
+   hypre_TFreeF(Cp, cogmres_functions);
+   hypre_TFreeF(G, cogmres_functions);
+   hypre_TFreeF(R, cogmres_functions);
+   hypre_TFreeF(w0, cogmres_functions);
+   hypre_TFreeF(Rh, cogmres_functions);
+   hypre_TFreeF(T, cogmres_functions);
+   hypre_TFreeF(alpha, cogmres_functions);
+
+   return nk;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSolve
  *-------------------------------------------------------------------------*/
@@ -257,6 +664,7 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
    HYPRE_Int     unroll            = (cogmres_data -> unroll);
    HYPRE_Int     cgs               = (cogmres_data -> cgs);
+   HYPRE_Int     s_step            = (cogmres_data -> s_step);
    HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
    HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
    HYPRE_Int     rel_change        = (cogmres_data -> rel_change);
@@ -287,6 +695,9 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    HYPRE_Int  i, j, k;
   /*KS: rv is the norm history */
    HYPRE_Real *rs, *hh, *uu, *c, *s, *rs_2, *rv;
+   /* s-step variant: unrotated Hessenberg matrix and end of the current block */
+   HYPRE_Real *hu = NULL;
+   HYPRE_Int   blk_end = 0, sk;
   //, *tmp;
    HYPRE_Int  iter;
    HYPRE_Int  my_id, num_procs;
@@ -335,6 +746,8 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    hh = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
    uu = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   if (s_step > 1)
+      hu = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
 
    (*(cogmres_functions->CopyVector))(b,p[0]);
 
@@ -463,6 +876,7 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
          if (rel_change)  hypre_TFreeF(rs_2,cogmres_functions);
          hypre_TFreeF(hh,cogmres_functions);
          hypre_TFreeF(uu,cogmres_functions);
+         hypre_TFreeF(hu,cogmres_functions);
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -498,6 +912,7 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
       t = 1.0 / r_norm;
       (*(cogmres_functions->ScaleVector))(t,p[0]);
       i = 0;
+      blk_end = 0;
       /***RESTART CYCLE (right-preconditioning) ***/
       while (i < k_dim && iter < max_iter)
       {
@@ -505,45 +920,64 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
          iter++;
          itmp = (i-1)*(k_dim+1);
 
-         (*(cogmres_functions->ClearVector))(r);
-
-         precond(precond_data, A, p[i-1], r);
-         (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
-         for (j=0; j<i; j++)
-            rv[j]  = 0;
-
-         if (cgs > 1)
+         if (s_step > 1)
          {
-            (*(cogmres_functions->MassDotpTwo))((void *) p[i], p[i-1], p, i, unroll, &hh[itmp], &uu[itmp]);
-            for (j=0; j<i-1; j++) uu[j*(k_dim+1)+i-1] = uu[itmp+j];
-            for (j=0; j<i; j++) rv[j] = hh[itmp+j];
-            for (k=0; k < i; k++)
+            /* the Hessenberg columns of an s-step block are all computed
+               at once; start a new block when they are used up */
+            if (i > blk_end)
             {
-               for (j=0; j < i; j++)
-               {
-                  hh[itmp+j] -= (uu[k*(k_dim+1)+j]*rv[j]);
-               }
+               sk = (cogmres_data -> have_spectrum) ? s_step : 1;
+               sk = hypre_min(sk, hypre_min(k_dim-i+1, max_iter-iter+1));
+               blk_end = i-1 + hypre_COGMRESSStepBlock(cogmres_data, A, i-1, sk, hu);
+
+               if (!(cogmres_data -> have_spectrum) && blk_end >= hypre_min(s_step, k_dim))
+                  hypre_COGMRESSStepSpectrum(cogmres_data, hu, hypre_min(s_step, k_dim));
             }
-            for (j=0; j<i; j++)
-               hh[itmp+j]  = -rv[j]-hh[itmp+j];
+            for (j=0; j<=i; j++)
+               hh[itmp+j] = hu[itmp+j];
          }
          else
          {
-            (*(cogmres_functions->MassInnerProd))((void *) p[i], p, i, unroll, &hh[itmp]);
+            (*(cogmres_functions->ClearVector))(r);
+
+            precond(precond_data, A, p[i-1], r);
+            (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
             for (j=0; j<i; j++)
-               hh[itmp+j]  = -hh[itmp+j];
-         }
+               rv[j]  = 0;
+
+            if (cgs > 1)
+            {
+               (*(cogmres_functions->MassDotpTwo))((void *) p[i], p[i-1], p, i, unroll, &hh[itmp], &uu[itmp]);
+               for (j=0; j<i-1; j++) uu[j*(k_dim+1)+i-1] = uu[itmp+j];
+               for (j=0; j<i; j++) rv[j] = hh[itmp+j];
+               for (k=0; k < i; k++)
+               {
+                  for (j=0; j < i; j++)
+                  {
+                     hh[itmp+j] -= (uu[k*(k_dim+1)+j]*rv[j]);
+                  }
+               }
+               for (j=0; j<i; j++)
+                  hh[itmp+j]  = -rv[j]-hh[itmp+j];
+            }
+            else
+            {
+               (*(cogmres_functions->MassInnerProd))((void *) p[i], p, i, unroll, &hh[itmp]);
+               for (j=0; j<i; j++)
+                  hh[itmp+j]  = -hh[itmp+j];
+            }
 
-         (*(cogmres_functions->MassAxpy))(&hh[itmp],p,p[i], i, unroll);
-         for (j=0; j<i; j++)
-            hh[itmp+j]  = -hh[itmp+j];
-         t = sqrt( (*(cogmres_functions->InnerProd))(p[i],p[i]) );
-         hh[itmp+i] = t;
+            (*(cogmres_functions->MassAxpy))(&hh[itmp],p,p[i], i, unroll);
+            for (j=0; j<i; j++)
+               hh[itmp+j]  = -hh[itmp+j];
+            t = sqrt( (*(cogmres_functions->InnerProd))(p[i],p[i]) );
+            hh[itmp+i] = t;
 
-         if (hh[itmp+i] != 0.0)
-         {
-            t = 1.0/t;
-            (*(cogmres_functions->ScaleVector))(t,p[i]);
+            if (hh[itmp+i] != 0.0)
+            {
+               t = 1.0/t;
+               (*(cogmres_functions->ScaleVector))(t,p[i]);
+            }
          }
          for (j = 1; j < i; j++)
          {
@@ -852,6 +1286,7 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    }*/
    hypre_TFreeF(hh,cogmres_functions);
    hypre_TFreeF(uu,cogmres_functions);
+   hypre_TFreeF(hu,cogmres_functions);
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -924,6 +1359,28 @@ hypre_COGMRESGetCGS( void   *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStep, hypre_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStep( void   *cogmres_vdata,
+        HYPRE_Int   s_step )
+{
+   hypre_COGMRESData *cogmres_data =(hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> s_step) = s_step;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStep( void   *cogmres_vdata,
+        HYPRE_Int * s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step = (cogmres_data -> s_step);
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetTol, hypre_COGMRESGetTol
  *--------------------------------------------------------------------------*/
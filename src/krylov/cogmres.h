@@ -65,6 +65,12 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
    HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
+
+   /* optional, used by the s-step variant; NULL if not available */
+   HYPRE_Int    (*MassInnerProdLocal) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result );
+   HYPRE_Int    (*Allreduce)     ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count );
+
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
 
@@ -81,6 +87,7 @@ typedef struct
    HYPRE_Int      k_dim;
    HYPRE_Int      unroll;
    HYPRE_Int      cgs;
+   HYPRE_Int      s_step;
    HYPRE_Int      min_iter;
    HYPRE_Int      max_iter;
    HYPRE_Int      rel_change;
@@ -91,6 +98,11 @@ typedef struct
    HYPRE_Real   a_tol;
    HYPRE_Real   rel_residual_norm;
 
+   /* Chebyshev interval of the s-step basis, center and half width */
+   HYPRE_Int    have_spectrum;
+   HYPRE_Real   cheb_center;
+   HYPRE_Real   cheb_width;
+
    void  *A;
    void  *r;
    void  *w;
@@ -154,6 +166,21 @@ hypre_COGMRESFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+/**
+ * Registers the operations needed for one reduction per block in the s-step
+ * variant (either may be NULL).  MassInnerProdLocal is MassInnerProd without
+ * the global sum, Allreduce sums count values over the communicator
+ * of A.
+ **/
+
+HYPRE_Int
+hypre_COGMRESFunctionsSetSStepOps(
+   hypre_COGMRESFunctions *cogmres_functions,
+   HYPRE_Int    (*MassInnerProdLocal) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result ),
+   HYPRE_Int    (*Allreduce)     ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count )
+   );
+
 /**
  * Description...
  *
@@ -65,6 +65,28 @@ hypre_GMRESFunctionsCreate(
    return gmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESFunctionsSetFusedOps
+ *
+ * Registers optional fused vector operations.  Any of them may be NULL, in
+ * which case the solver falls back to the basic operations above.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESFunctionsSetFusedOps(
+   hypre_GMRESFunctions *gmres_functions,
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+   HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result ),
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+   )
+{
+   gmres_functions->AxpyInnerProd = AxpyInnerProd;
+   gmres_functions->InnerProd2    = InnerProd2;
+   gmres_functions->Axpby         = Axpby;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESCreate
  *--------------------------------------------------------------------------*/
@@ -517,12 +539,25 @@ hypre_GMRESSolve(void  *gmres_vdata,
          precond(precond_data, A, p[i-1], r);
          (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
          /* modified Gram_Schmidt */
-         for (j=0; j < i; j++)
+         if (gmres_functions->AxpyInnerProd)
          {
-            hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
-            (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            /* each update of p[i] also computes the next inner product */
+            hh[0][i-1] = (*(gmres_functions->InnerProd))(p[0],p[i]);
+            for (j=0; j < i-1; j++)
+            {
+               hh[j+1][i-1] = (*(gmres_functions->AxpyInnerProd))(-hh[j][i-1],p[j],p[i],p[j+1]);
+            }
+            t = sqrt((*(gmres_functions->AxpyInnerProd))(-hh[i-1][i-1],p[i-1],p[i],p[i]));
+         }
+         else
+         {
+            for (j=0; j < i; j++)
+            {
+               hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
+               (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            }
+            t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          }
-         t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          hh[i][i-1] = t;
          if (t != 0.0)
          {
@@ -629,8 +664,15 @@ hypre_GMRESSolve(void  *gmres_vdata,
                   rs_2[k] = t/hh[k][k];
                }
 
-               (*(gmres_functions->CopyVector))(p[i-1],w);
-               (*(gmres_functions->ScaleVector))(rs_2[i-1],w);
+               if (gmres_functions->Axpby)
+               {
+                  (*(gmres_functions->Axpby))(rs_2[i-1],p[i-1],0.0,w);
+               }
+               else
+               {
+                  (*(gmres_functions->CopyVector))(p[i-1],w);
+                  (*(gmres_functions->ScaleVector))(rs_2[i-1],w);
+               }
                for (j = i-2; j >=0; j--)
                {
                   (*(gmres_functions->Axpy))(rs_2[j], p[j], w);
@@ -726,8 +768,15 @@ hypre_GMRESSolve(void  *gmres_vdata,
          rs[k] = t/hh[k][k];
       }
 
-      (*(gmres_functions->CopyVector))(p[i-1],w);
-      (*(gmres_functions->ScaleVector))(rs[i-1],w);
+      if (gmres_functions->Axpby)
+      {
+         (*(gmres_functions->Axpby))(rs[i-1],p[i-1],0.0,w);
+      }
+      else
+      {
+         (*(gmres_functions->CopyVector))(p[i-1],w);
+         (*(gmres_functions->ScaleVector))(rs[i-1],w);
+      }
       for (j = i-2; j >=0; j--)
          (*(gmres_functions->Axpy))(rs[j], p[j], w);
 
@@ -412,6 +412,11 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional fused vector operations, NULL if not available */
+    HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+    HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result );
+    HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
 
@@ -498,6 +503,20 @@ extern "C" {
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Registers optional fused vector operations (any of them may be NULL).
+     * AxpyInnerProd does y += alpha*x and returns <z,y>, InnerProd2 computes
+     * <x,y> and <x,z> with one reduction, and Axpby does y = alpha*x + beta*y.
+     **/
+
+    HYPRE_Int
+      hypre_GMRESFunctionsSetFusedOps(
+          hypre_GMRESFunctions *gmres_functions,
+          HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+          HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result ),
+          HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+          );
+
     /**
      * Description...
      *
@@ -575,6 +594,12 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
     HYPRE_Int    (*MassAxpy)      ( HYPRE_Complex * alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
+
+    /* optional, used by the s-step variant; NULL if not available */
+    HYPRE_Int    (*MassInnerProdLocal) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result );
+    HYPRE_Int    (*Allreduce)     ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+        HYPRE_Int count );
+
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
 
@@ -592,6 +617,7 @@ extern "C" {
     HYPRE_Int      k_dim;
     HYPRE_Int      unroll;
     HYPRE_Int      cgs;
+    HYPRE_Int      s_step;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -603,6 +629,11 @@ extern "C" {
     HYPRE_Real   a_tol;
     HYPRE_Real   rel_residual_norm;
 
+    /* Chebyshev interval of the s-step basis, center and half width */
+    HYPRE_Int    have_spectrum;
+    HYPRE_Real   cheb_center;
+    HYPRE_Real   cheb_width;
+
     void  *A;
     void  *r;
     void  *w;
@@ -665,6 +696,21 @@ extern "C" {
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Registers the operations needed for one reduction per block in the s-step
+     * variant (either may be NULL).  MassInnerProdLocal is MassInnerProd without
+     * the global sum, Allreduce sums count values over the communicator
+     * of A.
+     **/
+
+    HYPRE_Int
+      hypre_COGMRESFunctionsSetSStepOps(
+          hypre_COGMRESFunctions *cogmres_functions,
+          HYPRE_Int    (*MassInnerProdLocal) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result ),
+          HYPRE_Int    (*Allreduce)     ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+            HYPRE_Int count )
+          );
+
     /**
      * Description...
      *
@@ -1062,6 +1108,11 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional fused vector operations, NULL if not available */
+    HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+    HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result );
+    HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
     HYPRE_Int    (*precond)(void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup)(void *vdata , void *A , void *b , void *x);
 
@@ -1182,6 +1233,20 @@ extern "C" {
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
 
+    /**
+     * Registers optional fused vector operations (any of them may be NULL).
+     * AxpyInnerProd does y += alpha*x and returns <z,y>, InnerProd2 computes
+     * <x,y> and <x,z> with one reduction, and Axpby does y = alpha*x + beta*y.
+     **/
+
+    HYPRE_Int
+      hypre_PCGFunctionsSetFusedOps(
+          hypre_PCGFunctions *pcg_functions,
+          HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+          HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result ),
+          HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+          );
+
     /**
      * Description...
      *
@@ -1195,6 +1260,184 @@ extern "C" {
   }
 #endif
 
+#endif
+
+/******************************************************************************
+ *
+ * Pipelined preconditioned conjugate gradient headers
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_PIPELINED_PCG_HEADER
+#define hypre_KRYLOV_PIPELINED_PCG_HEADER
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Generic Pipelined PCG Interface
+ *
+ * Communication-hiding variant of PCG (Ghysels and Vanroose).  The inner
+ * products of an iteration are reduced with a single non-blocking reduction
+ * that is overlapped with one preconditioner application and one matvec.
+ *
+ * @memo A generic pipelined PCG linear solver interface
+ **/
+/*@{*/
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGData and hypre_PipelinedPCGFunctions
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Pipelined PCG structs
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * The {\tt hypre\_PipelinedPCGFunctions} object ...
+ *
+ * InnerProdLocal returns the contribution of the calling process to <x,y>,
+ * and IAllreduce starts a non-blocking sum of count values over the
+ * communicator of A.  The solver completes the request with hypre_MPI_Wait.
+ **/
+
+typedef struct
+{
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+   HYPRE_Int    (*Free)          ( void *ptr );
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs );
+   void *       (*CreateVector)  ( void *vector );
+   HYPRE_Int    (*DestroyVector) ( void *vector );
+   void *       (*MatvecCreate)  ( void *A, void *x );
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Real   (*InnerProdLocal)( void *x, void *y );
+   HYPRE_Int    (*IAllreduce)    ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count, hypre_MPI_Request *request );
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+   HYPRE_Int    (*ClearVector)   ( void *x );
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
+   HYPRE_Int    (*precond)       ( void *vdata, void *A, void *b, void *x );
+   HYPRE_Int    (*precond_setup) ( void *vdata, void *A, void *b, void *x );
+
+} hypre_PipelinedPCGFunctions;
+
+/**
+ * The {\tt hypre\_PipelinedPCGData} object ...
+ **/
+
+/*
+ Summary of Parameters to Control Stopping Test:
+ - The default norm is the energy norm wrt the preconditioner, |r|=sqrt(<Cr,r>).
+   two_norm!=0 means: the norm is the L2 norm, |r|=sqrt(<r,r>); this adds a
+   third value to the reduction but no extra synchronization.
+ - Convergence test is |r| <= max(tol*|b|, a_tol).
+ - replace_period>0 means: every replace_period iterations, replace the
+   recurred vectors r, u = C r, w = A u, s = A p, q = C s and z = A q with
+   their explicitly computed values.  This limits the loss of accuracy that
+   the additional recurrences of the pipelined method are prone to, at the
+   cost of two preconditioner applications and three matvecs.
+*/
+
+typedef struct
+{
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Int    max_iter;
+   HYPRE_Int    two_norm;
+   HYPRE_Int    replace_period;
+   HYPRE_Int    converged;
+
+   void    *A;
+   void    *r;  /* residual */
+   void    *u;  /* C r */
+   void    *w;  /* A u */
+   void    *m;  /* C w */
+   void    *n;  /* A m */
+   void    *p;  /* search direction */
+   void    *s;  /* A p */
+   void    *q;  /* C s */
+   void    *z;  /* A q */
+
+   HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
+   void      *matvec_data;
+   void      *precond_data;
+
+   hypre_PipelinedPCGFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int    num_iterations;
+   HYPRE_Real   rel_residual_norm;
+
+   HYPRE_Int    print_level; /* printing when print_level>0 */
+   HYPRE_Int    logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+   HYPRE_Real  *rel_norms;
+
+} hypre_PipelinedPCGData;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name generic Pipelined PCG Solver
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+hypre_PipelinedPCGFunctions *
+hypre_PipelinedPCGFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Real   (*InnerProdLocal)( void *x, void *y ),
+   HYPRE_Int    (*IAllreduce)    ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   );
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+void *
+hypre_PipelinedPCGCreate( hypre_PipelinedPCGFunctions *pcg_functions );
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
 
   /* bicgstab.c */
@@ -1280,6 +1523,8 @@ extern "C" {
   HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata , HYPRE_Int *unroll );
   HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata , HYPRE_Int cgs );
   HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata , HYPRE_Int *cgs );
+  HYPRE_Int hypre_COGMRESSetSStep ( void *gmres_vdata , HYPRE_Int s_step );
+  HYPRE_Int hypre_COGMRESGetSStep ( void *gmres_vdata , HYPRE_Int *s_step );
   HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata , HYPRE_Real a_tol );
@@ -1444,6 +1689,8 @@ extern "C" {
   HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver , HYPRE_Int *unroll );
   HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
   HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
+  HYPRE_Int HYPRE_COGMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
+  HYPRE_Int HYPRE_COGMRESGetSStep ( HYPRE_Solver solver , HYPRE_Int *s_step );
   HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1600,6 +1847,57 @@ extern "C" {
   HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata , HYPRE_Int myid );
   HYPRE_Int hypre_PCGGetFinalRelativeResidualNorm ( void *pcg_vdata , HYPRE_Real *relative_residual_norm );
 
+
+  /* HYPRE_pipelinedpcg.c */
+  HYPRE_Int HYPRE_PipelinedPCGSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
+  HYPRE_Int HYPRE_PipelinedPCGSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
+  HYPRE_Int HYPRE_PipelinedPCGSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+  HYPRE_Int HYPRE_PipelinedPCGGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
+  HYPRE_Int HYPRE_PipelinedPCGSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+  HYPRE_Int HYPRE_PipelinedPCGGetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real *a_tol );
+  HYPRE_Int HYPRE_PipelinedPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+  HYPRE_Int HYPRE_PipelinedPCGGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+  HYPRE_Int HYPRE_PipelinedPCGSetTwoNorm ( HYPRE_Solver solver , HYPRE_Int two_norm );
+  HYPRE_Int HYPRE_PipelinedPCGGetTwoNorm ( HYPRE_Solver solver , HYPRE_Int *two_norm );
+  HYPRE_Int HYPRE_PipelinedPCGSetResidualReplacement ( HYPRE_Solver solver , HYPRE_Int replace_period );
+  HYPRE_Int HYPRE_PipelinedPCGGetResidualReplacement ( HYPRE_Solver solver , HYPRE_Int *replace_period );
+  HYPRE_Int HYPRE_PipelinedPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
+  HYPRE_Int HYPRE_PipelinedPCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int HYPRE_PipelinedPCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_PipelinedPCGGetLogging ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_PipelinedPCGSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_PipelinedPCGGetPrintLevel ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_PipelinedPCGGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+  HYPRE_Int HYPRE_PipelinedPCGGetConverged ( HYPRE_Solver solver , HYPRE_Int *converged );
+  HYPRE_Int HYPRE_PipelinedPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+  HYPRE_Int HYPRE_PipelinedPCGGetResidual ( HYPRE_Solver solver , void *residual );
+
+  /* pipelinedpcg.c */
+  void *hypre_PipelinedPCGCreate ( hypre_PipelinedPCGFunctions *pcg_functions );
+  HYPRE_Int hypre_PipelinedPCGDestroy ( void *pcg_vdata );
+  HYPRE_Int hypre_PipelinedPCGGetResidual ( void *pcg_vdata , void **residual );
+  HYPRE_Int hypre_PipelinedPCGSetup ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PipelinedPCGSolve ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PipelinedPCGSetTol ( void *pcg_vdata , HYPRE_Real tol );
+  HYPRE_Int hypre_PipelinedPCGGetTol ( void *pcg_vdata , HYPRE_Real *tol );
+  HYPRE_Int hypre_PipelinedPCGSetAbsoluteTol ( void *pcg_vdata , HYPRE_Real a_tol );
+  HYPRE_Int hypre_PipelinedPCGGetAbsoluteTol ( void *pcg_vdata , HYPRE_Real *a_tol );
+  HYPRE_Int hypre_PipelinedPCGSetMaxIter ( void *pcg_vdata , HYPRE_Int max_iter );
+  HYPRE_Int hypre_PipelinedPCGGetMaxIter ( void *pcg_vdata , HYPRE_Int *max_iter );
+  HYPRE_Int hypre_PipelinedPCGSetTwoNorm ( void *pcg_vdata , HYPRE_Int two_norm );
+  HYPRE_Int hypre_PipelinedPCGGetTwoNorm ( void *pcg_vdata , HYPRE_Int *two_norm );
+  HYPRE_Int hypre_PipelinedPCGSetResidualReplacement ( void *pcg_vdata , HYPRE_Int replace_period );
+  HYPRE_Int hypre_PipelinedPCGGetResidualReplacement ( void *pcg_vdata , HYPRE_Int *replace_period );
+  HYPRE_Int hypre_PipelinedPCGGetPrecond ( void *pcg_vdata , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int hypre_PipelinedPCGSetPrecond ( void *pcg_vdata , HYPRE_Int (*precond)(void* , void* , void* , void*) , HYPRE_Int (*precond_setup)(void* , void* , void* , void*) , void *precond_data );
+  HYPRE_Int hypre_PipelinedPCGSetPrintLevel ( void *pcg_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_PipelinedPCGGetPrintLevel ( void *pcg_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_PipelinedPCGSetLogging ( void *pcg_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_PipelinedPCGGetLogging ( void *pcg_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_PipelinedPCGGetNumIterations ( void *pcg_vdata , HYPRE_Int *num_iterations );
+  HYPRE_Int hypre_PipelinedPCGGetConverged ( void *pcg_vdata , HYPRE_Int *converged );
+  HYPRE_Int hypre_PipelinedPCGGetFinalRelativeResidualNorm ( void *pcg_vdata , HYPRE_Real *relative_residual_norm );
+
 #ifdef __cplusplus
   }
 #endif
@@ -72,6 +72,28 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetFusedOps
+ *
+ * Registers optional fused vector operations.  Any of them may be NULL, in
+ * which case the solver falls back to the basic operations above.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetFusedOps(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+   HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result ),
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+   )
+{
+   pcg_functions->AxpyInnerProd = AxpyInnerProd;
+   pcg_functions->InnerProd2    = InnerProd2;
+   pcg_functions->Axpby         = Axpby;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -304,6 +326,7 @@ hypre_PCGSolve( void *pcg_vdata,
 
    HYPRE_Real      alpha, beta;
    HYPRE_Real      gamma, gamma_old;
+   HYPRE_Real      inner_prods[2];
    HYPRE_Real      bi_prod, eps;
    HYPRE_Real      pi_prod, xi_prod;
    HYPRE_Real      ieee_check = 0.;
@@ -566,8 +589,16 @@ hypre_PCGSolve( void *pcg_vdata,
       (*(pcg_functions->ClearVector))(s);
       precond(precond_data, A, r, s);
 
-      /* gamma = <r,s> */
-      gamma = (*(pcg_functions->InnerProd))(r, s);
+      /* gamma = <r,s>, together with <r,r> when both are needed */
+      if (two_norm && pcg_functions->InnerProd2)
+      {
+         (*(pcg_functions->InnerProd2))(r, s, r, inner_prods);
+         gamma = inner_prods[0];
+      }
+      else
+      {
+         gamma = (*(pcg_functions->InnerProd))(r, s);
+      }
 
       /* residual-based stopping criteria: ||r_new-r_old||_C < rtol ||b||_C */
       if (rtol && !two_norm)
@@ -585,7 +616,9 @@ hypre_PCGSolve( void *pcg_vdata,
       }
 
       /* set i_prod for convergence test */
-      if (two_norm)
+      if (two_norm && pcg_functions->InnerProd2)
+         i_prod = inner_prods[1];
+      else if (two_norm)
          i_prod = (*(pcg_functions->InnerProd))(r,r);
       else
          i_prod = gamma;
@@ -730,7 +763,11 @@ hypre_PCGSolve( void *pcg_vdata,
       beta = gamma / gamma_old;
 
       /* p = s + beta p */
-      if ( !recompute_true_residual )
+      if ( !recompute_true_residual && pcg_functions->Axpby )
+      {
+         (*(pcg_functions->Axpby))(1.0, s, beta, p);
+      }
+      else if ( !recompute_true_residual )
       {
          (*(pcg_functions->ScaleVector))(beta, p);
          (*(pcg_functions->Axpy))(1.0, s, p);
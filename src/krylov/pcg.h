@@ -64,6 +64,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional fused vector operations, NULL if not available */
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+   HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result );
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -183,6 +188,20 @@ hypre_PCGFunctionsCreate(
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
 
+/**
+ * Registers optional fused vector operations (any of them may be NULL).
+ * AxpyInnerProd does y += alpha*x and returns <z,y>, InnerProd2 computes
+ * <x,y> and <x,z> with one reduction, and Axpby does y = alpha*x + beta*y.
+ **/
+
+HYPRE_Int
+hypre_PCGFunctionsSetFusedOps(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+   HYPRE_Int    (*InnerProd2)    ( void *x, void *y, void *z, HYPRE_Real *result ),
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y )
+   );
+
 /**
  * Description...
  *
@@ -0,0 +1,841 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Pipelined preconditioned conjugate gradient functions
+ *
+ * This is the communication-hiding CG of P. Ghysels and W. Vanroose,
+ * "Hiding global synchronization latency in the preconditioned Conjugate
+ * Gradient algorithm", Parallel Computing 40 (2014).  Each iteration needs
+ * a single global reduction (of <r,u>, <w,u> and optionally <r,r>), which is
+ * started before and completed after the application of the preconditioner
+ * and the matrix to w.  The price is four additional vectors and recurrences
+ * for u = C r and w = A u, see hypre_PipelinedPCGSetResidualReplacement.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGFunctionsCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_PipelinedPCGFunctions *
+hypre_PipelinedPCGFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Real   (*InnerProdLocal)( void *x, void *y ),
+   HYPRE_Int    (*IAllreduce)    ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   )
+{
+   hypre_PipelinedPCGFunctions * pcg_functions;
+   pcg_functions = (hypre_PipelinedPCGFunctions *)
+      CAlloc( 1, sizeof(hypre_PipelinedPCGFunctions), HYPRE_MEMORY_HOST );
+
+   pcg_functions->CAlloc = CAlloc;
+   pcg_functions->Free = Free;
+   pcg_functions->CommInfo = CommInfo;
+   pcg_functions->CreateVector = CreateVector;
+   pcg_functions->DestroyVector = DestroyVector;
+   pcg_functions->MatvecCreate = MatvecCreate;
+   pcg_functions->Matvec = Matvec;
+   pcg_functions->MatvecDestroy = MatvecDestroy;
+   pcg_functions->InnerProd = InnerProd;
+   pcg_functions->InnerProdLocal = InnerProdLocal;
+   pcg_functions->IAllreduce = IAllreduce;
+   pcg_functions->CopyVector = CopyVector;
+   pcg_functions->ClearVector = ClearVector;
+   pcg_functions->Axpy = Axpy;
+   pcg_functions->Axpby = Axpby;
+/* default preconditioner must be set here but can be changed later... */
+   pcg_functions->precond_setup = PrecondSetup;
+   pcg_functions->precond       = Precond;
+
+   return pcg_functions;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PipelinedPCGCreate( hypre_PipelinedPCGFunctions *pcg_functions )
+{
+   hypre_PipelinedPCGData *pcg_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   pcg_data = hypre_CTAllocF(hypre_PipelinedPCGData, 1, pcg_functions, HYPRE_MEMORY_HOST);
+
+   pcg_data -> functions = pcg_functions;
+
+   /* set defaults */
+   (pcg_data -> tol)            = 1.0e-06;
+   (pcg_data -> a_tol)          = 0.0;
+   (pcg_data -> max_iter)       = 1000;
+   (pcg_data -> two_norm)       = 0;
+   (pcg_data -> replace_period) = 0;
+   (pcg_data -> converged)      = 0;
+   (pcg_data -> owns_matvec_data ) = 1;
+   (pcg_data -> matvec_data)    = NULL;
+   (pcg_data -> precond_data)   = NULL;
+   (pcg_data -> print_level)    = 0;
+   (pcg_data -> logging)        = 0;
+   (pcg_data -> norms)          = NULL;
+   (pcg_data -> rel_norms)      = NULL;
+   (pcg_data -> r)              = NULL;
+   (pcg_data -> u)              = NULL;
+   (pcg_data -> w)              = NULL;
+   (pcg_data -> m)              = NULL;
+   (pcg_data -> n)              = NULL;
+   (pcg_data -> p)              = NULL;
+   (pcg_data -> s)              = NULL;
+   (pcg_data -> q)              = NULL;
+   (pcg_data -> z)              = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (void *) pcg_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGDestroyVectors
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PipelinedPCGDestroyVectors( hypre_PipelinedPCGData *pcg_data )
+{
+   hypre_PipelinedPCGFunctions *pcg_functions = pcg_data->functions;
+   void  **vectors[9];
+   HYPRE_Int i;
+
+   vectors[0] = &(pcg_data -> r);
+   vectors[1] = &(pcg_data -> u);
+   vectors[2] = &(pcg_data -> w);
+   vectors[3] = &(pcg_data -> m);
+   vectors[4] = &(pcg_data -> n);
+   vectors[5] = &(pcg_data -> p);
+   vectors[6] = &(pcg_data -> s);
+   vectors[7] = &(pcg_data -> q);
+   vectors[8] = &(pcg_data -> z);
+
+   for (i = 0; i < 9; i++)
+   {
+      if ( *vectors[i] != NULL )
+      {
+         (*(pcg_functions->DestroyVector))(*vectors[i]);
+         *vectors[i] = NULL;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGDestroy( void *pcg_vdata )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (pcg_data)
+   {
+      hypre_PipelinedPCGFunctions *pcg_functions = pcg_data->functions;
+      if ( (pcg_data -> norms) != NULL )
+      {
+         hypre_TFreeF( pcg_data -> norms, pcg_functions );
+         pcg_data -> norms = NULL;
+      }
+      if ( (pcg_data -> rel_norms) != NULL )
+      {
+         hypre_TFreeF( pcg_data -> rel_norms, pcg_functions );
+         pcg_data -> rel_norms = NULL;
+      }
+      if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
+      {
+         (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
+         pcg_data -> matvec_data = NULL;
+      }
+      hypre_PipelinedPCGDestroyVectors(pcg_data);
+      hypre_TFreeF( pcg_data, pcg_functions );
+      hypre_TFreeF( pcg_functions, pcg_functions );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return(hypre_error_flag);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_PipelinedPCGGetResidual( void *pcg_vdata, void **residual )
+{
+   /* returns a pointer to the residual vector */
+
+   hypre_PipelinedPCGData  *pcg_data     =  (hypre_PipelinedPCGData *)pcg_vdata;
+   *residual = pcg_data->r;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetup( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x         )
+{
+   hypre_PipelinedPCGData *pcg_data =  (hypre_PipelinedPCGData *)pcg_vdata;
+   hypre_PipelinedPCGFunctions *pcg_functions = pcg_data->functions;
+   HYPRE_Int            max_iter         = (pcg_data -> max_iter);
+   HYPRE_Int          (*precond_setup)(void*,void*,void*,void*) = (pcg_functions -> precond_setup);
+   void          *precond_data     = (pcg_data -> precond_data);
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> A) = A;
+
+   /*--------------------------------------------------
+    * The arguments for CreateVector are important to
+    * maintain consistency between the setup and
+    * compute phases of matvec and the preconditioner.
+    * Vectors in the range of A (or of the residual)
+    * are created from b, the others from x.
+    *--------------------------------------------------*/
+
+   hypre_PipelinedPCGDestroyVectors(pcg_data);
+   (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
+   (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+   (pcg_data -> w) = (*(pcg_functions->CreateVector))(b);
+   (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+   (pcg_data -> n) = (*(pcg_functions->CreateVector))(b);
+   (pcg_data -> p) = (*(pcg_functions->CreateVector))(x);
+   (pcg_data -> s) = (*(pcg_functions->CreateVector))(b);
+   (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+   (pcg_data -> z) = (*(pcg_functions->CreateVector))(b);
+
+   if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
+      (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
+   (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
+
+   precond_setup(precond_data, A, b, x);
+
+   /*-----------------------------------------------------
+    * Allocate space for log info
+    *-----------------------------------------------------*/
+
+   if ( (pcg_data->logging)>0  || (pcg_data->print_level)>0 )
+   {
+      if ( (pcg_data -> norms) != NULL )
+         hypre_TFreeF( pcg_data -> norms, pcg_functions );
+      (pcg_data -> norms)     = hypre_CTAllocF( HYPRE_Real, max_iter + 1,
+                                                pcg_functions, HYPRE_MEMORY_HOST);
+
+      if ( (pcg_data -> rel_norms) != NULL )
+         hypre_TFreeF( pcg_data -> rel_norms, pcg_functions );
+      (pcg_data -> rel_norms) = hypre_CTAllocF( HYPRE_Real, max_iter + 1,
+                                                pcg_functions, HYPRE_MEMORY_HOST );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSolve
+ *--------------------------------------------------------------------------
+ *
+ * Iteration i (starting from p = s = q = z = 0):
+ *
+ *    gamma = <r,u>,  delta = <w,u>    (non-blocking reduction started)
+ *    m = C*w,  n = A*m                (overlapped with the reduction)
+ *    beta  = gamma / gamma_old
+ *    alpha = gamma / (delta - beta*gamma/alpha_old)
+ *    z = n + beta*z,  q = m + beta*q,  s = w + beta*s,  p = u + beta*p
+ *    x = x + alpha*p,  r = r - alpha*s,  u = u - alpha*q,  w = w - alpha*z
+ *
+ * The convergence test is the same as in hypre_PCGSolve, applied to the
+ * residual r at the start of each iteration.
+ *
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSolve( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x         )
+{
+   hypre_PipelinedPCGData  *pcg_data     =  (hypre_PipelinedPCGData *)pcg_vdata;
+   hypre_PipelinedPCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol          = (pcg_data -> tol);
+   HYPRE_Real      a_tol          = (pcg_data -> a_tol);
+   HYPRE_Int       max_iter       = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm       = (pcg_data -> two_norm);
+   HYPRE_Int       replace_period = (pcg_data -> replace_period);
+   void           *r              = (pcg_data -> r);
+   void           *u              = (pcg_data -> u);
+   void           *w              = (pcg_data -> w);
+   void           *m              = (pcg_data -> m);
+   void           *n              = (pcg_data -> n);
+   void           *p              = (pcg_data -> p);
+   void           *s              = (pcg_data -> s);
+   void           *q              = (pcg_data -> q);
+   void           *z              = (pcg_data -> z);
+   void           *matvec_data    = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data   = (pcg_data -> precond_data);
+   HYPRE_Int       print_level    = (pcg_data -> print_level);
+   HYPRE_Int       logging        = (pcg_data -> logging);
+   HYPRE_Real     *norms          = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms      = (pcg_data -> rel_norms);
+
+   HYPRE_Real      alpha = 0.0, alpha_old = 0.0, beta = 0.0;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta, denom;
+   HYPRE_Real      local_prods[3], prods[3];
+   HYPRE_Int       num_prods = two_norm ? 3 : 2;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      ieee_check = 0.;
+   HYPRE_Real      i_prod = 0.0;
+
+   hypre_MPI_Request request;
+   hypre_MPI_Status  status;
+
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Start pipelined pcg solve
+    *-----------------------------------------------------------------------*/
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<b,b>: %e\n",bi_prod);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(u);
+      precond(precond_data, A, b, u);
+      bi_prod = (*(pcg_functions->InnerProd))(u, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<C*b,b>: %e\n",bi_prod);
+   }
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (bi_prod != 0.) ieee_check = bi_prod/bi_prod; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+        hypre_printf("ERROR -- hypre_PipelinedPCGSolve: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied b.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   if ( bi_prod > 0.0 )
+   {
+      /* convergence criteria:  <C*r,r>  <= max( a_tol^2, r_tol^2 * <C*b,b> ) */
+      eps = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod);
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging>0 || print_level>0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[0] = 0.0;
+      }
+      (pcg_data -> num_iterations) = 0;
+      (pcg_data -> rel_residual_norm) = 0.0;
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+         hypre_printf("-----    ------------   ---------  ------------ \n");
+      }
+      else
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   for (i = 0; ; i++)
+   {
+      /*--------------------------------------------------------------------
+       * Compute r, u and w from their definitions, initially and then every
+       * replace_period iterations.  After the first iteration, s, q and z
+       * are recomputed for the current search direction p as well.
+       *--------------------------------------------------------------------*/
+
+      if ( i == 0 || (replace_period > 0 && !(i%replace_period)) )
+      {
+         if (i > 0 && print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Replacing the residual...\n");
+         }
+
+         /* r = b - Ax, u = C*r, w = A*u */
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+         if (i > 0)
+         {
+            /* s = A*p, q = C*s, z = A*q */
+            (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+            (*(pcg_functions->ClearVector))(q);
+            precond(precond_data, A, s, q);
+            (*(pcg_functions->Matvec))(matvec_data, 1.0, A, q, 0.0, z);
+         }
+      }
+
+      /* start the reduction of gamma = <r,u>, delta = <w,u> (and <r,r>) */
+      local_prods[0] = (*(pcg_functions->InnerProdLocal))(r, u);
+      local_prods[1] = (*(pcg_functions->InnerProdLocal))(w, u);
+      if (two_norm)
+      {
+         local_prods[2] = (*(pcg_functions->InnerProdLocal))(r, r);
+      }
+      (*(pcg_functions->IAllreduce))(A, local_prods, prods, num_prods, &request);
+
+      /* m = C*w, n = A*m while the reduction is in flight */
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      hypre_MPI_Wait(&request, &status);
+
+      gamma  = prods[0];
+      delta  = prods[1];
+      i_prod = two_norm ? prods[2] : gamma;
+
+      /* Since it is does not diminish performance, attempt to return an error flag
+         and notify users when they supply bad input. */
+      if (i == 0)
+      {
+         if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+              hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+              hypre_printf("ERROR -- hypre_PipelinedPCGSolve: INFs and/or NaNs detected in input.\n");
+              hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+              hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+              hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            HYPRE_ANNOTATE_FUNC_END;
+
+            return hypre_error_flag;
+         }
+      }
+
+      /* print norm info */
+      if ( logging>0 || print_level>0 )
+      {
+         norms[i]     = sqrt(i_prod);
+         rel_norms[i] = sqrt(i_prod/bi_prod);
+      }
+      if ( print_level > 1 && my_id==0 && i > 0 )
+      {
+         hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i]/norms[i-1], rel_norms[i] );
+      }
+
+      /* check for convergence */
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /*--------------------------------------------------------------------
+       * the core pipelined CG recurrences
+       *--------------------------------------------------------------------*/
+
+      if (i > 0)
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta*gamma/alpha_old;
+      }
+      else
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+
+      if (denom == 0.0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Breakdown in pipelined PCG: zero curvature <p,Ap>.\n");
+         break;
+      }
+      alpha = gamma / denom;
+
+      /* z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p */
+      (*(pcg_functions->Axpby))(1.0, n, beta, z);
+      (*(pcg_functions->Axpby))(1.0, m, beta, q);
+      (*(pcg_functions->Axpby))(1.0, w, beta, s);
+      (*(pcg_functions->Axpby))(1.0, u, beta, p);
+
+      /* x = x + alpha p, r = r - alpha s, u = u - alpha q, w = w - alpha z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (!(pcg_data -> converged) && i >= max_iter)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in pipelined PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetTol, hypre_PipelinedPCGGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetTol( void   *pcg_vdata,
+                          HYPRE_Real  tol       )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   (pcg_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetTol( void   *pcg_vdata,
+                          HYPRE_Real * tol       )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *tol = (pcg_data -> tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetAbsoluteTol, hypre_PipelinedPCGGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetAbsoluteTol( void   *pcg_vdata,
+                                  HYPRE_Real  a_tol       )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   (pcg_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetAbsoluteTol( void   *pcg_vdata,
+                                  HYPRE_Real  * a_tol       )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *a_tol = (pcg_data -> a_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetMaxIter, hypre_PipelinedPCGGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetMaxIter( void *pcg_vdata,
+                              HYPRE_Int   max_iter  )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   (pcg_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetMaxIter( void *pcg_vdata,
+                              HYPRE_Int * max_iter  )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *max_iter = (pcg_data -> max_iter);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetTwoNorm, hypre_PipelinedPCGGetTwoNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetTwoNorm( void *pcg_vdata,
+                              HYPRE_Int two_norm  )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   (pcg_data -> two_norm) = two_norm;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetTwoNorm( void *pcg_vdata,
+                              HYPRE_Int * two_norm  )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *two_norm = (pcg_data -> two_norm);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetResidualReplacement,
+ * hypre_PipelinedPCGGetResidualReplacement
+ *
+ * The additional recurrences of pipelined CG let rounding errors accumulate
+ * faster than in standard CG, so that the recursively updated residual can
+ * drift from b - Ax.  With replace_period > 0, the recurred vectors are
+ * recomputed from their definitions every replace_period iterations.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetResidualReplacement( void *pcg_vdata,
+                                          HYPRE_Int replace_period )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   (pcg_data -> replace_period) = replace_period;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetResidualReplacement( void *pcg_vdata,
+                                          HYPRE_Int * replace_period )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *replace_period = (pcg_data -> replace_period);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetPrecond( void         *pcg_vdata,
+                              HYPRE_Solver *precond_data_ptr )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *precond_data_ptr = (HYPRE_Solver)(pcg_data -> precond_data);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetPrecond( void  *pcg_vdata,
+                              HYPRE_Int  (*precond)(void*,void*,void*,void*),
+                              HYPRE_Int  (*precond_setup)(void*,void*,void*,void*),
+                              void  *precond_data )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+   hypre_PipelinedPCGFunctions *pcg_functions = pcg_data->functions;
+
+   (pcg_functions -> precond)       = precond;
+   (pcg_functions -> precond_setup) = precond_setup;
+   (pcg_data -> precond_data)  = precond_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetPrintLevel, hypre_PipelinedPCGGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetPrintLevel( void *pcg_vdata,
+                                 HYPRE_Int   level)
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   (pcg_data -> print_level) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetPrintLevel( void *pcg_vdata,
+                                 HYPRE_Int * level)
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *level = (pcg_data -> print_level);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGSetLogging, hypre_PipelinedPCGGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGSetLogging( void *pcg_vdata,
+                              HYPRE_Int   level)
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   (pcg_data -> logging) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PipelinedPCGGetLogging( void *pcg_vdata,
+                              HYPRE_Int * level)
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *level = (pcg_data -> logging);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetNumIterations( void *pcg_vdata,
+                                    HYPRE_Int  *num_iterations )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *num_iterations = (pcg_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetConverged( void *pcg_vdata,
+                                HYPRE_Int  *converged)
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *converged = (pcg_data -> converged);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PipelinedPCGGetFinalRelativeResidualNorm( void   *pcg_vdata,
+                                                HYPRE_Real *relative_residual_norm )
+{
+   hypre_PipelinedPCGData *pcg_data = (hypre_PipelinedPCGData *)pcg_vdata;
+
+   *relative_residual_norm = (pcg_data -> rel_residual_norm);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Pipelined preconditioned conjugate gradient headers
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_PIPELINED_PCG_HEADER
+#define hypre_KRYLOV_PIPELINED_PCG_HEADER
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Generic Pipelined PCG Interface
+ *
+ * Communication-hiding variant of PCG (Ghysels and Vanroose).  The inner
+ * products of an iteration are reduced with a single non-blocking reduction
+ * that is overlapped with one preconditioner application and one matvec.
+ *
+ * @memo A generic pipelined PCG linear solver interface
+ **/
+/*@{*/
+
+/*--------------------------------------------------------------------------
+ * hypre_PipelinedPCGData and hypre_PipelinedPCGFunctions
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Pipelined PCG structs
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * The {\tt hypre\_PipelinedPCGFunctions} object ...
+ *
+ * InnerProdLocal returns the contribution of the calling process to <x,y>,
+ * and IAllreduce starts a non-blocking sum of count values over the
+ * communicator of A.  The solver completes the request with hypre_MPI_Wait.
+ **/
+
+typedef struct
+{
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+   HYPRE_Int    (*Free)          ( void *ptr );
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs );
+   void *       (*CreateVector)  ( void *vector );
+   HYPRE_Int    (*DestroyVector) ( void *vector );
+   void *       (*MatvecCreate)  ( void *A, void *x );
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Real   (*InnerProdLocal)( void *x, void *y );
+   HYPRE_Int    (*IAllreduce)    ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count, hypre_MPI_Request *request );
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+   HYPRE_Int    (*ClearVector)   ( void *x );
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+
+   HYPRE_Int    (*precond)       ( void *vdata, void *A, void *b, void *x );
+   HYPRE_Int    (*precond_setup) ( void *vdata, void *A, void *b, void *x );
+
+} hypre_PipelinedPCGFunctions;
+
+/**
+ * The {\tt hypre\_PipelinedPCGData} object ...
+ **/
+
+/*
+ Summary of Parameters to Control Stopping Test:
+ - The default norm is the energy norm wrt the preconditioner, |r|=sqrt(<Cr,r>).
+   two_norm!=0 means: the norm is the L2 norm, |r|=sqrt(<r,r>); this adds a
+   third value to the reduction but no extra synchronization.
+ - Convergence test is |r| <= max(tol*|b|, a_tol).
+ - replace_period>0 means: every replace_period iterations, replace the
+   recurred vectors r, u = C r, w = A u, s = A p, q = C s and z = A q with
+   their explicitly computed values.  This limits the loss of accuracy that
+   the additional recurrences of the pipelined method are prone to, at the
+   cost of two preconditioner applications and three matvecs.
+*/
+
+typedef struct
+{
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Int    max_iter;
+   HYPRE_Int    two_norm;
+   HYPRE_Int    replace_period;
+   HYPRE_Int    converged;
+
+   void    *A;
+   void    *r;  /* residual */
+   void    *u;  /* C r */
+   void    *w;  /* A u */
+   void    *m;  /* C w */
+   void    *n;  /* A m */
+   void    *p;  /* search direction */
+   void    *s;  /* A p */
+   void    *q;  /* C s */
+   void    *z;  /* A q */
+
+   HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
+   void      *matvec_data;
+   void      *precond_data;
+
+   hypre_PipelinedPCGFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int    num_iterations;
+   HYPRE_Real   rel_residual_norm;
+
+   HYPRE_Int    print_level; /* printing when print_level>0 */
+   HYPRE_Int    logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+   HYPRE_Real  *rel_norms;
+
+} hypre_PipelinedPCGData;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name generic Pipelined PCG Solver
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+hypre_PipelinedPCGFunctions *
+hypre_PipelinedPCGFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Real   (*InnerProdLocal)( void *x, void *y ),
+   HYPRE_Int    (*IAllreduce)    ( void *A, HYPRE_Real *send_data, HYPRE_Real *recv_data,
+                                   HYPRE_Int count, hypre_MPI_Request *request ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   );
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+void *
+hypre_PipelinedPCGCreate( hypre_PipelinedPCGFunctions *pcg_functions );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
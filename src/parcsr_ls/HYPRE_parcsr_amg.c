@@ -1645,6 +1645,17 @@ HYPRE_BoomerAMGSetChebyEigEst( HYPRE_Solver  solver,
    return( hypre_BoomerAMGSetChebyEigEst( (void *) solver, eig_est ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyEigRefresh
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyEigRefresh( HYPRE_Solver  solver,
+                                   HYPRE_Int     eig_refresh )
+{
+   return( hypre_BoomerAMGSetChebyEigRefresh( (void *) solver, eig_refresh ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetInterpVectors
  *--------------------------------------------------------------------------*/
@@ -1851,6 +1862,28 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecision (HYPRE_Solver solver,
+                                  HYPRE_Int    mixed_precision)
+{
+   return (hypre_BoomerAMGSetMixedPrecision ( (void *) solver, mixed_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRefreshValues
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRefreshValues (HYPRE_Solver solver,
+                                 HYPRE_Int    refresh_values)
+{
+   return (hypre_BoomerAMGSetRefreshValues ( (void *) solver, refresh_values ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
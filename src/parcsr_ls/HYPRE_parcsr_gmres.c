@@ -32,6 +32,9 @@ HYPRE_ParCSRGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_GMRESFunctionsSetFusedOps(
+      gmres_functions, hypre_ParKrylovAxpyInnerProd,
+      hypre_ParKrylovInnerProd2, hypre_ParKrylovAxpby );
    *solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
@@ -107,6 +107,13 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
  * If used as a preconditioner, this function should be passed
  * to the iterative solver \e SetPrecond function.
  *
+ * b and x may also be multivectors stored row-wise (the values of all
+ * vectors at a row next to each other), to solve for a block of right hand
+ * sides at once.  This is available on the host for relaxation types 0, 3,
+ * 4, 6, 8, 13, 14 and 18 and for the coarse grid solvers 9, 99 and 199,
+ * with standard V/W-cycles.  Convergence is then reached when the relative
+ * residual of every right hand side is below the tolerance.
+ *
  * @param solver [IN] solver or preconditioner object to be applied.
  * @param A [IN] ParCSR matrix, matrix of the linear system to be solved
  * @param b [IN] right hand side of the linear system to be solved
@@ -731,6 +738,10 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 6  : hybrid symmetric Gauss-Seidel or SSOR
  *    - 8  : \f$\ell_1\f$-scaled hybrid symmetric Gauss-Seidel
  *    - 9  : Gaussian elimination (only on coarsest level)
+ *    - 11 : hybrid multicolor symmetric Gauss-Seidel; the local rows are
+ *           colored once per level during setup and the rows of a color
+ *           are relaxed by all threads at once, so the result does not
+ *           depend on the number of threads
  *    - 13 : \f$\ell_1\f$ Gauss-Seidel, forward solve
  *    - 14 : \f$\ell_1\f$ Gauss-Seidel, backward solve
  *    - 15 : CG (warning - not a fixed smoother - may require FGMRES)
@@ -889,6 +900,19 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                            HYPRE_Int   eig_est);
 
+/**
+ * (Optional) Defines how often the eigenvalue estimates of the Chebyshev
+ *  smoother are recomputed when HYPRE_BoomerAMGSetup is called again, e.g.
+ *  for a matrix whose values changed only slightly.  If eig_refresh is a
+ *  positive number n, the estimates are computed in every n-th setup and
+ *  reused in the setups in between; if eig_refresh=0, they are computed
+ *  once.  Estimates are only reused if the new hierarchy has the same
+ *  number of levels and level sizes.  The default is 1 (i.e., estimate
+ *  in every setup).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefresh (HYPRE_Solver solver,
+                                             HYPRE_Int    eig_refresh);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1111,9 +1135,19 @@ HYPRE_Int HYPRE_BoomerAMGSetPrintFileName(HYPRE_Solver  solver,
  *    - 2 : print solve information
  *    - 3 : print both setup and solve information
  *
+ * Adding 4 turns on a performance report: the wall clock time (maximum over
+ * the processes) and the number of messages and bytes sent (sum over the
+ * processes) on each level, for the strength, coarsening, interpolation and
+ * RAP phases of the setup and for the relaxation, restriction and
+ * interpolation phases of the cycle.  The setup part is printed at the end of
+ * the setup, the cycle part (accumulated over all solves since the setup)
+ * together with the solve information.  The report is not available for the
+ * additive cycles.
+ *
  * Note, that if one desires to print information and uses BoomerAMG as a
- * preconditioner, suggested \e print_level is 1 to avoid excessive output,
- * and use \e print_level of solver for solve phase information.
+ * preconditioner, suggested \e print_level is 1 (5 with the setup part of
+ * the performance report) to avoid excessive output, and use \e print_level
+ * of solver for solve phase information.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetPrintLevel(HYPRE_Solver solver,
                                        HYPRE_Int    print_level);
@@ -1167,6 +1201,41 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                       HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the values of the interpolation and restriction
+ * operators and of the coarse grid operators are stored in single precision
+ * at the end of the setup.  The index arrays, the fine grid matrix and all
+ * vectors stay in full precision, and all arithmetic is done in full
+ * precision.  This roughly halves the memory traffic of the V-cycle on the
+ * coarse levels.  A coarse grid operator is only converted if its smoother
+ * supports it (relax types 0, 3, 4, 6, 8, 13, 14 and 18, or Gaussian
+ * elimination on the coarsest level); otherwise it is kept in full
+ * precision.  Not available with block, additive or GPU cycles.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision(HYPRE_Solver solver,
+                                           HYPRE_Int    mixed_precision);
+
+/**
+ * (Optional) If set to 1, the setup keeps what it needs to be redone
+ * numerically: the strength matrices and the structure of the Galerkin
+ * products.  A later call of HYPRE_BoomerAMGSetup with a matrix that has
+ * the same sparsity pattern, but different values, then keeps the coarse
+ * grids and the sparsity patterns of the interpolation and coarse grid
+ * operators, and recomputes only their values.  The interpolation weights
+ * are computed with the same formula as in the first setup and restricted
+ * to the existing pattern of P (rescaled to the same row sums), so the
+ * hierarchy can differ slightly from a full setup when P was truncated.
+ * If the pattern of the matrix changed, a full setup is done.
+ * Only available on the host, for scalar problems with Galerkin coarse grid
+ * operators, interp types 0, 3, 6, 7, 8 and 12-18, and without aggressive
+ * coarsening, non-Galerkin coarse grids, additive cycles or dropping of
+ * small coarse entries; otherwise the option is ignored.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRefreshValues(HYPRE_Solver solver,
+                                          HYPRE_Int    refresh_values);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2458,6 +2527,80 @@ HYPRE_Int HYPRE_ParCSROnProcTriSolve(HYPRE_Solver       solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR Pipelined PCG Solver
+ *
+ * These routines should be used in conjunction with the generic interface in
+ * \ref KrylovSolvers.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGCreate(MPI_Comm      comm,
+                                         HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetup(HYPRE_Solver       solver,
+                                        HYPRE_ParCSRMatrix A,
+                                        HYPRE_ParVector    b,
+                                        HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSolve(HYPRE_Solver       solver,
+                                        HYPRE_ParCSRMatrix A,
+                                        HYPRE_ParVector    b,
+                                        HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTol(HYPRE_Solver solver,
+                                         HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetAbsoluteTol(HYPRE_Solver solver,
+                                                 HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetMaxIter(HYPRE_Solver solver,
+                                             HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTwoNorm(HYPRE_Solver solver,
+                                             HYPRE_Int    two_norm);
+
+/**
+ * (Optional) Replace the recurred residual and auxiliary vectors by their
+ * explicitly computed values every {\tt replace\_period} iterations.
+ **/
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetResidualReplacement(HYPRE_Solver solver,
+                                                         HYPRE_Int    replace_period);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrecond(HYPRE_Solver            solver,
+                                             HYPRE_PtrToParSolverFcn precond,
+                                             HYPRE_PtrToParSolverFcn precond_setup,
+                                             HYPRE_Solver            precond_solver);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetPrecond(HYPRE_Solver  solver,
+                                             HYPRE_Solver *precond_data);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetLogging(HYPRE_Solver solver,
+                                             HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrintLevel(HYPRE_Solver solver,
+                                                HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetNumIterations(HYPRE_Solver  solver,
+                                                   HYPRE_Int    *num_iterations);
+
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                               HYPRE_Real   *norm);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -2573,6 +2716,9 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS(HYPRE_Solver solver,
                                    HYPRE_Int    cgs);
 
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep(HYPRE_Solver solver,
+                                   HYPRE_Int    s_step);
+
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol(HYPRE_Solver solver,
                                   HYPRE_Real   tol);
 
@@ -4077,6 +4223,40 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
 HYPRE_Int
 HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int reordering_type );
 
+/**
+ * (Optional) Set how the triangular systems with the L and U factors are
+ * solved in each application of ILU.
+ *
+ * Options for \e tri_solve are:
+ *    - 1 : direct solves (default).  With more than one OpenMP thread, the
+ *          rows of the factors are grouped into levels during setup, and
+ *          the rows of a level are solved for concurrently.
+ *    - 0 : approximate solves with a fixed number of Jacobi iterations,
+ *          see HYPRE_ILUSetLowerJacobiIters and HYPRE_ILUSetUpperJacobiIters.
+ *          This is faster when the factors have many levels, at the cost of
+ *          a weaker preconditioner.
+ *
+ * The RAS variants (ilu_type 30 and 31) always use sequential direct solves.
+ * The option may be changed after setup; switching to 1 then gives
+ * sequential direct solves.
+ **/
+HYPRE_Int
+HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve );
+
+/**
+ * (Optional) Set the number of Jacobi iterations for the solve with L
+ * when tri_solve = 0.  The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetLowerJacobiIters( HYPRE_Solver solver, HYPRE_Int lower_jacobi_iters );
+
+/**
+ * (Optional) Set the number of Jacobi iterations for the solve with U
+ * when tri_solve = 0.  The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetUpperJacobiIters( HYPRE_Solver solver, HYPRE_Int upper_jacobi_iters );
+
 /**
  * (Optional) Set the print level to print setup and solve information.
  *
@@ -0,0 +1,206 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
+{
+   hypre_PipelinedPCGFunctions * pcg_functions;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   pcg_functions =
+      hypre_PipelinedPCGFunctionsCreate(
+         hypre_CAlloc, hypre_ParKrylovFree, hypre_ParKrylovCommInfo,
+         hypre_ParKrylovCreateVector,
+         hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
+         hypre_ParKrylovMatvec, hypre_ParKrylovMatvecDestroy,
+         hypre_ParKrylovInnerProd, hypre_ParKrylovInnerProdLocal,
+         hypre_ParKrylovIAllreduce, hypre_ParKrylovCopyVector,
+         hypre_ParKrylovClearVector, hypre_ParKrylovAxpy,
+         hypre_ParKrylovAxpby,
+         hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   *solver = ( (HYPRE_Solver) hypre_PipelinedPCGCreate( pcg_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGDestroy( HYPRE_Solver solver )
+{
+   return( hypre_PipelinedPCGDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetup( HYPRE_Solver solver,
+                               HYPRE_ParCSRMatrix A,
+                               HYPRE_ParVector b,
+                               HYPRE_ParVector x      )
+{
+   return( HYPRE_PipelinedPCGSetup( solver,
+                                    (HYPRE_Matrix) A,
+                                    (HYPRE_Vector) b,
+                                    (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSolve( HYPRE_Solver solver,
+                               HYPRE_ParCSRMatrix A,
+                               HYPRE_ParVector b,
+                               HYPRE_ParVector x      )
+{
+   return( HYPRE_PipelinedPCGSolve( solver,
+                                    (HYPRE_Matrix) A,
+                                    (HYPRE_Vector) b,
+                                    (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetTol( HYPRE_Solver solver,
+                                HYPRE_Real   tol    )
+{
+   return( HYPRE_PipelinedPCGSetTol( solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetAbsoluteTol( HYPRE_Solver solver,
+                                        HYPRE_Real   a_tol    )
+{
+   return( HYPRE_PipelinedPCGSetAbsoluteTol( solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetMaxIter( HYPRE_Solver solver,
+                                    HYPRE_Int    max_iter )
+{
+   return( HYPRE_PipelinedPCGSetMaxIter( solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetTwoNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetTwoNorm( HYPRE_Solver solver,
+                                    HYPRE_Int    two_norm )
+{
+   return( HYPRE_PipelinedPCGSetTwoNorm( solver, two_norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetResidualReplacement
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetResidualReplacement( HYPRE_Solver solver,
+                                                HYPRE_Int    replace_period )
+{
+   return( HYPRE_PipelinedPCGSetResidualReplacement( solver, replace_period ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetPrecond( HYPRE_Solver         solver,
+                                    HYPRE_PtrToParSolverFcn precond,
+                                    HYPRE_PtrToParSolverFcn precond_setup,
+                                    HYPRE_Solver         precond_solver )
+{
+   return( HYPRE_PipelinedPCGSetPrecond( solver,
+                                         (HYPRE_PtrToSolverFcn) precond,
+                                         (HYPRE_PtrToSolverFcn) precond_setup,
+                                         precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGGetPrecond( HYPRE_Solver  solver,
+                                    HYPRE_Solver *precond_data_ptr )
+{
+   return( HYPRE_PipelinedPCGGetPrecond( solver, precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetPrintLevel( HYPRE_Solver solver,
+                                       HYPRE_Int level )
+{
+   return( HYPRE_PipelinedPCGSetPrintLevel( solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGSetLogging( HYPRE_Solver solver,
+                                    HYPRE_Int level )
+{
+   return( HYPRE_PipelinedPCGSetLogging( solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGGetNumIterations( HYPRE_Solver  solver,
+                                          HYPRE_Int    *num_iterations )
+{
+   return( HYPRE_PipelinedPCGGetNumIterations( solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRPipelinedPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRPipelinedPCGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                                      HYPRE_Real   *norm   )
+{
+   return( HYPRE_PipelinedPCGGetFinalRelativeResidualNorm( solver, norm ) );
+}
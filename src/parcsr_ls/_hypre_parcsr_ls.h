@@ -30,6 +30,21 @@ typedef struct { HYPRE_Int prev; HYPRE_Int next; } Link;
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * Phases of the performance report (print_level & 4).  The first four are
+ * timed during the setup, the last three during the cycle.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_PHASE_NONE      -1
+#define HYPRE_AMG_PHASE_STRENGTH   0
+#define HYPRE_AMG_PHASE_COARSEN    1
+#define HYPRE_AMG_PHASE_INTERP     2
+#define HYPRE_AMG_PHASE_RAP        3
+#define HYPRE_AMG_PHASE_RELAX      4
+#define HYPRE_AMG_PHASE_RESTRICT   5
+#define HYPRE_AMG_PHASE_PROLONG    6
+#define HYPRE_AMG_NUM_PHASES       7
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -67,6 +82,9 @@ typedef struct
    HYPRE_Int      is_triangular;
    HYPRE_Int      gmres_switch;
    HYPRE_Int      agg_num_levels;
+   /* local number of entries of the untruncated product P1*P2 on each
+      level of aggressive coarsening (setup statistics) */
+   HYPRE_Real    *agg_P12_product_nnz;
    HYPRE_Int      num_paths;
    HYPRE_Int      post_interp_type;
    HYPRE_Int      num_CR_relax_steps;
@@ -127,6 +145,12 @@ typedef struct
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
 
+   /* multicolor Gauss-Seidel (relax_type 11): rows of the diagonal block
+      grouped by color, computed once per level in the setup */
+   HYPRE_Int           *num_colors;
+   HYPRE_Int          **color_offsets;
+   HYPRE_Int          **color_rows;
+
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
    hypre_ParCSRBlockMatrix **P_block_array;
@@ -164,6 +188,10 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_refresh;
+   HYPRE_Int            cheby_eig_age;        /* setups using the current estimates */
+   HYPRE_Int            cheby_eig_num_levels; /* levels of the current estimates ... */
+   HYPRE_BigInt        *cheby_eig_sizes;      /* ... and their global sizes */
 
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
@@ -195,6 +223,15 @@ typedef struct
 
    /* output params */
    HYPRE_Int      print_level;
+
+   /* performance report: wall clock time, messages and bytes sent per
+      level and phase, perf_data[(level*HYPRE_AMG_NUM_PHASES+phase)*3+k].
+      NULL unless print_level & 4 */
+   HYPRE_Real    *perf_data;
+   HYPRE_Int      perf_level;
+   HYPRE_Int      perf_phase;
+   HYPRE_Real     perf_start[3];
+
    char           log_file_name[256];
    HYPRE_Int      debug_flag;
 
@@ -252,6 +289,14 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* store coarse level operators in single precision */
+   HYPRE_Int mixed_precision;
+
+   /* numeric-only re-setup when the values of A change but not its pattern */
+   HYPRE_Int             refresh_values;
+   hypre_ParCSRMatrix  **S_array;
+   hypre_ParCSRRAPPlan **rap_plans;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -307,6 +352,7 @@ typedef struct
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
 #define hypre_ParAMGDataAggNumLevels(amg_data)         ((amg_data) -> agg_num_levels)
+#define hypre_ParAMGDataAggP12ProductNnz(amg_data)     ((amg_data) -> agg_P12_product_nnz)
 #define hypre_ParAMGDataPostInterpType(amg_data)       ((amg_data) -> post_interp_type)
 #define hypre_ParAMGDataNumCRRelaxSteps(amg_data)      ((amg_data) -> num_CR_relax_steps)
 #define hypre_ParAMGDataCRRate(amg_data)               ((amg_data) -> CR_rate)
@@ -316,6 +362,9 @@ typedef struct
 #define hypre_ParAMGDataISType(amg_data)               ((amg_data) -> IS_type)
 #define hypre_ParAMGDataCRUseCG(amg_data)              ((amg_data) -> CR_use_CG)
 #define hypre_ParAMGDataL1Norms(amg_data)              ((amg_data) -> l1_norms)
+#define hypre_ParAMGDataNumColors(amg_data)            ((amg_data) -> num_colors)
+#define hypre_ParAMGDataColorOffsets(amg_data)         ((amg_data) -> color_offsets)
+#define hypre_ParAMGDataColorRows(amg_data)            ((amg_data) -> color_rows)
 #define hypre_ParAMGDataCGCIts(amg_data)               ((amg_data) -> cgc_its)
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
@@ -399,6 +448,10 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigRefresh(amg_data) ((amg_data)->cheby_eig_refresh)
+#define hypre_ParAMGDataChebyEigAge(amg_data) ((amg_data)->cheby_eig_age)
+#define hypre_ParAMGDataChebyEigNumLevels(amg_data) ((amg_data)->cheby_eig_num_levels)
+#define hypre_ParAMGDataChebyEigSizes(amg_data) ((amg_data)->cheby_eig_sizes)
 
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
@@ -432,6 +485,10 @@ typedef struct
 
 /* output parameters */
 #define hypre_ParAMGDataPrintLevel(amg_data) ((amg_data)->print_level)
+#define hypre_ParAMGDataPerfData(amg_data) ((amg_data)->perf_data)
+#define hypre_ParAMGDataPerfLevel(amg_data) ((amg_data)->perf_level)
+#define hypre_ParAMGDataPerfPhase(amg_data) ((amg_data)->perf_phase)
+#define hypre_ParAMGDataPerfStart(amg_data) ((amg_data)->perf_start)
 #define hypre_ParAMGDataLogFileName(amg_data) ((amg_data)->log_file_name)
 #define hypre_ParAMGDataDebugFlag(amg_data)   ((amg_data)->debug_flag)
 
@@ -493,6 +550,10 @@ typedef struct
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataRefreshValues(amg_data) ((amg_data)->refresh_values)
+#define hypre_ParAMGDataSArray(amg_data) ((amg_data)->S_array)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
 
 /*indices for the dof which will keep coarsening to the coarse level */
@@ -1187,6 +1248,7 @@ HYPRE_Int HYPRE_BoomerAMGGetGridHierarchy(HYPRE_Solver solver, HYPRE_Int *cgrid
 HYPRE_Int HYPRE_BoomerAMGSetChebyOrder ( HYPRE_Solver solver , HYPRE_Int order );
 HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver , HYPRE_Real ratio );
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver , HYPRE_Int eig_est );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigRefresh ( HYPRE_Solver solver , HYPRE_Int eig_refresh );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver , HYPRE_Int scale );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver , HYPRE_Int num_vectors , HYPRE_ParVector *vectors );
@@ -1209,6 +1271,8 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver , HYPRE_Int nonga
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver , HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver , HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver , HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecision ( HYPRE_Solver solver , HYPRE_Int mixed_precision );
+HYPRE_Int HYPRE_BoomerAMGSetRefreshValues ( HYPRE_Solver solver , HYPRE_Int refresh_values );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver , HYPRE_Int slu_threshold );
 #endif
@@ -1344,6 +1408,7 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A
 HYPRE_Int HYPRE_ParCSRCOGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS2 ( HYPRE_Solver solver , HYPRE_Int cgs2 );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
@@ -1514,6 +1579,23 @@ HYPRE_Int HYPRE_ParCSRPilutSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter
 HYPRE_Int HYPRE_ParCSRPilutSetDropTolerance ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRPilutSetFactorRowSize ( HYPRE_Solver solver , HYPRE_Int size );
 
+/* HYPRE_parcsr_pipelinedpcg.c */
+HYPRE_Int HYPRE_ParCSRPipelinedPCGCreate ( MPI_Comm comm , HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetTwoNorm ( HYPRE_Solver solver , HYPRE_Int two_norm );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetResidualReplacement ( HYPRE_Solver solver , HYPRE_Int replace_period );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRPipelinedPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+
 /* HYPRE_parcsr_schwarz.c */
 HYPRE_Int HYPRE_SchwarzCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_SchwarzDestroy ( HYPRE_Solver solver );
@@ -1533,6 +1615,9 @@ HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
 
+/* par_agg_interp.c */
+HYPRE_Int hypre_BoomerAMGBuildTwoStageInterp ( hypre_ParCSRMatrix *P1 , hypre_ParCSRMatrix *P2 , HYPRE_Real trunc_factor , HYPRE_Int max_elmts , HYPRE_Real *product_nnz_ptr , hypre_ParCSRMatrix **P_ptr );
+
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
 HYPRE_Int hypre_BoomerAMGDestroy ( void *data );
@@ -1693,6 +1778,7 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data , HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data , HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data , HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data , HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyEigRefresh ( void *data , HYPRE_Int cheby_eig_refresh );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver , HYPRE_Int num_vectors , hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver , HYPRE_Int var );
 HYPRE_Int hypre_BoomerAMGSetInterpVecQMax ( void *data , HYPRE_Int q_max );
@@ -1713,12 +1799,19 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data , HYPRE_Int nongalerk_num_
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data , HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data , HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data , HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecision ( void *data , HYPRE_Int mixed_precision );
+HYPRE_Int hypre_BoomerAMGSetRefreshValues ( void *data , HYPRE_Int refresh_values );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data , HYPRE_Int slu_threshold );
 #endif
 HYPRE_Int hypre_BoomerAMGSetCPoints( void *data, HYPRE_Int cpt_coarse_level, HYPRE_Int  num_cpt_coarse, HYPRE_BigInt *cpt_coarse_index );
 HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int num_points, HYPRE_BigInt *indices );
 
+/* par_amg_refresh.c */
+HYPRE_Int hypre_BoomerAMGRefreshDataDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGRefreshCreatePlans ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGRefreshLevels ( void *amg_vdata , HYPRE_Int interp_type , HYPRE_Int sep_weight );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
@@ -1745,7 +1838,7 @@ HYPRE_Int hypre_Bisection ( HYPRE_Int n , HYPRE_Real *diag , HYPRE_Real *offd ,
 
 /* par_cheby.c */
 HYPRE_Int hypre_ParCSRRelax_Cheby_Setup ( hypre_ParCSRMatrix *A , HYPRE_Real max_eig , HYPRE_Real min_eig , HYPRE_Real fraction , HYPRE_Int order , HYPRE_Int scale , HYPRE_Int variant , HYPRE_Real **coefs_ptr , HYPRE_Real **ds_ptr );
-HYPRE_Int hypre_ParCSRRelax_Cheby_Solve ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Real *ds_data , HYPRE_Real *coefs , HYPRE_Int order , HYPRE_Int scale , HYPRE_Int variant , hypre_ParVector *u , hypre_ParVector *v , hypre_ParVector *r );
+HYPRE_Int hypre_ParCSRRelax_Cheby_Solve ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Real *ds_data , HYPRE_Real *coefs , HYPRE_Int order , HYPRE_Int scale , HYPRE_Int variant , hypre_ParVector *u , hypre_ParVector *v , hypre_ParVector *r , hypre_ParVector *z );
 
 /* par_coarsen.c */
 HYPRE_Int hypre_BoomerAMGCoarsen ( hypre_ParCSRMatrix *S , hypre_ParCSRMatrix *A , HYPRE_Int CF_init , HYPRE_Int debug_flag , HYPRE_Int **CF_marker_ptr );
@@ -1803,6 +1896,7 @@ HYPRE_Int hypre_BoomerAMGBuildInterpGSMG ( hypre_ParCSRMatrix *A , HYPRE_Int *CF
 /* par_indepset.c */
 HYPRE_Int hypre_BoomerAMGIndepSetInit ( hypre_ParCSRMatrix *S , HYPRE_Real *measure_array , HYPRE_Int seq_rand );
 HYPRE_Int hypre_BoomerAMGIndepSet ( hypre_ParCSRMatrix *S , HYPRE_Real *measure_array , HYPRE_Int *graph_array , HYPRE_Int graph_array_size , HYPRE_Int *graph_array_offd , HYPRE_Int graph_array_offd_size , HYPRE_Int *IS_marker , HYPRE_Int *IS_marker_offd );
+HYPRE_Int hypre_BoomerAMGIndepSetThreaded ( hypre_ParCSRMatrix *S , hypre_CSRMatrix *ST_diag , hypre_CSRMatrix *ST_offd , HYPRE_Real *measure_array , HYPRE_Int *graph_array , HYPRE_Int graph_array_size , HYPRE_Int *graph_array_offd , HYPRE_Int graph_array_offd_size , HYPRE_Int *IS_marker , HYPRE_Int *IS_marker_offd );
 
 HYPRE_Int hypre_BoomerAMGIndepSetInitDevice( hypre_ParCSRMatrix *S, HYPRE_Real *measure_array, HYPRE_Int aug_rand);
 
@@ -1815,6 +1909,7 @@ HYPRE_Int hypre_BoomerAMGBuildDirInterp ( hypre_ParCSRMatrix *A , HYPRE_Int *CF_
 HYPRE_Int hypre_BoomerAMGBuildDirInterpDevice( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker , hypre_ParCSRMatrix *S , HYPRE_BigInt *num_cpts_global , HYPRE_Int num_functions , HYPRE_Int *dof_func , HYPRE_Int debug_flag , HYPRE_Real trunc_factor , HYPRE_Int max_elmts , HYPRE_Int *col_offd_S_to_A , HYPRE_Int interp_type, hypre_ParCSRMatrix **P_ptr );
 
 HYPRE_Int hypre_BoomerAMGInterpTruncation ( hypre_ParCSRMatrix *P, HYPRE_Real trunc_factor, HYPRE_Int max_elmts );
+HYPRE_Int hypre_BoomerAMGInterpTruncationRow ( HYPRE_Real trunc_factor , HYPRE_Int max_elmts , HYPRE_Int num_cols_diag , HYPRE_Int *diag_size , HYPRE_Int *diag_j , HYPRE_Real *diag_data , HYPRE_Int *offd_size , HYPRE_Int *offd_j , HYPRE_Real *offd_data , HYPRE_Int *aux_j , HYPRE_Real *aux_data );
 HYPRE_Int hypre_BoomerAMGInterpTruncationDevice( hypre_ParCSRMatrix *P, HYPRE_Real trunc_factor, HYPRE_Int max_elmts );
 
 HYPRE_Int hypre_BoomerAMGBuildInterpModUnk ( hypre_ParCSRMatrix *A , HYPRE_Int *CF_marker , hypre_ParCSRMatrix *S , HYPRE_BigInt *num_cpts_global , HYPRE_Int num_functions , HYPRE_Int *dof_func , HYPRE_Int debug_flag , HYPRE_Real trunc_factor , HYPRE_Int max_elmts , HYPRE_Int *col_offd_S_to_A , hypre_ParCSRMatrix **P_ptr );
@@ -1907,6 +2002,18 @@ HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HY
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 
+/* par_relax_flt.c */
+HYPRE_Int hypre_BoomerAMGRelaxFltSupported ( HYPRE_Int relax_type );
+HYPRE_Int hypre_BoomerAMGRelaxFlt ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
+/* par_relax_multi.c */
+HYPRE_Int hypre_BoomerAMGRelaxMultiSupported ( HYPRE_Int relax_type );
+HYPRE_Int hypre_BoomerAMGRelaxMulti ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_BoomerAMGMulticolorSetup ( hypre_ParCSRMatrix *A , HYPRE_Int *num_colors_ptr , HYPRE_Int **color_offsets_ptr , HYPRE_Int **color_rows_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorGS ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Int num_colors , HYPRE_Int *color_offsets , HYPRE_Int *color_rows , hypre_ParVector *u );
+
 /* par_relax_interface.c */
 HYPRE_Int hypre_BoomerAMGRelaxIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
 
@@ -1946,6 +2053,8 @@ HYPRE_Int hypre_SchwarzSetDofFunc ( void *data , HYPRE_Int *dof_func );
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata , hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
+HYPRE_Int hypre_BoomerAMGPerfPhase ( void *amg_vdata , HYPRE_Int level , HYPRE_Int phase );
+HYPRE_Int hypre_BoomerAMGPerfPrint ( void *amg_vdata , MPI_Comm comm , HYPRE_Int setup );
 
 /* par_strength.c */
 HYPRE_Int hypre_BoomerAMGCreateS ( hypre_ParCSRMatrix *A , HYPRE_Real strength_threshold , HYPRE_Real max_row_sum , HYPRE_Int num_functions , HYPRE_Int *dof_func , hypre_ParCSRMatrix **S_ptr );
@@ -2014,10 +2123,17 @@ HYPRE_Real hypre_ParKrylovInnerProd ( void *x , void *y );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x , void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x , void *y , void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
+HYPRE_Real hypre_ParKrylovInnerProdLocal ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovMassInnerProdLocal ( void *x , void **y , HYPRE_Int k , HYPRE_Int unroll , void *result );
+HYPRE_Int hypre_ParKrylovAllreduce ( void *A , HYPRE_Real *send_data , HYPRE_Real *recv_data , HYPRE_Int count );
+HYPRE_Int hypre_ParKrylovIAllreduce ( void *A , HYPRE_Real *send_data , HYPRE_Real *recv_data , HYPRE_Int count , hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha , void *x );
 HYPRE_Int hypre_ParKrylovAxpy ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Real hypre_ParKrylovAxpyInnerProd ( HYPRE_Complex alpha , void *x , void *y , void *z );
+HYPRE_Int hypre_ParKrylovInnerProd2 ( void *x , void *y , void *z , HYPRE_Real *result );
+HYPRE_Int hypre_ParKrylovAxpby ( HYPRE_Complex alpha , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_ParKrylovCommInfo ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
 HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata , void *A , void *b , void *x );
@@ -2156,6 +2272,9 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve );
+HYPRE_Int hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters );
+HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -2192,6 +2311,8 @@ HYPRE_Int hypre_ILUGetPermddPQ(hypre_ParCSRMatrix *A, HYPRE_Int **pperm, HYPRE_I
 HYPRE_Int hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUWriteSolverParams(void *ilu_vdata);
+HYPRE_Int hypre_ILUBuildLevelSchedule(HYPRE_Int n, HYPRE_Int *A_i, HYPRE_Int *A_end, HYPRE_Int *A_j, HYPRE_Int lower, HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr, HYPRE_Int **level_rows_ptr);
+HYPRE_Int hypre_ILUSetupTriSolve(void *ilu_vdata, HYPRE_Int nLU, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUBuildRASExternalMatrix(hypre_ParCSRMatrix *A, HYPRE_Int *rperm, HYPRE_Int **E_i, HYPRE_Int **E_j, HYPRE_Real **E_data);
 HYPRE_Int hypre_ILUSetupILU0(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
@@ -2201,9 +2322,11 @@ HYPRE_Int hypre_ILUSetupILU0RAS(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_In
 HYPRE_Int hypre_ILUSetupILUKRASSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i, HYPRE_Int *A_offd_j, HYPRE_Int *E_i, HYPRE_Int *E_j, HYPRE_Int ext, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j);
 HYPRE_Int hypre_ILUSetupILUKRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUTRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
-HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *utemp, hypre_ParVector *ftemp);
-HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
-HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
+HYPRE_Int hypre_ILUSolveLower(void *ilu_vdata, HYPRE_Int nLU, hypre_CSRMatrix *L_diag, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Real *f_data, HYPRE_Real *x_data);
+HYPRE_Int hypre_ILUSolveUpper(void *ilu_vdata, HYPRE_Int nLU, hypre_CSRMatrix *U_diag, HYPRE_Int *u_end, HYPRE_Real *D, HYPRE_Int *qperm, HYPRE_Real *x_data);
+HYPRE_Int hypre_ILUSolveLU(void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *utemp, hypre_ParVector *ftemp);
+HYPRE_Int hypre_ILUSolveSchurGMRES(void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
+HYPRE_Int hypre_ILUSolveSchurNSH(void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext);
 HYPRE_Int hypre_ILUSetSchurNSHDropThreshold( void *ilu_vdata, HYPRE_Real threshold);
 HYPRE_Int hypre_ILUSetSchurNSHDropThresholdArray( void *ilu_vdata, HYPRE_Real *threshold);
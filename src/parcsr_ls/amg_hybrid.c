@@ -1859,6 +1859,9 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_PCGFunctionsSetFusedOps(
+               pcg_functions, hypre_ParKrylovAxpyInnerProd,
+               hypre_ParKrylovInnerProd2, hypre_ParKrylovAxpby );
             pcg_solver = hypre_PCGCreate( pcg_functions );
 
             hypre_PCGSetTol(pcg_solver, tol);
@@ -1926,6 +1929,9 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_GMRESFunctionsSetFusedOps(
+               gmres_functions, hypre_ParKrylovAxpyInnerProd,
+               hypre_ParKrylovInnerProd2, hypre_ParKrylovAxpby );
             pcg_solver = hypre_GMRESCreate( gmres_functions );
 
             hypre_GMRESSetTol(pcg_solver, tol);
@@ -548,6 +548,10 @@ HYPRE_Int hypre_ParCSRMatrixFixZeroRows(hypre_ParCSRMatrix *A)
       }
    }
 
+   /* the values may have changed in place: drop the SELL copies */
+   hypre_CSRMatrixSELLInvalidate(A_diag);
+   hypre_CSRMatrixSELLInvalidate(A_offd);
+
    return hypre_error_flag;
 }
 
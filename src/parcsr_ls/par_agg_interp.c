@@ -0,0 +1,521 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Two-stage interpolation for aggressive coarsening
+ *
+ * The interpolation on a level of aggressive coarsening is P = P1*P2, where
+ * P1 interpolates from the first-stage C-points and P2 from the second-stage
+ * C-points to the first-stage ones.  The product is usually much denser than
+ * the truncated P that is kept, so instead of forming P1*P2 with
+ * hypre_ParMatmul and truncating it afterwards, each row of the product is
+ * formed in a row buffer and truncated right away.  The untruncated product
+ * is never stored.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGBuildTwoStageInterp
+ *
+ * Computes P = P1*P2 and truncates its rows with trunc_factor and
+ * max_elmts as hypre_BoomerAMGInterpTruncation would.  On return,
+ * *product_nnz_ptr is the local number of entries of the untruncated
+ * product, i.e., the number of entries the product would have had.  P does
+ * not own its row and column partitionings (those of P1 and P2).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGBuildTwoStageInterp( hypre_ParCSRMatrix  *P1,
+                                    hypre_ParCSRMatrix  *P2,
+                                    HYPRE_Real           trunc_factor,
+                                    HYPRE_Int            max_elmts,
+                                    HYPRE_Real          *product_nnz_ptr,
+                                    hypre_ParCSRMatrix **P_ptr )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(P1);
+
+   hypre_CSRMatrix *P1_diag      = hypre_ParCSRMatrixDiag(P1);
+   HYPRE_Real      *P1_diag_data = hypre_CSRMatrixData(P1_diag);
+   HYPRE_Int       *P1_diag_i    = hypre_CSRMatrixI(P1_diag);
+   HYPRE_Int       *P1_diag_j    = hypre_CSRMatrixJ(P1_diag);
+   hypre_CSRMatrix *P1_offd      = hypre_ParCSRMatrixOffd(P1);
+   HYPRE_Real      *P1_offd_data = hypre_CSRMatrixData(P1_offd);
+   HYPRE_Int       *P1_offd_i    = hypre_CSRMatrixI(P1_offd);
+   HYPRE_Int       *P1_offd_j    = hypre_CSRMatrixJ(P1_offd);
+   HYPRE_Int        n_fine       = hypre_CSRMatrixNumRows(P1_diag);
+   HYPRE_Int        num_cols_P1_offd = hypre_CSRMatrixNumCols(P1_offd);
+
+   hypre_CSRMatrix *P2_diag      = hypre_ParCSRMatrixDiag(P2);
+   HYPRE_Real      *P2_diag_data = hypre_CSRMatrixData(P2_diag);
+   HYPRE_Int       *P2_diag_i    = hypre_CSRMatrixI(P2_diag);
+   HYPRE_Int       *P2_diag_j    = hypre_CSRMatrixJ(P2_diag);
+   hypre_CSRMatrix *P2_offd      = hypre_ParCSRMatrixOffd(P2);
+   HYPRE_Real      *P2_offd_data = hypre_CSRMatrixData(P2_offd);
+   HYPRE_Int       *P2_offd_i    = hypre_CSRMatrixI(P2_offd);
+   HYPRE_Int       *P2_offd_j    = hypre_CSRMatrixJ(P2_offd);
+   HYPRE_BigInt    *col_map_offd_P2 = hypre_ParCSRMatrixColMapOffd(P2);
+   HYPRE_Int        n_coarse     = hypre_CSRMatrixNumCols(P2_diag);
+   HYPRE_Int        num_cols_P2_offd = hypre_CSRMatrixNumCols(P2_offd);
+   HYPRE_BigInt     first_col    = hypre_ParCSRMatrixFirstColDiag(P2);
+   HYPRE_BigInt     last_col     = first_col + (HYPRE_BigInt) n_coarse - 1;
+
+   /* rows of P2 that belong to the off-processor columns of P1; the column
+      indices are local: c < n_coarse for the diagonal part, n_coarse + k
+      for column k of the off-diagonal part of P */
+   hypre_CSRMatrix *P2_ext = NULL;
+   HYPRE_Real      *P2_ext_data = NULL;
+   HYPRE_Int       *P2_ext_i = NULL;
+   HYPRE_Int       *P2_ext_j = NULL;
+   HYPRE_BigInt    *P2_ext_big_j = NULL;
+   HYPRE_Int        P2_ext_size = 0;
+
+   hypre_ParCSRMatrix *P;
+   hypre_CSRMatrix    *P_diag, *P_offd;
+   HYPRE_Real         *P_diag_data = NULL, *P_offd_data = NULL;
+   HYPRE_Int          *P_diag_i, *P_diag_j = NULL;
+   HYPRE_Int          *P_offd_i, *P_offd_j = NULL;
+   HYPRE_Int           P_diag_size = 0, P_offd_size = 0;
+   HYPRE_BigInt       *col_map_offd_P = NULL;
+   HYPRE_Int           num_cols_P_offd = 0;
+   HYPRE_Int          *map_P2_to_P = NULL;
+
+   HYPRE_Int           truncate = (trunc_factor > 0.0 || max_elmts > 0);
+   HYPRE_Real          product_nnz = 0.0;
+   HYPRE_Int          *prefix_sum_workspace;
+   HYPRE_BigInt       *big_buf;
+   HYPRE_Int           num_procs, i, j, cnt;
+
+   HYPRE_MemoryLocation memory_location_P = hypre_ParCSRMatrixMemoryLocation(P1);
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Get the rows of P2 needed for the off-processor columns of P1 and set
+    * up the off-diagonal columns of P
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      P2_ext       = hypre_ParCSRMatrixExtractBExt(P2, P1, 1);
+      P2_ext_data  = hypre_CSRMatrixData(P2_ext);
+      P2_ext_i     = hypre_CSRMatrixI(P2_ext);
+      P2_ext_big_j = hypre_CSRMatrixBigJ(P2_ext);
+      P2_ext_size  = P2_ext_i[num_cols_P1_offd];
+   }
+
+   cnt = 0;
+   big_buf = hypre_TAlloc(HYPRE_BigInt, P2_ext_size + num_cols_P2_offd, HYPRE_MEMORY_HOST);
+   for (i = 0; i < P2_ext_size; i++)
+   {
+      if (P2_ext_big_j[i] < first_col || P2_ext_big_j[i] > last_col)
+      {
+         big_buf[cnt++] = P2_ext_big_j[i];
+      }
+   }
+   for (i = 0; i < num_cols_P2_offd; i++)
+   {
+      big_buf[cnt++] = col_map_offd_P2[i];
+   }
+   if (cnt)
+   {
+      hypre_BigQsort0(big_buf, 0, cnt-1);
+      num_cols_P_offd = 1;
+      for (i = 1; i < cnt; i++)
+      {
+         if (big_buf[i] > big_buf[num_cols_P_offd-1])
+         {
+            big_buf[num_cols_P_offd++] = big_buf[i];
+         }
+      }
+      col_map_offd_P = hypre_TAlloc(HYPRE_BigInt, num_cols_P_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_P_offd; i++)
+      {
+         col_map_offd_P[i] = big_buf[i];
+      }
+   }
+   hypre_TFree(big_buf, HYPRE_MEMORY_HOST);
+
+   if (P2_ext_size)
+   {
+      P2_ext_j = hypre_TAlloc(HYPRE_Int, P2_ext_size, HYPRE_MEMORY_HOST);
+   }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < P2_ext_size; i++)
+   {
+      if (P2_ext_big_j[i] < first_col || P2_ext_big_j[i] > last_col)
+      {
+         P2_ext_j[i] = n_coarse + hypre_BigBinarySearch(col_map_offd_P, P2_ext_big_j[i],
+                                                         num_cols_P_offd);
+      }
+      else
+      {
+         P2_ext_j[i] = (HYPRE_Int)(P2_ext_big_j[i] - first_col);
+      }
+   }
+   if (P2_ext)
+   {
+      /* the global column indices are no longer needed */
+      hypre_TFree(hypre_CSRMatrixBigJ(P2_ext), hypre_CSRMatrixMemoryLocation(P2_ext));
+      hypre_CSRMatrixBigJ(P2_ext) = NULL;
+   }
+
+   if (num_cols_P2_offd)
+   {
+      map_P2_to_P = hypre_TAlloc(HYPRE_Int, num_cols_P2_offd, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_P2_offd; i++)
+      {
+         map_P2_to_P[i] = n_coarse + hypre_BigBinarySearch(col_map_offd_P, col_map_offd_P2[i],
+                                                            num_cols_P_offd);
+      }
+   }
+
+   P_diag_i = hypre_CTAlloc(HYPRE_Int, n_fine+1, memory_location_P);
+   P_offd_i = hypre_CTAlloc(HYPRE_Int, n_fine+1, memory_location_P);
+   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, 2*(hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Form the rows of P1*P2 one at a time.  Each thread collects its
+    * (truncated) rows in its own arrays; these are copied into P at the end.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j)
+#endif
+   {
+      HYPRE_Int   start, stop, jj, kk, k, col, row_size;
+      HYPRE_Int   max_row = 0;
+      HYPRE_Int   jj_diag = 0, jj_offd = 0;
+      HYPRE_Int   row_begin_diag, row_begin_offd;
+      HYPRE_Int   row_diag_size, row_offd_size;
+      HYPRE_Int   cnt_diag = 0, cnt_offd = 0;
+      HYPRE_Int   cap_diag = 0, cap_offd = 0;
+      HYPRE_Int   diag_start, offd_start;
+      HYPRE_Int  *marker;
+      HYPRE_Int  *row_diag_j, *row_offd_j, *aux_j = NULL;
+      HYPRE_Real *row_diag_data, *row_offd_data, *aux_data = NULL;
+      HYPRE_Int  *thread_diag_j, *thread_offd_j;
+      HYPRE_Real *thread_diag_data, *thread_offd_data;
+      HYPRE_Real  a_entry, my_product_nnz = 0.0;
+
+      hypre_GetSimpleThreadPartition(&start, &stop, n_fine);
+
+      /* bound on the length of the rows of the product */
+      for (i = start; i < stop; i++)
+      {
+         row_size = 0;
+         for (jj = P1_diag_i[i]; jj < P1_diag_i[i+1]; jj++)
+         {
+            k = P1_diag_j[jj];
+            row_size += P2_diag_i[k+1] - P2_diag_i[k] + P2_offd_i[k+1] - P2_offd_i[k];
+         }
+         for (jj = P1_offd_i[i]; jj < P1_offd_i[i+1]; jj++)
+         {
+            k = P1_offd_j[jj];
+            row_size += P2_ext_i[k+1] - P2_ext_i[k];
+         }
+         row_size = hypre_min(row_size, n_coarse + num_cols_P_offd);
+         max_row = hypre_max(max_row, row_size);
+         if (max_elmts > 0)
+         {
+            /* a truncated row has at most max_elmts entries */
+            cap_diag += hypre_min(row_size, max_elmts);
+         }
+      }
+      if (max_elmts <= 0)
+      {
+         cap_diag = stop - start + max_row;
+      }
+      cap_offd = cap_diag;
+
+      marker        = hypre_TAlloc(HYPRE_Int,  n_coarse + num_cols_P_offd, HYPRE_MEMORY_HOST);
+      row_diag_j    = hypre_TAlloc(HYPRE_Int,  max_row, HYPRE_MEMORY_HOST);
+      row_diag_data = hypre_TAlloc(HYPRE_Real, max_row, HYPRE_MEMORY_HOST);
+      row_offd_j    = hypre_TAlloc(HYPRE_Int,  max_row, HYPRE_MEMORY_HOST);
+      row_offd_data = hypre_TAlloc(HYPRE_Real, max_row, HYPRE_MEMORY_HOST);
+      if (max_elmts > 0)
+      {
+         aux_j    = hypre_TAlloc(HYPRE_Int,  max_row, HYPRE_MEMORY_HOST);
+         aux_data = hypre_TAlloc(HYPRE_Real, max_row, HYPRE_MEMORY_HOST);
+      }
+      thread_diag_j    = hypre_TAlloc(HYPRE_Int,  cap_diag, HYPRE_MEMORY_HOST);
+      thread_diag_data = hypre_TAlloc(HYPRE_Real, cap_diag, HYPRE_MEMORY_HOST);
+      thread_offd_j    = hypre_TAlloc(HYPRE_Int,  cap_offd, HYPRE_MEMORY_HOST);
+      thread_offd_data = hypre_TAlloc(HYPRE_Real, cap_offd, HYPRE_MEMORY_HOST);
+
+      for (k = 0; k < n_coarse + num_cols_P_offd; k++)
+      {
+         marker[k] = -1;
+      }
+
+      for (i = start; i < stop; i++)
+      {
+         /* marker[col] >= row_begin_diag (row_begin_offd) means that the
+            entry for col is in the row buffer at position
+            marker[col] - row_begin_diag (row_begin_offd) */
+         row_begin_diag = jj_diag;
+         row_begin_offd = jj_offd;
+
+         /* the entries are formed in the same order as in hypre_ParMatmul */
+         for (jj = P1_offd_i[i]; jj < P1_offd_i[i+1]; jj++)
+         {
+            k = P1_offd_j[jj];
+            a_entry = P1_offd_data[jj];
+            for (kk = P2_ext_i[k]; kk < P2_ext_i[k+1]; kk++)
+            {
+               col = P2_ext_j[kk];
+               if (col < n_coarse)
+               {
+                  if (marker[col] < row_begin_diag)
+                  {
+                     marker[col] = jj_diag;
+                     row_diag_j[jj_diag - row_begin_diag] = col;
+                     row_diag_data[jj_diag - row_begin_diag] = a_entry*P2_ext_data[kk];
+                     jj_diag++;
+                  }
+                  else
+                  {
+                     row_diag_data[marker[col] - row_begin_diag] += a_entry*P2_ext_data[kk];
+                  }
+               }
+               else
+               {
+                  if (marker[col] < row_begin_offd)
+                  {
+                     marker[col] = jj_offd;
+                     row_offd_j[jj_offd - row_begin_offd] = col - n_coarse;
+                     row_offd_data[jj_offd - row_begin_offd] = a_entry*P2_ext_data[kk];
+                     jj_offd++;
+                  }
+                  else
+                  {
+                     row_offd_data[marker[col] - row_begin_offd] += a_entry*P2_ext_data[kk];
+                  }
+               }
+            }
+         }
+
+         for (jj = P1_diag_i[i]; jj < P1_diag_i[i+1]; jj++)
+         {
+            k = P1_diag_j[jj];
+            a_entry = P1_diag_data[jj];
+            for (kk = P2_diag_i[k]; kk < P2_diag_i[k+1]; kk++)
+            {
+               col = P2_diag_j[kk];
+               if (marker[col] < row_begin_diag)
+               {
+                  marker[col] = jj_diag;
+                  row_diag_j[jj_diag - row_begin_diag] = col;
+                  row_diag_data[jj_diag - row_begin_diag] = a_entry*P2_diag_data[kk];
+                  jj_diag++;
+               }
+               else
+               {
+                  row_diag_data[marker[col] - row_begin_diag] += a_entry*P2_diag_data[kk];
+               }
+            }
+            for (kk = P2_offd_i[k]; kk < P2_offd_i[k+1]; kk++)
+            {
+               col = map_P2_to_P[P2_offd_j[kk]];
+               if (marker[col] < row_begin_offd)
+               {
+                  marker[col] = jj_offd;
+                  row_offd_j[jj_offd - row_begin_offd] = col - n_coarse;
+                  row_offd_data[jj_offd - row_begin_offd] = a_entry*P2_offd_data[kk];
+                  jj_offd++;
+               }
+               else
+               {
+                  row_offd_data[marker[col] - row_begin_offd] += a_entry*P2_offd_data[kk];
+               }
+            }
+         }
+
+         row_diag_size = jj_diag - row_begin_diag;
+         row_offd_size = jj_offd - row_begin_offd;
+         my_product_nnz += (HYPRE_Real) (row_diag_size + row_offd_size);
+
+         if (truncate)
+         {
+            hypre_BoomerAMGInterpTruncationRow(trunc_factor, max_elmts, n_coarse,
+                                               &row_diag_size, row_diag_j, row_diag_data,
+                                               &row_offd_size, row_offd_j, row_offd_data,
+                                               aux_j, aux_data);
+         }
+
+         if (cnt_diag + row_diag_size > cap_diag)
+         {
+            cap_diag = hypre_max(2*cap_diag, cnt_diag + row_diag_size);
+            thread_diag_j    = hypre_TReAlloc(thread_diag_j,    HYPRE_Int,  cap_diag, HYPRE_MEMORY_HOST);
+            thread_diag_data = hypre_TReAlloc(thread_diag_data, HYPRE_Real, cap_diag, HYPRE_MEMORY_HOST);
+         }
+         if (cnt_offd + row_offd_size > cap_offd)
+         {
+            cap_offd = hypre_max(2*cap_offd, cnt_offd + row_offd_size);
+            thread_offd_j    = hypre_TReAlloc(thread_offd_j,    HYPRE_Int,  cap_offd, HYPRE_MEMORY_HOST);
+            thread_offd_data = hypre_TReAlloc(thread_offd_data, HYPRE_Real, cap_offd, HYPRE_MEMORY_HOST);
+         }
+
+         P_diag_i[i] = cnt_diag;
+         P_offd_i[i] = cnt_offd;
+         for (jj = 0; jj < row_diag_size; jj++)
+         {
+            thread_diag_j[cnt_diag]      = row_diag_j[jj];
+            thread_diag_data[cnt_diag++] = row_diag_data[jj];
+         }
+         for (jj = 0; jj < row_offd_size; jj++)
+         {
+            thread_offd_j[cnt_offd]      = row_offd_j[jj];
+            thread_offd_data[cnt_offd++] = row_offd_data[jj];
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_offd_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(aux_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(aux_data, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic
+#endif
+      product_nnz += my_product_nnz;
+
+      /*--------------------------------------------------------------------
+       * Copy the thread parts into P
+       *--------------------------------------------------------------------*/
+
+      diag_start = cnt_diag;
+      offd_start = cnt_offd;
+      hypre_prefix_sum_pair(&diag_start, &P_diag_size, &offd_start, &P_offd_size,
+                            prefix_sum_workspace);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp master
+#endif
+      {
+         /* the external rows of P2 are not needed anymore */
+         hypre_CSRMatrixDestroy(P2_ext);
+         hypre_TFree(P2_ext_j, HYPRE_MEMORY_HOST);
+         P2_ext = NULL;
+         P2_ext_j = NULL;
+
+         P_diag_i[n_fine] = P_diag_size;
+         P_offd_i[n_fine] = P_offd_size;
+         if (P_diag_size)
+         {
+            P_diag_j    = hypre_TAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
+            P_diag_data = hypre_TAlloc(HYPRE_Real, P_diag_size, memory_location_P);
+         }
+         if (P_offd_size)
+         {
+            P_offd_j    = hypre_TAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
+            P_offd_data = hypre_TAlloc(HYPRE_Real, P_offd_size, memory_location_P);
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      for (i = start; i < stop; i++)
+      {
+         P_diag_i[i] += diag_start;
+         P_offd_i[i] += offd_start;
+      }
+      for (j = 0; j < cnt_diag; j++)
+      {
+         P_diag_j[diag_start + j]    = thread_diag_j[j];
+         P_diag_data[diag_start + j] = thread_diag_data[j];
+      }
+      for (j = 0; j < cnt_offd; j++)
+      {
+         P_offd_j[offd_start + j]    = thread_offd_j[j];
+         P_offd_data[offd_start + j] = thread_offd_data[j];
+      }
+
+      hypre_TFree(thread_diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(thread_diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(thread_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(thread_offd_data, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
+   hypre_TFree(map_P2_to_P, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Remove the off-diagonal columns that were truncated away
+    *-----------------------------------------------------------------------*/
+
+   if (num_cols_P_offd)
+   {
+      HYPRE_Int *P_marker = hypre_CTAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < P_offd_size; i++)
+      {
+         P_marker[P_offd_j[i]] = 1;
+      }
+      cnt = 0;
+      for (i = 0; i < num_cols_P_offd; i++)
+      {
+         if (P_marker[i])
+         {
+            col_map_offd_P[cnt] = col_map_offd_P[i];
+            P_marker[i] = cnt++;
+         }
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < P_offd_size; i++)
+      {
+         P_offd_j[i] = P_marker[P_offd_j[i]];
+      }
+      num_cols_P_offd = cnt;
+      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+      if (num_cols_P_offd == 0)
+      {
+         hypre_TFree(col_map_offd_P, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   P = hypre_ParCSRMatrixCreate(comm,
+                                hypre_ParCSRMatrixGlobalNumRows(P1),
+                                hypre_ParCSRMatrixGlobalNumCols(P2),
+                                hypre_ParCSRMatrixRowStarts(P1),
+                                hypre_ParCSRMatrixColStarts(P2),
+                                num_cols_P_offd,
+                                P_diag_size,
+                                P_offd_size);
+
+   /* Note that P does not own the partitionings */
+   hypre_ParCSRMatrixSetRowStartsOwner(P, 0);
+   hypre_ParCSRMatrixSetColStartsOwner(P, 0);
+
+   P_diag = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrixData(P_diag) = P_diag_data;
+   hypre_CSRMatrixI(P_diag)    = P_diag_i;
+   hypre_CSRMatrixJ(P_diag)    = P_diag_j;
+   hypre_CSRMatrixMemoryLocation(P_diag) = memory_location_P;
+
+   P_offd = hypre_ParCSRMatrixOffd(P);
+   hypre_CSRMatrixData(P_offd) = P_offd_data;
+   hypre_CSRMatrixI(P_offd)    = P_offd_i;
+   hypre_CSRMatrixJ(P_offd)    = P_offd_j;
+   hypre_CSRMatrixMemoryLocation(P_offd) = memory_location_P;
+   hypre_ParCSRMatrixColMapOffd(P) = col_map_offd_P;
+
+   *product_nnz_ptr = product_nnz;
+   *P_ptr = P;
+
+   return hypre_error_flag;
+}
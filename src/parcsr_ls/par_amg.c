@@ -380,6 +380,12 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataPointDofMapArray(amg_data) = NULL;
    hypre_ParAMGDataSmoother(amg_data) = NULL;
    hypre_ParAMGDataL1Norms(amg_data) = NULL;
+   hypre_ParAMGDataNumColors(amg_data) = NULL;
+   hypre_ParAMGDataColorOffsets(amg_data) = NULL;
+   hypre_ParAMGDataColorRows(amg_data) = NULL;
+   hypre_ParAMGDataAggP12ProductNnz(amg_data) = NULL;
+   hypre_ParAMGDataPerfData(amg_data) = NULL;
+   hypre_ParAMGDataPerfPhase(amg_data) = HYPRE_AMG_PHASE_NONE;
 
    hypre_ParAMGDataABlockArray(amg_data) = NULL;
    hypre_ParAMGDataPBlockArray(amg_data) = NULL;
@@ -393,6 +399,10 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
+   hypre_ParAMGDataChebyEigRefresh(amg_data) = 1;
+   hypre_ParAMGDataChebyEigAge(amg_data) = 0;
+   hypre_ParAMGDataChebyEigNumLevels(amg_data) = 0;
+   hypre_ParAMGDataChebyEigSizes(amg_data) = NULL;
 
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
@@ -443,6 +453,10 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataKeepTranspose(amg_data)     = 0;
    hypre_ParAMGDataModularizedMatMat(amg_data) = 0;
 #endif
+   hypre_ParAMGDataMixedPrecision(amg_data)    = 0;
+   hypre_ParAMGDataRefreshValues(amg_data)     = 0;
+   hypre_ParAMGDataSArray(amg_data)            = NULL;
+   hypre_ParAMGDataRAPPlans(amg_data)          = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -491,6 +505,8 @@ hypre_BoomerAMGDestroy( void *data )
    }
 #endif
 
+   hypre_BoomerAMGRefreshDataDestroy(amg_data);
+
    if (hypre_ParAMGDataMaxEigEst(amg_data))
    {
       hypre_TFree(hypre_ParAMGDataMaxEigEst(amg_data), HYPRE_MEMORY_HOST);
@@ -501,6 +517,7 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataMinEigEst(amg_data), HYPRE_MEMORY_HOST);
       hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    }
+   hypre_TFree(hypre_ParAMGDataChebyEigSizes(amg_data), HYPRE_MEMORY_HOST);
    if (hypre_ParAMGDataNumGridSweeps(amg_data))
    {
       hypre_TFree(hypre_ParAMGDataNumGridSweeps(amg_data), HYPRE_MEMORY_HOST);
@@ -615,6 +632,20 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
    }
 
+   if (hypre_ParAMGDataColorOffsets(amg_data))
+   {
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_TFree(hypre_ParAMGDataColorOffsets(amg_data)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorRows(amg_data)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParAMGDataNumColors(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataColorOffsets(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataColorRows(amg_data), HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(hypre_ParAMGDataAggP12ProductNnz(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataPerfData(amg_data), HYPRE_MEMORY_HOST);
+
    if (hypre_ParAMGDataChebyCoefs(amg_data))
    {
       for (i=0; i < num_levels; i++)
@@ -4039,6 +4070,8 @@ hypre_BoomerAMGSetChebyEigEst( void     *data,
       return hypre_error_flag;
    }
    hypre_ParAMGDataChebyEigEst(amg_data) = cheby_eig_est;
+   /* the kept estimates were computed differently */
+   hypre_ParAMGDataChebyEigNumLevels(amg_data) = 0;
 
    return hypre_error_flag;
 }
@@ -4069,6 +4102,28 @@ hypre_BoomerAMGSetChebyScale( void     *data,
       return hypre_error_flag;
    }
    hypre_ParAMGDataChebyScale(amg_data) = cheby_scale;
+   /* the kept estimates are for the other (un)scaled matrix */
+   hypre_ParAMGDataChebyEigNumLevels(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetChebyEigRefresh( void     *data,
+                                   HYPRE_Int cheby_eig_refresh)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (cheby_eig_refresh < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyEigRefresh(amg_data) = cheby_eig_refresh;
 
    return hypre_error_flag;
 }
@@ -4461,6 +4516,38 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
   return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecision( void       *data,
+                                  HYPRE_Int   mixed_precision)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataMixedPrecision(amg_data) = mixed_precision;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetRefreshValues( void       *data,
+                                 HYPRE_Int   refresh_values)
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataRefreshValues(amg_data) = refresh_values;
+  return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
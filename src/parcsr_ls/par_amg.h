@@ -12,6 +12,21 @@
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * Phases of the performance report (print_level & 4).  The first four are
+ * timed during the setup, the last three during the cycle.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_PHASE_NONE      -1
+#define HYPRE_AMG_PHASE_STRENGTH   0
+#define HYPRE_AMG_PHASE_COARSEN    1
+#define HYPRE_AMG_PHASE_INTERP     2
+#define HYPRE_AMG_PHASE_RAP        3
+#define HYPRE_AMG_PHASE_RELAX      4
+#define HYPRE_AMG_PHASE_RESTRICT   5
+#define HYPRE_AMG_PHASE_PROLONG    6
+#define HYPRE_AMG_NUM_PHASES       7
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -49,6 +64,9 @@ typedef struct
    HYPRE_Int      is_triangular;
    HYPRE_Int      gmres_switch;
    HYPRE_Int      agg_num_levels;
+   /* local number of entries of the untruncated product P1*P2 on each
+      level of aggressive coarsening (setup statistics) */
+   HYPRE_Real    *agg_P12_product_nnz;
    HYPRE_Int      num_paths;
    HYPRE_Int      post_interp_type;
    HYPRE_Int      num_CR_relax_steps;
@@ -109,6 +127,12 @@ typedef struct
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
 
+   /* multicolor Gauss-Seidel (relax_type 11): rows of the diagonal block
+      grouped by color, computed once per level in the setup */
+   HYPRE_Int           *num_colors;
+   HYPRE_Int          **color_offsets;
+   HYPRE_Int          **color_rows;
+
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
    hypre_ParCSRBlockMatrix **P_block_array;
@@ -146,6 +170,10 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_eig_refresh;
+   HYPRE_Int            cheby_eig_age;        /* setups using the current estimates */
+   HYPRE_Int            cheby_eig_num_levels; /* levels of the current estimates ... */
+   HYPRE_BigInt        *cheby_eig_sizes;      /* ... and their global sizes */
 
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
@@ -177,6 +205,15 @@ typedef struct
 
    /* output params */
    HYPRE_Int      print_level;
+
+   /* performance report: wall clock time, messages and bytes sent per
+      level and phase, perf_data[(level*HYPRE_AMG_NUM_PHASES+phase)*3+k].
+      NULL unless print_level & 4 */
+   HYPRE_Real    *perf_data;
+   HYPRE_Int      perf_level;
+   HYPRE_Int      perf_phase;
+   HYPRE_Real     perf_start[3];
+
    char           log_file_name[256];
    HYPRE_Int      debug_flag;
 
@@ -234,6 +271,14 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* store coarse level operators in single precision */
+   HYPRE_Int mixed_precision;
+
+   /* numeric-only re-setup when the values of A change but not its pattern */
+   HYPRE_Int             refresh_values;
+   hypre_ParCSRMatrix  **S_array;
+   hypre_ParCSRRAPPlan **rap_plans;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -289,6 +334,7 @@ typedef struct
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
 #define hypre_ParAMGDataNumPaths(amg_data)             ((amg_data) -> num_paths)
 #define hypre_ParAMGDataAggNumLevels(amg_data)         ((amg_data) -> agg_num_levels)
+#define hypre_ParAMGDataAggP12ProductNnz(amg_data)     ((amg_data) -> agg_P12_product_nnz)
 #define hypre_ParAMGDataPostInterpType(amg_data)       ((amg_data) -> post_interp_type)
 #define hypre_ParAMGDataNumCRRelaxSteps(amg_data)      ((amg_data) -> num_CR_relax_steps)
 #define hypre_ParAMGDataCRRate(amg_data)               ((amg_data) -> CR_rate)
@@ -298,6 +344,9 @@ typedef struct
 #define hypre_ParAMGDataISType(amg_data)               ((amg_data) -> IS_type)
 #define hypre_ParAMGDataCRUseCG(amg_data)              ((amg_data) -> CR_use_CG)
 #define hypre_ParAMGDataL1Norms(amg_data)              ((amg_data) -> l1_norms)
+#define hypre_ParAMGDataNumColors(amg_data)            ((amg_data) -> num_colors)
+#define hypre_ParAMGDataColorOffsets(amg_data)         ((amg_data) -> color_offsets)
+#define hypre_ParAMGDataColorRows(amg_data)            ((amg_data) -> color_rows)
 #define hypre_ParAMGDataCGCIts(amg_data)               ((amg_data) -> cgc_its)
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
@@ -381,6 +430,10 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyEigRefresh(amg_data) ((amg_data)->cheby_eig_refresh)
+#define hypre_ParAMGDataChebyEigAge(amg_data) ((amg_data)->cheby_eig_age)
+#define hypre_ParAMGDataChebyEigNumLevels(amg_data) ((amg_data)->cheby_eig_num_levels)
+#define hypre_ParAMGDataChebyEigSizes(amg_data) ((amg_data)->cheby_eig_sizes)
 
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
@@ -414,6 +467,10 @@ typedef struct
 
 /* output parameters */
 #define hypre_ParAMGDataPrintLevel(amg_data) ((amg_data)->print_level)
+#define hypre_ParAMGDataPerfData(amg_data) ((amg_data)->perf_data)
+#define hypre_ParAMGDataPerfLevel(amg_data) ((amg_data)->perf_level)
+#define hypre_ParAMGDataPerfPhase(amg_data) ((amg_data)->perf_phase)
+#define hypre_ParAMGDataPerfStart(amg_data) ((amg_data)->perf_start)
 #define hypre_ParAMGDataLogFileName(amg_data) ((amg_data)->log_file_name)
 #define hypre_ParAMGDataDebugFlag(amg_data)   ((amg_data)->debug_flag)
 
@@ -475,6 +532,10 @@ typedef struct
 
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
+#define hypre_ParAMGDataMixedPrecision(amg_data) ((amg_data)->mixed_precision)
+#define hypre_ParAMGDataRefreshValues(amg_data) ((amg_data)->refresh_values)
+#define hypre_ParAMGDataSArray(amg_data) ((amg_data)->S_array)
+#define hypre_ParAMGDataRAPPlans(amg_data) ((amg_data)->rap_plans)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
 
 /*indices for the dof which will keep coarsening to the coarse level */
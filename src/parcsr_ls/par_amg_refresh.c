@@ -0,0 +1,424 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric-only re-setup of BoomerAMG (see HYPRE_BoomerAMGSetRefreshValues).
+ *
+ * The first setup keeps the strength matrices and builds a hypre_ParCSRRAPPlan
+ * for every level.  When hypre_BoomerAMGSetup is called again with a matrix
+ * that has the same sparsity pattern, the CF splittings and the patterns of
+ * the interpolation and coarse grid operators are kept, and only their values
+ * are recomputed.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRefreshDataDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRefreshDataDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data  = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix  **S_array   = hypre_ParAMGDataSArray(amg_data);
+   hypre_ParCSRRAPPlan **rap_plans = hypre_ParAMGDataRAPPlans(amg_data);
+   HYPRE_Int             max_levels = hypre_ParAMGDataMaxLevels(amg_data);
+   HYPRE_Int             j;
+
+   if (S_array)
+   {
+      for (j = 0; j < max_levels; j++)
+      {
+         if (S_array[j])
+         {
+            hypre_ParCSRMatrixDestroy(S_array[j]);
+         }
+      }
+      hypre_TFree(S_array, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataSArray(amg_data) = NULL;
+   }
+
+   if (rap_plans)
+   {
+      for (j = 0; j < max_levels; j++)
+      {
+         hypre_ParCSRRAPPlanDestroy(rap_plans[j]);
+      }
+      hypre_TFree(rap_plans, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlans(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRefreshCreatePlans
+ *
+ * Creates the cached Galerkin products of all levels at the end of a full
+ * setup.  If one of them cannot be created, the refresh data is freed and
+ * the next setup will be a full one.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRefreshCreatePlans( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix  **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array    = hypre_ParAMGDataPArray(amg_data);
+   HYPRE_Int             num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int             max_levels = hypre_ParAMGDataMaxLevels(amg_data);
+   hypre_ParCSRRAPPlan **rap_plans;
+   HYPRE_Int             j;
+
+   rap_plans = hypre_CTAlloc(hypre_ParCSRRAPPlan*, max_levels, HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataRAPPlans(amg_data) = rap_plans;
+
+   for (j = 0; j < num_levels-1; j++)
+   {
+      rap_plans[j] = hypre_ParCSRRAPPlanCreate(A_array[j], P_array[j], A_array[j+1]);
+      if (!rap_plans[j])
+      {
+         hypre_BoomerAMGRefreshDataDestroy(amg_data);
+         break;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRefreshProjectInterp
+ *
+ * Copies the values of P_new into the pattern of P.  P_new must have the
+ * same rows and coarse columns as P, and its pattern usually contains the
+ * one of P (P may have been truncated).  If entries are dropped, the row is
+ * rescaled so that its sum is the one of P_new, as in the truncation of P.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRefreshProjectInterp( hypre_ParCSRMatrix *P,
+                                     hypre_ParCSRMatrix *P_new )
+{
+   hypre_CSRMatrix *P_diag      = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int       *P_diag_i    = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j    = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Real      *P_diag_data = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix *P_offd      = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int       *P_offd_i    = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j    = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Real      *P_offd_data = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(P_diag);
+   HYPRE_Int        num_cols    = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_BigInt    *col_map_offd  = hypre_ParCSRMatrixColMapOffd(P);
+
+   hypre_CSRMatrix *Pn_diag      = hypre_ParCSRMatrixDiag(P_new);
+   HYPRE_Int       *Pn_diag_i    = hypre_CSRMatrixI(Pn_diag);
+   HYPRE_Int       *Pn_diag_j    = hypre_CSRMatrixJ(Pn_diag);
+   HYPRE_Real      *Pn_diag_data = hypre_CSRMatrixData(Pn_diag);
+   hypre_CSRMatrix *Pn_offd      = hypre_ParCSRMatrixOffd(P_new);
+   HYPRE_Int       *Pn_offd_i    = hypre_CSRMatrixI(Pn_offd);
+   HYPRE_Int       *Pn_offd_j    = hypre_CSRMatrixJ(Pn_offd);
+   HYPRE_Real      *Pn_offd_data = hypre_CSRMatrixData(Pn_offd);
+   HYPRE_Int        num_cols_offd_new = hypre_CSRMatrixNumCols(Pn_offd);
+   HYPRE_BigInt    *col_map_offd_new  = hypre_ParCSRMatrixColMapOffd(P_new);
+
+   HYPRE_Int       *marker_diag, *marker_offd, *new_to_old;
+   HYPRE_Int        i, j, k, dropped;
+   HYPRE_Real       full_sum, kept_sum, scale;
+
+   new_to_old  = hypre_TAlloc(HYPRE_Int, num_cols_offd_new, HYPRE_MEMORY_HOST);
+   marker_diag = hypre_TAlloc(HYPRE_Int, num_cols, HYPRE_MEMORY_HOST);
+   marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < num_cols_offd_new; j++)
+   {
+      new_to_old[j] = hypre_BigBinarySearch(col_map_offd, col_map_offd_new[j], num_cols_offd);
+   }
+   for (j = 0; j < num_cols; j++)
+   {
+      marker_diag[j] = -1;
+   }
+   for (j = 0; j < num_cols_offd; j++)
+   {
+      marker_offd[j] = -1;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = P_diag_i[i]; j < P_diag_i[i+1]; j++)
+      {
+         marker_diag[P_diag_j[j]] = j;
+         P_diag_data[j] = 0.0;
+      }
+      for (j = P_offd_i[i]; j < P_offd_i[i+1]; j++)
+      {
+         marker_offd[P_offd_j[j]] = j;
+         P_offd_data[j] = 0.0;
+      }
+
+      full_sum = kept_sum = 0.0;
+      dropped = 0;
+      for (j = Pn_diag_i[i]; j < Pn_diag_i[i+1]; j++)
+      {
+         full_sum += Pn_diag_data[j];
+         k = marker_diag[Pn_diag_j[j]];
+         if (k >= 0)
+         {
+            P_diag_data[k] = Pn_diag_data[j];
+            kept_sum += Pn_diag_data[j];
+         }
+         else if (Pn_diag_data[j] != 0.0)
+         {
+            dropped = 1;
+         }
+      }
+      for (j = Pn_offd_i[i]; j < Pn_offd_i[i+1]; j++)
+      {
+         full_sum += Pn_offd_data[j];
+         k = new_to_old[Pn_offd_j[j]];
+         k = (k >= 0) ? marker_offd[k] : -1;
+         if (k >= 0)
+         {
+            P_offd_data[k] = Pn_offd_data[j];
+            kept_sum += Pn_offd_data[j];
+         }
+         else if (Pn_offd_data[j] != 0.0)
+         {
+            dropped = 1;
+         }
+      }
+
+      if (dropped && kept_sum != 0.0)
+      {
+         scale = full_sum / kept_sum;
+         for (j = P_diag_i[i]; j < P_diag_i[i+1]; j++)
+         {
+            P_diag_data[j] *= scale;
+         }
+         for (j = P_offd_i[i]; j < P_offd_i[i+1]; j++)
+         {
+            P_offd_data[j] *= scale;
+         }
+      }
+
+      for (j = P_diag_i[i]; j < P_diag_i[i+1]; j++)
+      {
+         marker_diag[P_diag_j[j]] = -1;
+      }
+      for (j = P_offd_i[i]; j < P_offd_i[i+1]; j++)
+      {
+         marker_offd[P_offd_j[j]] = -1;
+      }
+   }
+
+   hypre_TFree(new_to_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRefreshLevels
+ *
+ * Recomputes the values of P_array and A_array[1:num_levels-1] for the new
+ * values of A_array[0].  The interpolation weights are computed with the
+ * interpolation routine of the first setup (interp_type and sep_weight as
+ * used there), without truncation, and restricted to the pattern of P.
+ * Also creates F_array and U_array on the intermediate levels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRefreshLevels( void      *amg_vdata,
+                              HYPRE_Int  interp_type,
+                              HYPRE_Int  sep_weight )
+{
+   hypre_ParAMGData     *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix  **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **S_array         = hypre_ParAMGDataSArray(amg_data);
+   hypre_ParCSRRAPPlan **rap_plans       = hypre_ParAMGDataRAPPlans(amg_data);
+   hypre_ParVector     **F_array         = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector     **U_array         = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int           **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int           **dof_func_array  = hypre_ParAMGDataDofFuncArray(amg_data);
+   HYPRE_Int             num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int             num_functions   = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int             debug_flag      = hypre_ParAMGDataDebugFlag(amg_data);
+   HYPRE_Int             keepTranspose   = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A_array[0]);
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A_array[0]);
+
+   hypre_ParCSRMatrix   *A, *P, *S, *A_H, *P_new;
+   hypre_CSRMatrix      *P_diagT, *P_offdT;
+   HYPRE_BigInt         *coarse_pnts_global;
+   HYPRE_Int             num_cpts_global, num_procs;
+   HYPRE_Int             level, dbg_flg;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_cpts_global = 2;
+#else
+   num_cpts_global = num_procs + 1;
+#endif
+
+   /* the strength matrix of the finest level refers to the partitioning of A */
+   S = S_array[0];
+   if (!hypre_ParCSRMatrixOwnsRowStarts(S))
+   {
+      hypre_ParCSRMatrixRowStarts(S) = hypre_ParCSRMatrixRowStarts(A_array[0]);
+   }
+   if (!hypre_ParCSRMatrixOwnsColStarts(S))
+   {
+      hypre_ParCSRMatrixColStarts(S) = hypre_ParCSRMatrixColStarts(A_array[0]);
+   }
+
+   for (level = 0; level < num_levels-1; level++)
+   {
+      A   = A_array[level];
+      P   = P_array[level];
+      S   = S_array[level];
+      A_H = A_array[level+1];
+
+      /* the values may have been stored in single precision */
+      hypre_CSRMatrixConvertToDouble(hypre_ParCSRMatrixDiag(P));
+      hypre_CSRMatrixConvertToDouble(hypre_ParCSRMatrixOffd(P));
+      hypre_CSRMatrixConvertToDouble(hypre_ParCSRMatrixDiag(A_H));
+      hypre_CSRMatrixConvertToDouble(hypre_ParCSRMatrixOffd(A_H));
+
+      if (hypre_ParCSRMatrixDiagT(P))
+      {
+         hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P));
+         hypre_ParCSRMatrixDiagT(P) = NULL;
+      }
+      if (hypre_ParCSRMatrixOffdT(P))
+      {
+         hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P));
+         hypre_ParCSRMatrixOffdT(P) = NULL;
+      }
+
+      /*-----------------------------------------------------------------
+       * Interpolation weights for the new values of A
+       *-----------------------------------------------------------------*/
+
+      /* owned by P_new */
+      coarse_pnts_global = hypre_TAlloc(HYPRE_BigInt, num_cpts_global, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(coarse_pnts_global, hypre_ParCSRMatrixColStarts(P), HYPRE_BigInt,
+                    num_cpts_global, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      P_new = NULL;
+
+      switch (interp_type)
+      {
+         case 3:
+         case 15:
+            hypre_BoomerAMGBuildDirInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                          num_functions, dof_func_array[level], debug_flag,
+                                          0.0, 0, NULL, interp_type, &P_new);
+            break;
+         case 6:
+            hypre_BoomerAMGBuildExtPIInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                            num_functions, dof_func_array[level], debug_flag,
+                                            0.0, 0, NULL, &P_new);
+            break;
+         case 7:
+            hypre_BoomerAMGBuildExtPICCInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                              num_functions, dof_func_array[level], debug_flag,
+                                              0.0, 0, NULL, &P_new);
+            break;
+         case 8:
+            hypre_BoomerAMGBuildStdInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                          num_functions, dof_func_array[level], debug_flag,
+                                          0.0, 0, sep_weight, NULL, &P_new);
+            break;
+         case 12:
+            hypre_BoomerAMGBuildFFInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                         num_functions, dof_func_array[level], debug_flag,
+                                         0.0, 0, NULL, &P_new);
+            break;
+         case 13:
+            hypre_BoomerAMGBuildFF1Interp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                          num_functions, dof_func_array[level], debug_flag,
+                                          0.0, 0, NULL, &P_new);
+            break;
+         case 14:
+            hypre_BoomerAMGBuildExtInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                          num_functions, dof_func_array[level], debug_flag,
+                                          0.0, 0, NULL, &P_new);
+            break;
+         case 16:
+            hypre_BoomerAMGBuildModExtInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                             debug_flag, 0.0, 0, NULL, &P_new);
+            break;
+         case 17:
+            hypre_BoomerAMGBuildModExtPIInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                               debug_flag, 0.0, 0, NULL, &P_new);
+            break;
+         case 18:
+            hypre_BoomerAMGBuildModExtPEInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                               debug_flag, 0.0, 0, NULL, &P_new);
+            break;
+         default:
+            dbg_flg = debug_flag;
+            if (hypre_ParAMGDataPrintLevel(amg_data))
+            {
+               dbg_flg = -debug_flag;
+            }
+            hypre_BoomerAMGBuildInterp(A, CF_marker_array[level], S, coarse_pnts_global,
+                                       num_functions, dof_func_array[level], dbg_flg,
+                                       0.0, 0, NULL, &P_new);
+            break;
+      }
+
+      hypre_BoomerAMGRefreshProjectInterp(P, P_new);
+      hypre_ParCSRMatrixDestroy(P_new);
+
+      /*-----------------------------------------------------------------
+       * Coarse grid operator
+       *-----------------------------------------------------------------*/
+
+      hypre_ParCSRRAPPlanCompute(rap_plans[level], A, P, A_H);
+
+      hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixDiag(P));
+      hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixOffd(P));
+      hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixDiag(A_H));
+      hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixOffd(A_H));
+
+      if (keepTranspose)
+      {
+         hypre_CSRMatrixTranspose(hypre_ParCSRMatrixDiag(P), &P_diagT, 1);
+         hypre_ParCSRMatrixDiagT(P) = P_diagT;
+         if (hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(P)))
+         {
+            hypre_CSRMatrixTranspose(hypre_ParCSRMatrixOffd(P), &P_offdT, 1);
+            hypre_ParCSRMatrixOffdT(P) = P_offdT;
+         }
+      }
+
+      /* the vectors of the coarsest level are created by hypre_BoomerAMGSetup */
+      if (level > 0)
+      {
+         F_array[level] = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                                hypre_ParCSRMatrixRowStarts(A));
+         hypre_ParVectorInitialize_v2(F_array[level], memory_location);
+         hypre_ParVectorSetPartitioningOwner(F_array[level], 0);
+
+         U_array[level] = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                                hypre_ParCSRMatrixGlobalNumRows(A),
+                                                hypre_ParCSRMatrixRowStarts(A));
+         hypre_ParVectorInitialize_v2(U_array[level], memory_location);
+         hypre_ParVectorSetPartitioningOwner(U_array[level], 0);
+      }
+   }
+
+   return hypre_error_flag;
+}
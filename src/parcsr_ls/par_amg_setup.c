@@ -142,6 +142,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    HYPRE_Real *max_eig_est = NULL;
    HYPRE_Real *min_eig_est = NULL;
+   HYPRE_Int   cheby_eig_reuse = 0;
 
    HYPRE_Solver *smoother = NULL;
    HYPRE_Int     smooth_type = hypre_ParAMGDataSmoothType(amg_data);
@@ -203,6 +204,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       ns = num_grid_sweeps[1];
    HYPRE_Real      wall_time;   /* for debugging instrumentation */
    HYPRE_Int       add_end;
+   HYPRE_Int       coarse_redundant = 0; /* coarsest level solved redundantly */
+   HYPRE_Int       refresh = 0;          /* numeric-only re-setup */
 
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int       dslu_threshold = hypre_ParAMGDataDSLUThreshold(amg_data);
@@ -378,10 +381,29 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* end of systems checks */
 
+   /* a repeated setup usually follows an in-place change of the values of A:
+      bring the SELL copies of A (if any) up to date before they are used */
+   hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixSELLUpdateValues(hypre_ParCSRMatrixOffd(A));
+
+   /* numeric-only re-setup if the hierarchy was built for the pattern of A
+      (see HYPRE_BoomerAMGSetRefreshValues), otherwise drop the data kept
+      for it */
+   if (hypre_ParAMGDataRAPPlans(amg_data))
+   {
+      refresh = hypre_ParAMGDataRefreshValues(amg_data) &&
+                hypre_ParCSRRAPPlanMatchesA(hypre_ParAMGDataRAPPlans(amg_data)[0], A);
+   }
+   if (!refresh)
+   {
+      hypre_BoomerAMGRefreshDataDestroy(amg_data);
+   }
+
    /* free up storage in case of new setup without previous destroy */
 
-   if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
-       dof_func_array || R_array || R_block_array)
+   if (!refresh &&
+       (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
+        dof_func_array || R_array || R_block_array))
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -523,15 +545,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParAMGDataCoarseSolver(amg_data) = NULL;
       }
 
-      if (hypre_ParAMGDataMaxEigEst(amg_data))
-      {
-         hypre_TFree(hypre_ParAMGDataMaxEigEst(amg_data), HYPRE_MEMORY_HOST);
-         hypre_ParAMGDataMaxEigEst(amg_data) = NULL;
-      }
-      if (hypre_ParAMGDataMinEigEst(amg_data))
+      /* the eigenvalue estimates of the Chebyshev smoother are kept for
+         the next setup (see HYPRE_BoomerAMGSetChebyEigRefresh) */
+      if (hypre_ParAMGDataChebyCoefs(amg_data))
       {
-         hypre_TFree(hypre_ParAMGDataMinEigEst(amg_data), HYPRE_MEMORY_HOST);
-         hypre_ParAMGDataMinEigEst(amg_data) = NULL;
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataChebyCoefs(amg_data)[i], HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_ParAMGDataChebyDS(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataChebyCoefs(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
       }
       if (hypre_ParAMGDataL1Norms(amg_data))
       {
@@ -541,6 +565,20 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+      if (hypre_ParAMGDataColorOffsets(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataColorOffsets(amg_data)[i], HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_ParAMGDataColorRows(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataNumColors(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorOffsets(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorRows(amg_data), HYPRE_MEMORY_HOST);
+         hypre_ParAMGDataNumColors(amg_data) = NULL;
+         hypre_ParAMGDataColorOffsets(amg_data) = NULL;
+         hypre_ParAMGDataColorRows(amg_data) = NULL;
+      }
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > old_num_levels-1)
@@ -621,6 +659,23 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (P_block_array == NULL && max_levels > 1)
       P_block_array = hypre_CTAlloc(hypre_ParCSRBlockMatrix*, max_levels-1, HYPRE_MEMORY_HOST);
 
+   /* sizes of the P1*P2 products of aggressive coarsening (setup statistics) */
+   hypre_TFree(hypre_ParAMGDataAggP12ProductNnz(amg_data), HYPRE_MEMORY_HOST);
+   if (agg_num_levels > 0)
+   {
+      hypre_ParAMGDataAggP12ProductNnz(amg_data) = hypre_CTAlloc(HYPRE_Real, max_levels, HYPRE_MEMORY_HOST);
+   }
+
+   /* per-level, per-phase timers of the performance report; the cycle
+      phases accumulate over all solves until the next setup */
+   hypre_TFree(hypre_ParAMGDataPerfData(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataPerfPhase(amg_data) = HYPRE_AMG_PHASE_NONE;
+   if (amg_print_level & 4)
+   {
+      hypre_ParAMGDataPerfData(amg_data) =
+         hypre_CTAlloc(HYPRE_Real, 3*max_levels*HYPRE_AMG_NUM_PHASES, HYPRE_MEMORY_HOST);
+   }
+
    /* RL: if retri_type != 0, R != P^T, allocate R matrices */
    if (restri_type)
    {
@@ -808,6 +863,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }
 
+   /* Chebyshev of order 4 needs a third work vector */
+   if (hypre_ParAMGDataPtemp(amg_data) == NULL && hypre_ParAMGDataChebyOrder(amg_data) > 3 &&
+       (grid_relax_type[1] == 16 || grid_relax_type[2] == 16 || grid_relax_type[3] == 16))
+   {
+      Ptemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
+                                    hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
+                                    hypre_ParCSRMatrixRowStarts(A_array[0]));
+      hypre_ParVectorInitialize(Ptemp);
+      hypre_ParVectorSetPartitioningOwner(Ptemp,0);
+      hypre_ParAMGDataPtemp(amg_data) = Ptemp;
+   }
 
 
    F_array = hypre_ParAMGDataFArray(amg_data);
@@ -868,6 +934,23 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   if (refresh)
+   {
+      /* keep the grids and patterns, recompute P and the coarse grid
+         operators, then continue with the setup of the solvers */
+      hypre_BoomerAMGRefreshLevels(amg_data, interp_type, sep_weight);
+
+      HYPRE_ANNOTATE_MGLEVEL_END(level);
+      level = old_num_levels - 1;
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      not_finished_coarsening = 0;
+   }
+   else if (hypre_ParAMGDataRefreshValues(amg_data))
+   {
+      hypre_ParAMGDataSArray(amg_data) =
+         hypre_CTAlloc(hypre_ParCSRMatrix*, max_levels, HYPRE_MEMORY_HOST);
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -955,6 +1038,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
       else /* max_levels > 1 */
       {
+         hypre_BoomerAMGPerfPhase(amg_data, level, HYPRE_AMG_PHASE_STRENGTH);
+
          if (block_mode)
          {
             local_num_vars =
@@ -1088,6 +1173,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Do the appropriate coarsening ****/
 
+         hypre_BoomerAMGPerfPhase(amg_data, level, HYPRE_AMG_PHASE_COARSEN);
+
          if (nodal == 0) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
@@ -1532,6 +1619,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
+
+         hypre_BoomerAMGPerfPhase(amg_data, level, HYPRE_AMG_PHASE_INTERP);
+
          if (level < agg_num_levels)
          {
             if (nodal == 0)
@@ -1648,14 +1738,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   if (hypre_ParAMGDataModularizedMatMat(amg_data))
                   {
                      P = hypre_ParCSRMatMat(P1, P2);
+                     hypre_BoomerAMGInterpTruncation(P, agg_trunc_factor, agg_P_max_elmts);
                   }
                   else
                   {
-                     P = hypre_ParMatmul(P1, P2);
+                     /* P1*P2 is truncated row by row as it is formed */
+                     hypre_BoomerAMGBuildTwoStageInterp(P1, P2, agg_trunc_factor, agg_P_max_elmts,
+                                                        &hypre_ParAMGDataAggP12ProductNnz(amg_data)[level],
+                                                        &P);
                   }
 
-                  hypre_BoomerAMGInterpTruncation(P, agg_trunc_factor, agg_P_max_elmts);
-
                   hypre_MatvecCommPkgCreate(P);
                   hypre_ParCSRMatrixDestroy(P1);
                   hypre_ParCSRMatrixOwnsColStarts(P2) = 0;
@@ -1818,13 +1910,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                   if (hypre_ParAMGDataModularizedMatMat(amg_data))
                   {
                      P = hypre_ParCSRMatMat(P1, P2);
+                     hypre_BoomerAMGInterpTruncation(P, agg_trunc_factor,
+                                                     agg_P_max_elmts);
                   }
                   else
                   {
-                     P = hypre_ParMatmul(P1, P2);
+                     /* P1*P2 is truncated row by row as it is formed */
+                     hypre_BoomerAMGBuildTwoStageInterp(P1, P2, agg_trunc_factor, agg_P_max_elmts,
+                                                        &hypre_ParAMGDataAggP12ProductNnz(amg_data)[level],
+                                                        &P);
                   }
-                  hypre_BoomerAMGInterpTruncation(P, agg_trunc_factor,
-                                                  agg_P_max_elmts);
                   hypre_MatvecCommPkgCreate(P);
                   hypre_ParCSRMatrixDestroy(P1);
                   hypre_ParCSRMatrixOwnsColStarts(P2) = 0;
@@ -2665,7 +2760,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
       }
 
-      if (S)
+      if (S && hypre_ParAMGDataSArray(amg_data))
+      {
+         /* kept for hypre_BoomerAMGRefreshLevels */
+         hypre_ParAMGDataSArray(amg_data)[level] = S;
+      }
+      else if (S)
       {
          hypre_ParCSRMatrixDestroy(S);
       }
@@ -2686,6 +2786,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        * Build coarse-grid operator, A_array[level+1] by R*A*P
        *--------------------------------------------------------------*/
 
+      hypre_BoomerAMGPerfPhase(amg_data, level, HYPRE_AMG_PHASE_RAP);
+
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
 
       if (block_mode)
@@ -2875,12 +2977,15 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   hypre_BoomerAMGPerfPhase(amg_data, level, HYPRE_AMG_PHASE_NONE);
+
    /* redundant coarse grid solve */
    if ((seq_threshold >= coarse_threshold) &&
        (coarse_size > (HYPRE_BigInt) coarse_threshold) &&
        (level != max_levels-1))
    {
       hypre_seqAMGSetup(amg_data, level, coarse_threshold);
+      coarse_redundant = 1;
    }
 #ifdef HYPRE_USING_DSUPERLU
    else if ((dslu_threshold >= coarse_threshold) &&
@@ -2890,6 +2995,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       HYPRE_Solver dslu_solver;
       hypre_SLUDistSetup(&dslu_solver, A_array[level], amg_print_level);
       hypre_ParAMGDataDSLUSolver(amg_data) = dslu_solver;
+      coarse_redundant = 1;
    }
 #endif
    else if (grid_relax_type[3] == 9  ||
@@ -2963,6 +3069,54 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
    smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
 
+   /*-----------------------------------------------------------------------
+    * Keep what a numeric-only re-setup needs, if the hierarchy allows it:
+    * scalar interpolation computed from A and S only, Galerkin coarse grid
+    * operators and no aggressive coarsening
+    *-----------------------------------------------------------------------*/
+
+   if (!refresh && hypre_ParAMGDataSArray(amg_data))
+   {
+      HYPRE_Int max_thresh = hypre_max(coarse_threshold, seq_threshold);
+      HYPRE_Int supported;
+
+#ifdef HYPRE_USING_DSUPERLU
+      max_thresh = hypre_max(max_thresh, dslu_threshold);
+#endif
+      /* coarsening must have stopped on the size of the coarsest level */
+      supported = (num_levels > 1) &&
+                  (coarse_size == hypre_ParCSRMatrixGlobalNumRows(A_array[level])) &&
+                  (level == max_levels-1 || coarse_size <= (HYPRE_BigInt) max_thresh);
+
+      supported = supported && !block_mode && hypre_ParAMGDataNodal(amg_data) == 0 &&
+                  agg_num_levels == 0 &&
+                  ( interp_type == 0  || interp_type == 3  || interp_type == 6  ||
+                    interp_type == 7  || interp_type == 8  || interp_type == 12 ||
+                    interp_type == 13 || interp_type == 14 || interp_type == 15 ||
+                    interp_type == 16 || interp_type == 17 || interp_type == 18 ) &&
+                  interp_refine == 0 && interp_vec_variant == 0 && post_interp_type == 0 &&
+                  restri_type == 0 && hypre_ParAMGDataGSMG(amg_data) == 0 &&
+                  mult_addlvl == -1 && additive == -1 && nongalerk_num_tol == 0 &&
+                  nongal_tol_array == NULL && hypre_ParAMGDataNonGalerkinTol(amg_data) == 0.0 &&
+                  hypre_ParAMGDataADropTol(amg_data) <= 0.0 &&
+                  strong_threshold <= S_commpkg_switch &&
+                  hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST;
+
+      for (j = 0; supported && j < num_levels-1; j++)
+      {
+         supported = (hypre_ParAMGDataSArray(amg_data)[j] != NULL);
+      }
+
+      if (supported)
+      {
+         hypre_BoomerAMGRefreshCreatePlans(amg_data);
+      }
+      else
+      {
+         hypre_BoomerAMGRefreshDataDestroy(amg_data);
+      }
+   }
+
    /*-----------------------------------------------------------------------
     * Setup of special smoothers when needed
     *-----------------------------------------------------------------------*/
@@ -2982,10 +3136,50 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (grid_relax_type[0] == 16 || grid_relax_type[1] == 16 ||
        grid_relax_type[2] == 16 || grid_relax_type[3] == 16)
    {
-      max_eig_est = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
-      min_eig_est = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
-      hypre_ParAMGDataMaxEigEst(amg_data) = max_eig_est;
-      hypre_ParAMGDataMinEigEst(amg_data) = min_eig_est;
+      HYPRE_Int     cheby_eig_refresh = hypre_ParAMGDataChebyEigRefresh(amg_data);
+      HYPRE_BigInt *cheby_eig_sizes   = hypre_ParAMGDataChebyEigSizes(amg_data);
+
+      /* reuse the eigenvalue estimates of the previous setup if the
+         refresh policy allows it and the hierarchy has the same levels */
+      if (hypre_ParAMGDataMaxEigEst(amg_data) && cheby_eig_refresh != 1 &&
+          (cheby_eig_refresh == 0 ||
+           hypre_ParAMGDataChebyEigAge(amg_data) < cheby_eig_refresh) &&
+          hypre_ParAMGDataChebyEigNumLevels(amg_data) == num_levels)
+      {
+         cheby_eig_reuse = 1;
+         for (j = 0; j < num_levels; j++)
+         {
+            if (cheby_eig_sizes[j] != hypre_ParCSRMatrixGlobalNumRows(A_array[j]))
+            {
+               cheby_eig_reuse = 0;
+            }
+         }
+      }
+
+      if (cheby_eig_reuse)
+      {
+         max_eig_est = hypre_ParAMGDataMaxEigEst(amg_data);
+         min_eig_est = hypre_ParAMGDataMinEigEst(amg_data);
+         hypre_ParAMGDataChebyEigAge(amg_data)++;
+      }
+      else
+      {
+         hypre_TFree(hypre_ParAMGDataMaxEigEst(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMinEigEst(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(cheby_eig_sizes, HYPRE_MEMORY_HOST);
+         max_eig_est = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
+         min_eig_est = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
+         cheby_eig_sizes = hypre_CTAlloc(HYPRE_BigInt, num_levels, HYPRE_MEMORY_HOST);
+         for (j = 0; j < num_levels; j++)
+         {
+            cheby_eig_sizes[j] = hypre_ParCSRMatrixGlobalNumRows(A_array[j]);
+         }
+         hypre_ParAMGDataMaxEigEst(amg_data) = max_eig_est;
+         hypre_ParAMGDataMinEigEst(amg_data) = min_eig_est;
+         hypre_ParAMGDataChebyEigSizes(amg_data) = cheby_eig_sizes;
+         hypre_ParAMGDataChebyEigNumLevels(amg_data) = num_levels;
+         hypre_ParAMGDataChebyEigAge(amg_data) = 1;
+      }
       cheby_ds = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       cheby_coefs = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataChebyDS(amg_data) = cheby_ds;
@@ -3000,6 +3194,27 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /* multicolor Gauss-Seidel: the coloring only depends on the sparsity
+      pattern of the level */
+   if (grid_relax_type[1] == 11 || grid_relax_type[2] == 11 || grid_relax_type[3] == 11)
+   {
+      hypre_ParAMGDataNumColors(amg_data) = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataColorOffsets(amg_data) = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataColorRows(amg_data) = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+
+      for (j = 0; j < num_levels; j++)
+      {
+         if ((j <  num_levels-1 && (grid_relax_type[1] == 11 || grid_relax_type[2] == 11)) ||
+             (j == num_levels-1 && grid_relax_type[3] == 11))
+         {
+            hypre_BoomerAMGMulticolorSetup(A_array[j],
+                                           &hypre_ParAMGDataNumColors(amg_data)[j],
+                                           &hypre_ParAMGDataColorOffsets(amg_data)[j],
+                                           &hypre_ParAMGDataColorRows(amg_data)[j]);
+         }
+      }
+   }
+
    if (addlvl == -1)
    {
       addlvl = num_levels;
@@ -3132,7 +3347,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Int cheby_order = hypre_ParAMGDataChebyOrder(amg_data);
          HYPRE_Int cheby_eig_est = hypre_ParAMGDataChebyEigEst(amg_data);
          HYPRE_Real cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
-         if (cheby_eig_est)
+         if (cheby_eig_reuse)
+         {
+            max_eig = max_eig_est[j];
+            min_eig = min_eig_est[j];
+         }
+         else if (cheby_eig_est)
          {
             hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
                                          &max_eig, &min_eig);
@@ -3325,10 +3545,85 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
     * Print some stuff
     *-----------------------------------------------------------------------*/
 
-   if (amg_print_level == 1 || amg_print_level == 3)
+   if (amg_print_level & 1)
    {
       hypre_BoomerAMGSetupStats(amg_data,A);
    }
+   if (amg_print_level & 4)
+   {
+      hypre_BoomerAMGPerfPrint(amg_data, comm, 1);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Store the values of the coarse grid operators, interpolation and
+    * restriction in single precision.  A coarse grid operator is only
+    * converted if the smoother used on its level supports it.
+    *-----------------------------------------------------------------------*/
+
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   if (hypre_ParAMGDataMixedPrecision(amg_data) && !block_mode &&
+       mult_addlvl < 0 && additive < 0)
+   {
+      HYPRE_Int  convert_A;
+      HYPRE_Real nnz_flt[2], nnz_tot[2];
+
+      nnz_flt[0] = nnz_flt[1] = 0.0;
+      for (j = 0; j < num_levels; j++)
+      {
+         if (j > 0 && smooth_num_levels <= j)
+         {
+            if (j < num_levels-1)
+            {
+               convert_A = hypre_BoomerAMGRelaxFltSupported(grid_relax_type[1]) &&
+                           hypre_BoomerAMGRelaxFltSupported(grid_relax_type[2]);
+            }
+            else
+            {
+               convert_A = !coarse_redundant &&
+                           ( hypre_BoomerAMGRelaxFltSupported(grid_relax_type[3]) ||
+                             grid_relax_type[3] == 9 || grid_relax_type[3] == 99 ||
+                             grid_relax_type[3] == 199 );
+            }
+
+            if (convert_A)
+            {
+               hypre_ParCSRMatrixConvertToFloat(A_array[j]);
+               nnz_flt[0] += (HYPRE_Real)
+                  ( hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A_array[j])) +
+                    hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A_array[j])) );
+            }
+         }
+
+         if (j < num_levels-1)
+         {
+            hypre_ParCSRMatrixConvertToFloat(P_array[j]);
+            nnz_flt[1] += (HYPRE_Real)
+                  ( hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(P_array[j])) +
+                    hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(P_array[j])) );
+            if (restri_type && R_array[j] != P_array[j])
+            {
+               hypre_ParCSRMatrixConvertToFloat(R_array[j]);
+               nnz_flt[1] += (HYPRE_Real)
+                  ( hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(R_array[j])) +
+                    hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(R_array[j])) );
+            }
+         }
+      }
+
+      if (amg_print_level & 1)
+      {
+         hypre_MPI_Allreduce(nnz_flt, nnz_tot, 2, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+      }
+      if ((amg_print_level & 1) && my_id == 0)
+      {
+         hypre_printf("\n Mixed precision: %.0f coarse grid and %.0f interpolation/restriction",
+                      nnz_tot[0], nnz_tot[1]);
+         hypre_printf(" values stored in single precision (%.2f MB saved)\n",
+                      (nnz_tot[0] + nnz_tot[1]) *
+                      (HYPRE_Real) (sizeof(HYPRE_Complex) - sizeof(hypre_float)) / 1048576.0);
+      }
+   }
+#endif
 
    /* print out CF info to plot grids in matlab (see 'tools/AMGgrids.m') */
 
@@ -14,6 +14,192 @@
 #include "_hypre_parcsr_ls.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveResizeVector
+ *
+ * Replaces the work vector *v_ptr by one with num_vectors vectors, stored
+ * row-wise if num_vectors > 1.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSolveResizeVector( hypre_ParVector **v_ptr,
+                                  HYPRE_Int         num_vectors )
+{
+   hypre_ParVector *v = *v_ptr;
+   hypre_ParVector *w;
+
+   if (!v || hypre_ParVectorNumVectors(v) == num_vectors)
+   {
+      return hypre_error_flag;
+   }
+
+   w = hypre_ParMultiVectorCreate(hypre_ParVectorComm(v),
+                                  hypre_ParVectorGlobalSize(v),
+                                  hypre_ParVectorPartitioning(v),
+                                  num_vectors);
+   hypre_ParVectorOwnsPartitioning(w) = hypre_ParVectorOwnsPartitioning(v);
+   hypre_ParVectorOwnsPartitioning(v) = 0;
+   if (num_vectors > 1)
+   {
+      hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(w)) = 1;
+   }
+   hypre_ParVectorInitialize_v2(w, hypre_ParVectorMemoryLocation(v));
+
+   hypre_ParVectorDestroy(v);
+   *v_ptr = w;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveSetNumVectors
+ *
+ * Checks that the hierarchy can be cycled with a block of num_vectors
+ * right-hand sides (row-wise multivectors f and u), and sizes the work
+ * vectors of the solve phase accordingly.  Returns 1 (and sets the error
+ * flag) if it cannot.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGSolveSetNumVectors( hypre_ParAMGData *amg_data,
+                                   hypre_ParVector  *f,
+                                   hypre_ParVector  *u )
+{
+   HYPRE_Int        num_vectors = hypre_ParVectorNumVectors(f);
+   HYPRE_Int        num_levels  = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int       *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   hypre_ParVector *Vtemp, *Ztemp, *Rtemp, *Ptemp, *Residual;
+   HYPRE_Int        j, rt;
+
+   if (num_vectors > 1)
+   {
+      if (hypre_ParVectorNumVectors(u) != num_vectors ||
+          hypre_VectorIndexStride(hypre_ParVectorLocalVector(f)) != num_vectors ||
+          hypre_VectorIndexStride(hypre_ParVectorLocalVector(u)) != num_vectors)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Multiple right-hand sides must be stored row-wise!\n");
+         return 1;
+      }
+
+      if (hypre_GetExecPolicy1(hypre_ParVectorMemoryLocation(f)) != HYPRE_EXEC_HOST ||
+          hypre_ParAMGDataBlockMode(amg_data) ||
+          hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+          hypre_ParAMGDataParticipate(amg_data) ||
+          (hypre_ParAMGDataAdditive(amg_data) >= 0 &&
+           hypre_ParAMGDataAdditive(amg_data) < num_levels) ||
+          (hypre_ParAMGDataMultAdditive(amg_data) >= 0 &&
+           hypre_ParAMGDataMultAdditive(amg_data) < num_levels) ||
+          (hypre_ParAMGDataSimple(amg_data) >= 0 &&
+           hypre_ParAMGDataSimple(amg_data) < num_levels))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Multiple right-hand sides not available for this AMG configuration!\n");
+         return 1;
+      }
+
+      for (j = 1; j < 4; j++)
+      {
+         rt = grid_relax_type[j];
+         if (!hypre_BoomerAMGRelaxMultiSupported(rt) &&
+             !(j == 3 && (rt == 9 || rt == 99 || rt == 199)))
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "Relax type not available for multiple right-hand sides!\n");
+            return 1;
+         }
+      }
+
+      for (j = 0; j < num_levels; j++)
+      {
+         if (hypre_CSRMatrixDataFlt(hypre_ParCSRMatrixDiag(hypre_ParAMGDataAArray(amg_data)[j])))
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                              "Multiple right-hand sides not available for single precision matrices!\n");
+            return 1;
+         }
+      }
+   }
+
+   Vtemp    = hypre_ParAMGDataVtemp(amg_data);
+   Ztemp    = hypre_ParAMGDataZtemp(amg_data);
+   Rtemp    = hypre_ParAMGDataRtemp(amg_data);
+   Ptemp    = hypre_ParAMGDataPtemp(amg_data);
+   Residual = hypre_ParAMGDataResidual(amg_data);
+
+   hypre_BoomerAMGSolveResizeVector(&Vtemp, num_vectors);
+   hypre_BoomerAMGSolveResizeVector(&Ztemp, num_vectors);
+   hypre_BoomerAMGSolveResizeVector(&Rtemp, num_vectors);
+   hypre_BoomerAMGSolveResizeVector(&Ptemp, num_vectors);
+   hypre_BoomerAMGSolveResizeVector(&Residual, num_vectors);
+
+   hypre_ParAMGDataVtemp(amg_data)    = Vtemp;
+   hypre_ParAMGDataZtemp(amg_data)    = Ztemp;
+   hypre_ParAMGDataRtemp(amg_data)    = Rtemp;
+   hypre_ParAMGDataPtemp(amg_data)    = Ptemp;
+   hypre_ParAMGDataResidual(amg_data) = Residual;
+
+   for (j = 1; j < num_levels; j++)
+   {
+      hypre_BoomerAMGSolveResizeVector(&hypre_ParAMGDataFArray(amg_data)[j], num_vectors);
+      hypre_BoomerAMGSolveResizeVector(&hypre_ParAMGDataUArray(amg_data)[j], num_vectors);
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveNorm
+ *
+ * Returns the 2-norm of r; for a multivector, the largest 2-norm of its
+ * vectors, with all of them returned in norms.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_BoomerAMGSolveNorm( hypre_ParVector *r,
+                          HYPRE_Real      *norms )
+{
+   HYPRE_Int  num_vectors = hypre_ParVectorNumVectors(r);
+   HYPRE_Real norm = 0.0;
+   HYPRE_Int  j;
+
+   if (num_vectors == 1)
+   {
+      return sqrt(hypre_ParVectorInnerProd(r, r));
+   }
+
+   hypre_ParVectorInnerProdMulti(r, r, norms);
+   for (j = 0; j < num_vectors; j++)
+   {
+      norms[j] = sqrt(norms[j]);
+      norm = hypre_max(norm, norms[j]);
+   }
+
+   return norm;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveRelNorm
+ *
+ * Largest relative residual norms[j]/ref_norms[j] over the vectors
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_BoomerAMGSolveRelNorm( HYPRE_Int   num_vectors,
+                             HYPRE_Real *norms,
+                             HYPRE_Real *ref_norms )
+{
+   HYPRE_Real rel = 0.0;
+   HYPRE_Int  j;
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      rel = hypre_max(rel, ref_norms[j] ? norms[j] / ref_norms[j] : norms[j]);
+   }
+
+   return rel;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGSolve
  *--------------------------------------------------------------------*/
@@ -77,6 +263,12 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Real   old_resid;
    HYPRE_Real   ieee_check = 0.;
 
+   /* per-vector norms for a block of right-hand sides */
+   HYPRE_Int    num_vectors;
+   HYPRE_Real  *resid_nrms = NULL;
+   HYPRE_Real  *resid_nrms_init = NULL;
+   HYPRE_Real  *rhs_norms = NULL;
+
    hypre_ParVector  *Vtemp;
    hypre_ParVector  *Residual;
 
@@ -84,6 +276,20 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
 
+   if (hypre_BoomerAMGSolveSetNumVectors(amg_data, f, u))
+   {
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   num_vectors = hypre_ParVectorNumVectors(f);
+   if (num_vectors > 1)
+   {
+      resid_nrms      = hypre_CTAlloc(HYPRE_Real, 3*num_vectors, HYPRE_MEMORY_HOST);
+      resid_nrms_init = resid_nrms + num_vectors;
+      rhs_norms       = resid_nrms + 2*num_vectors;
+   }
+
    amg_print_level  = hypre_ParAMGDataPrintLevel(amg_data);
    amg_logging      = hypre_ParAMGDataLogging(amg_data);
    if ( amg_logging > 1 )
@@ -124,7 +330,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
     *    Write the solver parameters
     *-----------------------------------------------------------------------*/
 
-   if (my_id == 0 && amg_print_level > 1)
+   if (my_id == 0 && (amg_print_level & 2))
    {
       hypre_BoomerAMGWriteSolverParams(amg_data);
    }
@@ -145,7 +351,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
     *     write some initial info
     *-----------------------------------------------------------------------*/
 
-   if (my_id == 0 && amg_print_level > 1 && tol > 0.)
+   if (my_id == 0 && (amg_print_level & 2) && tol > 0.)
       hypre_printf("\n\nAMG SOLUTION INFO:\n");
 
 
@@ -153,7 +359,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
     *    Compute initial fine-grid residual and print
     *-----------------------------------------------------------------------*/
 
-   if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
+   if ((amg_print_level & 2) || amg_logging > 1 || tol > 0.)
    {
       if ( amg_logging > 1 )
       {
@@ -162,7 +368,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          {
             hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Residual );
          }
-         resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
+         resid_nrm = hypre_BoomerAMGSolveNorm(Residual, resid_nrms);
       }
       else
       {
@@ -171,7 +377,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
          {
             hypre_ParCSRMatrixMatvec(alpha, A_array[0], U_array[0], beta, Vtemp);
          }
-         resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+         resid_nrm = hypre_BoomerAMGSolveNorm(Vtemp, resid_nrms);
       }
 
       /* Since it is does not diminish performance, attempt to return an error flag
@@ -196,6 +402,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
          }
          hypre_error(HYPRE_ERROR_GENERIC);
+         hypre_TFree(resid_nrms, HYPRE_MEMORY_HOST);
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -203,11 +410,19 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
       /* r0 */
       resid_nrm_init = resid_nrm;
+      for (j = 0; j < num_vectors && resid_nrms; j++)
+      {
+         resid_nrms_init[j] = resid_nrms[j];
+      }
 
       if (0 == converge_type)
       {
-         rhs_norm = sqrt(hypre_ParVectorInnerProd(f, f));
-         if (rhs_norm)
+         rhs_norm = hypre_BoomerAMGSolveNorm(f, rhs_norms);
+         if (num_vectors > 1)
+         {
+            relative_resid = hypre_BoomerAMGSolveRelNorm(num_vectors, resid_nrms, rhs_norms);
+         }
+         else if (rhs_norm)
          {
             relative_resid = resid_nrm_init / rhs_norm;
          }
@@ -227,7 +442,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       relative_resid = 1.;
    }
 
-   if (my_id == 0 && amg_print_level > 1)
+   if (my_id == 0 && (amg_print_level & 2))
    {
       hypre_printf("                                            relative\n");
       hypre_printf("               residual        factor       residual\n");
@@ -259,19 +474,19 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
        *    Compute  fine-grid residual and residual norm
        *----------------------------------------------------------------*/
 
-      if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
+      if ((amg_print_level & 2) || amg_logging > 1 || tol > 0.)
       {
          old_resid = resid_nrm;
 
          if ( amg_logging > 1 )
          {
             hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Residual );
-            resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
+            resid_nrm = hypre_BoomerAMGSolveNorm(Residual, resid_nrms);
          }
          else
          {
             hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Vtemp);
-            resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
+            resid_nrm = hypre_BoomerAMGSolveNorm(Vtemp, resid_nrms);
          }
 
          if (old_resid)
@@ -283,7 +498,12 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
             conv_factor = resid_nrm;
          }
 
-         if (0 == converge_type)
+         if (num_vectors > 1)
+         {
+            relative_resid = hypre_BoomerAMGSolveRelNorm(num_vectors, resid_nrms,
+                                                         converge_type ? resid_nrms_init : rhs_norms);
+         }
+         else if (0 == converge_type)
          {
             if (rhs_norm)
             {
@@ -309,7 +529,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       ++hypre_ParAMGDataCumNumIterations(amg_data);
 #endif
 
-      if (my_id == 0 && amg_print_level > 1)
+      if (my_id == 0 && (amg_print_level & 2))
       {
          hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
                resid_nrm, conv_factor, relative_resid);
@@ -331,7 +551,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    else
       conv_factor = 1.;
 
-   if (amg_print_level > 1)
+   if (amg_print_level & 2)
    {
       num_coeffs       = hypre_CTAlloc(HYPRE_Real,  num_levels, HYPRE_MEMORY_HOST);
       num_variables    = hypre_CTAlloc(HYPRE_Real,  num_levels, HYPRE_MEMORY_HOST);
@@ -393,6 +613,13 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
       hypre_TFree(num_variables, HYPRE_MEMORY_HOST);
    }
+   /* cycle part of the performance report, accumulated since the setup */
+   if ((amg_print_level & 2) && (amg_print_level & 4))
+   {
+      hypre_BoomerAMGPerfPrint(amg_data, comm, 0);
+   }
+
+   hypre_TFree(resid_nrms, HYPRE_MEMORY_HOST);
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
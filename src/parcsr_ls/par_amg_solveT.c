@@ -119,7 +119,7 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
     *-----------------------------------------------------------------------*/
 
 
-   if (my_id == 0 && amg_print_level > 1)
+   if (my_id == 0 && (amg_print_level & 2))
       hypre_BoomerAMGWriteSolverParams(amg_data);
 
 
@@ -140,7 +140,7 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
     *     open the log file and write some initial info
     *-----------------------------------------------------------------------*/
 
-   if (my_id == 0 && amg_print_level > 1)
+   if (my_id == 0 && (amg_print_level & 2))
    {
       /*fp = fopen(file_name, "a");*/
 
@@ -172,7 +172,7 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
       relative_resid = resid_nrm_init / rhs_norm;
    }
 
-   if (my_id ==0 && (amg_print_level > 1))
+   if (my_id ==0 && (amg_print_level & 2))
    {
       hypre_printf("                                            relative\n");
       hypre_printf("               residual        factor       residual\n");
@@ -225,7 +225,7 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
       hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
       hypre_ParAMGDataNumIterations(amg_data) = cycle_count;
 
-      if (my_id == 0 && (amg_print_level > 1))
+      if (my_id == 0 && (amg_print_level & 2))
       {
          hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
                  resid_nrm, conv_factor, relative_resid);
@@ -257,7 +257,7 @@ hypre_BoomerAMGSolveT( void               *amg_vdata,
       cycle_cmplxty = cycle_op_count / num_coeffs[0];
    }
 
-   if (my_id == 0 && amg_print_level > 1)
+   if (my_id == 0 && (amg_print_level & 2))
    {
       if (Solve_err_flag == 1)
       {
@@ -86,7 +86,7 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
    /*-----------------------------------------------------------------------
     * Write the solver parameters
     *-----------------------------------------------------------------------*/
-   if (myid == 0 && amg_print_level > 1)
+   if (myid == 0 && (amg_print_level & 2))
    {
       hypre_BoomerAMGWriteSolverParams(amg_data);
    }
@@ -114,7 +114,7 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
    /*-----------------------------------------------------------------------
     *    Compute initial fine-grid residual and print
     *-----------------------------------------------------------------------*/
-   if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
+   if ((amg_print_level & 2) || amg_logging > 1 || tol > 0.)
    {
       if (amg_logging > 1)
       {
@@ -187,7 +187,7 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
       relative_resid = 1.;
    }
 
-   if (myid == 0 && amg_print_level > 1)
+   if (myid == 0 && (amg_print_level & 2))
    {
       hypre_printf("                                            relative\n");
       hypre_printf("               residual        factor       residual\n");
@@ -278,7 +278,7 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
       /*---------------------------------------------------------------
        * Compute fine-grid residual and residual norm
        *----------------------------------------------------------------*/
-      if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
+      if ((amg_print_level & 2) || amg_logging > 1 || tol > 0.)
       {
          old_resid = resid_nrm;
 
@@ -323,7 +323,7 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
          hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
       }
 
-      if (myid == 0 && amg_print_level > 1)
+      if (myid == 0 && (amg_print_level & 2))
       {
          hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
                       resid_nrm, conv_factor, relative_resid);
@@ -347,7 +347,7 @@ hypre_BoomerAMGDDSolve( void               *amgdd_vdata,
       hypre_error(HYPRE_ERROR_CONV);
    }
 
-   if (myid == 0 && amg_print_level > 1)
+   if (myid == 0 && (amg_print_level & 2))
    {
       hypre_printf("\n");
    }
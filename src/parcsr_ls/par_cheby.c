@@ -187,35 +187,165 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A, /* matrix to rela
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_Cheby_Halo
+ *
+ * Gathers the off-processor values of x needed by the rows of A into x_ext.
+ * send_buf must hold the send_map_elmts of the comm_pkg of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRRelax_Cheby_Halo( hypre_ParCSRMatrix *A,
+                              HYPRE_Real         *x,
+                              HYPRE_Real         *send_buf,
+                              HYPRE_Real         *x_ext )
+{
+   hypre_ParCSRCommPkg    *comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int               num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int               send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int              *send_map  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               k;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < send_size; k++)
+   {
+      send_buf[k] = x[send_map[k]];
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_buf, x_ext);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_Cheby_Step
+ *
+ * One fused step of the smoother: for every row i,
+ *
+ *    y_i = c * b_i + d_i * s * (A x)_i       (y_i += ... if add != 0)
+ *
+ * or, if scale_b != 0, y_i = d_i * (c * b_i + s * (A x)_i), with
+ * d_i = ds_i^2 = 1/a_ii if ds != NULL and d_i = 1 otherwise.  The row of A
+ * is read once and the product A x is never stored.  x_ext holds the
+ * off-processor values of x.  y must not be x.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRRelax_Cheby_Step( hypre_ParCSRMatrix *A,
+                              HYPRE_Real          s,
+                              HYPRE_Real         *x,
+                              HYPRE_Real         *x_ext,
+                              HYPRE_Real          c,
+                              HYPRE_Real         *b,
+                              HYPRE_Int           scale_b,
+                              HYPRE_Real         *ds,
+                              HYPRE_Int           add,
+                              HYPRE_Real         *y )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   HYPRE_Real       ax, val;
+   HYPRE_Int        i, jj;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,ax,val) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      ax = 0.0;
+      for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+      {
+         ax += A_diag_data[jj] * x[A_diag_j[jj]];
+      }
+      if (num_cols_offd)
+      {
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ax += A_offd_data[jj] * x_ext[A_offd_j[jj]];
+         }
+      }
+
+      val = s * ax;
+      if (scale_b)
+      {
+         val += c * b[i];
+      }
+      if (ds)
+      {
+         val *= ds[i] * ds[i];
+      }
+      if (!scale_b)
+      {
+         val += c * b[i];
+      }
+
+      if (add)
+      {
+         y[i] += val;
+      }
+      else
+      {
+         y[i] = val;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_Cheby_Solve
+ *
+ * u = u + p(A) r, with the polynomial evaluated by Horner's rule.  With
+ * scaling, the polynomial is in D^(-1/2) A D^(-1/2); writing the iterate in
+ * the unscaled variables, every Horner step becomes
+ *
+ *    w = coefs[i] * D^(-1) r + D^(-1) A w,
+ *
+ * which is a single pass over the rows of A (hypre_ParCSRRelax_Cheby_Step),
+ * and the last step adds to u directly.  r and v are work vectors, z is
+ * only used for order 4.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to relax with */
                             hypre_ParVector *f,    /* right-hand side */
                             HYPRE_Real *ds_data,
                             HYPRE_Real *coefs,
                             HYPRE_Int order,            /* polynomial order */
                             HYPRE_Int scale,            /* scale by diagonal?*/
-                            HYPRE_Int variant,           
+                            HYPRE_Int variant,
                             hypre_ParVector *u,   /* initial/updated approximation */
                             hypre_ParVector *v    /* temporary vector */,
-                            hypre_ParVector *r    /*another temp vector */  )
+                            hypre_ParVector *r    /*another temp vector */,
+                            hypre_ParVector *z    /* third temp vector (order 4) */ )
 {
-   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   MPI_Comm         comm   = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
    HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
    HYPRE_Real *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
-   HYPRE_Real *v_data = hypre_VectorData(hypre_ParVectorLocalVector(v));
-
-   HYPRE_Real  *r_data = hypre_VectorData(hypre_ParVectorLocalVector(r));
-
-   HYPRE_Int i, j;
-   HYPRE_Int num_rows = hypre_CSRMatrixNumRows(A_diag);
- 
-   HYPRE_Real mult;
-   HYPRE_Real *orig_u;
-   
-   HYPRE_Int cheby_order;
-
-   HYPRE_Real  *tmp_data;
-
-   hypre_ParVector    *tmp_vec;
+   HYPRE_Real *r_data = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Real *w_data[2];
+
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Real *send_buf = NULL;
+   HYPRE_Real *x_ext = NULL;
+   HYPRE_Real *x, *y, *ds;
+   HYPRE_Real  mult;
+   HYPRE_Int   num_procs, num_sends;
+   HYPRE_Int   i, k, cheby_order;
+   HYPRE_Int   num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
 
    /* u = u + p(A)r */
 
@@ -226,120 +356,70 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to rela
 
    /* we are using the order of p(A) */
    cheby_order = order -1;
-   
-   orig_u = hypre_CTAlloc(HYPRE_Real,  num_rows, HYPRE_MEMORY_HOST);
 
-   if (!scale)
+   if (cheby_order > 2 && !z)
    {
-      /* get residual: r = f - A*u */
-      hypre_ParVectorCopy(f, r); 
-      hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
-
-      for ( i = 0; i < num_rows; i++ ) 
-      {
-         orig_u[i] = u_data[i];
-         u_data[i] = r_data[i] * coefs[cheby_order]; 
-      }
-      for (i = cheby_order - 1; i >= 0; i-- ) 
-      {
-         hypre_ParCSRMatrixMatvec(1.0, A, u, 0.0, v);
-         mult = coefs[i];
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
-#endif
-         for ( j = 0; j < num_rows; j++ )
-         {
-            u_data[j] = mult * r_data[j] + v_data[j];
-         }
-      }
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE 
-#endif
-      for ( i = 0; i < num_rows; i++ ) 
-      {
-         u_data[i] = orig_u[i] + u_data[i];
-      }
+      hypre_error_in_arg(11);
+      return hypre_error_flag;
    }
-   else /* scaling! */
-   {
-      
-      /*grab 1/sqrt(diagonal) */
-      
-      tmp_vec = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
-                                      hypre_ParCSRMatrixGlobalNumRows(A),
-                                      hypre_ParCSRMatrixRowStarts(A));
-      hypre_ParVectorInitialize(tmp_vec);
-      hypre_ParVectorSetPartitioningOwner(tmp_vec,0);
-      tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(tmp_vec));
 
-    /* get ds_data and get scaled residual: r = D^(-1/2)f -
-       * D^(-1/2)A*u */
+   ds = scale ? ds_data : NULL;
+   w_data[0] = hypre_VectorData(hypre_ParVectorLocalVector(v));
+   w_data[1] = z ? hypre_VectorData(hypre_ParVectorLocalVector(z)) : NULL;
 
-      hypre_ParCSRMatrixMatvec(-1.0, A, u, 0.0, tmp_vec);
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
-#endif
-      for ( j = 0; j < num_rows; j++ ) 
+   hypre_MPI_Comm_size(comm, &num_procs);
+   if (num_procs > 1)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      if (!comm_pkg)
       {
-         r_data[j] = ds_data[j] * (f_data[j] + tmp_data[j]);
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
       }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      send_buf = hypre_TAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                              HYPRE_MEMORY_HOST);
+      x_ext = hypre_TAlloc(HYPRE_Real, hypre_CSRMatrixNumCols(A_offd), HYPRE_MEMORY_HOST);
+   }
 
-      /* save original u, then start 
-         the iteration by multiplying r by the cheby coef.*/
+   /* (scaled) residual: r = D^(-1) (f - A u) */
+   if (num_procs > 1)
+   {
+      hypre_ParCSRRelax_Cheby_Halo(A, u_data, send_buf, x_ext);
+   }
+   hypre_ParCSRRelax_Cheby_Step(A, -1.0, u_data, x_ext, 1.0, f_data, 1, ds, 0, r_data);
 
+   if (cheby_order == 0)
+   {
+      mult = coefs[0];
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-      for ( j = 0; j < num_rows; j++ ) 
+      for (i = 0; i < num_rows; i++)
       {
-         orig_u[j] = u_data[j]; /* orig, unscaled u */
-
-         u_data[j] = r_data[j] * coefs[cheby_order]; 
+         u_data[i] += mult * r_data[i];
       }
-
-      /* now do the other coefficients */   
-      for (i = cheby_order - 1; i >= 0; i-- ) 
+   }
+   else
+   {
+      /* the first Horner iterate, coefs[cheby_order] * r, is not formed */
+      x = r_data;
+      mult = coefs[cheby_order];
+      for (i = cheby_order - 1, k = 0; i >= 0; i--, k = 1 - k)
       {
-         /* v = D^(-1/2)AD^(-1/2)u */
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
-#endif
-         for ( j = 0; j < num_rows; j++ )
-         {
-            tmp_data[j]  =  ds_data[j] * u_data[j];
-         }
-         hypre_ParCSRMatrixMatvec(1.0, A, tmp_vec, 0.0, v);
-
-         /* u_new = coef*r + v*/
-         mult = coefs[i];
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
-#endif
-         for ( j = 0; j < num_rows; j++ )
+         if (num_procs > 1)
          {
-            u_data[j] = mult * r_data[j] + ds_data[j]*v_data[j];
+            hypre_ParCSRRelax_Cheby_Halo(A, x, send_buf, x_ext);
          }
-         
-      } /* end of cheby_order loop */
-
-      /* now we have to scale u_data before adding it to u_orig*/
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
-#endif
-      for ( j = 0; j < num_rows; j++ ) 
-      {
-         u_data[j] = orig_u[j] + ds_data[j]*u_data[j];
+         y = (i > 0) ? w_data[k] : u_data;
+         hypre_ParCSRRelax_Cheby_Step(A, mult, x, x_ext, coefs[i], r_data, 0, ds, (i == 0), y);
+         x = y;
+         mult = 1.0;
       }
-   
-      hypre_ParVectorDestroy(tmp_vec);  
+   }
 
-   }/* end of scaling code */
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_ext, HYPRE_MEMORY_HOST);
 
-   hypre_TFree(orig_u, HYPRE_MEMORY_HOST);
-  
    return hypre_error_flag;
 }
-
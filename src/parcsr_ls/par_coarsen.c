@@ -2064,16 +2064,21 @@ hypre_BoomerAMGCoarsenPMISHost( hypre_ParCSRMatrix    *S,
    HYPRE_Int                *CF_marker;
    HYPRE_Int                *CF_marker_offd;
 
+   hypre_CSRMatrix          *ST_diag, *ST_offd;
+   HYPRE_Int                *ST_diag_i, *ST_offd_i;
+
    HYPRE_Real               *measure_array;
    HYPRE_Int                *graph_array;
    HYPRE_Int                *graph_array_offd;
+   HYPRE_Int                *graph_array2;
+   HYPRE_Int                *graph_array_offd2 = NULL;
    HYPRE_Int                 graph_size;
    HYPRE_BigInt              big_graph_size;
    HYPRE_Int                 graph_offd_size;
    HYPRE_BigInt              global_graph_size;
 
-   HYPRE_Int                 i, j, jj, jS, ig;
-   HYPRE_Int                 index, start, my_id, num_procs, jrow, cnt, elmt;
+   HYPRE_Int                 i, j, jS, ig;
+   HYPRE_Int                 index, start, my_id, num_procs, elmt;
    HYPRE_Int                 nnzrow;
 
    HYPRE_Int                 ierr = 0;
@@ -2158,28 +2163,22 @@ CF_marker, CF_marker_offd: initialize CF_marker
 
    measure_array = hypre_CTAlloc(HYPRE_Real, num_variables + num_cols_offd, HYPRE_MEMORY_HOST);
 
+   /* The column sums of S are the row lengths of its transpose.  The
+      transposes are also used to select the independent sets, so that each
+      node only needs to update its own entry of CF_marker */
+   hypre_CSRMatrixTranspose(S_diag, &ST_diag, 0);
+   hypre_CSRMatrixTranspose(S_offd, &ST_offd, 0);
+   ST_diag_i = hypre_CSRMatrixI(ST_diag);
+   ST_offd_i = hypre_CSRMatrixI(ST_offd);
+
    /* first calculate the local part of the sums for the external nodes */
 #ifdef HYPRE_USING_OPENMP
-   HYPRE_Int *measure_array_temp = hypre_CTAlloc(HYPRE_Int,  num_variables + num_cols_offd, HYPRE_MEMORY_HOST);
-
-#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-   for (i = 0; i < S_offd_i[num_variables]; i++)
-   {
-#pragma omp atomic
-      measure_array_temp[num_variables + S_offd_j[i]]++;
-   }
-
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i = 0; i < num_cols_offd; i++)
    {
-      measure_array[i + num_variables] = measure_array_temp[i + num_variables];
-   }
-#else
-   for (i = 0; i < S_offd_i[num_variables]; i++)
-   {
-      measure_array[num_variables + S_offd_j[i]] += 1.0;
+      measure_array[num_variables + i] = (HYPRE_Real) (ST_offd_i[i+1] - ST_offd_i[i]);
    }
-#endif // HYPRE_USING_OPENMP
 
    /* now send those locally calculated values for the external nodes to the neighboring processors */
    if (num_procs > 1)
@@ -2190,33 +2189,20 @@ CF_marker, CF_marker_offd: initialize CF_marker
    /* calculate the local part for the local nodes */
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
-   for (i = 0; i < S_diag_i[num_variables]; i++)
-   {
-#pragma omp atomic
-      measure_array_temp[S_diag_j[i]]++;
-   }
-
-#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i = 0; i < num_variables; i++)
    {
-      measure_array[i] = measure_array_temp[i];
+      measure_array[i] = (HYPRE_Real) (ST_diag_i[i+1] - ST_diag_i[i]);
    }
 
-   hypre_TFree(measure_array_temp, HYPRE_MEMORY_HOST);
-#else
-   for (i = 0; i < S_diag_i[num_variables]; i++)
-   {
-      measure_array[S_diag_j[i]] += 1.0;
-   }
-#endif // HYPRE_USING_OPENMP
-
    /* finish the communication */
    if (num_procs > 1)
    {
       hypre_ParCSRCommHandleDestroy(comm_handle);
    }
 
-   /* now add the externally calculated part of the local nodes to the local nodes */
+   /* now add the externally calculated part of the local nodes to the local nodes
+      (sequentially, since a node can be sent to several processors) */
    index = 0;
    for (i = 0; i < num_sends; i++)
    {
@@ -2228,6 +2214,9 @@ CF_marker, CF_marker_offd: initialize CF_marker
    }
 
    /* set the measures of the external nodes to zero */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
    for (i = num_variables; i < num_variables + num_cols_offd; i++)
    {
       measure_array[i] = 0;
@@ -2259,6 +2248,9 @@ CF_marker, CF_marker_offd: initialize CF_marker
       graph_array_offd = NULL;
    }
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig) HYPRE_SMP_SCHEDULE
+#endif
    for (ig = 0; ig < num_cols_offd; ig++)
    {
       graph_array_offd[ig] = ig;
@@ -2269,6 +2261,13 @@ CF_marker, CF_marker_offd: initialize CF_marker
    /* now the local part of the graph array, and the local CF_marker array */
    graph_array = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
 
+   /* graph_array2 (also used to flag the nodes of the initial graph) */
+   graph_array2 = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
+   if (num_cols_offd)
+   {
+      graph_array_offd2 = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
+   }
+
    /* Allocate CF_marker if not done before */
    if (*CF_marker_ptr == NULL)
    {
@@ -2276,64 +2275,89 @@ CF_marker, CF_marker_offd: initialize CF_marker
    }
    CF_marker = *CF_marker_ptr;
 
-   if (CF_init == 1)
+   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, 2*(hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,nnzrow)
+#endif
    {
-      cnt = 0;
-      for (i = 0; i < num_variables; i++)
+      HYPRE_Int private_graph_size_cnt = 0;
+
+      HYPRE_Int i_begin, i_end;
+      hypre_GetSimpleThreadPartition(&i_begin, &i_end, num_variables);
+
+      if (CF_init == 1)
       {
-         if ( CF_marker[i] != SF_PT )
+         for (i = i_begin; i < i_end; i++)
          {
-            if ( S_offd_i[i+1] - S_offd_i[i] > 0 || CF_marker[i] == -1 )
+            graph_array2[i] = 0;
+            if ( CF_marker[i] != SF_PT )
             {
-               CF_marker[i] = 0;
-            }
-            if ( CF_marker[i] == Z_PT)
-            {
-               if ( measure_array[i] >= 1.0 || S_diag_i[i+1] - S_diag_i[i] > 0 )
+               if ( S_offd_i[i+1] - S_offd_i[i] > 0 || CF_marker[i] == -1 )
                {
                   CF_marker[i] = 0;
-                  graph_array[cnt++] = i;
+               }
+               if ( CF_marker[i] == Z_PT)
+               {
+                  if ( measure_array[i] >= 1.0 || S_diag_i[i+1] - S_diag_i[i] > 0 )
+                  {
+                     CF_marker[i] = 0;
+                     graph_array2[i] = 1;
+                  }
+                  else
+                  {
+                     CF_marker[i] = F_PT;
+                  }
                }
                else
                {
-                  CF_marker[i] = F_PT;
+                  graph_array2[i] = 1;
                }
             }
             else
             {
-               graph_array[cnt++] = i;
+               measure_array[i] = 0;
             }
-         }
-         else
-         {
-            measure_array[i] = 0;
+            private_graph_size_cnt += graph_array2[i];
          }
       }
-   }
-   else
-   {
-      cnt = 0;
-      for (i = 0; i < num_variables; i++)
+      else
       {
-         CF_marker[i] = 0;
-         nnzrow = (S_diag_i[i+1] - S_diag_i[i]) + (S_offd_i[i+1] - S_offd_i[i]);
-         if (nnzrow == 0)
+         for (i = i_begin; i < i_end; i++)
          {
-            CF_marker[i] = SF_PT; /* an isolated fine grid */
-            if (CF_init == 3 || CF_init == 4)
+            CF_marker[i] = 0;
+            nnzrow = (S_diag_i[i+1] - S_diag_i[i]) + (S_offd_i[i+1] - S_offd_i[i]);
+            graph_array2[i] = 0;
+            if (nnzrow == 0)
             {
-               CF_marker[i] = C_PT;
+               CF_marker[i] = SF_PT; /* an isolated fine grid */
+               if (CF_init == 3 || CF_init == 4)
+               {
+                  CF_marker[i] = C_PT;
+               }
+               measure_array[i] = 0;
+            }
+            else
+            {
+               graph_array2[i] = 1;
+               private_graph_size_cnt++;
             }
-            measure_array[i] = 0;
          }
-         else
+      }
+
+      hypre_prefix_sum(&private_graph_size_cnt, &graph_size, prefix_sum_workspace);
+
+      /* the graph nodes are stored in increasing order, as in the sequential case */
+      for (i = i_begin; i < i_end; i++)
+      {
+         if (graph_array2[i])
          {
-            graph_array[cnt++] = i;
+            graph_array[private_graph_size_cnt++] = i;
          }
       }
-   }
+   } /* omp parallel */
 
-   graph_size = cnt;
+   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
 
    /* now the off-diagonal part of CF_marker */
    if (num_cols_offd)
@@ -2345,24 +2369,16 @@ CF_marker, CF_marker_offd: initialize CF_marker
       CF_marker_offd = NULL;
    }
 
-   for (i = 0; i < num_cols_offd; i++)
-   {
-      CF_marker_offd[i] = 0;
-   }
-
    /*------------------------------------------------
     * Communicate the local measures, which are complete,
     to the external nodes
     *------------------------------------------------*/
-   index = 0;
-   for (i = 0; i < num_sends; i++)
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); j++)
    {
-      start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-      for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
-      {
-         jrow = hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j);
-         buf_data[index++] = measure_array[jrow];
-      }
+      buf_data[j] = measure_array[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
    }
 
    if (num_procs > 1)
@@ -2377,14 +2393,6 @@ CF_marker, CF_marker_offd: initialize CF_marker
       hypre_printf("Proc = %d    Initialize CLJP phase = %f\n", my_id, wall_time);
    }
 
-   /* graph_array2 */
-   HYPRE_Int *graph_array2 = hypre_CTAlloc(HYPRE_Int, num_variables, HYPRE_MEMORY_HOST);
-   HYPRE_Int *graph_array_offd2 = NULL;
-   if (num_cols_offd)
-   {
-      graph_array_offd2 = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
-   }
-
    /*******************************************************************************
      THE INDEPENDENT SET COARSENING LOOP:
     ******************************************************************************/
@@ -2419,83 +2427,10 @@ CF_marker, CF_marker_offd: initialize CF_marker
        *----------------------------------------------------------------------------------------*/
       if (!CF_init || iter)
       {
-         /*
-            hypre_BoomerAMGIndepSet(S, measure_array, graph_array, graph_size,
-            graph_array_offd, graph_offd_size, CF_marker, CF_marker_offd);
-            */
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
-#endif
-         for (ig = 0; ig < graph_size; ig++)
-         {
-            i = graph_array[ig];
-            if (measure_array[i] > 1)
-            {
-               CF_marker[i] = 1;
-            }
-         }
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
-#endif
-         for (ig = 0; ig < graph_offd_size; ig++)
-         {
-            i = graph_array_offd[ig];
-            if (measure_array[i+num_variables] > 1)
-            {
-               CF_marker_offd[i] = 1;
-            }
-         }
-
-         /*-------------------------------------------------------
-          * Remove nodes from the initial independent set
-          *-------------------------------------------------------*/
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(ig, i, jS, j, jj) HYPRE_SMP_SCHEDULE
-#endif
-         for (ig = 0; ig < graph_size; ig++)
-         {
-            i = graph_array[ig];
-
-            if (measure_array[i] > 1)
-            {
-               /* for each local neighbor j of i */
-               for (jS = S_diag_i[i]; jS < S_diag_i[i+1]; jS++)
-               {
-                  j = S_diag_j[jS];
-                  if (measure_array[j] > 1)
-                  {
-                     if (measure_array[i] > measure_array[j])
-                     {
-                        CF_marker[j] = 0;
-                     }
-                     else if (measure_array[j] > measure_array[i])
-                     {
-                        CF_marker[i] = 0;
-                     }
-                  }
-               }
-
-               /* for each offd neighbor j of i */
-               for (jS = S_offd_i[i]; jS < S_offd_i[i+1]; jS++)
-               {
-                  jj = S_offd_j[jS];
-                  j = num_variables + jj;
-                  if (measure_array[j] > 1)
-                  {
-                     if (measure_array[i] > measure_array[j])
-                     {
-                        CF_marker_offd[jj] = 0;
-                     }
-                     else if (measure_array[j] > measure_array[i])
-                     {
-                        CF_marker[i] = 0;
-                     }
-                  }
-               }
-            } /* for each node with measure > 1 */
-         } /* for each node i */
+         hypre_BoomerAMGIndepSetThreaded(S, ST_diag, ST_offd, measure_array,
+                                         graph_array, graph_size,
+                                         graph_array_offd, graph_offd_size,
+                                         CF_marker, CF_marker_offd);
 
          /*------------------------------------------------------------------------------
           * Exchange boundary data for CF_marker: send external CF to internal CF
@@ -2537,23 +2472,32 @@ CF_marker, CF_marker_offd: initialize CF_marker
       /*------------------------------------------------
        * Set C-pts and F-pts.
        *------------------------------------------------*/
+
+      /*---------------------------------------------
+       * If the measure of i is smaller than 1, then
+       * make i and F point (because it does not influence
+       * any other point).  This is done in a separate
+       * pass, so that the loop below only reads entries
+       * of CF_marker whose sign it does not change.
+       *---------------------------------------------*/
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(ig, i, jS, j) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(ig, i) HYPRE_SMP_SCHEDULE
 #endif
       for (ig = 0; ig < graph_size; ig++)
       {
          i = graph_array[ig];
-
-         /*---------------------------------------------
-          * If the measure of i is smaller than 1, then
-          * make i and F point (because it does not influence
-          * any other point)
-          *---------------------------------------------*/
-
          if (measure_array[i] < 1)
          {
             CF_marker[i]= F_PT;
          }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig, i, jS, j) HYPRE_SMP_SCHEDULE
+#endif
+      for (ig = 0; ig < graph_size; ig++)
+      {
+         i = graph_array[ig];
 
          /*---------------------------------------------
           * First treat the case where point i is in the
@@ -2600,14 +2544,12 @@ CF_marker, CF_marker_offd: initialize CF_marker
       /*------------------------------------------------------------------------------
        * Exchange boundary data for CF_marker: send internal points to external points
        *------------------------------------------------------------------------------*/
-      index = 0;
-      for (i = 0; i < num_sends; i++)
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); j++)
       {
-         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
-         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
-         {
-            int_buf_data[index++] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
-         }
+         int_buf_data[j] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
       }
 
       if (num_procs > 1)
@@ -2728,6 +2670,8 @@ CF_marker, CF_marker_offd: initialize CF_marker
    hypre_TFree(buf_data, HYPRE_MEMORY_HOST);
    hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
    hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(ST_diag);
+   hypre_CSRMatrixDestroy(ST_offd);
    /*if (num_procs > 1) hypre_CSRMatrixDestroy(S_ext);*/
 
 #ifdef HYPRE_PROFILE
@@ -98,6 +98,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    hypre_Vector   *l1_norms_level;
    HYPRE_Real    **ds = hypre_ParAMGDataChebyDS(amg_data);
    HYPRE_Real    **coefs = hypre_ParAMGDataChebyCoefs(amg_data);
+   HYPRE_Int      *num_colors = hypre_ParAMGDataNumColors(amg_data);
+   HYPRE_Int     **color_offsets = hypre_ParAMGDataColorOffsets(amg_data);
+   HYPRE_Int     **color_rows = hypre_ParAMGDataColorRows(amg_data);
    HYPRE_Int       seq_cg = 0;
    HYPRE_Int       partial_cycle_coarsest_level;
    HYPRE_Int       partial_cycle_control;
@@ -272,6 +275,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
    while (Not_Finished)
    {
+      hypre_BoomerAMGPerfPhase(amg_data, level, HYPRE_AMG_PHASE_RELAX);
+
       if (num_levels > 1)
       {
          local_size = hypre_VectorSize(hypre_ParVectorLocalVector(F_array[level]));
@@ -452,6 +457,24 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                { /* Gaussian elimination */
                   hypre_GaussElimSolve(amg_data, level, relax_type);
                }
+               else if (relax_type == 18 &&
+                        (hypre_CSRMatrixDataFlt(hypre_ParCSRMatrixDiag(A_array[level])) ||
+                         hypre_VectorNumVectors(hypre_ParVectorLocalVector(Aux_F)) > 1))
+               {   /* L1 - Jacobi on a level stored in single precision or
+                      for a block of right-hand sides */
+                  Solve_err_flag = hypre_BoomerAMGRelaxIF(A_array[level],
+                                                          Aux_F,
+                                                          CF_marker_array[level],
+                                                          relax_type,
+                                                          relax_order,
+                                                          cycle_param,
+                                                          relax_weight[level],
+                                                          omega[level],
+                                                          l1_norms_level ? hypre_VectorData(l1_norms_level) : NULL,
+                                                          Aux_U,
+                                                          Vtemp,
+                                                          Ztemp);
+               }
                else if (relax_type == 18)
                {   /* L1 - Jacobi*/
                   if (relax_order == 1 && cycle_param < 3)
@@ -542,7 +565,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                   hypre_ParCSRRelax_Cheby_Solve(A_array[level], Aux_F,
                                                 ds[level], coefs[level],
                                                 cheby_order, scale,
-                                                variant, Aux_U, Vtemp, Ztemp );
+                                                variant, Aux_U, Vtemp, Ztemp, Ptemp );
                }
                else if (relax_type == 17)
                {
@@ -561,6 +584,36 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                     Aux_U, Vtemp);
                   }
                }
+               else if (relax_type == 11 && color_offsets && color_offsets[level] &&
+                        hypre_VectorNumVectors(hypre_ParVectorLocalVector(Aux_F)) == 1)
+               {  /* multicolor hybrid symmetric Gauss-Seidel */
+                  HYPRE_Int i;
+                  HYPRE_Int loc_relax_points[2] = {0, 0};
+                  HYPRE_Int num_passes = 1;
+
+                  if (old_version)
+                  {
+                     loc_relax_points[0] = relax_points;
+                  }
+                  else if (relax_order == 1 && cycle_param < 3)
+                  {
+                     num_passes = 2;
+                     loc_relax_points[0] = (cycle_param < 2) ?  1 : -1;
+                     loc_relax_points[1] = (cycle_param < 2) ? -1 :  1;
+                  }
+                  for (i = 0; i < num_passes; i++)
+                  {
+                     hypre_BoomerAMGRelaxMulticolorGS(A_array[level],
+                                                      Aux_F,
+                                                      CF_marker_array[level],
+                                                      loc_relax_points[i],
+                                                      relax_weight[level],
+                                                      num_colors[level],
+                                                      color_offsets[level],
+                                                      color_rows[level],
+                                                      Aux_U);
+                  }
+               }
                else if (old_version)
                {
                   /*
@@ -664,6 +717,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          fine_grid = level;
          coarse_grid = level + 1;
 
+         hypre_BoomerAMGPerfPhase(amg_data, fine_grid, HYPRE_AMG_PHASE_RESTRICT);
+
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
 
          alpha = -1.0;
@@ -732,6 +787,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          coarse_grid = level;
          alpha = 1.0;
          beta = 1.0;
+
+         hypre_BoomerAMGPerfPhase(amg_data, fine_grid, HYPRE_AMG_PHASE_PROLONG);
+
          if (block_mode)
          {
             hypre_ParCSRBlockMatrixMatvec(alpha, P_block_array[fine_grid],
@@ -765,6 +823,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       }
    } /* main loop: while (Not_Finished) */
 
+   hypre_BoomerAMGPerfPhase(amg_data, level, HYPRE_AMG_PHASE_NONE);
+
    HYPRE_ANNOTATE_MGLEVEL_END(level);
 
    hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
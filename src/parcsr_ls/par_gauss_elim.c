@@ -198,6 +198,113 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
    return hypre_error_flag;
 }
 
+/*-------------------------------------------------------------------------
+ * Coarse grid solve for a block of right-hand sides stored row-wise
+ * (host only).  All right-hand sides are gathered at once and solved with
+ * one factorization; relax_type 9 uses the LU factorization with pivoting
+ * as well, since hypre_gselim only takes a single right-hand side.
+ *------------------------------------------------------------------------ */
+
+static HYPRE_Int
+hypre_GaussElimSolveMulti (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
+{
+   hypre_ParCSRMatrix *A = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParVector    *f = hypre_ParAMGDataFArray(amg_data)[level];
+   hypre_ParVector    *u = hypre_ParAMGDataUArray(amg_data)[level];
+   MPI_Comm      new_comm  = hypre_ParAMGDataNewComm(amg_data);
+   HYPRE_Int    *comm_info = hypre_ParAMGDataCommInfo(amg_data);
+   HYPRE_Real   *f_data    = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real   *u_data    = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Int     nv        = hypre_VectorNumVectors(hypre_ParVectorLocalVector(f));
+   HYPRE_Int     n         = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int     n_global  = (HYPRE_Int) hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_Int     first_row_index = (HYPRE_Int) hypre_ParCSRMatrixFirstRowIndex(A);
+
+   HYPRE_Int    *info, *displs, *nv_info, *nv_displs;
+   HYPRE_Real   *B_row, *B_col;
+   HYPRE_Int     new_num_procs, i, jv, my_info;
+
+   hypre_MPI_Comm_size(new_comm, &new_num_procs);
+   info   = &comm_info[0];
+   displs = &comm_info[new_num_procs];
+
+   nv_info   = hypre_TAlloc(HYPRE_Int, new_num_procs, HYPRE_MEMORY_HOST);
+   nv_displs = hypre_TAlloc(HYPRE_Int, new_num_procs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < new_num_procs; i++)
+   {
+      nv_info[i]   = nv*info[i];
+      nv_displs[i] = nv*displs[i];
+   }
+
+   B_row = hypre_TAlloc(HYPRE_Real, n_global*nv, HYPRE_MEMORY_HOST);
+   B_col = hypre_TAlloc(HYPRE_Real, n_global*nv, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Allgatherv(f_data, n*nv, HYPRE_MPI_REAL, B_row, nv_info,
+                        nv_displs, HYPRE_MPI_REAL, new_comm);
+
+   /* the right-hand sides are needed column-major */
+   for (i = 0; i < n_global; i++)
+   {
+      for (jv = 0; jv < nv; jv++)
+      {
+         B_col[jv*n_global + i] = B_row[i*nv + jv];
+      }
+   }
+
+   if (relax_type == 9 || relax_type == 99)
+   {
+      HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
+      HYPRE_Real *A_tmp = hypre_TAlloc(HYPRE_Real, n_global*n_global, HYPRE_MEMORY_HOST);
+      HYPRE_Int  *piv   = hypre_CTAlloc(HYPRE_Int, n_global, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < n_global*n_global; i++)
+      {
+         A_tmp[i] = A_mat[i];
+      }
+
+      /* A_mat is stored row-major for 9 and column-major for 99 */
+      hypre_dgetrf(&n_global, &n_global, A_tmp, &n_global, piv, &my_info);
+      hypre_dgetrs(relax_type == 9 ? "T" : "N", &n_global, &nv, A_tmp, &n_global, piv,
+                   B_col, &n_global, &my_info);
+
+      for (i = 0; i < n; i++)
+      {
+         for (jv = 0; jv < nv; jv++)
+         {
+            u_data[i*nv + jv] = B_col[jv*n_global + first_row_index + i];
+         }
+      }
+
+      hypre_TFree(piv, HYPRE_MEMORY_HOST);
+      hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
+   }
+   else if (relax_type == 199)
+   {
+      HYPRE_Real *Ainv = hypre_ParAMGDataAInv(amg_data);
+      char cN = 'N';
+      HYPRE_Real one = 1.0, zero = 0.0;
+
+      /* B_row holds the local rows of inv(A)*B, column-major */
+      hypre_dgemm(&cN, &cN, &n, &nv, &n_global, &one, Ainv, &n, B_col, &n_global,
+                  &zero, B_row, &n);
+
+      for (i = 0; i < n; i++)
+      {
+         for (jv = 0; jv < nv; jv++)
+         {
+            u_data[i*nv + jv] = B_row[jv*n + i];
+         }
+      }
+   }
+
+   hypre_TFree(nv_info, HYPRE_MEMORY_HOST);
+   hypre_TFree(nv_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(B_row, HYPRE_MEMORY_HOST);
+   hypre_TFree(B_col, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /* relax_type = 9, 99, 199, see par_relax.c for 19 and 98 */
 HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
 {
@@ -215,7 +322,11 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
       hypre_GaussElimSetup(amg_data, level, relax_type);
    }
 
-   if (n)
+   if (n && hypre_VectorNumVectors(hypre_ParVectorLocalVector(hypre_ParAMGDataFArray(amg_data)[level])) > 1)
+   {
+      hypre_GaussElimSolveMulti(amg_data, level, relax_type);
+   }
+   else if (n)
    {
       MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
       hypre_ParVector *f = hypre_ParAMGDataFArray(amg_data)[level];
@@ -76,6 +76,18 @@ hypre_ILUCreate()
    /* reordering_type default to use local RCM */
    (ilu_data -> reordering_type) = 1;
 
+   /* triangular solves */
+   (ilu_data -> tri_solve)             = 1;
+   (ilu_data -> lower_jacobi_iters)    = 5;
+   (ilu_data -> upper_jacobi_iters)    = 5;
+   (ilu_data -> l_num_levels)          = 0;
+   (ilu_data -> l_level_ptr)           = NULL;
+   (ilu_data -> l_level_rows)          = NULL;
+   (ilu_data -> u_num_levels)          = 0;
+   (ilu_data -> u_level_ptr)           = NULL;
+   (ilu_data -> u_level_rows)          = NULL;
+   (ilu_data -> tri_work)              = NULL;
+
    /* see hypre_ILUSetType for more default values */
 
    return (void *)                     ilu_data;
@@ -145,6 +157,13 @@ hypre_ILUDestroy( void *data )
       hypre_ParILUDataUEnd(ilu_data) = NULL;
    }
 
+   /* triangular solves */
+   hypre_TFree(hypre_ParILUDataLLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataTriWork(ilu_data), HYPRE_MEMORY_HOST);
+
    /* Factors */
    if(ilu_data -> matL)
    {
@@ -383,6 +402,40 @@ hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type )
    (ilu_data -> reordering_type) = ordering_type;
    return hypre_error_flag;
 }
+/* Set how the triangular systems with L and U are solved */
+HYPRE_Int
+hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> tri_solve) = tri_solve;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi iterations for the L solve (tri_solve = 0) */
+HYPRE_Int
+hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   if (lower_jacobi_iters < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (ilu_data -> lower_jacobi_iters) = lower_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi iterations for the U solve (tri_solve = 0) */
+HYPRE_Int
+hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   if (upper_jacobi_iters < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (ilu_data -> upper_jacobi_iters) = upper_jacobi_iters;
+   return hypre_error_flag;
+}
 
 /* Set KDim (for GMRES) for Solver of Schur System */
 HYPRE_Int
@@ -720,6 +773,84 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
    hypre_printf("\n ILU Solver Parameters: \n");
    hypre_printf("Max number of iterations: %d\n", (ilu_data -> max_iter));
    hypre_printf("Stopping tolerance: %e\n", (ilu_data -> tol));
+   if (ilu_data -> tri_solve)
+   {
+      hypre_printf("Triangular solves: direct, levels of L = %d, U = %d\n",
+                   (ilu_data -> l_num_levels), (ilu_data -> u_num_levels));
+   }
+   else
+   {
+      hypre_printf("Triangular solves: Jacobi, iterations for L = %d, U = %d\n",
+                   (ilu_data -> lower_jacobi_iters), (ilu_data -> upper_jacobi_iters));
+   }
+
+   return hypre_error_flag;
+}
+
+/* Level schedule of a triangular factor
+ * Row i of the factor depends on the rows given by the column indices
+ * A_j[A_i[i]], ..., A_j[end-1], with end = A_end[i] if A_end is not NULL and
+ * end = A_i[i+1] otherwise.  Only columns j < i (lower != 0) or i < j < n
+ * (lower == 0) are dependencies, other columns are ignored.
+ * The level of a row is one more than the largest level of the rows it
+ * depends on, so the rows of a level can be solved for concurrently once
+ * the previous levels are done.  On return, the rows of level k are
+ *    level_rows[level_ptr[k]], ..., level_rows[level_ptr[k+1]-1]
+ * in increasing order.
+ */
+HYPRE_Int
+hypre_ILUBuildLevelSchedule(HYPRE_Int n, HYPRE_Int *A_i, HYPRE_Int *A_end, HYPRE_Int *A_j,
+      HYPRE_Int lower, HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr,
+      HYPRE_Int **level_rows_ptr)
+{
+   HYPRE_Int   *level, *level_ptr, *level_rows;
+   HYPRE_Int   num_levels = 0;
+   HYPRE_Int   i, j, k, jj, end, lev;
+
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (k = 0; k < n; k++)
+   {
+      i = lower ? k : n-1-k;
+      end = A_end ? A_end[i] : A_i[i+1];
+      lev = 0;
+      for (jj = A_i[i]; jj < end; jj++)
+      {
+         j = A_j[jj];
+         if (lower ? (j >= 0 && j < i) : (j > i && j < n))
+         {
+            lev = hypre_max(lev, level[j]+1);
+         }
+      }
+      level[i] = lev;
+      num_levels = hypre_max(num_levels, lev+1);
+   }
+
+   /* group the rows by level */
+   level_ptr  = hypre_CTAlloc(HYPRE_Int, num_levels+1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      level_ptr[level[i]+1]++;
+   }
+   for (k = 0; k < num_levels; k++)
+   {
+      level_ptr[k+1] += level_ptr[k];
+   }
+   for (i = 0; i < n; i++)
+   {
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for (k = num_levels; k > 0; k--)
+   {
+      level_ptr[k] = level_ptr[k-1];
+   }
+   level_ptr[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levels_ptr = num_levels;
+   *level_ptr_ptr  = level_ptr;
+   *level_rows_ptr = level_rows;
 
    return hypre_error_flag;
 }
@@ -2968,6 +3099,7 @@ hypre_CSRMatrixScale(hypre_CSRMatrix *A, HYPRE_Real scalar)
    {
       data[i] *= scalar;
    }
+   hypre_CSRMatrixSELLUpdateValues(A);
    return hypre_error_flag;
 }
 
@@ -85,6 +85,22 @@ typedef struct hypre_ParILUData_struct
    
    /* local reordering */
    HYPRE_Int 	reordering_type;
+
+   /* triangular solves with L and U, see hypre_ILUSetTriSolve */
+   HYPRE_Int            tri_solve;/* 1: direct, 0: Jacobi iterations */
+   HYPRE_Int            lower_jacobi_iters;
+   HYPRE_Int            upper_jacobi_iters;
+   /* level schedules of L and U for the threaded direct solves, the rows
+    * of level k are level_rows[level_ptr[k]], ..., level_rows[level_ptr[k+1]-1]
+    */
+   HYPRE_Int            l_num_levels;
+   HYPRE_Int            *l_level_ptr;
+   HYPRE_Int            *l_level_rows;
+   HYPRE_Int            u_num_levels;
+   HYPRE_Int            *u_level_ptr;
+   HYPRE_Int            *u_level_rows;
+   /* two vectors of work space for the Jacobi iterations */
+   HYPRE_Real           *tri_work;
    
 } hypre_ParILUData;
 
@@ -128,6 +144,16 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataRhs(ilu_data)                          ((ilu_data) -> rhs)
 #define hypre_ParILUDataX(ilu_data)                            ((ilu_data) -> x)
 #define hypre_ParILUDataReorderingType(ilu_data)                            ((ilu_data) -> reordering_type)
+#define hypre_ParILUDataTriSolve(ilu_data)                     ((ilu_data) -> tri_solve)
+#define hypre_ParILUDataLowerJacobiIters(ilu_data)             ((ilu_data) -> lower_jacobi_iters)
+#define hypre_ParILUDataUpperJacobiIters(ilu_data)             ((ilu_data) -> upper_jacobi_iters)
+#define hypre_ParILUDataLNumLevels(ilu_data)                   ((ilu_data) -> l_num_levels)
+#define hypre_ParILUDataLLevelPtr(ilu_data)                    ((ilu_data) -> l_level_ptr)
+#define hypre_ParILUDataLLevelRows(ilu_data)                   ((ilu_data) -> l_level_rows)
+#define hypre_ParILUDataUNumLevels(ilu_data)                   ((ilu_data) -> u_num_levels)
+#define hypre_ParILUDataULevelPtr(ilu_data)                    ((ilu_data) -> u_level_ptr)
+#define hypre_ParILUDataULevelRows(ilu_data)                   ((ilu_data) -> u_level_rows)
+#define hypre_ParILUDataTriWork(ilu_data)                      ((ilu_data) -> tri_work)
 /* Schur System */
 #define hypre_ParILUDataSchurGMRESKDim(ilu_data)               ((ilu_data) -> ss_kDim)
 #define hypre_ParILUDataSchurNSHMaxNumIter(ilu_data)           ((ilu_data) -> ss_kDim)
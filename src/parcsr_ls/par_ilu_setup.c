@@ -147,6 +147,13 @@ hypre_ILUSetup( void               *ilu_vdata,
       hypre_TFree(hypre_ParILUDataUEnd(ilu_data), HYPRE_MEMORY_HOST);
       hypre_ParILUDataUEnd(ilu_data) = NULL;
    }
+   hypre_TFree(hypre_ParILUDataLLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataTriWork(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataLNumLevels(ilu_data) = 0;
+   hypre_ParILUDataUNumLevels(ilu_data) = 0;
    if (hypre_ParILUDataRhs(ilu_data))
    {
       hypre_ParVectorDestroy(hypre_ParILUDataRhs(ilu_data));
@@ -285,6 +292,9 @@ hypre_ILUSetup( void               *ilu_vdata,
             hypre_ILUSetOwnDropThreshold  (schur_precond, 0);/* using exist droptol */
             HYPRE_ILUSetPrintLevel        (schur_precond, (ilu_data -> sp_print_level));
             HYPRE_ILUSetMaxIter           (schur_precond, (ilu_data -> sp_max_iter));
+            HYPRE_ILUSetTriSolve          (schur_precond, (ilu_data -> tri_solve));
+            HYPRE_ILUSetLowerJacobiIters  (schur_precond, (ilu_data -> lower_jacobi_iters));
+            HYPRE_ILUSetUpperJacobiIters  (schur_precond, (ilu_data -> upper_jacobi_iters));
             //HYPRE_ILUSetTol               (schur_precond, (ilu_data -> sp_tol));
             HYPRE_ILUSetTol               (schur_precond, 0.); /* set tol for preconditioner to zero. Avoids triggering hypre error for non convergence -DOK*/
 
@@ -403,6 +413,19 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParILUDataUExt(ilu_data)            = uext;
    hypre_ParILUDataFExt(ilu_data)            = fext;
 
+   /* setup triangular solves with the first nLU rows of L and U */
+   switch(ilu_type)
+   {
+      case 10: case 11: case 20: case 21: case 40: case 41:
+         hypre_ILUSetupTriSolve(ilu_data, nLU, u_end);
+         break;
+      case 30: case 31:
+         break;
+      default:
+         hypre_ILUSetupTriSolve(ilu_data, n, NULL);
+         break;
+   }
+
    /* compute operator complexity */
    hypre_ParCSRMatrixSetDNumNonzeros(matA);
    nnzS = 0.0;
@@ -462,6 +485,40 @@ hypre_ILUSetup( void               *ilu_vdata,
    return hypre_error_flag;
 }
 
+/* Setup of the triangular solves with the first nLU rows of the factors
+ * tri_solve = 1: level schedules of L and U for the threaded direct solves.
+ *    With a single thread the solves are sequential and no schedule is built.
+ * tri_solve = 0: work space for the Jacobi iterations.
+ * u_end[i] is the end of the part of row i of U in the first nLU columns,
+ *    NULL if all of U is used.
+ */
+HYPRE_Int
+hypre_ILUSetupTriSolve(void *ilu_vdata, HYPRE_Int nLU, HYPRE_Int *u_end)
+{
+   hypre_ParILUData     *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_CSRMatrix      *L_diag   = hypre_ParCSRMatrixDiag(hypre_ParILUDataMatL(ilu_data));
+   hypre_CSRMatrix      *U_diag   = hypre_ParCSRMatrixDiag(hypre_ParILUDataMatU(ilu_data));
+
+   if (hypre_ParILUDataTriSolve(ilu_data))
+   {
+      if (hypre_NumThreads() > 1)
+      {
+         hypre_ILUBuildLevelSchedule(nLU, hypre_CSRMatrixI(L_diag), NULL, hypre_CSRMatrixJ(L_diag), 1,
+               &hypre_ParILUDataLNumLevels(ilu_data), &hypre_ParILUDataLLevelPtr(ilu_data),
+               &hypre_ParILUDataLLevelRows(ilu_data));
+         hypre_ILUBuildLevelSchedule(nLU, hypre_CSRMatrixI(U_diag), u_end, hypre_CSRMatrixJ(U_diag), 0,
+               &hypre_ParILUDataUNumLevels(ilu_data), &hypre_ParILUDataULevelPtr(ilu_data),
+               &hypre_ParILUDataULevelRows(ilu_data));
+      }
+   }
+   else
+   {
+      hypre_ParILUDataTriWork(ilu_data) = hypre_TAlloc(HYPRE_Real, 2*nLU, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 /* ILU(0)
  * A = input matrix
  * perm = permutation array indicating ordering of rows. Perm could come from a
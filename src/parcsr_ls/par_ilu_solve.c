@@ -215,25 +215,25 @@ hypre_ILUSolve( void               *ilu_vdata,
       /* Do one solve on LUe=r */
       switch(ilu_type){
          case 0: case 1:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLU(ilu_vdata, matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
             break;
          case 10: case 11:
-            hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, perm, nLU, matL, matD, matU, matS,
+            hypre_ILUSolveSchurGMRES(ilu_vdata, matA, F_array, U_array, perm, perm, nLU, matL, matD, matU, matS,
                   Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end); //GMRES
             break;
          case 20: case 21:
-            hypre_ILUSolveSchurNSH(matA, F_array, U_array, perm, nLU, matL, matD, matU, matS,
+            hypre_ILUSolveSchurNSH(ilu_vdata, matA, F_array, U_array, perm, nLU, matL, matD, matU, matS,
                   Utemp, Ftemp, schur_solver, rhs, x, u_end); //MR+NSH
             break;
          case 30: case 31:
             hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext); //RAS
             break;
          case 40: case 41:
-            hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, qperm, nLU, matL, matD, matU, matS,
+            hypre_ILUSolveSchurGMRES(ilu_vdata, matA, F_array, U_array, perm, qperm, nLU, matL, matD, matU, matS,
                   Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end); //GMRES
             break;
          default:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLU(ilu_vdata, matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
             break;
 
       }
@@ -325,6 +325,228 @@ hypre_ILUSolve( void               *ilu_vdata,
    return hypre_error_flag;
 }
 
+/* Work space of the Jacobi iterations (tri_solve = 0), allocated here if
+ * tri_solve was switched to 0 after setup
+ */
+static HYPRE_Real *
+hypre_ILUTriWork(hypre_ParILUData *ilu_data, HYPRE_Int nLU)
+{
+   if (!hypre_ParILUDataTriWork(ilu_data))
+   {
+      hypre_ParILUDataTriWork(ilu_data) = hypre_TAlloc(HYPRE_Real, 2*nLU, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_ParILUDataTriWork(ilu_data);
+}
+
+/* Solve with the first nLU rows of the unit lower triangular factor L
+ *    x[qperm[i]] = f[perm[i]] - sum_j L(i,j) x[qperm[j]],  i < nLU
+ * tri_solve = 1: forward substitution, level by level if a level schedule
+ *    was built in setup (rows of a level are independent).
+ * tri_solve = 0: lower_jacobi_iters Jacobi iterations starting from x = f,
+ *    an approximation of the solve that is fully parallel.
+ */
+HYPRE_Int
+hypre_ILUSolveLower(void *ilu_vdata, HYPRE_Int nLU, hypre_CSRMatrix *L_diag,
+                  HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Real *f_data, HYPRE_Real *x_data)
+{
+   hypre_ParILUData  *ilu_data    = (hypre_ParILUData*) ilu_vdata;
+   HYPRE_Real        *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int         *L_diag_i    = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int         *L_diag_j    = hypre_CSRMatrixJ(L_diag);
+   HYPRE_Int         num_levels   = hypre_ParILUDataLNumLevels(ilu_data);
+   HYPRE_Int         *level_ptr   = hypre_ParILUDataLLevelPtr(ilu_data);
+   HYPRE_Int         *level_rows  = hypre_ParILUDataLLevelRows(ilu_data);
+   HYPRE_Int         num_iters    = hypre_ParILUDataLowerJacobiIters(ilu_data);
+   HYPRE_Real        *y_old, *y_new, *y_tmp;
+   HYPRE_Real        val;
+   HYPRE_Int         i, j, ii, lev, iter;
+
+   if (!hypre_ParILUDataTriSolve(ilu_data))
+   {
+      /* Jacobi iterations for x = f - (L - I) x, the last writes into x */
+      y_old = hypre_ILUTriWork(ilu_data, nLU);
+      y_new = y_old + nLU;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         y_old[i] = f_data[perm[i]];
+         if (num_iters == 0)
+         {
+            x_data[qperm[i]] = y_old[i];
+         }
+      }
+      for (iter = 0; iter < num_iters; iter++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,val) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < nLU; i++)
+         {
+            val = f_data[perm[i]];
+            for (j = L_diag_i[i]; j < L_diag_i[i+1]; j++)
+            {
+               val -= L_diag_data[j] * y_old[L_diag_j[j]];
+            }
+            if (iter == num_iters-1)
+            {
+               x_data[qperm[i]] = val;
+            }
+            else
+            {
+               y_new[i] = val;
+            }
+         }
+         y_tmp = y_old; y_old = y_new; y_new = y_tmp;
+      }
+   }
+   else if (level_ptr)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev,ii,i,j,val)
+#endif
+      for (lev = 0; lev < num_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = level_ptr[lev]; ii < level_ptr[lev+1]; ii++)
+         {
+            i = level_rows[ii];
+            val = f_data[perm[i]];
+            for (j = L_diag_i[i]; j < L_diag_i[i+1]; j++)
+            {
+               val -= L_diag_data[j] * x_data[qperm[L_diag_j[j]]];
+            }
+            x_data[qperm[i]] = val;
+         }
+      }
+   }
+   else
+   {
+      for (i = 0; i < nLU; i++)
+      {
+         x_data[qperm[i]] = f_data[perm[i]];
+         for (j = L_diag_i[i]; j < L_diag_i[i+1]; j++)
+         {
+            x_data[qperm[i]] -= L_diag_data[j] * x_data[qperm[L_diag_j[j]]];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/* Solve with the first nLU rows of the upper triangular factor D^{-1} + U,
+ * D is stored as its inverse
+ *    x[qperm[i]] = D[i] * (x[qperm[i]] - sum_j U(i,j) x[qperm[j]]),  i < nLU
+ * The entries of row i are U_diag_j[U_diag_i[i]], ..., up to u_end[i], or to
+ *    the end of the row if u_end is NULL.  The last of them may be in column
+ *    nLU (the first of the Schur complement), whose value is taken from x.
+ * tri_solve = 1: backward substitution, level by level if a level schedule
+ *    was built in setup.
+ * tri_solve = 0: upper_jacobi_iters Jacobi iterations starting from D x.
+ */
+HYPRE_Int
+hypre_ILUSolveUpper(void *ilu_vdata, HYPRE_Int nLU, hypre_CSRMatrix *U_diag,
+                  HYPRE_Int *u_end, HYPRE_Real *D, HYPRE_Int *qperm, HYPRE_Real *x_data)
+{
+   hypre_ParILUData  *ilu_data    = (hypre_ParILUData*) ilu_vdata;
+   HYPRE_Real        *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int         *U_diag_i    = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int         *U_diag_j    = hypre_CSRMatrixJ(U_diag);
+   HYPRE_Int         num_levels   = hypre_ParILUDataUNumLevels(ilu_data);
+   HYPRE_Int         *level_ptr   = hypre_ParILUDataULevelPtr(ilu_data);
+   HYPRE_Int         *level_rows  = hypre_ParILUDataULevelRows(ilu_data);
+   HYPRE_Int         num_iters    = hypre_ParILUDataUpperJacobiIters(ilu_data);
+   HYPRE_Real        *y_old, *y_new, *y_tmp;
+   HYPRE_Real        val;
+   HYPRE_Int         i, j, ii, lev, iter, k2, col;
+
+   if (!hypre_ParILUDataTriSolve(ilu_data))
+   {
+      /* Jacobi iterations, the right-hand side stays in x until the last
+       * iteration writes the result into x */
+      y_old = hypre_ILUTriWork(ilu_data, nLU);
+      y_new = y_old + nLU;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         y_old[i] = D[i] * x_data[qperm[i]];
+         if (num_iters == 0)
+         {
+            x_data[qperm[i]] = y_old[i];
+         }
+      }
+      for (iter = 0; iter < num_iters; iter++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k2,col,val) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < nLU; i++)
+         {
+            k2 = u_end ? u_end[i] : U_diag_i[i+1];
+            val = x_data[qperm[i]];
+            for (j = U_diag_i[i]; j < k2; j++)
+            {
+               col = U_diag_j[j];
+               val -= U_diag_data[j] * (col < nLU ? y_old[col] : x_data[qperm[col]]);
+            }
+            if (iter == num_iters-1)
+            {
+               x_data[qperm[i]] = D[i] * val;
+            }
+            else
+            {
+               y_new[i] = D[i] * val;
+            }
+         }
+         y_tmp = y_old; y_old = y_new; y_new = y_tmp;
+      }
+   }
+   else if (level_ptr)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev,ii,i,j,k2,val)
+#endif
+      for (lev = 0; lev < num_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (ii = level_ptr[lev]; ii < level_ptr[lev+1]; ii++)
+         {
+            i = level_rows[ii];
+            k2 = u_end ? u_end[i] : U_diag_i[i+1];
+            val = x_data[qperm[i]];
+            for (j = U_diag_i[i]; j < k2; j++)
+            {
+               val -= U_diag_data[j] * x_data[qperm[U_diag_j[j]]];
+            }
+            x_data[qperm[i]] = D[i] * val;
+         }
+      }
+   }
+   else
+   {
+      for (i = nLU-1; i >= 0; i--)
+      {
+         k2 = u_end ? u_end[i] : U_diag_i[i+1];
+         for (j = U_diag_i[i]; j < k2; j++)
+         {
+            x_data[qperm[i]] -= U_diag_data[j] * x_data[qperm[U_diag_j[j]]];
+         }
+         x_data[qperm[i]] *= D[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /* Schur Complement solve with GMRES on schur complement
  * ParCSRMatrix S is already built in ilu data sturcture, here directly use S
  * L, D and U factors only have local scope (no off-diagonal processor terms)
@@ -337,7 +559,7 @@ hypre_ILUSolve( void               *ilu_vdata,
 */
 
 HYPRE_Int
-hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+hypre_ILUSolveSchurGMRES(void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParVector    *u, HYPRE_Int *perm, HYPRE_Int *qperm,
                   HYPRE_Int nLU, hypre_ParCSRMatrix *L,
                   HYPRE_Real* D, hypre_ParCSRMatrix *U,
@@ -392,19 +614,14 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    //   f_local = hypre_ParVectorLocalVector(f);
    //   f_data = hypre_VectorData(f_local);
    /* now update with L to solve */
-   for(i = 0 ; i < nLU ; i ++)
-   {
-      utemp_data[qperm[i]] = ftemp_data[perm[i]];
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      for(j = k1 ; j < k2 ; j ++)
-      {
-         utemp_data[qperm[i]] -= L_diag_data[j] * utemp_data[qperm[L_diag_j[j]]];
-      }
-   }
+   hypre_ILUSolveLower(ilu_vdata, nLU, L_diag, perm, qperm, ftemp_data, utemp_data);
 
    /* 2nd need to compute g'i = gi - Ei*UBi^-1*xi
     * now put g'i into the f_temp lower
     */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k1,k2,col) HYPRE_SMP_SCHEDULE
+#endif
    for(i = nLU ; i < n ; i ++)
    {
       k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
@@ -453,6 +670,9 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
     */
    if(nLU < n)
    {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k1,k2,col) HYPRE_SMP_SCHEDULE
+#endif
       for(i = 0 ; i < nLU ; i ++)
       {
          ftemp_data[perm[i]] = utemp_data[qperm[i]];
@@ -463,6 +683,9 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
             ftemp_data[perm[i]] -= U_diag_data[j] * utemp_data[qperm[col]];
          }
       }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for(i = 0 ; i < nLU ; i ++)
       {
          utemp_data[qperm[i]] = ftemp_data[perm[i]];
@@ -471,16 +694,7 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    /* 5th need to solve UBi*ui = zi */
    /* put result in u_temp upper */
-   for(i = nLU-1 ; i >= 0 ; i --)
-   {
-      k1 = U_diag_i[i] ; k2 = u_end[i];
-      for(j = k1 ; j < k2 ; j ++)
-      {
-         col = U_diag_j[j];
-         utemp_data[qperm[i]] -= U_diag_data[j] * utemp_data[qperm[col]];
-      }
-      utemp_data[qperm[i]] *= D[i];
-   }
+   hypre_ILUSolveUpper(ilu_vdata, nLU, U_diag, u_end, D, qperm, utemp_data);
 
    /* done, now everything are in u_temp, update solution */
    hypre_ParVectorAxpy(beta, utemp, u);
@@ -499,7 +713,7 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 */
 
 HYPRE_Int
-hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+hypre_ILUSolveSchurNSH(void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParVector    *u, HYPRE_Int *perm,
                   HYPRE_Int nLU, hypre_ParCSRMatrix *L,
                   HYPRE_Real* D, hypre_ParCSRMatrix *U,
@@ -554,19 +768,14 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    //   f_local = hypre_ParVectorLocalVector(f);
    //   f_data = hypre_VectorData(f_local);
    /* now update with L to solve */
-   for(i = 0 ; i < nLU ; i ++)
-   {
-      utemp_data[perm[i]] = ftemp_data[perm[i]];
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      for(j = k1 ; j < k2 ; j ++)
-      {
-         utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
-      }
-   }
+   hypre_ILUSolveLower(ilu_vdata, nLU, L_diag, perm, perm, ftemp_data, utemp_data);
 
    /* 2nd need to compute g'i = gi - Ei*UBi^-1*xi
     * now put g'i into the f_temp lower
     */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k1,k2,col) HYPRE_SMP_SCHEDULE
+#endif
    for(i = nLU ; i < n ; i ++)
    {
       k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
@@ -617,6 +826,9 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
     */
    if(nLU < n)
    {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k1,k2,col) HYPRE_SMP_SCHEDULE
+#endif
       for(i = 0 ; i < nLU ; i ++)
       {
          ftemp_data[perm[i]] = utemp_data[perm[i]];
@@ -627,6 +839,9 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
             ftemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[col]];
          }
       }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for(i = 0 ; i < nLU ; i ++)
       {
          utemp_data[perm[i]] = ftemp_data[perm[i]];
@@ -635,16 +850,7 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    /* 5th need to solve UBi*ui = zi */
    /* put result in u_temp upper */
-   for(i = nLU-1 ; i >= 0 ; i --)
-   {
-      k1 = U_diag_i[i] ; k2 = u_end[i];
-      for(j = k1 ; j < k2 ; j ++)
-      {
-         col = U_diag_j[j];
-         utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[col]];
-      }
-      utemp_data[perm[i]] *= D[i];
-   }
+   hypre_ILUSolveUpper(ilu_vdata, nLU, U_diag, u_end, D, perm, utemp_data);
 
    /* done, now everything are in u_temp, update solution */
    hypre_ParVectorAxpy(beta, utemp, u);
@@ -659,21 +865,14 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 */
 
 HYPRE_Int
-hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+hypre_ILUSolveLU(void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParVector    *u, HYPRE_Int *perm,
                   HYPRE_Int nLU, hypre_ParCSRMatrix *L,
                   HYPRE_Real* D, hypre_ParCSRMatrix *U,
                   hypre_ParVector *ftemp, hypre_ParVector *utemp)
 {
    hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
-   HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
-   HYPRE_Int       *L_diag_i = hypre_CSRMatrixI(L_diag);
-   HYPRE_Int       *L_diag_j = hypre_CSRMatrixJ(L_diag);
-
    hypre_CSRMatrix *U_diag = hypre_ParCSRMatrixDiag(U);
-   HYPRE_Real      *U_diag_data = hypre_CSRMatrixData(U_diag);
-   HYPRE_Int       *U_diag_i = hypre_CSRMatrixI(U_diag);
-   HYPRE_Int       *U_diag_j = hypre_CSRMatrixJ(U_diag);
 
    hypre_Vector    *utemp_local = hypre_ParVectorLocalVector(utemp);
    HYPRE_Real      *utemp_data  = hypre_VectorData(utemp_local);
@@ -683,7 +882,6 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    HYPRE_Real      alpha;
    HYPRE_Real      beta;
-   HYPRE_Int       i, j, k1, k2;
 
    /* begin */
    alpha = -1.0;
@@ -698,32 +896,10 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
 
    /* L solve - Forward solve */
-   /* copy rhs to account for diagonal of L (which is identity) */
-   for( i = 0; i < nLU; i++ )
-   {
-      utemp_data[perm[i]] = ftemp_data[perm[i]];
-   }
-   /* update with remaining (off-diagonal) entries of L */
-   for( i = 0; i < nLU; i++ )
-   {
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      for(j=k1; j <k2; j++)
-      {
-         utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
-      }
-   }
+   hypre_ILUSolveLower(ilu_vdata, nLU, L_diag, perm, perm, ftemp_data, utemp_data);
+
    /*-------------------- U solve - Backward substitution */
-   for( i = nLU-1; i >= 0; i-- )
-   {
-      /* first update with the remaining (off-diagonal) entries of U */
-      k1 = U_diag_i[i] ; k2 = U_diag_i[i+1];
-      for(j=k1; j <k2; j++)
-      {
-         utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
-      }
-      /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
-      utemp_data[perm[i]] *= D[i];
-   }
+   hypre_ILUSolveUpper(ilu_vdata, nLU, U_diag, NULL, D, perm, utemp_data);
 
    /* Update solution */
    hypre_ParVectorAxpy(beta, utemp, u);
@@ -208,3 +208,140 @@ hypre_BoomerAMGIndepSet( hypre_ParCSRMatrix *S,
    return hypre_error_flag;
 }
 
+
+/*==========================================================================*/
+/*==========================================================================*/
+/**
+  Select an independent set from a graph, as hypre\_BoomerAMGIndepSet,
+  but in a form that can be run on multiple threads.
+
+  hypre\_BoomerAMGIndepSet removes a node from the independent set while
+  visiting its neighbors, i.e., it writes to entries of `IS\_marker' that
+  belong to other nodes.  Here, every node decides on its own entry
+  instead: a node stays in the independent set if no node that it depends
+  on (its row of S) and no node that depends on it (its row of the
+  transpose of S) has a larger measure.  This gives the same independent
+  set, no two threads write the same entry, and the result does not depend
+  on the number of threads.
+
+  {\bf Input files:}
+  _hypre_parcsr_ls.h
+
+  @return Error code.
+
+  @param S [IN]
+  parent graph matrix in CSR format
+  @param ST_diag [IN]
+  transpose of the diagonal part of S
+  @param ST_offd [IN]
+  transpose of the off-diagonal part of S
+  @param measure_array [IN]
+  measures assigned to each node of the parent graph
+  @param graph_array [IN]
+  node numbers in the subgraph to be partitioned
+  @param graph_array_size [IN]
+  number of nodes in the subgraph to be partitioned
+  @param IS_marker [IN/OUT]
+  marker array for independent set
+
+  @see hypre_BoomerAMGIndepSet */
+/*--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGIndepSetThreaded( hypre_ParCSRMatrix *S,
+                                 hypre_CSRMatrix    *ST_diag,
+                                 hypre_CSRMatrix    *ST_offd,
+                                 HYPRE_Real         *measure_array,
+                                 HYPRE_Int          *graph_array,
+                                 HYPRE_Int           graph_array_size,
+                                 HYPRE_Int          *graph_array_offd,
+                                 HYPRE_Int           graph_array_offd_size,
+                                 HYPRE_Int          *IS_marker,
+                                 HYPRE_Int          *IS_marker_offd     )
+{
+   hypre_CSRMatrix *S_diag    = hypre_ParCSRMatrixDiag(S);
+   HYPRE_Int       *S_diag_i  = hypre_CSRMatrixI(S_diag);
+   HYPRE_Int       *S_diag_j  = hypre_CSRMatrixJ(S_diag);
+   hypre_CSRMatrix *S_offd    = hypre_ParCSRMatrixOffd(S);
+   HYPRE_Int       *S_offd_i  = hypre_CSRMatrixI(S_offd);
+   HYPRE_Int       *S_offd_j  = hypre_CSRMatrixJ(S_offd);
+   HYPRE_Int       *ST_diag_i = hypre_CSRMatrixI(ST_diag);
+   HYPRE_Int       *ST_diag_j = hypre_CSRMatrixJ(ST_diag);
+   HYPRE_Int       *ST_offd_i = hypre_CSRMatrixI(ST_offd);
+   HYPRE_Int       *ST_offd_j = hypre_CSRMatrixJ(ST_offd);
+
+   HYPRE_Int        local_num_vars = hypre_CSRMatrixNumRows(S_diag);
+   HYPRE_Int        i, ig, jS, in_set;
+   HYPRE_Real       measure;
+
+   /*-------------------------------------------------------
+    * A local node with measure > 1 is in the independent
+    * set unless one of its neighbors (in either direction)
+    * has a larger measure.  Since the node's own measure is
+    * larger than 1, so is the neighbor's in that case.
+    *-------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig,i,jS,in_set,measure) HYPRE_SMP_SCHEDULE
+#endif
+   for (ig = 0; ig < graph_array_size; ig++)
+   {
+      i = graph_array[ig];
+      measure = measure_array[i];
+      if (measure > 1)
+      {
+         in_set = 1;
+         for (jS = S_diag_i[i]; jS < S_diag_i[i+1] && in_set; jS++)
+         {
+            if (measure_array[S_diag_j[jS]] > measure)
+            {
+               in_set = 0;
+            }
+         }
+         for (jS = S_offd_i[i]; jS < S_offd_i[i+1] && in_set; jS++)
+         {
+            if (measure_array[local_num_vars+S_offd_j[jS]] > measure)
+            {
+               in_set = 0;
+            }
+         }
+         for (jS = ST_diag_i[i]; jS < ST_diag_i[i+1] && in_set; jS++)
+         {
+            if (measure_array[ST_diag_j[jS]] > measure)
+            {
+               in_set = 0;
+            }
+         }
+         IS_marker[i] = in_set;
+      }
+   }
+
+   /*-------------------------------------------------------
+    * An external node is only compared with the local nodes
+    * that depend on it; its other neighbors are taken care
+    * of by its owner.
+    *-------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ig,i,jS,in_set,measure) HYPRE_SMP_SCHEDULE
+#endif
+   for (ig = 0; ig < graph_array_offd_size; ig++)
+   {
+      i = graph_array_offd[ig];
+      measure = measure_array[i+local_num_vars];
+      if (measure > 1)
+      {
+         in_set = 1;
+         for (jS = ST_offd_i[i]; jS < ST_offd_i[i+1] && in_set; jS++)
+         {
+            if (measure_array[ST_offd_j[jS]] > measure)
+            {
+               in_set = 0;
+            }
+         }
+         IS_marker_offd[i] = in_set;
+      }
+   }
+
+   return hypre_error_flag;
+}
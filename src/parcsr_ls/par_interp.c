@@ -2740,6 +2740,153 @@ hypre_BoomerAMGInterpTruncation( hypre_ParCSRMatrix *P,
    }
 }
 
+/*------------------------------------------------
+ * Drop entries in a single row of P, in place
+ *
+ * Row i of P is given by its diagonal part (diag_j, diag_data, *diag_size
+ * entries) and its off-diagonal part (offd_j, offd_data, *offd_size
+ * entries).  The entries kept and their rescaling are the same as in
+ * hypre_BoomerAMGInterpTruncation, so that interpolation routines can
+ * truncate each row as soon as it is formed.  num_cols_diag must be larger
+ * than any column index in diag_j.  aux_j and aux_data are work arrays with
+ * room for the whole row; they are only used if max_elmts > 0.
+ *------------------------------------------------*/
+HYPRE_Int
+hypre_BoomerAMGInterpTruncationRow( HYPRE_Real  trunc_factor,
+                                    HYPRE_Int   max_elmts,
+                                    HYPRE_Int   num_cols_diag,
+                                    HYPRE_Int  *diag_size,
+                                    HYPRE_Int  *diag_j,
+                                    HYPRE_Real *diag_data,
+                                    HYPRE_Int  *offd_size,
+                                    HYPRE_Int  *offd_j,
+                                    HYPRE_Real *offd_data,
+                                    HYPRE_Int  *aux_j,
+                                    HYPRE_Real *aux_data )
+{
+   HYPRE_Int  nd = *diag_size;
+   HYPRE_Int  no = *offd_size;
+   HYPRE_Int  j, cnt, cnt_diag, cnt_offd;
+   HYPRE_Real row_nrm, drop_coeff, row_sum, scale;
+
+   /* drop the entries smaller than trunc_factor times the largest one */
+   if (trunc_factor > 0.0)
+   {
+      row_nrm = 0;
+      for (j = 0; j < nd; j++)
+      {
+         row_nrm = (row_nrm < fabs(diag_data[j])) ? fabs(diag_data[j]) : row_nrm;
+      }
+      for (j = 0; j < no; j++)
+      {
+         row_nrm = (row_nrm < fabs(offd_data[j])) ? fabs(offd_data[j]) : row_nrm;
+      }
+      drop_coeff = trunc_factor * row_nrm;
+
+      row_sum = 0;
+      scale = 0;
+      cnt_diag = 0;
+      for (j = 0; j < nd; j++)
+      {
+         row_sum += diag_data[j];
+         if (fabs(diag_data[j]) < drop_coeff)
+         {
+            continue;
+         }
+         scale += diag_data[j];
+         diag_j[cnt_diag] = diag_j[j];
+         diag_data[cnt_diag++] = diag_data[j];
+      }
+      cnt_offd = 0;
+      for (j = 0; j < no; j++)
+      {
+         row_sum += offd_data[j];
+         if (fabs(offd_data[j]) < drop_coeff)
+         {
+            continue;
+         }
+         scale += offd_data[j];
+         offd_j[cnt_offd] = offd_j[j];
+         offd_data[cnt_offd++] = offd_data[j];
+      }
+      nd = cnt_diag;
+      no = cnt_offd;
+
+      /* rescale, so that the row sum is preserved */
+      if (scale != 0. && scale != row_sum)
+      {
+         scale = row_sum/scale;
+         for (j = 0; j < nd; j++)
+         {
+            diag_data[j] *= scale;
+         }
+         for (j = 0; j < no; j++)
+         {
+            offd_data[j] *= scale;
+         }
+      }
+   }
+
+   /* keep only the max_elmts largest entries */
+   if (max_elmts > 0 && nd + no > max_elmts)
+   {
+      row_sum = 0;
+      cnt = 0;
+      for (j = 0; j < nd; j++)
+      {
+         aux_j[cnt] = diag_j[j];
+         aux_data[cnt++] = diag_data[j];
+         row_sum += diag_data[j];
+      }
+      for (j = 0; j < no; j++)
+      {
+         aux_j[cnt] = offd_j[j] + num_cols_diag;
+         aux_data[cnt++] = offd_data[j];
+         row_sum += offd_data[j];
+      }
+
+      hypre_qsort2_abs(aux_j, aux_data, 0, cnt-1);
+
+      scale = 0;
+      cnt_diag = 0;
+      cnt_offd = 0;
+      for (j = 0; j < max_elmts; j++)
+      {
+         scale += aux_data[j];
+         if (aux_j[j] < num_cols_diag)
+         {
+            diag_j[cnt_diag] = aux_j[j];
+            diag_data[cnt_diag++] = aux_data[j];
+         }
+         else
+         {
+            offd_j[cnt_offd] = aux_j[j] - num_cols_diag;
+            offd_data[cnt_offd++] = aux_data[j];
+         }
+      }
+      nd = cnt_diag;
+      no = cnt_offd;
+
+      if (scale != 0. && scale != row_sum)
+      {
+         scale = row_sum/scale;
+         for (j = 0; j < nd; j++)
+         {
+            diag_data[j] *= scale;
+         }
+         for (j = 0; j < no; j++)
+         {
+            offd_data[j] *= scale;
+         }
+      }
+   }
+
+   *diag_size = nd;
+   *offd_size = no;
+
+   return hypre_error_flag;
+}
+
 /*---------------------------------------------------------------------------
  * hypre_BoomerAMGBuildInterpModUnk - this is a modified interpolation for the unknown approach.
  * here we need to pass in a strength matrix built on the entire matrix.
@@ -200,6 +200,89 @@ hypre_ParKrylovMassDotpTwo( void *x, void *y,
 
 
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdLocal
+ *
+ * Contribution of the calling process to <x,y>; no communication.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParKrylovInnerProdLocal( void *x,
+                               void *y )
+{
+   return ( hypre_SeqVectorInnerProd(
+               hypre_ParVectorLocalVector((hypre_ParVector *) x),
+               hypre_ParVectorLocalVector((hypre_ParVector *) y) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMassInnerProdLocal
+ *
+ * Contributions of the calling process to <x,y[i]>, i = 0..k-1; no
+ * communication.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovMassInnerProdLocal( void      *x,
+                                   void     **y,
+                                   HYPRE_Int  k,
+                                   HYPRE_Int  unroll,
+                                   void      *result )
+{
+   hypre_Vector **y_local;
+   HYPRE_Int      i;
+
+   y_local = hypre_TAlloc(hypre_Vector *, k, HYPRE_MEMORY_HOST);
+   for (i = 0; i < k; i++)
+   {
+      y_local[i] = hypre_ParVectorLocalVector((hypre_ParVector *) y[i]);
+   }
+
+   hypre_SeqVectorMassInnerProd(hypre_ParVectorLocalVector((hypre_ParVector *) x),
+                                y_local, k, unroll, (HYPRE_Real *) result);
+
+   hypre_TFree(y_local, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAllreduce
+ *
+ * Sums count values over the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovAllreduce( void       *A,
+                          HYPRE_Real *send_data,
+                          HYPRE_Real *recv_data,
+                          HYPRE_Int   count )
+{
+   MPI_Comm comm = hypre_ParCSRMatrixComm((hypre_ParCSRMatrix *) A);
+
+   return ( hypre_MPI_Allreduce(send_data, recv_data, count, HYPRE_MPI_REAL,
+                                hypre_MPI_SUM, comm) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovIAllreduce
+ *
+ * Starts a non-blocking sum of count values over the communicator of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovIAllreduce( void              *A,
+                           HYPRE_Real        *send_data,
+                           HYPRE_Real        *recv_data,
+                           HYPRE_Int          count,
+                           hypre_MPI_Request *request )
+{
+   MPI_Comm comm = hypre_ParCSRMatrixComm((hypre_ParCSRMatrix *) A);
+
+   return ( hypre_MPI_Iallreduce(send_data, recv_data, count, HYPRE_MPI_REAL,
+                                 hypre_MPI_SUM, comm, request) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovCopyVector
  *--------------------------------------------------------------------------*/
@@ -246,6 +329,50 @@ hypre_ParKrylovAxpy( HYPRE_Complex alpha,
                                  (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpyInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParKrylovAxpyInnerProd( HYPRE_Complex alpha,
+                              void   *x,
+                              void   *y,
+                              void   *z )
+{
+   return ( hypre_ParVectorAxpyInnerProd( alpha, (hypre_ParVector *) x,
+                                          (hypre_ParVector *) y,
+                                          (hypre_ParVector *) z ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProd2
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProd2( void       *x,
+                           void       *y,
+                           void       *z,
+                           HYPRE_Real *result )
+{
+   return ( hypre_ParVectorInnerProd2( (hypre_ParVector *) x,
+                                       (hypre_ParVector *) y,
+                                       (hypre_ParVector *) z, result ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpby
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovAxpby( HYPRE_Complex alpha,
+                      void         *x,
+                      HYPRE_Complex beta,
+                      void         *y )
+{
+   return ( hypre_ParVectorAxpby( alpha, (hypre_ParVector *) x, beta,
+                                  (hypre_ParVector *) y ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassAxpy
  *--------------------------------------------------------------------------*/
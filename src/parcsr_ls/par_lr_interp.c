@@ -1158,6 +1158,11 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
    hypre_ParCSRCommPkg   *extend_comm_pkg = NULL;
 
+   /* Truncation of the rows of P as they are formed */
+   HYPRE_Int        truncate = (trunc_factor > 0.0 || max_elmts > 0);
+   HYPRE_Int        n_coarse = 0;
+   HYPRE_Int       *prefix_sum_workspace;
+
    if (debug_flag==4) wall_time = time_getWallclockSeconds();
 
    /* BEGIN */
@@ -1242,6 +1247,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
       fine_to_coarse_offset[i] = 0;
       offd_offset[i] = 0;
    }
+   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int, 2*(max_num_threads[0] + 1), HYPRE_MEMORY_HOST);
 
    /*-----------------------------------------------------------------------
     *  Loop over fine grid.
@@ -1482,14 +1488,18 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
          P_diag_size =  P_diag_i[n_fine];
          P_offd_size = P_offd_i[n_fine];
+         n_coarse = fine_to_coarse_offset[num_threads-1];
 
-         if (P_diag_size)
+         /* if P is truncated, the untruncated P is never formed; the
+            truncated rows are collected per thread and copied into P at
+            the end */
+         if (!truncate && P_diag_size)
          {
             P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
             P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
          }
 
-         if (P_offd_size)
+         if (!truncate && P_offd_size)
          {
             P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
             P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
@@ -1514,6 +1524,54 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
          P_marker_offd[i] = -1;
       }
 
+      /*-----------------------------------------------------------------------
+       *  Each row is formed in a row buffer, truncated if requested and
+       *  then appended to P (or to the thread's part of the truncated P).
+       *  P_diag_i and P_offd_i hold the untruncated row offsets until the
+       *  row is formed; the markers refer to these offsets.
+       *-----------------------------------------------------------------------*/
+      HYPRE_Int   max_row_diag = 0, max_row_offd = 0;
+      HYPRE_Int   row_diag_size, row_offd_size;
+      HYPRE_Int  *row_diag_j = NULL, *row_offd_j = NULL, *aux_j = NULL;
+      HYPRE_Real *row_diag_data = NULL, *row_offd_data = NULL, *aux_data = NULL;
+      HYPRE_Int   cnt_diag = 0, cnt_offd = 0;
+      HYPRE_Int   cap_diag = 0, cap_offd = 0;
+      HYPRE_Int  *thread_diag_j = NULL, *thread_offd_j = NULL;
+      HYPRE_Real *thread_diag_data = NULL, *thread_offd_data = NULL;
+
+      for (i = start; i < stop; i++)
+      {
+         max_row_diag = hypre_max(max_row_diag, P_diag_i[i+1] - P_diag_i[i]);
+         max_row_offd = hypre_max(max_row_offd, P_offd_i[i+1] - P_offd_i[i]);
+         if (truncate && max_elmts > 0)
+         {
+            /* a truncated row has at most max_elmts entries */
+            cap_diag += hypre_min(P_diag_i[i+1] - P_diag_i[i], max_elmts);
+            cap_offd += hypre_min(P_offd_i[i+1] - P_offd_i[i], max_elmts);
+         }
+      }
+      if (truncate && max_elmts <= 0)
+      {
+         cap_diag = (P_diag_i[stop] - P_diag_i[start])/2 + max_row_diag;
+         cap_offd = (P_offd_i[stop] - P_offd_i[start])/2 + max_row_offd;
+      }
+      row_diag_j    = hypre_TAlloc(HYPRE_Int,  max_row_diag, HYPRE_MEMORY_HOST);
+      row_diag_data = hypre_TAlloc(HYPRE_Real, max_row_diag, HYPRE_MEMORY_HOST);
+      row_offd_j    = hypre_TAlloc(HYPRE_Int,  max_row_offd, HYPRE_MEMORY_HOST);
+      row_offd_data = hypre_TAlloc(HYPRE_Real, max_row_offd, HYPRE_MEMORY_HOST);
+      if (truncate)
+      {
+         if (max_elmts > 0)
+         {
+            aux_j    = hypre_TAlloc(HYPRE_Int,  max_row_diag + max_row_offd, HYPRE_MEMORY_HOST);
+            aux_data = hypre_TAlloc(HYPRE_Real, max_row_diag + max_row_offd, HYPRE_MEMORY_HOST);
+         }
+         thread_diag_j    = hypre_TAlloc(HYPRE_Int,  cap_diag, HYPRE_MEMORY_HOST);
+         thread_diag_data = hypre_TAlloc(HYPRE_Real, cap_diag, HYPRE_MEMORY_HOST);
+         thread_offd_j    = hypre_TAlloc(HYPRE_Int,  cap_offd, HYPRE_MEMORY_HOST);
+         thread_offd_data = hypre_TAlloc(HYPRE_Real, cap_offd, HYPRE_MEMORY_HOST);
+      }
+
       /*-----------------------------------------------------------------------
        *  Loop over fine grid points.
        *-----------------------------------------------------------------------*/
@@ -1533,8 +1591,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
          if (CF_marker[i] >= 0)
          {
-            P_diag_j[jj_counter]    = fine_to_coarse[i];
-            P_diag_data[jj_counter] = one;
+            row_diag_j[jj_counter - jj_begin_row]    = fine_to_coarse[i];
+            row_diag_data[jj_counter - jj_begin_row] = one;
             jj_counter++;
          }
 
@@ -1559,8 +1617,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                   if (P_marker[i1] < jj_begin_row)
                   {
                      P_marker[i1] = jj_counter;
-                     P_diag_j[jj_counter]    = fine_to_coarse[i1];
-                     P_diag_data[jj_counter] = zero;
+                     row_diag_j[jj_counter - jj_begin_row]    = fine_to_coarse[i1];
+                     row_diag_data[jj_counter - jj_begin_row] = zero;
                      jj_counter++;
                   }
                }
@@ -1575,8 +1633,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                         if (P_marker[k1] < jj_begin_row)
                         {
                            P_marker[k1] = jj_counter;
-                           P_diag_j[jj_counter] = fine_to_coarse[k1];
-                           P_diag_data[jj_counter] = zero;
+                           row_diag_j[jj_counter - jj_begin_row] = fine_to_coarse[k1];
+                           row_diag_data[jj_counter - jj_begin_row] = zero;
                            jj_counter++;
                         }
                      }
@@ -1594,8 +1652,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                            if (P_marker_offd[k1] < jj_begin_row_offd)
                            {
                               P_marker_offd[k1] = jj_counter_offd;
-                              P_offd_j[jj_counter_offd] = k1;
-                              P_offd_data[jj_counter_offd] = zero;
+                              row_offd_j[jj_counter_offd - jj_begin_row_offd] = k1;
+                              row_offd_data[jj_counter_offd - jj_begin_row_offd] = zero;
                               jj_counter_offd++;
                            }
                         }
@@ -1616,8 +1674,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                      if (P_marker_offd[i1] < jj_begin_row_offd)
                      {
                         P_marker_offd[i1] = jj_counter_offd;
-                        P_offd_j[jj_counter_offd] = i1;
-                        P_offd_data[jj_counter_offd] = zero;
+                        row_offd_j[jj_counter_offd - jj_begin_row_offd] = i1;
+                        row_offd_data[jj_counter_offd - jj_begin_row_offd] = zero;
                         jj_counter_offd++;
                      }
                   }
@@ -1634,8 +1692,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                            if (P_marker[loc_col] < jj_begin_row)
                            {
                               P_marker[loc_col] = jj_counter;
-                              P_diag_j[jj_counter] = fine_to_coarse[loc_col];
-                              P_diag_data[jj_counter] = zero;
+                              row_diag_j[jj_counter - jj_begin_row] = fine_to_coarse[loc_col];
+                              row_diag_data[jj_counter - jj_begin_row] = zero;
                               jj_counter++;
                            }
                         }
@@ -1645,8 +1703,8 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                            if (P_marker_offd[loc_col] < jj_begin_row_offd)
                            {
                               P_marker_offd[loc_col] = jj_counter_offd;
-                              P_offd_j[jj_counter_offd]=loc_col;
-                              P_offd_data[jj_counter_offd] = zero;
+                              row_offd_j[jj_counter_offd - jj_begin_row_offd]=loc_col;
+                              row_offd_data[jj_counter_offd - jj_begin_row_offd] = zero;
                               jj_counter_offd++;
                            }
                         }
@@ -1666,7 +1724,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                i1 = A_diag_j[jj];
                if (P_marker[i1] >= jj_begin_row)
                {
-                  P_diag_data[P_marker[i1]] += A_diag_data[jj];
+                  row_diag_data[P_marker[i1] - jj_begin_row] += A_diag_data[jj];
                }
                else if (P_marker[i1] == strong_f_marker)
                {
@@ -1699,7 +1757,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                      {
                         i2 = A_diag_j[jj1];
                         if (P_marker[i2] >= jj_begin_row && (sgn*A_diag_data[jj1]) < 0)
-                           P_diag_data[P_marker[i2]] +=
+                           row_diag_data[P_marker[i2] - jj_begin_row] +=
                               distribute*A_diag_data[jj1];
                         if (i2 == i && (sgn*A_diag_data[jj1]) < 0)
                            diagonal += distribute*A_diag_data[jj1];
@@ -1711,7 +1769,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                            i2 = A_offd_j[jj1];
                            if (P_marker_offd[i2] >= jj_begin_row_offd &&
                                  (sgn*A_offd_data[jj1]) < 0)
-                              P_offd_data[P_marker_offd[i2]] +=
+                              row_offd_data[P_marker_offd[i2] - jj_begin_row_offd] +=
                                  distribute*A_offd_data[jj1];
                         }
                      }
@@ -1735,7 +1793,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                {
                   i1 = A_offd_j[jj];
                   if (P_marker_offd[i1] >= jj_begin_row_offd)
-                     P_offd_data[P_marker_offd[i1]] += A_offd_data[jj];
+                     row_offd_data[P_marker_offd[i1] - jj_begin_row_offd] += A_offd_data[jj];
                   else if (P_marker_offd[i1] == strong_f_marker)
                   {
                      sum = zero;
@@ -1765,7 +1823,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                            { /* diag */
                               loc_col = (HYPRE_Int)(big_k1 - col_1);
                               if (P_marker[loc_col] >= jj_begin_row)
-                                 P_diag_data[P_marker[loc_col]] += distribute*
+                                 row_diag_data[P_marker[loc_col] - jj_begin_row] += distribute*
                                     A_ext_data[jj1];
                               if (loc_col == i)
                                  diagonal += distribute*A_ext_data[jj1];
@@ -1774,7 +1832,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
                            {
                               loc_col = (HYPRE_Int)(-big_k1 - 1);
                               if (P_marker_offd[loc_col] >= jj_begin_row_offd)
-                                 P_offd_data[P_marker_offd[loc_col]] += distribute*
+                                 row_offd_data[P_marker_offd[loc_col] - jj_begin_row_offd] += distribute*
                                     A_ext_data[jj1];
                            }
                         }
@@ -1793,18 +1851,128 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
             }
             if (diagonal)
             {
-               for (jj = jj_begin_row; jj < jj_end_row; jj++)
-                  P_diag_data[jj] /= -diagonal;
-               for (jj = jj_begin_row_offd; jj < jj_end_row_offd; jj++)
-                  P_offd_data[jj] /= -diagonal;
+               for (jj = 0; jj < jj_end_row - jj_begin_row; jj++)
+                  row_diag_data[jj] /= -diagonal;
+               for (jj = 0; jj < jj_end_row_offd - jj_begin_row_offd; jj++)
+                  row_offd_data[jj] /= -diagonal;
             }
          }
          strong_f_marker--;
+
+         row_diag_size = jj_counter - jj_begin_row;
+         row_offd_size = jj_counter_offd - jj_begin_row_offd;
+
+         if (truncate)
+         {
+            hypre_BoomerAMGInterpTruncationRow(trunc_factor, max_elmts, n_coarse,
+                                               &row_diag_size, row_diag_j, row_diag_data,
+                                               &row_offd_size, row_offd_j, row_offd_data,
+                                               aux_j, aux_data);
+
+            if (cnt_diag + row_diag_size > cap_diag)
+            {
+               cap_diag = hypre_max(2*cap_diag, cnt_diag + row_diag_size);
+               thread_diag_j    = hypre_TReAlloc(thread_diag_j,    HYPRE_Int,  cap_diag, HYPRE_MEMORY_HOST);
+               thread_diag_data = hypre_TReAlloc(thread_diag_data, HYPRE_Real, cap_diag, HYPRE_MEMORY_HOST);
+            }
+            if (cnt_offd + row_offd_size > cap_offd)
+            {
+               cap_offd = hypre_max(2*cap_offd, cnt_offd + row_offd_size);
+               thread_offd_j    = hypre_TReAlloc(thread_offd_j,    HYPRE_Int,  cap_offd, HYPRE_MEMORY_HOST);
+               thread_offd_data = hypre_TReAlloc(thread_offd_data, HYPRE_Real, cap_offd, HYPRE_MEMORY_HOST);
+            }
+
+            /* from here on, P_diag_i[i] and P_offd_i[i] are offsets into
+               the thread's part of the truncated P */
+            P_diag_i[i] = cnt_diag;
+            P_offd_i[i] = cnt_offd;
+            for (jj = 0; jj < row_diag_size; jj++)
+            {
+               thread_diag_j[cnt_diag]      = row_diag_j[jj];
+               thread_diag_data[cnt_diag++] = row_diag_data[jj];
+            }
+            for (jj = 0; jj < row_offd_size; jj++)
+            {
+               thread_offd_j[cnt_offd]      = row_offd_j[jj];
+               thread_offd_data[cnt_offd++] = row_offd_data[jj];
+            }
+         }
+         else
+         {
+            for (jj = 0; jj < row_diag_size; jj++)
+            {
+               P_diag_j[jj_begin_row + jj]    = row_diag_j[jj];
+               P_diag_data[jj_begin_row + jj] = row_diag_data[jj];
+            }
+            for (jj = 0; jj < row_offd_size; jj++)
+            {
+               P_offd_j[jj_begin_row_offd + jj]    = row_offd_j[jj];
+               P_offd_data[jj_begin_row_offd + jj] = row_offd_data[jj];
+            }
+         }
       }
       /*-----------------------------------------------------------------------
        *  End large for loop over nfine
        *-----------------------------------------------------------------------*/
 
+      /* copy the thread parts of the truncated P into P */
+      if (truncate)
+      {
+         HYPRE_Int diag_start = cnt_diag, offd_start = cnt_offd;
+
+         hypre_prefix_sum_pair(&diag_start, &P_diag_size, &offd_start, &P_offd_size,
+                               prefix_sum_workspace);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp master
+#endif
+         {
+            P_diag_i[n_fine] = P_diag_size;
+            P_offd_i[n_fine] = P_offd_size;
+            if (P_diag_size)
+            {
+               P_diag_j    = hypre_TAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
+               P_diag_data = hypre_TAlloc(HYPRE_Real, P_diag_size, memory_location_P);
+            }
+            if (P_offd_size)
+            {
+               P_offd_j    = hypre_TAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
+               P_offd_data = hypre_TAlloc(HYPRE_Real, P_offd_size, memory_location_P);
+            }
+         }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+         for (i = start; i < stop; i++)
+         {
+            P_diag_i[i] += diag_start;
+            P_offd_i[i] += offd_start;
+         }
+         for (jj = 0; jj < cnt_diag; jj++)
+         {
+            P_diag_j[diag_start + jj]    = thread_diag_j[jj];
+            P_diag_data[diag_start + jj] = thread_diag_data[jj];
+         }
+         for (jj = 0; jj < cnt_offd; jj++)
+         {
+            P_offd_j[offd_start + jj]    = thread_offd_j[jj];
+            P_offd_data[offd_start + jj] = thread_offd_data[jj];
+         }
+
+         hypre_TFree(aux_j, HYPRE_MEMORY_HOST);
+         hypre_TFree(aux_data, HYPRE_MEMORY_HOST);
+         hypre_TFree(thread_diag_j, HYPRE_MEMORY_HOST);
+         hypre_TFree(thread_diag_data, HYPRE_MEMORY_HOST);
+         hypre_TFree(thread_offd_j, HYPRE_MEMORY_HOST);
+         hypre_TFree(thread_offd_data, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_TFree(row_diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_diag_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_offd_data, HYPRE_MEMORY_HOST);
+
       if (n_fine)
       {
          hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
@@ -1852,27 +2020,6 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    hypre_CSRMatrixMemoryLocation(P_diag) = memory_location_P;
    hypre_CSRMatrixMemoryLocation(P_offd) = memory_location_P;
 
-   /* Compress P, removing coefficients smaller than trunc_factor * Max */
-   if (trunc_factor != 0.0 || max_elmts > 0)
-   {
-#ifdef HYPRE_PROFILE
-      hypre_profile_times[HYPRE_TIMER_ID_EXTENDED_I_INTERP] += hypre_MPI_Wtime();
-#endif
-      hypre_BoomerAMGInterpTruncation(P, trunc_factor, max_elmts);
-#ifdef HYPRE_PROFILE
-      hypre_profile_times[HYPRE_TIMER_ID_EXTENDED_I_INTERP] -= hypre_MPI_Wtime();
-#endif
-
-      P_diag_data = hypre_CSRMatrixData(P_diag);
-      P_diag_i = hypre_CSRMatrixI(P_diag);
-      P_diag_j = hypre_CSRMatrixJ(P_diag);
-      P_offd_data = hypre_CSRMatrixData(P_offd);
-      P_offd_i = hypre_CSRMatrixI(P_offd);
-      P_offd_j = hypre_CSRMatrixJ(P_offd);
-      P_diag_size = P_diag_i[n_fine];
-      P_offd_size = P_offd_i[n_fine];
-   }
-
    /* This builds col_map, col_map should be monotone increasing and contain
     * global numbers. */
    if (P_offd_size)
@@ -1901,6 +2048,7 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    hypre_TFree(diag_offset, HYPRE_MEMORY_HOST);
    hypre_TFree(offd_offset, HYPRE_MEMORY_HOST);
    hypre_TFree(fine_to_coarse_offset, HYPRE_MEMORY_HOST);
+   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
 
    if (num_procs > 1)
    {
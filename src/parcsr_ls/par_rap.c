@@ -9,6 +9,50 @@
 #include "_hypre_utilities.h"
 #include "hypre_hopscotch_hash.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCoarseOperatorPartition
+ *
+ * Splits the rows of R among the threads by the number of entries of A they
+ * touch (the products of R*A) instead of by the number of rows, so that rows
+ * of R of very different lengths (e.g., with aggressive coarsening) do not
+ * serialize on one thread.  The rows of RAP do not depend on the partition.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGCoarseOperatorPartition( HYPRE_Int  num_rows_R,
+                                        HYPRE_Int *R_i,
+                                        HYPRE_Int *R_j,
+                                        HYPRE_Int *A_diag_i,
+                                        HYPRE_Int *A_offd_i,
+                                        HYPRE_Int  num_threads,
+                                        HYPRE_Int *part )
+{
+   HYPRE_Int *work = hypre_TAlloc(HYPRE_Int, num_rows_R+1, HYPRE_MEMORY_HOST);
+   HYPRE_Int  i, jj, i1;
+
+   work[0] = 0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,i1) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_R; i++)
+   {
+      work[i+1] = 1;
+      for (jj = R_i[i]; jj < R_i[i+1]; jj++)
+      {
+         i1 = R_j[jj];
+         work[i+1] += A_diag_i[i1+1] - A_diag_i[i1] + A_offd_i[i1+1] - A_offd_i[i1];
+      }
+   }
+   for (i = 0; i < num_rows_R; i++)
+   {
+      work[i+1] += work[i];
+   }
+
+   hypre_SplitRowsByWork(num_rows_R, work, num_threads, part);
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGBuildCoarseOperator
  *--------------------------------------------------------------------------*/
@@ -169,7 +213,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    HYPRE_Int              num_cols_offd_Pext = 0;
 
    HYPRE_Int              ic, i, j, k;
-   HYPRE_Int              i1, i2, i3, ii, ns, ne, size, rest;
+   HYPRE_Int              i1, i2, i3, ii, ns, ne;
+   HYPRE_Int             *rap_part;
    HYPRE_Int              cnt = 0; /*value; */
    HYPRE_Int              jj1, jj2, jj3, jcol;
 
@@ -517,28 +562,21 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
    P_mark_array = hypre_CTAlloc(HYPRE_Int *,  num_threads, HYPRE_MEMORY_HOST);
    A_mark_array = hypre_CTAlloc(HYPRE_Int *,  num_threads, HYPRE_MEMORY_HOST);
+   rap_part = hypre_TAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
 
    if (num_cols_offd_RT)
    {
       jj_count = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
+      hypre_BoomerAMGCoarseOperatorPartition(num_cols_offd_RT, R_offd_i, R_offd_j,
+                                             A_diag_i, A_offd_i, num_threads, rap_part);
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,jj_counter,jj_row_begining,A_marker,P_marker) HYPRE_SMP_SCHEDULE
 #endif
       for (ii = 0; ii < num_threads; ii++)
       {
-         size = num_cols_offd_RT/num_threads;
-         rest = num_cols_offd_RT - size*num_threads;
-         if (ii < rest)
-         {
-            ns = ii*size+ii;
-            ne = (ii+1)*size+ii+1;
-         }
-         else
-         {
-            ns = ii*size+rest;
-            ne = (ii+1)*size+rest;
-         }
+         ns = rap_part[ii];
+         ne = rap_part[ii+1];
 
          /*-----------------------------------------------------------------------
           *  Allocate marker arrays.
@@ -731,22 +769,12 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
        *-----------------------------------------------------------------------*/
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,jj_counter,jj_row_begining,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
 #endif
       for (ii = 0; ii < num_threads; ii++)
       {
-         size = num_cols_offd_RT/num_threads;
-         rest = num_cols_offd_RT - size*num_threads;
-         if (ii < rest)
-         {
-            ns = ii*size+ii;
-            ne = (ii+1)*size+ii+1;
-         }
-         else
-         {
-            ns = ii*size+rest;
-            ne = (ii+1)*size+rest;
-         }
+         ns = rap_part[ii];
+         ne = rap_part[ii+1];
 
          /*-----------------------------------------------------------------------
           *  Initialize some stuff.
@@ -1160,24 +1188,16 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *-----------------------------------------------------------------------*/
    jj_cnt_diag = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
    jj_cnt_offd = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
+   hypre_BoomerAMGCoarseOperatorPartition(num_cols_diag_RT, R_diag_i, R_diag_j,
+                                          A_diag_i, A_offd_i, num_threads, rap_part);
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker) HYPRE_SMP_SCHEDULE
 #endif
    for (ii = 0; ii < num_threads; ii++)
    {
-      size = num_cols_diag_RT/num_threads;
-      rest = num_cols_diag_RT - size*num_threads;
-      if (ii < rest)
-      {
-         ns = ii*size+ii;
-         ne = (ii+1)*size+ii+1;
-      }
-      else
-      {
-         ns = ii*size+rest;
-         ne = (ii+1)*size+rest;
-      }
+      ns = rap_part[ii];
+      ne = rap_part[ii+1];
 
       P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_cols_diag_P+num_cols_offd_RAP, HYPRE_MEMORY_HOST);
       A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_nz_cols_A, HYPRE_MEMORY_HOST);
@@ -1477,22 +1497,12 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *-----------------------------------------------------------------------*/
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
+#pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker,r_entry,r_a_product,r_a_p_product) HYPRE_SMP_SCHEDULE
 #endif
    for (ii = 0; ii < num_threads; ii++)
    {
-      size = num_cols_diag_RT/num_threads;
-      rest = num_cols_diag_RT - size*num_threads;
-      if (ii < rest)
-      {
-         ns = ii*size+ii;
-         ne = (ii+1)*size+ii+1;
-      }
-      else
-      {
-         ns = ii*size+rest;
-         ne = (ii+1)*size+rest;
-      }
+      ns = rap_part[ii];
+      ne = rap_part[ii+1];
 
       /*-----------------------------------------------------------------------
        *  Initialize some stuff.
@@ -1982,6 +1992,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       RAP_ext = NULL;
    }
    hypre_TFree(P_mark_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(rap_part, HYPRE_MEMORY_HOST);
    hypre_TFree(A_mark_array, HYPRE_MEMORY_HOST);
    hypre_TFree(P_ext_diag_i, HYPRE_MEMORY_HOST);
    hypre_TFree(P_ext_offd_i, HYPRE_MEMORY_HOST);
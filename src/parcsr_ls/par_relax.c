@@ -99,6 +99,20 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    HYPRE_Real      one_minus_omega;
    HYPRE_Real      prod;
 
+   /* blocks of right-hand sides (row-wise multivectors) have their own kernels */
+   if (hypre_VectorNumVectors(hypre_ParVectorLocalVector(f)) > 1)
+   {
+      return hypre_BoomerAMGRelaxMulti(A, f, cf_marker, relax_type, relax_points,
+                                       relax_weight, omega, l1_norms, u, Vtemp, Ztemp);
+   }
+
+   /* matrices with single precision values have their own kernels */
+   if (hypre_CSRMatrixDataFlt(A_diag))
+   {
+      return hypre_BoomerAMGRelaxFlt(A, f, cf_marker, relax_type, relax_points,
+                                     relax_weight, omega, l1_norms, u, Vtemp, Ztemp);
+   }
+
    one_minus_weight = 1.0 - relax_weight;
    one_minus_omega = 1.0 - omega;
    hypre_MPI_Comm_size(comm,&num_procs);
@@ -122,6 +136,7 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 10 -> On-processor direct forward solve for matrices with
     *                        triangular structure (indices need not be ordered
     *                        triangular)
+    *     relax_type = 11 -> hybrid multicolor Symm. Gauss-Seidel
     *     relax_type = 13 -> hybrid L1 Gauss-Seidel forward solve
     *     relax_type = 14 -> hybrid L1 Gauss-Seidel backward solve
     *     relax_type = 15 -> CG
@@ -4256,6 +4271,23 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
       }
       break;
 
+      case 11: /* hybrid multicolor Symm. Gauss-Seidel; BoomerAMG keeps the
+                  coloring of each level, otherwise it is computed on the first
+                  call and stored with the matrix */
+      {
+         if (!hypre_ParCSRMatrixColorOffsets(A))
+         {
+            hypre_BoomerAMGMulticolorSetup(A, &hypre_ParCSRMatrixNumColors(A),
+                                           &hypre_ParCSRMatrixColorOffsets(A),
+                                           &hypre_ParCSRMatrixColorRows(A));
+         }
+         hypre_BoomerAMGRelaxMulticolorGS(A, f, cf_marker, relax_points, relax_weight,
+                                          hypre_ParCSRMatrixNumColors(A),
+                                          hypre_ParCSRMatrixColorOffsets(A),
+                                          hypre_ParCSRMatrixColorRows(A), u);
+      }
+      break;
+
       case 19: /* Direct solve: use gaussian elimination */
       {
          HYPRE_Int n_global = (HYPRE_Int) global_num_rows;
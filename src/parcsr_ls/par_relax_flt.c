@@ -0,0 +1,326 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Relaxation for matrices with single precision values
+ * (see hypre_ParCSRMatrixConvertToFloat and HYPRE_BoomerAMGSetMixedPrecision).
+ *
+ * The matrix values are read in single precision; the vectors and all
+ * arithmetic stay in full precision.  The same smoothers as in par_relax.c
+ * are provided for relax types 0, 3, 4, 6, 8, 13, 14 and 18.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFltSupported
+ *
+ * Returns 1 if relax_type can be used on a matrix with single precision
+ * values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxFltSupported( HYPRE_Int relax_type )
+{
+   switch (relax_type)
+   {
+      case 0:
+      case 3:
+      case 4:
+      case 6:
+      case 8:
+      case 13:
+      case 14:
+      case 18:
+         return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxFlt
+ *
+ * Same arguments as hypre_BoomerAMGRelax.  The hybrid Gauss-Seidel/SOR
+ * smoothers (3, 4, 6) and their l1 variants (13, 14, 8) are Jacobi across
+ * processors and across thread blocks, and Gauss-Seidel within a block.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxFlt( hypre_ParCSRMatrix *A,
+                         hypre_ParVector    *f,
+                         HYPRE_Int          *cf_marker,
+                         HYPRE_Int           relax_type,
+                         HYPRE_Int           relax_points,
+                         HYPRE_Real          relax_weight,
+                         HYPRE_Real          omega,
+                         HYPRE_Real         *l1_norms,
+                         hypre_ParVector    *u,
+                         hypre_ParVector    *Vtemp,
+                         hypre_ParVector    *Ztemp )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_float     *A_diag_data  = hypre_CSRMatrixDataFlt(A_diag);
+   HYPRE_Int       *A_diag_i     = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_float     *A_offd_data  = hypre_CSRMatrixDataFlt(A_offd);
+   HYPRE_Int       *A_offd_i     = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j     = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle;
+
+   HYPRE_Int        n = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+
+   HYPRE_Real      *u_data  = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data  = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Real      *Vext_data = NULL;
+   HYPRE_Real      *v_buf_data = NULL;
+   HYPRE_Real      *tmp_data = NULL;
+
+   HYPRE_Int        i, ii, j, jj, k;
+   HYPRE_Int        ns, ne, size, rest;
+   HYPRE_Int        num_sends, index, start;
+   HYPRE_Int        num_procs, num_threads;
+   HYPRE_Int        use_l1, num_sweeps, sweep, forward;
+
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       diag, res, res0, res2;
+   HYPRE_Real       one_minus_omega = 1.0 - omega;
+   HYPRE_Real       prod = 1.0 - relax_weight*omega;
+
+   if (!hypre_BoomerAMGRelaxFltSupported(relax_type))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Relax type not available for single precision matrices!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+
+   use_l1 = (l1_norms != NULL) &&
+            (relax_type == 8 || relax_type == 13 || relax_type == 14 || relax_type == 18);
+
+   /*-----------------------------------------------------------------
+    * Get the off-processor values of u
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      v_buf_data = hypre_CTAlloc(HYPRE_Real,
+                                 hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                 HYPRE_MEMORY_HOST);
+      Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+         {
+            v_buf_data[index++] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      comm_handle = NULL;
+   }
+
+   /*-----------------------------------------------------------------
+    * Jacobi (0) and l1-Jacobi (18)
+    *-----------------------------------------------------------------*/
+
+   if (relax_type == 0 || relax_type == 18)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,diag,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         if (relax_points != 0 && cf_marker[i] != relax_points)
+         {
+            continue;
+         }
+
+         diag = use_l1 ? l1_norms[i] : (HYPRE_Real) A_diag_data[A_diag_i[i]];
+         if (diag == zero)
+         {
+            continue;
+         }
+
+         res = f_data[i];
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            res -= A_diag_data[jj] * Vtemp_data[ii];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[ii];
+         }
+
+         /* for Jacobi this is (1-w) u_i + w (f_i - sum_{j!=i} a_ij u_j) / a_ii */
+         u_data[i] = Vtemp_data[i] + relax_weight * res / diag;
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Hybrid Gauss-Seidel/SOR: forward (3, 13), backward (4, 14) and
+    * symmetric (6, 8)
+    *-----------------------------------------------------------------*/
+
+   else
+   {
+      num_sweeps = (relax_type == 6 || relax_type == 8) ? 2 : 1;
+
+      if (num_threads > 1)
+      {
+         tmp_data = Ztemp ? hypre_VectorData(hypre_ParVectorLocalVector(Ztemp)) :
+                    hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         tmp_data = u_data;
+      }
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         forward = (relax_type == 4 || relax_type == 14) ? 0 : (sweep == 0);
+
+         if (num_threads > 1 || relax_weight != 1.0 || omega != 1.0)
+         {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < n; i++)
+            {
+               Vtemp_data[i] = u_data[i];
+               if (num_threads > 1)
+               {
+                  tmp_data[i] = u_data[i];
+               }
+            }
+         }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,j,jj,k,ns,ne,size,rest,diag,res,res0,res2) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < num_threads; j++)
+         {
+            size = n/num_threads;
+            rest = n - size*num_threads;
+            if (j < rest)
+            {
+               ns = j*size+j;
+               ne = (j+1)*size+j+1;
+            }
+            else
+            {
+               ns = j*size+rest;
+               ne = (j+1)*size+rest;
+            }
+
+            for (k = 0; k < ne - ns; k++)
+            {
+               i = forward ? ns + k : ne - 1 - k;
+
+               if (relax_points != 0 && cf_marker[i] != relax_points)
+               {
+                  continue;
+               }
+
+               diag = use_l1 ? l1_norms[i] : (HYPRE_Real) A_diag_data[A_diag_i[i]];
+               if (diag == zero)
+               {
+                  continue;
+               }
+
+               res = f_data[i];
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  ii = A_offd_j[jj];
+                  res -= A_offd_data[jj] * Vext_data[ii];
+               }
+
+               if (relax_weight == 1.0 && omega == 1.0)
+               {
+                  for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+                  {
+                     ii = A_diag_j[jj];
+                     if (ii >= ns && ii < ne)
+                     {
+                        res -= A_diag_data[jj] * u_data[ii];
+                     }
+                     else
+                     {
+                        res -= A_diag_data[jj] * tmp_data[ii];
+                     }
+                  }
+                  u_data[i] += res / diag;
+               }
+               else
+               {
+                  res0 = 0.0;
+                  res2 = 0.0;
+                  for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+                  {
+                     ii = A_diag_j[jj];
+                     if (ii >= ns && ii < ne)
+                     {
+                        res0 -= A_diag_data[jj] * u_data[ii];
+                        res2 += A_diag_data[jj] * Vtemp_data[ii];
+                     }
+                     else
+                     {
+                        res -= A_diag_data[jj] * tmp_data[ii];
+                     }
+                  }
+                  u_data[i] *= prod;
+                  u_data[i] += relax_weight*(omega*res + res0 + one_minus_omega*res2) / diag;
+               }
+            }
+         }
+      }
+
+      if (num_threads > 1 && !Ztemp)
+      {
+         hypre_TFree(tmp_data, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   if (num_procs > 1)
+   {
+      hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
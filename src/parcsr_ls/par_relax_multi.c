@@ -0,0 +1,379 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Relaxation for multivectors stored row-wise (multivec_storage_method 1,
+ * see hypre_ParVectorSetMultiVecStorageMethod), used for AMG solves with a
+ * block of right-hand sides.
+ *
+ * Each row of the matrix is loaded once and applied to the num_vectors
+ * values of the row.  The same smoothers as in par_relax.c are provided for
+ * relax types 0, 3, 4, 6, 8, 13, 14 and 18.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiSupported
+ *
+ * Returns 1 if relax_type can be used with row-wise multivectors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiSupported( HYPRE_Int relax_type )
+{
+   switch (relax_type)
+   {
+      case 0:
+      case 3:
+      case 4:
+      case 6:
+      case 8:
+      case 13:
+      case 14:
+      case 18:
+         return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulti
+ *
+ * Same arguments as hypre_BoomerAMGRelax; f, u, Vtemp and Ztemp (if given)
+ * are row-wise multivectors with the same number of vectors.  As in
+ * hypre_BoomerAMGRelaxFlt, the hybrid Gauss-Seidel/SOR smoothers are Jacobi
+ * across processors and across thread blocks, and Gauss-Seidel within a
+ * block.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulti( hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           HYPRE_Int          *cf_marker,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           relax_points,
+                           HYPRE_Real          relax_weight,
+                           HYPRE_Real          omega,
+                           HYPRE_Real         *l1_norms,
+                           hypre_ParVector    *u,
+                           hypre_ParVector    *Vtemp,
+                           hypre_ParVector    *Ztemp )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data  = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i     = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data  = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i     = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j     = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRHaloPlan *plan;
+
+   hypre_Vector    *u_local = hypre_ParVectorLocalVector(u);
+   hypre_Vector    *f_local = hypre_ParVectorLocalVector(f);
+
+   HYPRE_Int        n  = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        nv = hypre_VectorNumVectors(u_local);
+
+   HYPRE_Real      *u_data  = hypre_VectorData(u_local);
+   HYPRE_Real      *f_data  = hypre_VectorData(f_local);
+   HYPRE_Real      *Vtemp_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Real      *Vext_data = NULL;
+   HYPRE_Real      *tmp_data = NULL;
+   HYPRE_Real      *work, *res, *res0, *res2;
+
+   HYPRE_Int        i, ii, j, jj, jv, k;
+   HYPRE_Int        ns, ne, size, rest;
+   HYPRE_Int        num_procs, num_threads;
+   HYPRE_Int        use_l1, num_sweeps, sweep, forward;
+
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       diag, a_ij;
+   HYPRE_Real       one_minus_omega = 1.0 - omega;
+   HYPRE_Real       prod = 1.0 - relax_weight*omega;
+
+   if (!hypre_BoomerAMGRelaxMultiSupported(relax_type))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Relax type not available for multiple right-hand sides!\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_CSRMatrixDataFlt(A_diag))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multiple right-hand sides not available for single precision matrices!\n");
+      return hypre_error_flag;
+   }
+
+   if (hypre_VectorIndexStride(u_local) != nv || hypre_VectorIndexStride(f_local) != nv ||
+       hypre_VectorNumVectors(f_local) != nv)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Multivectors must be stored row-wise!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+
+   use_l1 = (l1_norms != NULL) &&
+            (relax_type == 8 || relax_type == 13 || relax_type == 14 || relax_type == 18);
+
+   /* scratch for the residuals of one row, per thread */
+   work = hypre_TAlloc(HYPRE_Real, 3*nv*num_threads, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * Get the off-processor values of u.  The receive buffer of the halo
+    * plan holds them row-wise, in the layout of u.
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      plan = hypre_ParCSRCommPkgGetHaloPlan(comm_pkg, 1, nv);
+      hypre_ParCSRHaloPlanPack(plan, comm_pkg, u_data, 1, nv);
+      hypre_ParCSRHaloPlanStart(plan);
+      hypre_ParCSRHaloPlanWait(plan);
+      Vext_data = hypre_ParCSRHaloPlanRecvData(plan);
+   }
+
+   /*-----------------------------------------------------------------
+    * Jacobi (0) and l1-Jacobi (18)
+    *-----------------------------------------------------------------*/
+
+   if (relax_type == 0 || relax_type == 18)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n*nv; i++)
+      {
+         Vtemp_data[i] = u_data[i];
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,jv,diag,a_ij,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         if (relax_points != 0 && cf_marker[i] != relax_points)
+         {
+            continue;
+         }
+
+         diag = use_l1 ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+         if (diag == zero)
+         {
+            continue;
+         }
+
+         res = work + 3*nv*hypre_GetThreadNum();
+         for (jv = 0; jv < nv; jv++)
+         {
+            res[jv] = f_data[i*nv + jv];
+         }
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            ii   = A_diag_j[jj];
+            a_ij = A_diag_data[jj];
+            for (jv = 0; jv < nv; jv++)
+            {
+               res[jv] -= a_ij * Vtemp_data[ii*nv + jv];
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii   = A_offd_j[jj];
+            a_ij = A_offd_data[jj];
+            for (jv = 0; jv < nv; jv++)
+            {
+               res[jv] -= a_ij * Vext_data[ii*nv + jv];
+            }
+         }
+
+         for (jv = 0; jv < nv; jv++)
+         {
+            u_data[i*nv + jv] = Vtemp_data[i*nv + jv] + relax_weight * res[jv] / diag;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Hybrid Gauss-Seidel/SOR: forward (3, 13), backward (4, 14) and
+    * symmetric (6, 8)
+    *-----------------------------------------------------------------*/
+
+   else
+   {
+      num_sweeps = (relax_type == 6 || relax_type == 8) ? 2 : 1;
+
+      if (num_threads > 1)
+      {
+         tmp_data = Ztemp ? hypre_VectorData(hypre_ParVectorLocalVector(Ztemp)) :
+                    hypre_TAlloc(HYPRE_Real, n*nv, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         tmp_data = u_data;
+      }
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         forward = (relax_type == 4 || relax_type == 14) ? 0 : (sweep == 0);
+
+         if (num_threads > 1 || relax_weight != 1.0 || omega != 1.0)
+         {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < n*nv; i++)
+            {
+               Vtemp_data[i] = u_data[i];
+               if (num_threads > 1)
+               {
+                  tmp_data[i] = u_data[i];
+               }
+            }
+         }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,j,jj,jv,k,ns,ne,size,rest,diag,a_ij,res,res0,res2) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < num_threads; j++)
+         {
+            size = n/num_threads;
+            rest = n - size*num_threads;
+            if (j < rest)
+            {
+               ns = j*size+j;
+               ne = (j+1)*size+j+1;
+            }
+            else
+            {
+               ns = j*size+rest;
+               ne = (j+1)*size+rest;
+            }
+
+            res  = work + 3*nv*j;
+            res0 = res + nv;
+            res2 = res + 2*nv;
+
+            for (k = 0; k < ne - ns; k++)
+            {
+               i = forward ? ns + k : ne - 1 - k;
+
+               if (relax_points != 0 && cf_marker[i] != relax_points)
+               {
+                  continue;
+               }
+
+               diag = use_l1 ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+               if (diag == zero)
+               {
+                  continue;
+               }
+
+               for (jv = 0; jv < nv; jv++)
+               {
+                  res[jv] = f_data[i*nv + jv];
+               }
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  ii   = A_offd_j[jj];
+                  a_ij = A_offd_data[jj];
+                  for (jv = 0; jv < nv; jv++)
+                  {
+                     res[jv] -= a_ij * Vext_data[ii*nv + jv];
+                  }
+               }
+
+               if (relax_weight == 1.0 && omega == 1.0)
+               {
+                  for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+                  {
+                     ii   = A_diag_j[jj];
+                     a_ij = A_diag_data[jj];
+                     if (ii >= ns && ii < ne)
+                     {
+                        for (jv = 0; jv < nv; jv++)
+                        {
+                           res[jv] -= a_ij * u_data[ii*nv + jv];
+                        }
+                     }
+                     else
+                     {
+                        for (jv = 0; jv < nv; jv++)
+                        {
+                           res[jv] -= a_ij * tmp_data[ii*nv + jv];
+                        }
+                     }
+                  }
+                  for (jv = 0; jv < nv; jv++)
+                  {
+                     u_data[i*nv + jv] += res[jv] / diag;
+                  }
+               }
+               else
+               {
+                  for (jv = 0; jv < nv; jv++)
+                  {
+                     res0[jv] = 0.0;
+                     res2[jv] = 0.0;
+                  }
+                  for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+                  {
+                     ii   = A_diag_j[jj];
+                     a_ij = A_diag_data[jj];
+                     if (ii >= ns && ii < ne)
+                     {
+                        for (jv = 0; jv < nv; jv++)
+                        {
+                           res0[jv] -= a_ij * u_data[ii*nv + jv];
+                           res2[jv] += a_ij * Vtemp_data[ii*nv + jv];
+                        }
+                     }
+                     else
+                     {
+                        for (jv = 0; jv < nv; jv++)
+                        {
+                           res[jv] -= a_ij * tmp_data[ii*nv + jv];
+                        }
+                     }
+                  }
+                  for (jv = 0; jv < nv; jv++)
+                  {
+                     u_data[i*nv + jv] *= prod;
+                     u_data[i*nv + jv] += relax_weight*(omega*res[jv] + res0[jv] +
+                                                        one_minus_omega*res2[jv]) / diag;
+                  }
+               }
+            }
+         }
+      }
+
+      if (num_threads > 1 && !Ztemp)
+      {
+         hypre_TFree(tmp_data, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,257 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Multicolor hybrid Gauss-Seidel (relax_type 11)
+ *
+ * The graph of the local diagonal block is colored once during setup so that
+ * no two rows of the same color are coupled.  A sweep then relaxes the colors
+ * one after another, with all rows of a color relaxed concurrently.  Unlike
+ * the threaded hybrid smoothers (relax_type 3, 6, 8, ...), which use Jacobi
+ * across the boundaries of the thread blocks, the result does not depend on
+ * the number of threads.  Off-processor couplings are handled as in the
+ * other hybrid smoothers (Jacobi).
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMulticolorSetup
+ *
+ * Greedy coloring of the (symmetrized) graph of the diagonal block of A.
+ * On return, the rows of color c are
+ *
+ *    color_rows[color_offsets[c]], ..., color_rows[color_offsets[c+1]-1]
+ *
+ * in increasing order.  The coloring is computed sequentially and is
+ * therefore independent of the number of threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMulticolorSetup( hypre_ParCSRMatrix  *A,
+                                HYPRE_Int           *num_colors_ptr,
+                                HYPRE_Int          **color_offsets_ptr,
+                                HYPRE_Int          **color_rows_ptr )
+{
+   hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int        n        = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix *A_diagT;
+   HYPRE_Int       *AT_i, *AT_j;
+   HYPRE_Int       *color, *mark, *color_offsets, *color_rows;
+   HYPRE_Int        num_colors = 0;
+   HYPRE_Int        i, j, jj, c;
+
+   /* a row must not share its color with the rows it depends on nor with the
+      rows that depend on it */
+   hypre_CSRMatrixTranspose(A_diag, &A_diagT, 0);
+   AT_i = hypre_CSRMatrixI(A_diagT);
+   AT_j = hypre_CSRMatrixJ(A_diagT);
+
+   color = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   mark  = hypre_TAlloc(HYPRE_Int, n+1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      color[i] = -1;
+      mark[i]  = -1;
+   }
+   mark[n] = -1;
+
+   for (i = 0; i < n; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+      {
+         j = A_diag_j[jj];
+         if (color[j] > -1)
+         {
+            mark[color[j]] = i;
+         }
+      }
+      for (jj = AT_i[i]; jj < AT_i[i+1]; jj++)
+      {
+         j = AT_j[jj];
+         if (color[j] > -1)
+         {
+            mark[color[j]] = i;
+         }
+      }
+
+      /* smallest color not used by a neighbor */
+      c = 0;
+      while (mark[c] == i)
+      {
+         c++;
+      }
+      color[i] = c;
+      num_colors = hypre_max(num_colors, c+1);
+   }
+
+   /* group the rows by color */
+   color_offsets = hypre_CTAlloc(HYPRE_Int, num_colors+1, HYPRE_MEMORY_HOST);
+   color_rows    = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      color_offsets[color[i]+1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_offsets[c+1] += color_offsets[c];
+      mark[c] = color_offsets[c];
+   }
+   for (i = 0; i < n; i++)
+   {
+      color_rows[mark[color[i]]++] = i;
+   }
+
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(mark, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(A_diagT);
+
+   *num_colors_ptr    = num_colors;
+   *color_offsets_ptr = color_offsets;
+   *color_rows_ptr    = color_rows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorGS
+ *
+ * One symmetric multicolor Gauss-Seidel sweep: the colors in increasing
+ * order, then in decreasing order.  relax_weight != 1 gives SSOR.  If
+ * relax_points != 0, only the points with cf_marker[i] == relax_points are
+ * relaxed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorGS( hypre_ParCSRMatrix *A,
+                                  hypre_ParVector    *f,
+                                  HYPRE_Int          *cf_marker,
+                                  HYPRE_Int           relax_points,
+                                  HYPRE_Real          relax_weight,
+                                  HYPRE_Int           num_colors,
+                                  HYPRE_Int          *color_offsets,
+                                  HYPRE_Int          *color_rows,
+                                  hypre_ParVector    *u )
+{
+   MPI_Comm         comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real      *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   HYPRE_Real      *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *Vext_data = NULL;
+   HYPRE_Real      *v_buf_data = NULL;
+
+   HYPRE_Real       one_minus_weight = 1.0 - relax_weight;
+   HYPRE_Real       res, diag;
+   HYPRE_Int        num_procs, num_sends, start, index;
+   HYPRE_Int        c, cc, i, ii, j, jj;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------
+    * Off-processor values of u at the beginning of the sweep
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      v_buf_data = hypre_CTAlloc(HYPRE_Real,
+                                 hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                 HYPRE_MEMORY_HOST);
+      Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+         {
+            v_buf_data[index++] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      comm_handle = NULL;
+   }
+
+   /*-----------------------------------------------------------------
+    * Forward sweep over the colors, then backward.  The rows of a
+    * color are not coupled, so they can be relaxed in any order.
+    *-----------------------------------------------------------------*/
+
+   for (cc = 0; cc < 2*num_colors; cc++)
+   {
+      c = (cc < num_colors) ? cc : 2*num_colors-1-cc;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,i,j,jj,res,diag) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = color_offsets[c]; ii < color_offsets[c+1]; ii++)
+      {
+         i = color_rows[ii];
+         diag = A_diag_data[A_diag_i[i]];
+
+         /*-----------------------------------------------------------
+          * If diagonal is nonzero, relax point i; otherwise, skip it.
+          *-----------------------------------------------------------*/
+
+         if (diag == 0.0 || (relax_points && cf_marker[i] != relax_points))
+         {
+            continue;
+         }
+
+         res = f_data[i];
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            j = A_diag_j[jj];
+            res -= A_diag_data[jj] * u_data[j];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            j = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[j];
+         }
+
+         if (relax_weight == 1.0)
+         {
+            u_data[i] = res / diag;
+         }
+         else
+         {
+            u_data[i] = one_minus_weight * u_data[i] + relax_weight * res / diag;
+         }
+      }
+   }
+
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
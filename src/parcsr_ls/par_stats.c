@@ -121,6 +121,8 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    HYPRE_Real   operat_cmplxty;
    HYPRE_Real   grid_cmplxty = 0;
    HYPRE_Real   memory_cmplxty = 0;
+   HYPRE_Real  *agg_product_nnz = NULL;
+   HYPRE_Int    num_agg_levels;
 
    /* amg solve params */
    HYPRE_Int      max_iter;
@@ -1044,6 +1046,38 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       hypre_printf("\n\n");
    }
 
+   /*----------------------------------------------------------
+    * Aggressive coarsening: the products P1*P2 are truncated
+    * while they are formed, so their untruncated entries are
+    * never stored.  Report how much memory the product would
+    * have needed on top of the truncated P.
+    *----------------------------------------------------------*/
+
+   num_agg_levels = hypre_min(agg_num_levels, num_levels-1);
+   if (hypre_ParAMGDataAggP12ProductNnz(amg_data) && num_agg_levels > 0 && !block_mode)
+   {
+      agg_product_nnz = hypre_CTAlloc(HYPRE_Real, num_agg_levels, HYPRE_MEMORY_HOST);
+      hypre_MPI_Reduce(hypre_ParAMGDataAggP12ProductNnz(amg_data), agg_product_nnz,
+                       num_agg_levels, HYPRE_MPI_REAL, hypre_MPI_SUM, 0, comm);
+
+      if (my_id == 0 && agg_product_nnz[0] > 0)
+      {
+         hypre_printf("Aggressive coarsening, P1*P2 truncated as it is formed:\n\n");
+         hypre_printf("lev %15s %15s %20s\n", "P1*P2 entries", "P entries", "memory saved (MB)");
+         for (i = 0; i < 55; i++) hypre_printf("%s", "=");
+         hypre_printf("\n");
+         for (level = 0; level < num_agg_levels; level++)
+         {
+            global_nonzeros = hypre_ParCSRMatrixDNumNonzeros(P_array[level]);
+            hypre_printf("%3d %15.0f %15.0f %20.2f\n", level, agg_product_nnz[level],
+                         global_nonzeros, (agg_product_nnz[level] - global_nonzeros) *
+                         (sizeof(HYPRE_Int) + sizeof(HYPRE_Complex)) / (1024.0*1024.0));
+         }
+         hypre_printf("\n\n");
+      }
+      hypre_TFree(agg_product_nnz, HYPRE_MEMORY_HOST);
+   }
+
    if (my_id == 0)
    {
       hypre_printf("\n\nBoomerAMG SOLVER PARAMETERS:\n\n");
@@ -1348,7 +1382,7 @@ HYPRE_Int    hypre_BoomerAMGWriteSolverParams(void* data)
     * AMG info
     *----------------------------------------------------------*/
 
-   if (amg_print_level == 1 || amg_print_level == 3)
+   if (amg_print_level & 1)
    {
       hypre_printf("\n\nBoomerAMG SOLVER PARAMETERS:\n\n");
       hypre_printf( "  Maximum number of cycles:         %d \n",max_iter);
@@ -1432,3 +1466,161 @@ HYPRE_Int    hypre_BoomerAMGWriteSolverParams(void* data)
    return 0;
 }
 
+
+/*---------------------------------------------------------------
+ * hypre_BoomerAMGPerfPhase
+ *
+ * Performance report (print_level & 4): stops the phase that is
+ * currently timed and starts timing 'phase' on 'level'.  The wall
+ * clock time and the messages and bytes sent by this process
+ * (see hypre_parcsr_comm_num_messages) are charged to the level
+ * and phase.  phase = HYPRE_AMG_PHASE_NONE only stops the timer.
+ * Does nothing if the report is off.
+ *---------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPerfPhase( void      *amg_vdata,
+                          HYPRE_Int  level,
+                          HYPRE_Int  phase )
+{
+   hypre_ParAMGData *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Real       *perf_data  = hypre_ParAMGDataPerfData(amg_data);
+   HYPRE_Real       *perf_start = hypre_ParAMGDataPerfStart(amg_data);
+   HYPRE_Real       *entry;
+   HYPRE_Real        now[3];
+   HYPRE_Int         k;
+
+   if (!perf_data)
+   {
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_SEQUENTIAL
+   now[0] = time_getWallclockSeconds();
+#else
+   now[0] = hypre_MPI_Wtime();
+#endif
+   now[1] = hypre_parcsr_comm_num_messages;
+   now[2] = hypre_parcsr_comm_num_bytes;
+
+   if (hypre_ParAMGDataPerfPhase(amg_data) != HYPRE_AMG_PHASE_NONE)
+   {
+      entry = perf_data + 3*(hypre_ParAMGDataPerfLevel(amg_data)*HYPRE_AMG_NUM_PHASES +
+                             hypre_ParAMGDataPerfPhase(amg_data));
+      for (k = 0; k < 3; k++)
+      {
+         entry[k] += now[k] - perf_start[k];
+      }
+   }
+
+   hypre_ParAMGDataPerfLevel(amg_data) = level;
+   hypre_ParAMGDataPerfPhase(amg_data) = phase;
+   for (k = 0; k < 3; k++)
+   {
+      perf_start[k] = now[k];
+   }
+
+   return hypre_error_flag;
+}
+
+/*---------------------------------------------------------------
+ * hypre_BoomerAMGPerfPrint
+ *
+ * Prints the setup (setup != 0) or the cycle part of the
+ * performance report.  Times are the maximum over the processes,
+ * messages and bytes the sum.  Collective on comm.
+ *---------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPerfPrint( void      *amg_vdata,
+                          MPI_Comm   comm,
+                          HYPRE_Int  setup )
+{
+   hypre_ParAMGData *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Real       *perf_data  = hypre_ParAMGDataPerfData(amg_data);
+   HYPRE_Int         num_levels = hypre_ParAMGDataNumLevels(amg_data);
+
+   static const char *phase_names[HYPRE_AMG_NUM_PHASES] =
+      { "strength", "coarsen", "interp", "RAP", "relax", "restrict", "interp" };
+
+   HYPRE_Int   first_phase = setup ? HYPRE_AMG_PHASE_STRENGTH : HYPRE_AMG_PHASE_RELAX;
+   HYPRE_Int   num_phases  = setup ? HYPRE_AMG_PHASE_RAP + 1 - first_phase :
+                                     HYPRE_AMG_NUM_PHASES - first_phase;
+   HYPRE_Int   num_cols    = num_phases + 1;
+   HYPRE_Real *times, *max_times, *counts, *sum_counts, *entry;
+   HYPRE_Int   my_id, level, phase, i;
+
+   if (!perf_data)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* one row per level plus the totals; the last column of a row of
+      times is the total over the phases */
+   times      = hypre_CTAlloc(HYPRE_Real, 2*(num_levels+1)*num_cols, HYPRE_MEMORY_HOST);
+   max_times  = times + (num_levels+1)*num_cols;
+   counts     = hypre_CTAlloc(HYPRE_Real, 4*(num_levels+1), HYPRE_MEMORY_HOST);
+   sum_counts = counts + 2*(num_levels+1);
+
+   for (level = 0; level < num_levels; level++)
+   {
+      for (phase = 0; phase < num_phases; phase++)
+      {
+         entry = perf_data + 3*(level*HYPRE_AMG_NUM_PHASES + first_phase + phase);
+         times[level*num_cols + phase]        += entry[0];
+         times[level*num_cols + num_phases]   += entry[0];
+         times[num_levels*num_cols + phase]   += entry[0];
+         times[num_levels*num_cols + num_phases] += entry[0];
+         counts[2*level]   += entry[1];
+         counts[2*level+1] += entry[2];
+      }
+      counts[2*num_levels]   += counts[2*level];
+      counts[2*num_levels+1] += counts[2*level+1];
+   }
+
+   hypre_MPI_Reduce(times, max_times, (num_levels+1)*num_cols, HYPRE_MPI_REAL,
+                    hypre_MPI_MAX, 0, comm);
+   hypre_MPI_Reduce(counts, sum_counts, 2*(num_levels+1), HYPRE_MPI_REAL,
+                    hypre_MPI_SUM, 0, comm);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n\nBoomerAMG %s performance:\n\n", setup ? "setup" : "cycle");
+      hypre_printf("%-5s %*s %24s\n", "", 11*num_cols, "wall clock time (max over procs)",
+                   "sent (sum over procs)");
+      hypre_printf("%-5s", "lev");
+      for (phase = 0; phase < num_phases; phase++)
+      {
+         hypre_printf(" %10s", phase_names[first_phase + phase]);
+      }
+      hypre_printf(" %10s %12s %11s\n", "total", "messages", "MB");
+      for (i = 0; i < 5 + 11*num_cols + 25; i++) hypre_printf("%s", "=");
+      hypre_printf("\n");
+
+      for (level = 0; level <= num_levels; level++)
+      {
+         if (level < num_levels)
+         {
+            hypre_printf("%-5d", level);
+         }
+         else
+         {
+            hypre_printf("%-5s", "all");
+         }
+         for (i = 0; i < num_cols; i++)
+         {
+            hypre_printf(" %10.4f", max_times[level*num_cols + i]);
+         }
+         hypre_printf(" %12.0f %11.3f\n", sum_counts[2*level],
+                      sum_counts[2*level+1] / (1024.0*1024.0));
+      }
+      hypre_printf("\n\n");
+   }
+
+   hypre_TFree(times, HYPRE_MEMORY_HOST);
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -119,7 +119,10 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    HYPRE_Int          *S_offd_j = NULL;
    /* HYPRE_Real         *S_offd_data; */
 
-   HYPRE_Real          diag, row_scale, row_sum;
+   char               *S_diag_mask;
+   char               *S_offd_mask;
+
+   HYPRE_Real          diag, row_scale, row_sum, threshold;
    HYPRE_Int           i, jA, jS;
 
    HYPRE_Int           ierr = 0;
@@ -158,24 +161,22 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    hypre_ParCSRMatrixSetRowStartsOwner(S,0);
    S_diag = hypre_ParCSRMatrixDiag(S);
    hypre_CSRMatrixI(S_diag) = hypre_CTAlloc(HYPRE_Int,  num_variables+1, HYPRE_MEMORY_HOST);
-   hypre_CSRMatrixJ(S_diag) = hypre_CTAlloc(HYPRE_Int,  num_nonzeros_diag, HYPRE_MEMORY_HOST);
    S_offd = hypre_ParCSRMatrixOffd(S);
    hypre_CSRMatrixI(S_offd) = hypre_CTAlloc(HYPRE_Int,  num_variables+1, HYPRE_MEMORY_HOST);
 
    S_diag_i = hypre_CSRMatrixI(S_diag);
-   HYPRE_Int *S_temp_diag_j = hypre_CSRMatrixJ(S_diag);
    S_offd_i = hypre_CSRMatrixI(S_offd);
 
-   S_diag_j = hypre_TAlloc(HYPRE_Int,  num_nonzeros_diag, HYPRE_MEMORY_HOST);
-   HYPRE_Int *S_temp_offd_j = NULL;
+   /* one byte per entry of A, nonzero for the strong connections; S_diag_j
+      and S_offd_j are allocated with their exact sizes once these are known */
+   S_diag_mask = hypre_TAlloc(char, num_nonzeros_diag, HYPRE_MEMORY_HOST);
+   S_offd_mask = hypre_TAlloc(char, num_nonzeros_offd, HYPRE_MEMORY_HOST);
 
    dof_func_offd = NULL;
 
    if (num_cols_offd)
    {
       A_offd_data = hypre_CSRMatrixData(A_offd);
-      hypre_CSRMatrixJ(S_offd) = hypre_CTAlloc(HYPRE_Int, num_nonzeros_offd, HYPRE_MEMORY_HOST);
-      S_temp_offd_j = hypre_CSRMatrixJ(S_offd);
       HYPRE_BigInt *col_map_offd_S = hypre_TAlloc(HYPRE_BigInt,  num_cols_offd, HYPRE_MEMORY_HOST);
       hypre_ParCSRMatrixColMapOffd(S) = col_map_offd_S;
       if (num_functions > 1)
@@ -183,8 +184,6 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
          dof_func_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_offd, HYPRE_MEMORY_HOST);
       }
 
-      S_offd_j = hypre_TAlloc(HYPRE_Int, num_nonzeros_offd, HYPRE_MEMORY_HOST);
-
       HYPRE_BigInt *col_map_offd_A = hypre_ParCSRMatrixColMapOffd(A);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
@@ -229,9 +228,8 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
    /*HYPRE_Int prefix_sum_workspace[2*(hypre_NumThreads() + 1)];*/
    prefix_sum_workspace = hypre_TAlloc(HYPRE_Int,  2*(hypre_NumThreads() + 1), HYPRE_MEMORY_HOST);
 
-   /* give S same nonzero structure as A */
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel private(i,diag,row_scale,row_sum,jA,jS)
+#pragma omp parallel private(i,diag,row_scale,row_sum,threshold,jA,jS)
 #endif
    {
       HYPRE_Int start, stop;
@@ -241,10 +239,7 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
       for (i = start; i < stop; i++)
       {
          S_diag_i[i] = jS_diag;
-         if (num_cols_offd)
-         {
-            S_offd_i[i] = jS_offd;
-         }
+         S_offd_i[i] = jS_offd;
 
          diag = A_diag_data[A_diag_i[i]];
 
@@ -322,151 +317,99 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
             } /* diag >= 0*/
          } /* num_functions <= 1 */
 
-         jS_diag += A_diag_i[i + 1] - A_diag_i[i] - 1;
-         jS_offd += A_offd_i[i + 1] - A_offd_i[i];
-
-         /* compute row entries of S */
-         S_temp_diag_j[A_diag_i[i]] = -1;
+         /* mark the strong entries of the row and count them; the loops
+            without dof_func have no branches and can be vectorized */
+         threshold = strength_threshold * row_scale;
+         S_diag_mask[A_diag_i[i]] = 0;
          if ((fabs(row_sum) > fabs(diag)*max_row_sum) && (max_row_sum < 1.0))
          {
             /* make all dependencies weak */
             for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
             {
-               S_temp_diag_j[jA] = -1;
+               S_diag_mask[jA] = 0;
             }
-            jS_diag -= A_diag_i[i + 1] - (A_diag_i[i] + 1);
-
             for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
             {
-               S_temp_offd_j[jA] = -1;
+               S_offd_mask[jA] = 0;
             }
-            jS_offd -= A_offd_i[i + 1] - A_offd_i[i];
          }
+         else if (num_functions > 1)
+         {
+            if (diag < 0)
+            {
+               for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
+               {
+                  S_diag_mask[jA] = A_diag_data[jA] > threshold &&
+                                    dof_func[i] == dof_func[A_diag_j[jA]];
+                  jS_diag += S_diag_mask[jA];
+               }
+               for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
+               {
+                  S_offd_mask[jA] = A_offd_data[jA] > threshold &&
+                                    dof_func[i] == dof_func_offd[A_offd_j[jA]];
+                  jS_offd += S_offd_mask[jA];
+               }
+            }
+            else
+            {
+               for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
+               {
+                  S_diag_mask[jA] = A_diag_data[jA] < threshold &&
+                                    dof_func[i] == dof_func[A_diag_j[jA]];
+                  jS_diag += S_diag_mask[jA];
+               }
+               for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
+               {
+                  S_offd_mask[jA] = A_offd_data[jA] < threshold &&
+                                    dof_func[i] == dof_func_offd[A_offd_j[jA]];
+                  jS_offd += S_offd_mask[jA];
+               }
+            } /* diag >= 0 */
+         } /* num_functions > 1 */
          else
          {
-            if (num_functions > 1)
+            if (diag < 0)
             {
-               if (diag < 0)
+               for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
                {
-                  for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
-                  {
-                     if (A_diag_data[jA] <= strength_threshold * row_scale
-                           || dof_func[i] != dof_func[A_diag_j[jA]])
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
-                  {
-                     if (A_offd_data[jA] <= strength_threshold * row_scale
-                           || dof_func[i] != dof_func_offd[A_offd_j[jA]])
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
+                  S_diag_mask[jA] = A_diag_data[jA] > threshold;
+                  jS_diag += S_diag_mask[jA];
                }
-               else
+               for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
                {
-                  for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
-                  {
-                     if (A_diag_data[jA] >= strength_threshold * row_scale
-                           || dof_func[i] != dof_func[A_diag_j[jA]])
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
-                  {
-                     if (A_offd_data[jA] >= strength_threshold * row_scale
-                           || dof_func[i] != dof_func_offd[A_offd_j[jA]])
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
-               } /* diag >= 0 */
-            } /* num_functions > 1 */
+                  S_offd_mask[jA] = A_offd_data[jA] > threshold;
+                  jS_offd += S_offd_mask[jA];
+               }
+            }
             else
             {
-               if (diag < 0)
+               for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
                {
-                  for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
-                  {
-                     if (A_diag_data[jA] <= strength_threshold * row_scale)
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
-                  {
-                     if (A_offd_data[jA] <= strength_threshold * row_scale)
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
+                  S_diag_mask[jA] = A_diag_data[jA] < threshold;
+                  jS_diag += S_diag_mask[jA];
                }
-               else
+               for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
                {
-                  for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
-                  {
-                     if (A_diag_data[jA] >= strength_threshold * row_scale)
-                     {
-                        S_temp_diag_j[jA] = -1;
-                        --jS_diag;
-                     }
-                     else
-                     {
-                        S_temp_diag_j[jA] = A_diag_j[jA];
-                     }
-                  }
-                  for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
-                  {
-                     if (A_offd_data[jA] >= strength_threshold * row_scale)
-                     {
-                        S_temp_offd_j[jA] = -1;
-                        --jS_offd;
-                     }
-                     else
-                     {
-                        S_temp_offd_j[jA] = A_offd_j[jA];
-                     }
-                  }
-               } /* diag >= 0 */
-            } /* num_functions <= 1 */
-         } /* !((row_sum > max_row_sum) && (max_row_sum < 1.0)) */
+                  S_offd_mask[jA] = A_offd_data[jA] < threshold;
+                  jS_offd += S_offd_mask[jA];
+               }
+            } /* diag >= 0 */
+         } /* num_functions <= 1 */
       } /* for each variable */
 
       hypre_prefix_sum_pair(&jS_diag, S_diag_i + num_variables, &jS_offd, S_offd_i + num_variables, prefix_sum_workspace);
 
+#ifdef HYPRE_USING_OPENMP
+#pragma omp master
+#endif
+      {
+         S_diag_j = hypre_TAlloc(HYPRE_Int, S_diag_i[num_variables], HYPRE_MEMORY_HOST);
+         S_offd_j = hypre_TAlloc(HYPRE_Int, S_offd_i[num_variables], HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
       /*--------------------------------------------------------------
        * "Compress" the strength matrix.
        *
@@ -483,11 +426,11 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
          S_offd_i[i] += jS_offd;
 
          jS = S_diag_i[i];
-         for (jA = A_diag_i[i]; jA < A_diag_i[i+1]; jA++)
+         for (jA = A_diag_i[i]+1; jA < A_diag_i[i+1]; jA++)
          {
-            if (S_temp_diag_j[jA] > -1)
+            if (S_diag_mask[jA])
             {
-               S_diag_j[jS]    = S_temp_diag_j[jA];
+               S_diag_j[jS] = A_diag_j[jA];
                jS++;
             }
          }
@@ -495,9 +438,9 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
          jS = S_offd_i[i];
          for (jA = A_offd_i[i]; jA < A_offd_i[i+1]; jA++)
          {
-            if (S_temp_offd_j[jA] > -1)
+            if (S_offd_mask[jA])
             {
-               S_offd_j[jS]    = S_temp_offd_j[jA];
+               S_offd_j[jS] = A_offd_j[jA];
                jS++;
             }
          }
@@ -519,8 +462,8 @@ hypre_BoomerAMGCreateSHost(hypre_ParCSRMatrix    *A,
 
    hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
    hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
-   hypre_TFree(S_temp_diag_j, HYPRE_MEMORY_HOST);
-   hypre_TFree(S_temp_offd_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_diag_mask, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_offd_mask, HYPRE_MEMORY_HOST);
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_CREATES] += hypre_MPI_Wtime();
@@ -93,6 +93,36 @@ HYPRE_ParCSRMatrixPrint( HYPRE_ParCSRMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixReadBinary( MPI_Comm            comm,
+                              const char         *file_name,
+                              HYPRE_ParCSRMatrix *matrix)
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *matrix = (HYPRE_ParCSRMatrix) hypre_ParCSRMatrixReadBinary( comm, file_name );
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixPrintBinary( HYPRE_ParCSRMatrix  matrix,
+                               const char         *file_name )
+{
+   return ( hypre_ParCSRMatrixPrintBinary( (hypre_ParCSRMatrix *) matrix,
+                                           file_name ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRMatrixGetComm
  *--------------------------------------------------------------------------*/
@@ -104,6 +104,36 @@ HYPRE_ParVectorPrint( HYPRE_ParVector  vector,
                                   file_name ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorReadBinary( MPI_Comm         comm,
+                           const char      *file_name,
+                           HYPRE_ParVector *vector)
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *vector = (HYPRE_ParVector) hypre_ParVectorReadBinary( comm, file_name ) ;
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParVectorPrintBinary( HYPRE_ParVector  vector,
+                            const char      *file_name )
+{
+   return ( hypre_ParVectorPrintBinary( (hypre_ParVector *) vector,
+                                        file_name ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParVectorSetConstantValues
  *--------------------------------------------------------------------------*/
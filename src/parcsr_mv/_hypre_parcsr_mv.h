@@ -59,10 +59,157 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   HYPRE_Int             node_job;   /* job of a node-aware exchange, 0 otherwise */
+#endif
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRHaloPlan:
+ *   Persistent halo exchange of HYPRE_Complex data for the matvec (job 1)
+ *   and the transpose matvec (job 2).  Plans are created at runtime (see
+ *   HYPRE_SetSpMVHaloOverlap) and cached in the comm_pkg.  A message holds
+ *   the num_vectors components of each exchanged entry next to each other,
+ *   i.e., entry k of vector jv is found at position k*num_vectors+jv.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             job;
+   HYPRE_Int             num_vectors;
+   HYPRE_Complex        *send_data;
+   HYPRE_Complex        *recv_data;
+   HYPRE_Int             num_requests;
+   hypre_MPI_Request    *requests;
+   HYPRE_Int             num_send_msgs;   /* for the traffic counters */
+   HYPRE_Int             num_send_bytes;
+
+   /* job 2: positions in recv_data grouped by the local index they are
+    * added to, so that the unpack can be threaded without races */
+   HYPRE_Int             num_elmts;
+   HYPRE_Int            *elmts;
+   HYPRE_Int            *elmts_starts;
+   HYPRE_Int            *elmts_pos;
+} hypre_ParCSRHaloPlan;
+
+#define hypre_ParCSRHaloPlanJob(plan)              ((plan) -> job)
+#define hypre_ParCSRHaloPlanNumVectors(plan)       ((plan) -> num_vectors)
+#define hypre_ParCSRHaloPlanSendData(plan)         ((plan) -> send_data)
+#define hypre_ParCSRHaloPlanRecvData(plan)         ((plan) -> recv_data)
+#define hypre_ParCSRHaloPlanNumRequests(plan)      ((plan) -> num_requests)
+#define hypre_ParCSRHaloPlanRequests(plan)         ((plan) -> requests)
+#define hypre_ParCSRHaloPlanNumSendMsgs(plan)      ((plan) -> num_send_msgs)
+#define hypre_ParCSRHaloPlanNumSendBytes(plan)     ((plan) -> num_send_bytes)
+#define hypre_ParCSRHaloPlanNumElmts(plan)         ((plan) -> num_elmts)
+#define hypre_ParCSRHaloPlanElmts(plan)            ((plan) -> elmts)
+#define hypre_ParCSRHaloPlanElmtsStarts(plan)      ((plan) -> elmts_starts)
+#define hypre_ParCSRHaloPlanElmtsPos(plan)         ((plan) -> elmts_pos)
+
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeSchedule, hypre_ParCSRCommNode:
+ *   Node-aware exchange (see par_csr_node_comm.c).  The processes of a
+ *   node share a window (arena) in which each process has an out segment
+ *   (a copy of its send buffer) and an in segment (laid out as its receive
+ *   buffer).  Data for processes on the same node is copied directly from
+ *   the out segment of the sender.  Data for other nodes is gathered by one
+ *   aggregator per pair of nodes and sent as a single message to the
+ *   aggregator of the other node, which deposits it in the in segments.
+ *   All offsets and lengths are in number of entries.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* receives from processes on this node */
+   HYPRE_Int             num_local;
+   HYPRE_Int            *local_rank;       /* node rank of the sender */
+   HYPRE_Int            *local_src;        /* offset in its out segment */
+   HYPRE_Int            *local_dst;        /* offset in the receive buffer */
+   HYPRE_Int            *local_len;
+
+   /* receives from other nodes, found in the in segment */
+   HYPRE_Int             num_remote;
+   HYPRE_Int            *remote_dst;
+   HYPRE_Int            *remote_len;
+
+   /* aggregated messages sent by this process; message i consists of the
+    * pieces agg_send_starts[i] to agg_send_starts[i+1]-1 */
+   HYPRE_Int             num_agg_sends;
+   HYPRE_Int            *agg_send_procs;
+   HYPRE_Int            *agg_send_starts;
+   HYPRE_Int            *agg_send_rank;    /* node rank owning the piece */
+   HYPRE_Int            *agg_send_off;     /* offset in its out segment */
+   HYPRE_Int            *agg_send_len;
+   HYPRE_Int             agg_send_size;
+
+   /* aggregated messages received by this process */
+   HYPRE_Int             num_agg_recvs;
+   HYPRE_Int            *agg_recv_procs;
+   HYPRE_Int            *agg_recv_starts;
+   HYPRE_Int            *agg_recv_rank;    /* node rank of the destination */
+   HYPRE_Int            *agg_recv_off;     /* offset in its in segment */
+   HYPRE_Int            *agg_recv_len;
+   HYPRE_Int             agg_recv_size;
+
+   char                 *agg_send_buf;
+   char                 *agg_recv_buf;
+
+   /* processes of this node (node ranks) this process synchronizes with:
+    * the owners of the out segments it reads, the processes reading its out
+    * segment, the processes writing to its in segment, and the owners of
+    * the in segments it writes to */
+   HYPRE_Int             num_sources;
+   HYPRE_Int            *sources;
+   HYPRE_Int             num_readers;
+   HYPRE_Int            *readers;
+   HYPRE_Int             num_writers;
+   HYPRE_Int            *writers;
+   HYPRE_Int             num_targets;
+   HYPRE_Int            *targets;
+} hypre_ParCSRNodeSchedule;
+
+typedef struct
+{
+   hypre_MPI_Win              win;
+   char                     **bases;       /* window memory of each node rank */
+   size_t                     capacity;    /* bytes per process */
+   size_t                     used;
+   HYPRE_Int                  ref_count;   /* comm_pkgs with segments in it */
+} hypre_ParCSRNodeArena;
+
+typedef struct
+{
+   hypre_MPI_Comm             comm;        /* processes on this node */
+   HYPRE_Int                  rank;
+   HYPRE_Int                  size;
+   HYPRE_Int                  leader;      /* global rank of node rank 0 */
+   HYPRE_Int                  num_pkgs;    /* comm_pkgs set up so far */
+   HYPRE_Int                  ref_count;   /* comm_pkgs using it */
+   hypre_ParCSRNodeArena     *arena;       /* arena new segments come from */
+} hypre_ParCSRNodeComm;
+
+typedef struct
+{
+   hypre_ParCSRNodeComm      *node_comm;   /* shared by all comm_pkgs of the
+                                              parent communicator */
+   hypre_MPI_Comm             comm;        /* copies from node_comm */
+   HYPRE_Int                  rank;
+   HYPRE_Int                  size;
+   HYPRE_Int                  tag;         /* added to the node tags */
+   hypre_ParCSRNodeArena     *arena;       /* holds the segments */
+   hypre_MPI_Win              win;
+   char                     **out_segs;    /* out segment of each node rank */
+   char                     **in_segs;     /* in segment of each node rank */
+   HYPRE_Int                  busy;        /* a node-aware exchange is active */
+   HYPRE_Int                  sent;        /* its aggregated messages are sent */
+   HYPRE_Int                  num_pending; /* completion messages of the last */
+   hypre_MPI_Request         *pending;     /* exchange, see DestroyNode */
+   hypre_ParCSRNodeSchedule   sched[2];    /* jobs 1, 11, 21 and jobs 2, 12, 22 */
+} hypre_ParCSRCommNode;
+#endif
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                     comm;
@@ -85,6 +232,13 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
 
+   /* runtime persistent halo plans for the matvec (0) and its transpose (1) */
+   hypre_ParCSRHaloPlan        *halo_plans[2];
+
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   hypre_ParCSRCommNode        *node;
+#endif
+
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Complex *tmp_data;
@@ -116,6 +270,10 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgHaloPlan(comm_pkg,i)          (comm_pkg -> halo_plans[i])
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+#define hypre_ParCSRCommPkgNode(comm_pkg)                (comm_pkg -> node)
+#endif
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -155,6 +313,21 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+#define hypre_ParCSRCommHandleNodeJob(comm_handle)                (comm_handle -> node_job)
+#endif
+
+/*--------------------------------------------------------------------------
+ * Traffic counters:
+ *   Number of messages and bytes sent by this process through
+ *   hypre_ParCSRCommHandleCreate and hypre_ParCSRHaloPlanStart (for the
+ *   node-aware exchange, the aggregated messages to other nodes).  They are
+ *   only ever incremented; users take differences (see the BoomerAMG
+ *   performance report).
+ *--------------------------------------------------------------------------*/
+
+extern HYPRE_Real hypre_parcsr_comm_num_messages;
+extern HYPRE_Real hypre_parcsr_comm_num_bytes;
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 
@@ -358,6 +531,11 @@ typedef struct hypre_ParCSRMatrix_struct
    /* Array to store ordering of local diagonal block to relax. In particular,
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
+   /* Coloring of the local diagonal block for multicolor relaxation
+      (relax_type 11), computed the first time it is needed */
+   HYPRE_Int             num_colors;
+   HYPRE_Int            *color_offsets;
+   HYPRE_Int            *color_rows;
 
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
@@ -404,6 +582,9 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixNumColors(matrix)              ((matrix) -> num_colors)
+#define hypre_ParCSRMatrixColorOffsets(matrix)           ((matrix) -> color_offsets)
+#define hypre_ParCSRMatrixColorRows(matrix)              ((matrix) -> color_rows)
 #if defined(HYPRE_USING_CUDA)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -426,6 +607,57 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Cached structure of the Galerkin product RAP = P^T A P
+ * (see par_csr_rap_plan.c).
+ *
+ * Locally, A_loc = [A_diag A_offd] and P_loc = [P; P_ext], where P_ext
+ * holds the rows of P for the columns of A_offd.  The columns of P_loc are
+ * the local coarse columns followed by the external ones in col_map_ext.
+ * Q = A_loc P_loc and C = PT Q, where PT is the transpose of the local rows
+ * of P.  The rows of C for the columns of P_offd (C_ext) belong to other
+ * processes and are sent to their owners, which receive them as C_int.
+ * C_pos and C_int_pos give the position of every entry of C and C_int in
+ * RAP: p >= 0 is entry p of RAP_diag, p < 0 is entry -p-1 of RAP_offd.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_cols_offd_A;
+   HYPRE_BigInt         *col_map_offd_A;
+
+   hypre_CSRMatrix      *A_loc;
+   hypre_CSRMatrix      *P_loc;
+   HYPRE_Int             num_cols_ext;
+   HYPRE_BigInt         *col_map_ext;
+   hypre_CSRMatrix      *PT;
+   HYPRE_Int            *PT_perm;
+   hypre_CSRMatrix      *Q;
+   hypre_CSRMatrix      *C;
+
+   /* exchange of the values of P_ext */
+   hypre_ParCSRCommPkg  *P_ext_comm_pkg;
+   HYPRE_Int             num_rows_P_send;
+   HYPRE_Int            *P_send_rows;
+   HYPRE_Int            *P_send_i;
+   HYPRE_Complex        *P_send_data;
+
+   /* exchange of the values of C_ext/C_int */
+   hypre_ParCSRCommPkg  *C_ext_comm_pkg;
+   HYPRE_Int             num_rows_C_ext;
+   HYPRE_Int            *C_ext_rows;
+   HYPRE_Int            *C_ext_i;
+   HYPRE_Complex        *C_ext_data;
+   HYPRE_Int             num_rows_C_int;
+   HYPRE_Int            *C_int_rows;
+   HYPRE_Int            *C_int_i;
+   HYPRE_Complex        *C_int_data;
+
+   HYPRE_Int            *C_pos;
+   HYPRE_Int            *C_int_pos;
+
+} hypre_ParCSRRAPPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -796,6 +1028,13 @@ HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros , HYPRE_Int num_rows , HYPRE_Complex *a_data , HYPRE_Int *a_i , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros , HYPRE_Complex *a_data , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_jdata_datatype );
+hypre_ParCSRHaloPlan *hypre_ParCSRHaloPlanCreate ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int job , HYPRE_Int num_vectors );
+HYPRE_Int hypre_ParCSRHaloPlanDestroy ( hypre_ParCSRHaloPlan *plan );
+hypre_ParCSRHaloPlan *hypre_ParCSRCommPkgGetHaloPlan ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int job , HYPRE_Int num_vectors );
+HYPRE_Int hypre_ParCSRHaloPlanPack ( hypre_ParCSRHaloPlan *plan , hypre_ParCSRCommPkg *comm_pkg , HYPRE_Complex *data , HYPRE_Int vecstride , HYPRE_Int idxstride );
+HYPRE_Int hypre_ParCSRHaloPlanUnpack ( hypre_ParCSRHaloPlan *plan , hypre_ParCSRCommPkg *comm_pkg , HYPRE_Complex *data , HYPRE_Int vecstride , HYPRE_Int idxstride );
+HYPRE_Int hypre_ParCSRHaloPlanStart ( hypre_ParCSRHaloPlan *plan );
+HYPRE_Int hypre_ParCSRHaloPlanWait ( hypre_ParCSRHaloPlan *plan );
 HYPRE_Int hypre_ParCSRFindExtendCommPkg(MPI_Comm comm, HYPRE_BigInt global_num_cols, HYPRE_BigInt first_col_diag, HYPRE_Int num_cols_diag, HYPRE_BigInt *col_starts, hypre_IJAssumedPart *apart, HYPRE_Int indices_len, HYPRE_BigInt *indices, hypre_ParCSRCommPkg **extend_comm_pkg);
 /* par_csr_matop.c */
 void hypre_ParMatmul_RowSizes (HYPRE_MemoryLocation memory_location, HYPRE_Int **C_diag_i , HYPRE_Int **C_offd_i , HYPRE_Int *A_diag_i , HYPRE_Int *A_diag_j , HYPRE_Int *A_offd_i , HYPRE_Int *A_offd_j , HYPRE_Int *B_diag_i , HYPRE_Int *B_diag_j , HYPRE_Int *B_offd_i , HYPRE_Int *B_offd_j , HYPRE_Int *B_ext_diag_i , HYPRE_Int *B_ext_diag_j , HYPRE_Int *B_ext_offd_i , HYPRE_Int *B_ext_offd_j , HYPRE_Int *map_B_to_C , HYPRE_Int *C_diag_size , HYPRE_Int *C_offd_size , HYPRE_Int num_rows_diag_A , HYPRE_Int num_cols_offd_A , HYPRE_Int allsquare , HYPRE_Int num_cols_diag_B , HYPRE_Int num_cols_offd_B , HYPRE_Int num_cols_offd_C );
@@ -868,6 +1107,8 @@ HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYP
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRead ( MPI_Comm comm , const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrint ( hypre_ParCSRMatrix *matrix , const char *file_name );
+HYPRE_Int hypre_ParCSRMatrixPrintBinary ( hypre_ParCSRMatrix *matrix , const char *file_name );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixReadBinary ( MPI_Comm comm , const char *file_name );
 HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix , const HYPRE_Int base_i , const HYPRE_Int base_j , const char *filename );
 HYPRE_Int hypre_ParCSRMatrixReadIJ ( MPI_Comm comm , const char *filename , HYPRE_Int *base_i_ptr , HYPRE_Int *base_j_ptr , hypre_ParCSRMatrix **matrix_ptr );
 HYPRE_Int hypre_ParCSRMatrixGetLocalRange ( hypre_ParCSRMatrix *matrix , HYPRE_BigInt *row_start , HYPRE_BigInt *row_end , HYPRE_BigInt *col_start , HYPRE_BigInt *col_end );
@@ -886,6 +1127,7 @@ hypre_ParCSRMatrix* hypre_ParCSRMatrixClone ( hypre_ParCSRMatrix *A, HYPRE_Int c
 hypre_ParCSRMatrix* hypre_ParCSRMatrixClone_v2 ( hypre_ParCSRMatrix *A, HYPRE_Int copy_data, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParCSRMatrixMigrate(hypre_ParCSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int type);
+HYPRE_Int hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *A );
 
 /* par_csr_matvec.c */
 // y = alpha*A*x + beta*b
@@ -893,8 +1135,16 @@ HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_ParCS
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlaceHalo ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *b, hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixMatvecTHalo ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y , HYPRE_Int *CF_marker , HYPRE_Int fpt );
 
+/* par_csr_node_comm.c */
+HYPRE_Int hypre_ParCSRCommPkgCreateNode ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNode ( hypre_ParCSRCommPkg *comm_pkg );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateNode ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
+HYPRE_Int hypre_ParCSRCommHandleDestroyNode ( hypre_ParCSRCommHandle *comm_handle );
+
 /* par_csr_triplemat.c */
 hypre_ParCSRMatrix *hypre_ParCSRMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
 hypre_ParCSRMatrix *hypre_ParCSRMatMatHost( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
@@ -909,6 +1159,12 @@ hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R, hypre_ParCSRMa
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTDevice( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
 
+/* par_csr_rap_plan.c */
+hypre_ParCSRRAPPlan *hypre_ParCSRRAPPlanCreate ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *RAP );
+HYPRE_Int hypre_ParCSRRAPPlanDestroy ( hypre_ParCSRRAPPlan *plan );
+HYPRE_Int hypre_ParCSRRAPPlanMatchesA ( hypre_ParCSRRAPPlan *plan , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRRAPPlanCompute ( hypre_ParCSRRAPPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParCSRMatrix *RAP );
+
 /* par_make_system.c */
 HYPRE_ParCSR_System_Problem *HYPRE_Generate2DSystem ( HYPRE_ParCSRMatrix H_L1 , HYPRE_ParCSRMatrix H_L2 , HYPRE_ParVector H_b1 , HYPRE_ParVector H_b2 , HYPRE_ParVector H_x1 , HYPRE_ParVector H_x2 , HYPRE_Complex *M_vals );
 HYPRE_Int HYPRE_Destroy2DSystem ( HYPRE_ParCSR_System_Problem *sys_prob );
@@ -921,9 +1177,12 @@ HYPRE_Int hypre_ParVectorInitialize ( hypre_ParVector *vector );
 HYPRE_Int hypre_ParVectorInitialize_v2( hypre_ParVector *vector, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_ParVectorSetDataOwner ( hypre_ParVector *vector , HYPRE_Int owns_data );
 HYPRE_Int hypre_ParVectorSetPartitioningOwner ( hypre_ParVector *vector , HYPRE_Int owns_partitioning );
+HYPRE_Int hypre_ParVectorSetMultiVecStorageMethod( hypre_ParVector *vector, HYPRE_Int method );
 HYPRE_Int hypre_ParVectorSetNumVectors ( hypre_ParVector *vector , HYPRE_Int num_vectors );
 hypre_ParVector *hypre_ParVectorRead ( MPI_Comm comm , const char *file_name );
 HYPRE_Int hypre_ParVectorPrint ( hypre_ParVector *vector , const char *file_name );
+HYPRE_Int hypre_ParVectorPrintBinary ( hypre_ParVector *vector , const char *file_name );
+hypre_ParVector *hypre_ParVectorReadBinary ( MPI_Comm comm , const char *file_name );
 HYPRE_Int hypre_ParVectorSetConstantValues ( hypre_ParVector *v , HYPRE_Complex value );
 HYPRE_Int hypre_ParVectorSetRandomValues ( hypre_ParVector *v , HYPRE_Int seed );
 HYPRE_Int hypre_ParVectorCopy ( hypre_ParVector *x , hypre_ParVector *y );
@@ -934,6 +1193,10 @@ HYPRE_Int hypre_ParVectorScale ( HYPRE_Complex alpha , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Real hypre_ParVectorAxpyInnerProd ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector *z );
+HYPRE_Int hypre_ParVectorInnerProd2 ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector *z , HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorAxpby ( HYPRE_Complex alpha , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProdMulti( hypre_ParVector *x, hypre_ParVector *y, HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x , hypre_ParVector **y , HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector **z, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x , HYPRE_Real *prod_y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_BigInt *vec_starts );
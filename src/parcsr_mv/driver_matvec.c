@@ -35,6 +35,8 @@ main( HYPRE_Int   argc,
    HYPRE_Complex 	*data, *data2;
    HYPRE_BigInt		*row_starts, *col_starts;
    char		file_name[80];
+   HYPRE_Int		num_reps = 100;
+   HYPRE_Real		csr_time, sell_time, diff;
    /* Initialize MPI */
    hypre_MPI_Init(&argc, &argv);
 
@@ -42,6 +44,11 @@ main( HYPRE_Int   argc,
    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &my_id);
 
    hypre_printf(" my_id: %d num_procs: %d\n", my_id, num_procs);
+
+   if (argc > 1)
+   {
+      num_reps = atoi(argv[1]);
+   }
  
    if (my_id == 0) 
    {
@@ -128,6 +135,60 @@ main( HYPRE_Int   argc,
 
    hypre_ParVectorPrint(x2, "transp"); 
 
+   /*-----------------------------------------------------------
+    * Compare the CSR and SELL-C-sigma matvec kernels
+    *-----------------------------------------------------------*/
+
+   HYPRE_SetSpMVUseSELL(0);
+   hypre_ParCSRMatrixMatvec(1.0, par_matrix, x, 0.0, y);
+   hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+   csr_time = hypre_MPI_Wtime();
+   for (i=0; i < num_reps; i++)
+      hypre_ParCSRMatrixMatvec(1.0, par_matrix, x, 0.0, y);
+   csr_time = hypre_MPI_Wtime() - csr_time;
+
+   /* the first call builds the SELL copies of diag and offd */
+   HYPRE_SetSpMVUseSELL(1);
+   hypre_ParCSRMatrixMatvec(1.0, par_matrix, x, 0.0, y2);
+   hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+   sell_time = hypre_MPI_Wtime();
+   for (i=0; i < num_reps; i++)
+      hypre_ParCSRMatrixMatvec(1.0, par_matrix, x, 0.0, y2);
+   sell_time = hypre_MPI_Wtime() - sell_time;
+
+   hypre_ParVectorAxpy(-1.0, y, y2);
+   diff = sqrt(hypre_ParVectorInnerProd(y2, y2));
+   if (my_id == 0)
+   {
+      hypre_printf(" matvec  (%d reps): CSR %e s, SELL %e s, speedup %.2f, ||diff|| %e\n",
+                   num_reps, csr_time, sell_time, csr_time/sell_time, diff);
+   }
+
+   HYPRE_SetSpMVUseSELL(0);
+   hypre_ParCSRMatrixMatvecT(1.0, par_matrix, y, 0.0, x);
+   hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+   csr_time = hypre_MPI_Wtime();
+   for (i=0; i < num_reps; i++)
+      hypre_ParCSRMatrixMatvecT(1.0, par_matrix, y, 0.0, x);
+   csr_time = hypre_MPI_Wtime() - csr_time;
+
+   HYPRE_SetSpMVUseSELL(1);
+   hypre_ParCSRMatrixMatvecT(1.0, par_matrix, y, 0.0, x2);
+   hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+   sell_time = hypre_MPI_Wtime();
+   for (i=0; i < num_reps; i++)
+      hypre_ParCSRMatrixMatvecT(1.0, par_matrix, y, 0.0, x2);
+   sell_time = hypre_MPI_Wtime() - sell_time;
+   HYPRE_SetSpMVUseSELL(0);
+
+   hypre_ParVectorAxpy(-1.0, x, x2);
+   diff = sqrt(hypre_ParVectorInnerProd(x2, x2));
+   if (my_id == 0)
+   {
+      hypre_printf(" matvecT (%d reps): CSR %e s, SELL %e s, speedup %.2f, ||diff|| %e\n",
+                   num_reps, csr_time, sell_time, csr_time/sell_time, diff);
+   }
+
    hypre_ParCSRMatrixDestroy(par_matrix);
    hypre_ParVectorDestroy(x);
    hypre_ParVectorDestroy(x2);
@@ -584,6 +584,8 @@ hypre_ParCSRCommPkgCreateApart
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
    hypre_ParCSRCommPkgSendMapElmts (comm_pkg) = send_map_elmts;
 
+   hypre_ParCSRCommPkgCreateNode(comm_pkg);
+
    return hypre_error_flag;
 
 
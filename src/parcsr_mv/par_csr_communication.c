@@ -7,6 +7,9 @@
 
 #include "_hypre_parcsr_mv.h"
 
+HYPRE_Real hypre_parcsr_comm_num_messages = 0.0;
+HYPRE_Real hypre_parcsr_comm_num_bytes    = 0.0;
+
 /*==========================================================================*/
 
 #ifdef HYPRE_USING_PERSISTENT_COMM
@@ -294,6 +297,352 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
 }
 #endif // HYPRE_USING_PERSISTENT_COMM
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRHaloPlanCreate
+ *
+ * Creates the persistent requests of a halo exchange for num_vectors
+ * vectors.  Job 1 sends the entries listed in send_map_elmts and receives
+ * the external (offd) entries, job 2 goes the other way.  The message
+ * to/from a neighbor is the contiguous part [start, end)*num_vectors of the
+ * buffers, where [start, end) is its range in send_map_starts or
+ * recv_vec_starts.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRHaloPlan *
+hypre_ParCSRHaloPlanCreate( hypre_ParCSRCommPkg *comm_pkg,
+                            HYPRE_Int            job,
+                            HYPRE_Int            num_vectors )
+{
+   MPI_Comm   comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int  num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int  num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int *send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+   HYPRE_Int *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   HYPRE_Int  send_size       = send_map_starts[num_sends];
+   HYPRE_Int  recv_size       = recv_vec_starts[num_recvs];
+
+   hypre_ParCSRHaloPlan *plan;
+   hypre_MPI_Request    *requests;
+   HYPRE_Complex        *send_data, *recv_data;
+   HYPRE_Int            *elmts, *elmts_starts, *elmts_pos, *sorted_elmts;
+   HYPRE_Int             i, k, ip, start, len, num_elmts;
+
+   plan     = hypre_CTAlloc(hypre_ParCSRHaloPlan, 1, HYPRE_MEMORY_HOST);
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+
+   if (job == 1)
+   {
+      send_data = hypre_TAlloc(HYPRE_Complex, send_size*num_vectors, HYPRE_MEMORY_HOST);
+      recv_data = hypre_TAlloc(HYPRE_Complex, recv_size*num_vectors, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < num_recvs; i++)
+      {
+         ip    = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+         start = recv_vec_starts[i]*num_vectors;
+         len   = (recv_vec_starts[i+1] - recv_vec_starts[i])*num_vectors;
+         hypre_MPI_Recv_init(recv_data + start, len, HYPRE_MPI_COMPLEX, ip, 0, comm, &requests[i]);
+      }
+      for (i = 0; i < num_sends; i++)
+      {
+         ip    = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+         start = send_map_starts[i]*num_vectors;
+         len   = (send_map_starts[i+1] - send_map_starts[i])*num_vectors;
+         hypre_MPI_Send_init(send_data + start, len, HYPRE_MPI_COMPLEX, ip, 0, comm,
+                             &requests[num_recvs + i]);
+      }
+   }
+   else
+   {
+      send_data = hypre_TAlloc(HYPRE_Complex, recv_size*num_vectors, HYPRE_MEMORY_HOST);
+      recv_data = hypre_TAlloc(HYPRE_Complex, send_size*num_vectors, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < num_sends; i++)
+      {
+         ip    = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+         start = send_map_starts[i]*num_vectors;
+         len   = (send_map_starts[i+1] - send_map_starts[i])*num_vectors;
+         hypre_MPI_Recv_init(recv_data + start, len, HYPRE_MPI_COMPLEX, ip, 0, comm, &requests[i]);
+      }
+      for (i = 0; i < num_recvs; i++)
+      {
+         ip    = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
+         start = recv_vec_starts[i]*num_vectors;
+         len   = (recv_vec_starts[i+1] - recv_vec_starts[i])*num_vectors;
+         hypre_MPI_Send_init(send_data + start, len, HYPRE_MPI_COMPLEX, ip, 0, comm,
+                             &requests[num_sends + i]);
+      }
+
+      /* send_map_elmts may contain an index more than once (it can be sent
+       * to several processors), so group the receive positions by index.
+       * Within a group the positions stay in increasing order, so the sums
+       * are accumulated in the same order as in hypre_ParCSRMatrixMatvecT */
+      sorted_elmts = hypre_TAlloc(HYPRE_Int, send_size, HYPRE_MEMORY_HOST);
+      elmts_pos    = hypre_TAlloc(HYPRE_Int, send_size, HYPRE_MEMORY_HOST);
+      for (k = 0; k < send_size; k++)
+      {
+         sorted_elmts[k] = send_map_elmts[k];
+         elmts_pos[k] = k;
+      }
+      hypre_qsort2i(sorted_elmts, elmts_pos, 0, send_size - 1);
+
+      num_elmts = 0;
+      for (k = 0; k < send_size; k++)
+      {
+         if (k == 0 || sorted_elmts[k] != sorted_elmts[k-1])
+         {
+            num_elmts++;
+         }
+      }
+
+      elmts        = hypre_TAlloc(HYPRE_Int, num_elmts, HYPRE_MEMORY_HOST);
+      elmts_starts = hypre_TAlloc(HYPRE_Int, num_elmts + 1, HYPRE_MEMORY_HOST);
+      num_elmts = 0;
+      for (k = 0; k < send_size; k++)
+      {
+         if (k == 0 || sorted_elmts[k] != sorted_elmts[k-1])
+         {
+            elmts[num_elmts] = sorted_elmts[k];
+            elmts_starts[num_elmts++] = k;
+         }
+      }
+      elmts_starts[num_elmts] = send_size;
+
+      for (i = 0; i < num_elmts; i++)
+      {
+         hypre_qsort0(elmts_pos, elmts_starts[i], elmts_starts[i+1] - 1);
+      }
+      hypre_TFree(sorted_elmts, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRHaloPlanNumElmts(plan)    = num_elmts;
+      hypre_ParCSRHaloPlanElmts(plan)       = elmts;
+      hypre_ParCSRHaloPlanElmtsStarts(plan) = elmts_starts;
+      hypre_ParCSRHaloPlanElmtsPos(plan)    = elmts_pos;
+   }
+
+   hypre_ParCSRHaloPlanJob(plan)         = job;
+   hypre_ParCSRHaloPlanNumVectors(plan)  = num_vectors;
+   hypre_ParCSRHaloPlanSendData(plan)    = send_data;
+   hypre_ParCSRHaloPlanRecvData(plan)    = recv_data;
+   hypre_ParCSRHaloPlanNumRequests(plan) = num_sends + num_recvs;
+   hypre_ParCSRHaloPlanRequests(plan)    = requests;
+   if (job == 1)
+   {
+      hypre_ParCSRHaloPlanNumSendMsgs(plan)  = num_sends;
+      hypre_ParCSRHaloPlanNumSendBytes(plan) = send_size*num_vectors*sizeof(HYPRE_Complex);
+   }
+   else
+   {
+      hypre_ParCSRHaloPlanNumSendMsgs(plan)  = num_recvs;
+      hypre_ParCSRHaloPlanNumSendBytes(plan) = recv_size*num_vectors*sizeof(HYPRE_Complex);
+   }
+
+   return plan;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRHaloPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRHaloPlanDestroy( hypre_ParCSRHaloPlan *plan )
+{
+   HYPRE_Int i;
+
+   if (plan)
+   {
+      for (i = 0; i < hypre_ParCSRHaloPlanNumRequests(plan); i++)
+      {
+         hypre_MPI_Request_free(&hypre_ParCSRHaloPlanRequests(plan)[i]);
+      }
+      hypre_TFree(hypre_ParCSRHaloPlanRequests(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRHaloPlanSendData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRHaloPlanRecvData(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRHaloPlanElmts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRHaloPlanElmtsStarts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRHaloPlanElmtsPos(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgGetHaloPlan
+ *
+ * Returns the plan cached in comm_pkg for job (1 or 2), creating it on
+ * first use or when the number of vectors has changed.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRHaloPlan *
+hypre_ParCSRCommPkgGetHaloPlan( hypre_ParCSRCommPkg *comm_pkg,
+                                HYPRE_Int            job,
+                                HYPRE_Int            num_vectors )
+{
+   hypre_ParCSRHaloPlan *plan = hypre_ParCSRCommPkgHaloPlan(comm_pkg, job - 1);
+
+   if (plan && hypre_ParCSRHaloPlanNumVectors(plan) != num_vectors)
+   {
+      hypre_ParCSRHaloPlanDestroy(plan);
+      plan = NULL;
+   }
+
+   if (!plan)
+   {
+      plan = hypre_ParCSRHaloPlanCreate(comm_pkg, job, num_vectors);
+      hypre_ParCSRCommPkgHaloPlan(comm_pkg, job - 1) = plan;
+   }
+
+   return plan;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRHaloPlanPack
+ *
+ * Fills the send buffer of the plan.  For job 1, data is the local part of
+ * the (multi)vector; for job 2, it holds the num_cols_offd partial sums to
+ * be sent back.  Consecutive vectors are vecstride apart in data and
+ * consecutive entries of one vector are idxstride apart.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRHaloPlanPack( hypre_ParCSRHaloPlan *plan,
+                          hypre_ParCSRCommPkg  *comm_pkg,
+                          HYPRE_Complex        *data,
+                          HYPRE_Int             vecstride,
+                          HYPRE_Int             idxstride )
+{
+   HYPRE_Int      num_vectors = hypre_ParCSRHaloPlanNumVectors(plan);
+   HYPRE_Complex *send_data   = hypre_ParCSRHaloPlanSendData(plan);
+   HYPRE_Int     *send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+   HYPRE_Int      size, i, jv;
+
+   if (hypre_ParCSRHaloPlanJob(plan) == 1)
+   {
+      size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, hypre_ParCSRCommPkgNumSends(comm_pkg));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            send_data[i*num_vectors + jv] = data[jv*vecstride + send_map_elmts[i]*idxstride];
+         }
+      }
+   }
+   else
+   {
+      size = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, hypre_ParCSRCommPkgNumRecvs(comm_pkg));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            send_data[i*num_vectors + jv] = data[jv*vecstride + i*idxstride];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRHaloPlanUnpack
+ *
+ * Job 1 copies the received external entries into data (num_cols_offd
+ * entries per vector), job 2 adds the received partial sums to data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRHaloPlanUnpack( hypre_ParCSRHaloPlan *plan,
+                            hypre_ParCSRCommPkg  *comm_pkg,
+                            HYPRE_Complex        *data,
+                            HYPRE_Int             vecstride,
+                            HYPRE_Int             idxstride )
+{
+   HYPRE_Int      num_vectors  = hypre_ParCSRHaloPlanNumVectors(plan);
+   HYPRE_Complex *recv_data    = hypre_ParCSRHaloPlanRecvData(plan);
+   HYPRE_Int     *elmts        = hypre_ParCSRHaloPlanElmts(plan);
+   HYPRE_Int     *elmts_starts = hypre_ParCSRHaloPlanElmtsStarts(plan);
+   HYPRE_Int     *elmts_pos    = hypre_ParCSRHaloPlanElmtsPos(plan);
+   HYPRE_Int      size, i, k, jv;
+
+   if (hypre_ParCSRHaloPlanJob(plan) == 1)
+   {
+      size = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, hypre_ParCSRCommPkgNumRecvs(comm_pkg));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            data[jv*vecstride + i*idxstride] = recv_data[i*num_vectors + jv];
+         }
+      }
+   }
+   else
+   {
+      size = hypre_ParCSRHaloPlanNumElmts(plan);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,k,jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         for (k = elmts_starts[i]; k < elmts_starts[i+1]; k++)
+         {
+            for (jv = 0; jv < num_vectors; jv++)
+            {
+               data[jv*vecstride + elmts[i]*idxstride] += recv_data[elmts_pos[k]*num_vectors + jv];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRHaloPlanStart, hypre_ParCSRHaloPlanWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRHaloPlanStart( hypre_ParCSRHaloPlan *plan )
+{
+   hypre_parcsr_comm_num_messages += hypre_ParCSRHaloPlanNumSendMsgs(plan);
+   hypre_parcsr_comm_num_bytes    += hypre_ParCSRHaloPlanNumSendBytes(plan);
+
+   if (hypre_ParCSRHaloPlanNumRequests(plan) > 0)
+   {
+      if (hypre_MPI_Startall(hypre_ParCSRHaloPlanNumRequests(plan),
+                             hypre_ParCSRHaloPlanRequests(plan)) != hypre_MPI_SUCCESS)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI error\n");
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRHaloPlanWait( hypre_ParCSRHaloPlan *plan )
+{
+   if (hypre_ParCSRHaloPlanNumRequests(plan) > 0)
+   {
+      if (hypre_MPI_Waitall(hypre_ParCSRHaloPlanNumRequests(plan),
+                            hypre_ParCSRHaloPlanRequests(plan),
+                            hypre_MPI_STATUSES_IGNORE) != hypre_MPI_SUCCESS)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI error\n");
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 hypre_ParCSRCommHandle*
 hypre_ParCSRCommHandleCreate ( HYPRE_Int            job,
                                hypre_ParCSRCommPkg *comm_pkg,
@@ -326,6 +675,18 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    void                      *send_data;
    void                      *recv_data;
 
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   if ( hypre_GetActualMemLocation(send_memory_location) == hypre_MEMORY_HOST &&
+        hypre_GetActualMemLocation(recv_memory_location) == hypre_MEMORY_HOST )
+   {
+      comm_handle = hypre_ParCSRCommHandleCreateNode(job, comm_pkg, send_data_in, recv_data_in);
+      if (comm_handle)
+      {
+         return ( comm_handle );
+      }
+   }
+#endif
+
    /*--------------------------------------------------------------------
     * hypre_Initialize sets up a communication handle,
     * posts receives and initiates sends. It always requires num_sends,
@@ -416,6 +777,17 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    HYPRE_CUDA_CALL( cudaStreamSynchronize(hypre_HandleCudaComputeStream(hypre_handle())) );
 #endif
 
+   /* jobs 2, 12 and 22 send to the processors we normally receive from */
+   if (job == 2 || job == 12 || job == 22)
+   {
+      hypre_parcsr_comm_num_messages += num_recvs;
+   }
+   else
+   {
+      hypre_parcsr_comm_num_messages += num_sends;
+   }
+   hypre_parcsr_comm_num_bytes += num_send_bytes;
+
    num_requests = num_sends + num_recvs;
    requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
@@ -587,6 +959,13 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
       return hypre_error_flag;
    }
 
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   if (hypre_ParCSRCommHandleNodeJob(comm_handle))
+   {
+      return hypre_ParCSRCommHandleDestroyNode(comm_handle);
+   }
+#endif
+
    if (hypre_ParCSRCommHandleNumRequests(comm_handle))
    {
       hypre_MPI_Status *status0;
@@ -896,6 +1275,8 @@ hypre_ParCSRCommPkgCreate
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
    hypre_ParCSRCommPkgSendMapElmts (comm_pkg) = send_map_elmts;
 
+   hypre_ParCSRCommPkgCreateNode(comm_pkg);
+
    return hypre_error_flag;
 }
 
@@ -961,6 +1342,10 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    }
 #endif
 
+   hypre_ParCSRHaloPlanDestroy(hypre_ParCSRCommPkgHaloPlan(comm_pkg, 0));
+   hypre_ParCSRHaloPlanDestroy(hypre_ParCSRCommPkgHaloPlan(comm_pkg, 1));
+   hypre_ParCSRCommPkgDestroyNode(comm_pkg);
+
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
       hypre_TFree(hypre_ParCSRCommPkgSendProcs(comm_pkg), HYPRE_MEMORY_HOST);
@@ -44,10 +44,157 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   HYPRE_Int             node_job;   /* job of a node-aware exchange, 0 otherwise */
+#endif
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRHaloPlan:
+ *   Persistent halo exchange of HYPRE_Complex data for the matvec (job 1)
+ *   and the transpose matvec (job 2).  Plans are created at runtime (see
+ *   HYPRE_SetSpMVHaloOverlap) and cached in the comm_pkg.  A message holds
+ *   the num_vectors components of each exchanged entry next to each other,
+ *   i.e., entry k of vector jv is found at position k*num_vectors+jv.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             job;
+   HYPRE_Int             num_vectors;
+   HYPRE_Complex        *send_data;
+   HYPRE_Complex        *recv_data;
+   HYPRE_Int             num_requests;
+   hypre_MPI_Request    *requests;
+   HYPRE_Int             num_send_msgs;   /* for the traffic counters */
+   HYPRE_Int             num_send_bytes;
+
+   /* job 2: positions in recv_data grouped by the local index they are
+    * added to, so that the unpack can be threaded without races */
+   HYPRE_Int             num_elmts;
+   HYPRE_Int            *elmts;
+   HYPRE_Int            *elmts_starts;
+   HYPRE_Int            *elmts_pos;
+} hypre_ParCSRHaloPlan;
+
+#define hypre_ParCSRHaloPlanJob(plan)              ((plan) -> job)
+#define hypre_ParCSRHaloPlanNumVectors(plan)       ((plan) -> num_vectors)
+#define hypre_ParCSRHaloPlanSendData(plan)         ((plan) -> send_data)
+#define hypre_ParCSRHaloPlanRecvData(plan)         ((plan) -> recv_data)
+#define hypre_ParCSRHaloPlanNumRequests(plan)      ((plan) -> num_requests)
+#define hypre_ParCSRHaloPlanRequests(plan)         ((plan) -> requests)
+#define hypre_ParCSRHaloPlanNumSendMsgs(plan)      ((plan) -> num_send_msgs)
+#define hypre_ParCSRHaloPlanNumSendBytes(plan)     ((plan) -> num_send_bytes)
+#define hypre_ParCSRHaloPlanNumElmts(plan)         ((plan) -> num_elmts)
+#define hypre_ParCSRHaloPlanElmts(plan)            ((plan) -> elmts)
+#define hypre_ParCSRHaloPlanElmtsStarts(plan)      ((plan) -> elmts_starts)
+#define hypre_ParCSRHaloPlanElmtsPos(plan)         ((plan) -> elmts_pos)
+
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeSchedule, hypre_ParCSRCommNode:
+ *   Node-aware exchange (see par_csr_node_comm.c).  The processes of a
+ *   node share a window (arena) in which each process has an out segment
+ *   (a copy of its send buffer) and an in segment (laid out as its receive
+ *   buffer).  Data for processes on the same node is copied directly from
+ *   the out segment of the sender.  Data for other nodes is gathered by one
+ *   aggregator per pair of nodes and sent as a single message to the
+ *   aggregator of the other node, which deposits it in the in segments.
+ *   All offsets and lengths are in number of entries.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   /* receives from processes on this node */
+   HYPRE_Int             num_local;
+   HYPRE_Int            *local_rank;       /* node rank of the sender */
+   HYPRE_Int            *local_src;        /* offset in its out segment */
+   HYPRE_Int            *local_dst;        /* offset in the receive buffer */
+   HYPRE_Int            *local_len;
+
+   /* receives from other nodes, found in the in segment */
+   HYPRE_Int             num_remote;
+   HYPRE_Int            *remote_dst;
+   HYPRE_Int            *remote_len;
+
+   /* aggregated messages sent by this process; message i consists of the
+    * pieces agg_send_starts[i] to agg_send_starts[i+1]-1 */
+   HYPRE_Int             num_agg_sends;
+   HYPRE_Int            *agg_send_procs;
+   HYPRE_Int            *agg_send_starts;
+   HYPRE_Int            *agg_send_rank;    /* node rank owning the piece */
+   HYPRE_Int            *agg_send_off;     /* offset in its out segment */
+   HYPRE_Int            *agg_send_len;
+   HYPRE_Int             agg_send_size;
+
+   /* aggregated messages received by this process */
+   HYPRE_Int             num_agg_recvs;
+   HYPRE_Int            *agg_recv_procs;
+   HYPRE_Int            *agg_recv_starts;
+   HYPRE_Int            *agg_recv_rank;    /* node rank of the destination */
+   HYPRE_Int            *agg_recv_off;     /* offset in its in segment */
+   HYPRE_Int            *agg_recv_len;
+   HYPRE_Int             agg_recv_size;
+
+   char                 *agg_send_buf;
+   char                 *agg_recv_buf;
+
+   /* processes of this node (node ranks) this process synchronizes with:
+    * the owners of the out segments it reads, the processes reading its out
+    * segment, the processes writing to its in segment, and the owners of
+    * the in segments it writes to */
+   HYPRE_Int             num_sources;
+   HYPRE_Int            *sources;
+   HYPRE_Int             num_readers;
+   HYPRE_Int            *readers;
+   HYPRE_Int             num_writers;
+   HYPRE_Int            *writers;
+   HYPRE_Int             num_targets;
+   HYPRE_Int            *targets;
+} hypre_ParCSRNodeSchedule;
+
+typedef struct
+{
+   hypre_MPI_Win              win;
+   char                     **bases;       /* window memory of each node rank */
+   size_t                     capacity;    /* bytes per process */
+   size_t                     used;
+   HYPRE_Int                  ref_count;   /* comm_pkgs with segments in it */
+} hypre_ParCSRNodeArena;
+
+typedef struct
+{
+   hypre_MPI_Comm             comm;        /* processes on this node */
+   HYPRE_Int                  rank;
+   HYPRE_Int                  size;
+   HYPRE_Int                  leader;      /* global rank of node rank 0 */
+   HYPRE_Int                  num_pkgs;    /* comm_pkgs set up so far */
+   HYPRE_Int                  ref_count;   /* comm_pkgs using it */
+   hypre_ParCSRNodeArena     *arena;       /* arena new segments come from */
+} hypre_ParCSRNodeComm;
+
+typedef struct
+{
+   hypre_ParCSRNodeComm      *node_comm;   /* shared by all comm_pkgs of the
+                                              parent communicator */
+   hypre_MPI_Comm             comm;        /* copies from node_comm */
+   HYPRE_Int                  rank;
+   HYPRE_Int                  size;
+   HYPRE_Int                  tag;         /* added to the node tags */
+   hypre_ParCSRNodeArena     *arena;       /* holds the segments */
+   hypre_MPI_Win              win;
+   char                     **out_segs;    /* out segment of each node rank */
+   char                     **in_segs;     /* in segment of each node rank */
+   HYPRE_Int                  busy;        /* a node-aware exchange is active */
+   HYPRE_Int                  sent;        /* its aggregated messages are sent */
+   HYPRE_Int                  num_pending; /* completion messages of the last */
+   hypre_MPI_Request         *pending;     /* exchange, see DestroyNode */
+   hypre_ParCSRNodeSchedule   sched[2];    /* jobs 1, 11, 21 and jobs 2, 12, 22 */
+} hypre_ParCSRCommNode;
+#endif
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                     comm;
@@ -70,6 +217,13 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
 
+   /* runtime persistent halo plans for the matvec (0) and its transpose (1) */
+   hypre_ParCSRHaloPlan        *halo_plans[2];
+
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   hypre_ParCSRCommNode        *node;
+#endif
+
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Complex *tmp_data;
@@ -101,6 +255,10 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgHaloPlan(comm_pkg,i)          (comm_pkg -> halo_plans[i])
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+#define hypre_ParCSRCommPkgNode(comm_pkg)                (comm_pkg -> node)
+#endif
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -140,6 +298,21 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+#define hypre_ParCSRCommHandleNodeJob(comm_handle)                (comm_handle -> node_job)
+#endif
+
+/*--------------------------------------------------------------------------
+ * Traffic counters:
+ *   Number of messages and bytes sent by this process through
+ *   hypre_ParCSRCommHandleCreate and hypre_ParCSRHaloPlanStart (for the
+ *   node-aware exchange, the aggregated messages to other nodes).  They are
+ *   only ever incremented; users take differences (see the BoomerAMG
+ *   performance report).
+ *--------------------------------------------------------------------------*/
+
+extern HYPRE_Real hypre_parcsr_comm_num_messages;
+extern HYPRE_Real hypre_parcsr_comm_num_bytes;
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 
@@ -114,6 +114,9 @@ hypre_ParCSRMatrixCreate( MPI_Comm comm,
    hypre_ParCSRMatrixColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixDeviceColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixProcOrdering(matrix) = NULL;
+   hypre_ParCSRMatrixNumColors(matrix) = 0;
+   hypre_ParCSRMatrixColorOffsets(matrix) = NULL;
+   hypre_ParCSRMatrixColorRows(matrix) = NULL;
 
    hypre_ParCSRMatrixAssumedPartition(matrix) = NULL;
    hypre_ParCSRMatrixOwnsAssumedPartition(matrix) = 1;
@@ -225,6 +228,9 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
          hypre_TFree(hypre_ParCSRMatrixProcOrdering(matrix), HYPRE_MEMORY_HOST);
       }
 
+      hypre_TFree(hypre_ParCSRMatrixColorOffsets(matrix), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRMatrixColorRows(matrix), HYPRE_MEMORY_HOST);
+
       hypre_TFree(matrix->bdiaginv, HYPRE_MEMORY_HOST);
       if (matrix->bdiaginv_comm_pkg)
       {
@@ -689,6 +695,200 @@ hypre_ParCSRMatrixPrint( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinary
+ *
+ * Writes the local part of the matrix to "<file_name>.bin.<myid>" in the
+ * binary format described in hypre_binary_io.h.  After the header, the file
+ * contains:
+ *
+ *    HYPRE_BigInt   global_num_rows, global_num_cols,
+ *                   first_row, last_row + 1, first_col_diag, last_col_diag + 1
+ *    HYPRE_Int      num_rows, num_cols_offd, num_nonzeros_diag, num_nonzeros_offd
+ *    HYPRE_BigInt   col_map_offd[num_cols_offd]
+ *    diag i, j and data arrays, then offd i, j and data arrays
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinary( hypre_ParCSRMatrix *matrix,
+                               const char         *file_name )
+{
+   hypre_CSRMatrix      *diag;
+   hypre_CSRMatrix      *offd;
+   HYPRE_MemoryLocation  memory_location;
+   HYPRE_BigInt          info_big[6];
+   HYPRE_Int             info[4];
+   HYPRE_Int             my_id, num_procs, num_rows;
+   char                  new_file_name[255];
+   FILE                 *fp;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+   memory_location = hypre_ParCSRMatrixMemoryLocation(matrix);
+   num_rows = hypre_CSRMatrixNumRows(diag);
+
+   info_big[0] = hypre_ParCSRMatrixGlobalNumRows(matrix);
+   info_big[1] = hypre_ParCSRMatrixGlobalNumCols(matrix);
+   info_big[2] = hypre_ParCSRMatrixFirstRowIndex(matrix);
+   info_big[3] = hypre_ParCSRMatrixLastRowIndex(matrix) + 1;
+   info_big[4] = hypre_ParCSRMatrixFirstColDiag(matrix);
+   info_big[5] = hypre_ParCSRMatrixLastColDiag(matrix) + 1;
+   info[0] = num_rows;
+   info[1] = hypre_CSRMatrixNumCols(offd);
+   info[2] = hypre_CSRMatrixNumNonzeros(diag);
+   info[3] = hypre_CSRMatrixNumNonzeros(offd);
+
+   hypre_MPI_Comm_rank(hypre_ParCSRMatrixComm(matrix), &my_id);
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(matrix), &num_procs);
+   hypre_sprintf(new_file_name, "%s.bin.%05d", file_name, my_id);
+   if ((fp = fopen(new_file_name, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_BinaryWriteHeader(fp, hypre_BINARY_PARCSR_MATRIX, num_procs);
+   hypre_BinaryWrite(fp, info_big, 6*sizeof(HYPRE_BigInt), HYPRE_MEMORY_HOST);
+   hypre_BinaryWrite(fp, info, 4*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+   hypre_BinaryWrite(fp, hypre_ParCSRMatrixColMapOffd(matrix),
+                     info[1]*sizeof(HYPRE_BigInt), HYPRE_MEMORY_HOST);
+
+   hypre_BinaryWrite(fp, hypre_CSRMatrixI(diag), (num_rows+1)*sizeof(HYPRE_Int), memory_location);
+   hypre_BinaryWrite(fp, hypre_CSRMatrixJ(diag), info[2]*sizeof(HYPRE_Int), memory_location);
+   hypre_BinaryWrite(fp, hypre_CSRMatrixData(diag), info[2]*sizeof(HYPRE_Complex), memory_location);
+   hypre_BinaryWrite(fp, hypre_CSRMatrixI(offd), (num_rows+1)*sizeof(HYPRE_Int), memory_location);
+   hypre_BinaryWrite(fp, hypre_CSRMatrixJ(offd), info[3]*sizeof(HYPRE_Int), memory_location);
+   hypre_BinaryWrite(fp, hypre_CSRMatrixData(offd), info[3]*sizeof(HYPRE_Complex), memory_location);
+
+   fclose(fp);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinary
+ *
+ * Reads a matrix written by hypre_ParCSRMatrixPrintBinary.  The number of
+ * processes in comm must match the number of files.  If any process fails to
+ * read its file, all processes return NULL.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix *
+hypre_ParCSRMatrixReadBinary( MPI_Comm    comm,
+                              const char *file_name )
+{
+   hypre_ParCSRMatrix   *matrix;
+   hypre_CSRMatrix      *diag;
+   hypre_CSRMatrix      *offd;
+   HYPRE_MemoryLocation  memory_location;
+   hypre_BinaryReader    reader;
+   HYPRE_BigInt          info_big[6];
+   HYPRE_Int             info[4];
+   HYPRE_BigInt         *row_starts;
+   HYPRE_BigInt         *col_starts;
+   HYPRE_Int             my_id, num_procs, num_rows, i;
+   HYPRE_Int             equal = 1;
+   HYPRE_Int             ok = 1;
+   char                  new_file_name[255];
+#ifndef HYPRE_NO_GLOBAL_PARTITION
+   HYPRE_BigInt          local_starts[2];
+   HYPRE_BigInt         *all_starts;
+#endif
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   hypre_sprintf(new_file_name, "%s.bin.%05d", file_name, my_id);
+   if (hypre_BinaryReaderOpen(&reader, new_file_name, hypre_BINARY_PARCSR_MATRIX, num_procs) ||
+       hypre_BinaryRead(&reader, info_big, 6*sizeof(HYPRE_BigInt), HYPRE_MEMORY_HOST) ||
+       hypre_BinaryRead(&reader, info, 4*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST))
+   {
+      ok = 0;
+   }
+   if (!hypre_BinaryAllOK(comm, ok))
+   {
+      hypre_BinaryReaderClose(&reader);
+      return NULL;
+   }
+   num_rows = info[0];
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   row_starts = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+   col_starts = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+   row_starts[0] = info_big[2];
+   row_starts[1] = info_big[3];
+   col_starts[0] = info_big[4];
+   col_starts[1] = info_big[5];
+   for (i = 1; i >= 0; i--)
+#else
+   row_starts = hypre_CTAlloc(HYPRE_BigInt, num_procs+1, HYPRE_MEMORY_HOST);
+   col_starts = hypre_CTAlloc(HYPRE_BigInt, num_procs+1, HYPRE_MEMORY_HOST);
+   all_starts = hypre_CTAlloc(HYPRE_BigInt, 2*num_procs, HYPRE_MEMORY_HOST);
+   local_starts[0] = info_big[2];
+   local_starts[1] = info_big[4];
+   hypre_MPI_Allgather(local_starts, 2, HYPRE_MPI_BIG_INT,
+                       all_starts, 2, HYPRE_MPI_BIG_INT, comm);
+   for (i = 0; i < num_procs; i++)
+   {
+      row_starts[i] = all_starts[2*i];
+      col_starts[i] = all_starts[2*i+1];
+   }
+   row_starts[num_procs] = info_big[0];
+   col_starts[num_procs] = info_big[1];
+   hypre_TFree(all_starts, HYPRE_MEMORY_HOST);
+   for (i = num_procs; i >= 0; i--)
+#endif
+   {
+      if (row_starts[i] != col_starts[i])
+      {
+         equal = 0;
+         break;
+      }
+   }
+   if (equal)
+   {
+      hypre_TFree(col_starts, HYPRE_MEMORY_HOST);
+      col_starts = row_starts;
+   }
+
+   matrix = hypre_ParCSRMatrixCreate(comm, info_big[0], info_big[1],
+                                     row_starts, col_starts,
+                                     info[1], info[2], info[3]);
+   hypre_ParCSRMatrixInitialize(matrix);
+
+   diag = hypre_ParCSRMatrixDiag(matrix);
+   offd = hypre_ParCSRMatrixOffd(matrix);
+   memory_location = hypre_ParCSRMatrixMemoryLocation(matrix);
+
+   if (hypre_BinaryRead(&reader, hypre_ParCSRMatrixColMapOffd(matrix),
+                        info[1]*sizeof(HYPRE_BigInt), HYPRE_MEMORY_HOST) ||
+       hypre_BinaryRead(&reader, hypre_CSRMatrixI(diag), (num_rows+1)*sizeof(HYPRE_Int), memory_location) ||
+       hypre_BinaryRead(&reader, hypre_CSRMatrixJ(diag), info[2]*sizeof(HYPRE_Int), memory_location) ||
+       hypre_BinaryRead(&reader, hypre_CSRMatrixData(diag), info[2]*sizeof(HYPRE_Complex), memory_location) ||
+       hypre_BinaryRead(&reader, hypre_CSRMatrixI(offd), (num_rows+1)*sizeof(HYPRE_Int), memory_location) ||
+       hypre_BinaryRead(&reader, hypre_CSRMatrixJ(offd), info[3]*sizeof(HYPRE_Int), memory_location) ||
+       hypre_BinaryRead(&reader, hypre_CSRMatrixData(offd), info[3]*sizeof(HYPRE_Complex), memory_location))
+   {
+      ok = 0;
+   }
+
+   hypre_BinaryReaderClose(&reader);
+
+   if (!hypre_BinaryAllOK(comm, ok))
+   {
+      hypre_ParCSRMatrixDestroy(matrix);
+      return NULL;
+   }
+
+   return matrix;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixPrintIJ
  *--------------------------------------------------------------------------*/
@@ -3256,3 +3456,34 @@ hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A,
    return ierr;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToFloat
+ *
+ * Stores the values of the diag and offd blocks (and of their transposes,
+ * if present) in single precision.  The pattern is left unchanged.  See
+ * hypre_CSRMatrixConvertToFloat.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *A )
+{
+   if (!A)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffd(A));
+
+   if (hypre_ParCSRMatrixDiagT(A))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiagT(A));
+   }
+   if (hypre_ParCSRMatrixOffdT(A))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffdT(A));
+   }
+
+   return hypre_error_flag;
+}
@@ -79,6 +79,11 @@ typedef struct hypre_ParCSRMatrix_struct
    /* Array to store ordering of local diagonal block to relax. In particular,
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
+   /* Coloring of the local diagonal block for multicolor relaxation
+      (relax_type 11), computed the first time it is needed */
+   HYPRE_Int             num_colors;
+   HYPRE_Int            *color_offsets;
+   HYPRE_Int            *color_rows;
 
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
@@ -125,6 +130,9 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixNumColors(matrix)              ((matrix) -> num_colors)
+#define hypre_ParCSRMatrixColorOffsets(matrix)           ((matrix) -> color_offsets)
+#define hypre_ParCSRMatrixColorRows(matrix)              ((matrix) -> color_rows)
 #if defined(HYPRE_USING_CUDA)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -147,6 +155,57 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Cached structure of the Galerkin product RAP = P^T A P
+ * (see par_csr_rap_plan.c).
+ *
+ * Locally, A_loc = [A_diag A_offd] and P_loc = [P; P_ext], where P_ext
+ * holds the rows of P for the columns of A_offd.  The columns of P_loc are
+ * the local coarse columns followed by the external ones in col_map_ext.
+ * Q = A_loc P_loc and C = PT Q, where PT is the transpose of the local rows
+ * of P.  The rows of C for the columns of P_offd (C_ext) belong to other
+ * processes and are sent to their owners, which receive them as C_int.
+ * C_pos and C_int_pos give the position of every entry of C and C_int in
+ * RAP: p >= 0 is entry p of RAP_diag, p < 0 is entry -p-1 of RAP_offd.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_cols_offd_A;
+   HYPRE_BigInt         *col_map_offd_A;
+
+   hypre_CSRMatrix      *A_loc;
+   hypre_CSRMatrix      *P_loc;
+   HYPRE_Int             num_cols_ext;
+   HYPRE_BigInt         *col_map_ext;
+   hypre_CSRMatrix      *PT;
+   HYPRE_Int            *PT_perm;
+   hypre_CSRMatrix      *Q;
+   hypre_CSRMatrix      *C;
+
+   /* exchange of the values of P_ext */
+   hypre_ParCSRCommPkg  *P_ext_comm_pkg;
+   HYPRE_Int             num_rows_P_send;
+   HYPRE_Int            *P_send_rows;
+   HYPRE_Int            *P_send_i;
+   HYPRE_Complex        *P_send_data;
+
+   /* exchange of the values of C_ext/C_int */
+   hypre_ParCSRCommPkg  *C_ext_comm_pkg;
+   HYPRE_Int             num_rows_C_ext;
+   HYPRE_Int            *C_ext_rows;
+   HYPRE_Int            *C_ext_i;
+   HYPRE_Complex        *C_ext_data;
+   HYPRE_Int             num_rows_C_int;
+   HYPRE_Int            *C_int_rows;
+   HYPRE_Int            *C_int_i;
+   HYPRE_Complex        *C_int_data;
+
+   HYPRE_Int            *C_pos;
+   HYPRE_Int            *C_int_pos;
+
+} hypre_ParCSRRAPPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -14,6 +14,37 @@
 #include "_hypre_parcsr_mv.h"
 #include "_hypre_utilities.hpp" //RL: TODO par_csr_matvec_device.c, include cuda there
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecUseHalo
+ *
+ * Returns 1 if the host matvec should go through the persistent halo plans
+ * (hypre_ParCSRMatrixMatvecOutOfPlaceHalo, hypre_ParCSRMatrixMatvecTHalo).
+ * Multivectors stored row-wise always take this path, since their message
+ * layout is the one of the plan buffers.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecUseHalo( hypre_Vector *x_local,
+                                 hypre_Vector *y_local )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return 0;
+#else
+   HYPRE_Int num_vectors = hypre_VectorNumVectors(x_local);
+
+   if (num_vectors > 1 &&
+       hypre_VectorIndexStride(x_local) == num_vectors &&
+       hypre_VectorIndexStride(y_local) == num_vectors)
+   {
+      return 1;
+   }
+
+   return hypre_HandleSpMVHaloOverlap(hypre_handle()) &&
+          hypre_VectorIndexStride(x_local) == 1 &&
+          hypre_VectorIndexStride(y_local) == 1;
+#endif
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -89,6 +120,12 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(b_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+   if (hypre_ParCSRMatrixMatvecUseHalo(x_local, y_local))
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlaceHalo(alpha, A, x, beta, b, y);
+      return ierr;
+   }
+
    if ( num_vectors == 1 )
    {
       x_tmp = hypre_SeqVectorCreate( num_cols_offd );
@@ -433,6 +470,12 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    hypre_assert( hypre_VectorNumVectors(x_local) == num_vectors );
    hypre_assert( hypre_VectorNumVectors(y_local) == num_vectors );
 
+   if (hypre_ParCSRMatrixMatvecUseHalo(x_local, y_local))
+   {
+      hypre_ParCSRMatrixMatvecTHalo(alpha, A, x, beta, y);
+      return ierr;
+   }
+
    if ( num_vectors == 1 )
    {
       y_tmp = hypre_SeqVectorCreate(num_cols_offd);
@@ -710,6 +753,319 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOutOfPlaceHalo
+ *
+ * y = alpha*A*x + beta*b with the persistent halo plan cached in the
+ * comm_pkg (see HYPRE_SetSpMVHaloOverlap).  The rows without offd entries
+ * are computed while the halo is exchanged, and the remaining (boundary)
+ * rows afterwards in one pass over diag and offd.  When the values of A are
+ * stored in single precision or in SELL-C-sigma format, y shares its data
+ * with x, or the vectors are row-wise multivectors (SpMM), the full diag
+ * product is overlapped instead.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecOutOfPlaceHalo( HYPRE_Complex       alpha,
+                                        hypre_ParCSRMatrix *A,
+                                        hypre_ParVector    *x,
+                                        HYPRE_Complex       beta,
+                                        hypre_ParVector    *b,
+                                        hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRHaloPlan *plan;
+
+   hypre_CSRMatrix *diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Complex   *diag_data = hypre_CSRMatrixData(diag);
+   HYPRE_Int       *diag_i    = hypre_CSRMatrixI(diag);
+   HYPRE_Int       *diag_j    = hypre_CSRMatrixJ(diag);
+   hypre_CSRMatrix *offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex   *offd_data = hypre_CSRMatrixData(offd);
+   HYPRE_Int       *offd_i    = hypre_CSRMatrixI(offd);
+   HYPRE_Int       *offd_j    = hypre_CSRMatrixJ(offd);
+
+   hypre_Vector    *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector    *b_local = hypre_ParVectorLocalVector(b);
+   hypre_Vector    *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector    *x_tmp;
+   HYPRE_Complex   *x_data  = hypre_VectorData(x_local);
+   HYPRE_Complex   *b_data  = hypre_VectorData(b_local);
+   HYPRE_Complex   *y_data  = hypre_VectorData(y_local);
+   HYPRE_Complex   *x_ext;
+
+   HYPRE_Int        num_rows      = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int        num_vectors   = hypre_VectorNumVectors(x_local);
+   HYPRE_Int        x_stride      = hypre_VectorVectorStride(x_local);
+   HYPRE_Int        b_stride      = hypre_VectorVectorStride(b_local);
+   HYPRE_Int        y_stride      = hypre_VectorVectorStride(y_local);
+   HYPRE_Int        x_idxstride   = hypre_VectorIndexStride(x_local);
+
+   HYPRE_Int        split, i, jj, jv;
+   HYPRE_Complex    tmp;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   split = alpha != 0.0 && x_data != y_data && x_idxstride == 1 &&
+           !hypre_HandleSpMVUseSELL(hypre_handle()) &&
+           !hypre_CSRMatrixDataFlt(diag) && !hypre_CSRMatrixDataFlt(offd);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   plan = hypre_ParCSRCommPkgGetHaloPlan(comm_pkg, 1, num_vectors);
+   hypre_ParCSRHaloPlanPack(plan, comm_pkg, x_data, x_stride, x_idxstride);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRHaloPlanStart(plan);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (split)
+   {
+      /* interior rows, overlapped with the communication */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,jv,tmp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         if (offd_i[i+1] > offd_i[i])
+         {
+            continue;
+         }
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            tmp = 0.0;
+            for (jj = diag_i[i]; jj < diag_i[i+1]; jj++)
+            {
+               tmp += diag_data[jj] * x_data[jv*x_stride + diag_j[jj]];
+            }
+
+            if (beta == 0.0)
+            {
+               y_data[jv*y_stride + i] = alpha*tmp;
+            }
+            else
+            {
+               y_data[jv*y_stride + i] = alpha*tmp + beta*b_data[jv*b_stride + i];
+            }
+         }
+      }
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRHaloPlanWait(plan);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (split)
+   {
+      /* boundary rows; the received entries are used directly from the
+       * buffer of the plan */
+      x_ext = hypre_ParCSRHaloPlanRecvData(plan);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,jv,tmp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         if (offd_i[i+1] == offd_i[i])
+         {
+            continue;
+         }
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            tmp = 0.0;
+            for (jj = diag_i[i]; jj < diag_i[i+1]; jj++)
+            {
+               tmp += diag_data[jj] * x_data[jv*x_stride + diag_j[jj]];
+            }
+            for (jj = offd_i[i]; jj < offd_i[i+1]; jj++)
+            {
+               tmp += offd_data[jj] * x_ext[offd_j[jj]*num_vectors + jv];
+            }
+
+            if (beta == 0.0)
+            {
+               y_data[jv*y_stride + i] = alpha*tmp;
+            }
+            else
+            {
+               y_data[jv*y_stride + i] = alpha*tmp + beta*b_data[jv*b_stride + i];
+            }
+         }
+      }
+   }
+   else if (num_cols_offd)
+   {
+      /* the receive buffer holds the external entries row-wise */
+      if (num_vectors == 1 || x_idxstride == num_vectors)
+      {
+         x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+         hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+         hypre_VectorData(x_tmp) = hypre_ParCSRHaloPlanRecvData(plan);
+         hypre_SeqVectorSetDataOwner(x_tmp, 0);
+         hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+         hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+         hypre_ParCSRHaloPlanUnpack(plan, comm_pkg, hypre_VectorData(x_tmp), num_cols_offd, 1);
+      }
+
+      hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecTHalo
+ *
+ * y = alpha*A^T*x + beta*y with the persistent halo plan cached in the
+ * comm_pkg.  The diag^T product is overlapped with the communication of
+ * the offd^T partial sums, which are then added to y by a threaded unpack.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecTHalo( HYPRE_Complex       alpha,
+                               hypre_ParCSRMatrix *A,
+                               hypre_ParVector    *x,
+                               HYPRE_Complex       beta,
+                               hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRHaloPlan *plan;
+
+   hypre_CSRMatrix *diag  = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd  = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *diagT = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix *offdT = hypre_ParCSRMatrixOffdT(A);
+
+   hypre_Vector    *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector    *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector    *y_tmp;
+
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int        num_vectors   = hypre_VectorNumVectors(y_local);
+   HYPRE_Int        rowwise       = num_vectors > 1 &&
+                                    hypre_VectorIndexStride(y_local) == num_vectors;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   plan = hypre_ParCSRCommPkgGetHaloPlan(comm_pkg, 2, num_vectors);
+
+   /* for a single vector or row-wise multivectors, the partial sums are
+    * computed in the send buffer */
+   if (num_vectors == 1 || rowwise)
+   {
+      y_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+      hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+      hypre_VectorData(y_tmp) = hypre_ParCSRHaloPlanSendData(plan);
+      hypre_SeqVectorSetDataOwner(y_tmp, 0);
+   }
+   else
+   {
+      y_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   }
+   hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
+
+   if (num_cols_offd)
+   {
+      if (offdT)
+      {
+         hypre_CSRMatrixMatvec(alpha, offdT, x_local, 0.0, y_tmp);
+      }
+      else
+      {
+         hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   if (num_vectors > 1 && !rowwise)
+   {
+      hypre_ParCSRHaloPlanPack(plan, comm_pkg, hypre_VectorData(y_tmp), num_cols_offd, 1);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRHaloPlanStart(plan);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   if (diagT)
+   {
+      hypre_CSRMatrixMatvec(alpha, diagT, x_local, beta, y_local);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRHaloPlanWait(plan);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRHaloPlanUnpack(plan, comm_pkg, hypre_VectorData(y_local),
+                              hypre_VectorVectorStride(y_local),
+                              hypre_VectorIndexStride(y_local));
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorDestroy(y_tmp);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec_FF
  *--------------------------------------------------------------------------*/
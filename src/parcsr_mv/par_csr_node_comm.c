@@ -0,0 +1,1314 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Node-aware exchange for hypre_ParCSRCommPkg.
+ *
+ * The processes of a shared memory node allocate common MPI-3 windows.
+ * A node-aware exchange (jobs 1, 2, 11, 12, 21 and 22 on host memory) runs
+ * in two levels:
+ *
+ *   - every process copies its send buffer to its out segment;
+ *   - data for other nodes is gathered from the out segments by one
+ *     aggregator per pair of nodes and sent as a single message to the
+ *     aggregator of the destination node, which scatters it to the in
+ *     segments of the receiving processes;
+ *   - every process copies the data from processes on its node directly
+ *     from their out segments, and the data from other nodes from its
+ *     in segment.
+ *
+ * Only processes with neighbors in the comm_pkg (active processes) take part
+ * in its exchanges.  Messages from node a to node b are handled by active
+ * process number (leader_b % active_a) of node a and by active process
+ * number (leader_a % active_b) of node b, where leader is the smallest global
+ * rank of a node and active the number of its active processes.  Inside a
+ * message, the pieces are ordered by node rank of the sender and then by
+ * rank of the receiver.
+ *
+ * The processes of a node synchronize with zero-byte messages on the node
+ * communicator, and only with the processes whose segments they actually
+ * share in the exchange: a process tells the readers of its out segment that
+ * it is filled (when the exchange is started), an aggregator tells the
+ * receivers that their in segments are filled, and every process tells the
+ * owners of the segments it has read, or written to, when it is done with
+ * them (when the exchange is completed).  The latter messages are only
+ * waited for before the segments are filled again in the next exchange.
+ * Starting an exchange does not wait for other processes, unless the
+ * previous exchange is still being completed by a process sharing a segment;
+ * aggregated messages whose pieces are not yet published are sent when the
+ * exchange is completed.
+ *
+ * The node communicator is cached as an attribute of the parent communicator
+ * and shared by all comm_pkgs of that communicator.  The segments of the
+ * comm_pkgs live in arenas, shared windows of at least HYPRE_NODE_ARENA_SIZE
+ * bytes per process that are filled one comm_pkg after the other, so that a
+ * hierarchy of comm_pkgs needs few window handles.  The messages of a
+ * comm_pkg carry their own tags.  None of this is set up unless enabled with HYPRE_SetCommNodeAware.
+ * The node information is set up when the comm_pkg is created and freed
+ * with the comm_pkg, so creation and destruction of comm_pkgs must be called
+ * by all processes of their communicator in the same order, and every
+ * exchange by all active processes.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+
+#define HYPRE_NODE_COMM_TAG 4397
+#define HYPRE_NODE_OUT_TAG  4398      /* an out segment is filled */
+#define HYPRE_NODE_IN_TAG   4399      /* an in segment is filled */
+#define HYPRE_NODE_DONE_TAG 4400      /* a segment is no longer accessed */
+#define HYPRE_NODE_NUM_TAGS 4096      /* comm_pkgs with different tags */
+
+#define HYPRE_NODE_ARENA_SIZE (1 << 20)
+#define HYPRE_NODE_ALIGN      64
+
+static HYPRE_Int hypre_ParCSRNodeCommKeyval = hypre_MPI_KEYVAL_INVALID;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeSortPieces
+ *
+ * Returns in perm the order of the n pieces sorted by key1 and then by key2.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRNodeSortPieces( HYPRE_Int  n,
+                            HYPRE_Int *key1,
+                            HYPRE_Int *key2,
+                            HYPRE_Int *perm )
+{
+   HYPRE_Int *keys = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   HYPRE_Int  i, j;
+
+   for (i = 0; i < n; i++)
+   {
+      keys[i] = key1[i];
+      perm[i] = i;
+   }
+   hypre_qsort2i(keys, perm, 0, n-1);
+
+   for (i = 0; i < n; i = j)
+   {
+      for (j = i; j < n && key1[perm[j]] == key1[perm[i]]; j++)
+      {
+         keys[j] = key2[perm[j]];
+      }
+      hypre_qsort2i(keys, perm, i, j-1);
+   }
+
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeRankList
+ *
+ * Returns the node ranks r != node_rank with marker[r] != 0 in increasing
+ * order, and resets marker.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRNodeRankList( HYPRE_Int   node_size,
+                          HYPRE_Int   node_rank,
+                          HYPRE_Int  *marker,
+                          HYPRE_Int **list_ptr )
+{
+   HYPRE_Int *list;
+   HYPRE_Int  num, r;
+
+   marker[node_rank] = 0;
+   num = 0;
+   for (r = 0; r < node_size; r++)
+   {
+      if (marker[r])
+      {
+         num++;
+      }
+   }
+   list = hypre_TAlloc(HYPRE_Int, num, HYPRE_MEMORY_HOST);
+   num = 0;
+   for (r = 0; r < node_size; r++)
+   {
+      if (marker[r])
+      {
+         list[num++] = r;
+         marker[r] = 0;
+      }
+   }
+
+   *list_ptr = list;
+
+   return num;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeScheduleSetup
+ *
+ * Sets up the schedule for the exchange sending the num_out pieces given by
+ * out_procs and out_starts, and receiving the num_in pieces given by
+ * in_procs and in_starts.  leader and nrank give the node leader and node
+ * rank of every process, by_node lists the active processes of the node with
+ * leader L in by_node[by_node_starts[L]] to by_node[by_node_starts[L+1]-1].
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRNodeScheduleSetup( hypre_ParCSRCommNode     *node,
+                               HYPRE_Int                 my_id,
+                               HYPRE_Int                *leader,
+                               HYPRE_Int                *nrank,
+                               HYPRE_Int                *by_node,
+                               HYPRE_Int                *by_node_starts,
+                               HYPRE_Int                 num_out,
+                               HYPRE_Int                *out_procs,
+                               HYPRE_Int                *out_starts,
+                               HYPRE_Int                 num_in,
+                               HYPRE_Int                *in_procs,
+                               HYPRE_Int                *in_starts,
+                               size_t                    elem_size,
+                               hypre_ParCSRNodeSchedule *sched )
+{
+   hypre_MPI_Comm  node_comm = node -> comm;
+   HYPRE_Int       node_rank = node -> rank;
+   HYPRE_Int       node_size = node -> size;
+   HYPRE_Int       my_leader = leader[my_id];
+   HYPRE_Int      *my_active = by_node + by_node_starts[my_leader];
+   HYPRE_Int       num_active = by_node_starts[my_leader+1] - by_node_starts[my_leader];
+
+   HYPRE_Int      *my_out, *my_in, *perm, *keys, *marker;
+   HYPRE_Int      *all_out, *all_in;
+   HYPRE_Int      *out_counts, *out_displs, *in_counts, *in_displs;
+   HYPRE_Int      *key1, *key2, *p_rank, *p_off, *p_len;
+   HYPRE_Int       cnt, num_pieces, num_msgs;
+   HYPRE_Int       i, j, k, q, r, s, L;
+
+   /*-----------------------------------------------------------------
+    * Gather the out pieces (sorted by destination) and in pieces of
+    * all processes on the node
+    *-----------------------------------------------------------------*/
+
+   my_out = hypre_TAlloc(HYPRE_Int, 3*num_out, HYPRE_MEMORY_HOST);
+   my_in  = hypre_TAlloc(HYPRE_Int, 3*num_in, HYPRE_MEMORY_HOST);
+   perm   = hypre_TAlloc(HYPRE_Int, num_out, HYPRE_MEMORY_HOST);
+   keys   = hypre_TAlloc(HYPRE_Int, num_out, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_out; i++)
+   {
+      keys[i] = out_procs[i];
+      perm[i] = i;
+   }
+   hypre_qsort2i(keys, perm, 0, num_out-1);
+   for (i = 0; i < num_out; i++)
+   {
+      j = perm[i];
+      my_out[3*i]   = out_procs[j];
+      my_out[3*i+1] = out_starts[j];
+      my_out[3*i+2] = out_starts[j+1] - out_starts[j];
+   }
+   for (i = 0; i < num_in; i++)
+   {
+      my_in[3*i]   = in_procs[i];
+      my_in[3*i+1] = in_starts[i];
+      my_in[3*i+2] = in_starts[i+1] - in_starts[i];
+   }
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+
+   out_counts = hypre_TAlloc(HYPRE_Int, node_size, HYPRE_MEMORY_HOST);
+   out_displs = hypre_TAlloc(HYPRE_Int, node_size+1, HYPRE_MEMORY_HOST);
+   in_counts  = hypre_TAlloc(HYPRE_Int, node_size, HYPRE_MEMORY_HOST);
+   in_displs  = hypre_TAlloc(HYPRE_Int, node_size+1, HYPRE_MEMORY_HOST);
+
+   cnt = 3*num_out;
+   hypre_MPI_Allgather(&cnt, 1, HYPRE_MPI_INT, out_counts, 1, HYPRE_MPI_INT, node_comm);
+   cnt = 3*num_in;
+   hypre_MPI_Allgather(&cnt, 1, HYPRE_MPI_INT, in_counts, 1, HYPRE_MPI_INT, node_comm);
+   out_displs[0] = 0;
+   in_displs[0] = 0;
+   for (r = 0; r < node_size; r++)
+   {
+      out_displs[r+1] = out_displs[r] + out_counts[r];
+      in_displs[r+1]  = in_displs[r] + in_counts[r];
+   }
+
+   all_out = hypre_TAlloc(HYPRE_Int, out_displs[node_size], HYPRE_MEMORY_HOST);
+   all_in  = hypre_TAlloc(HYPRE_Int, in_displs[node_size], HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgatherv(my_out, 3*num_out, HYPRE_MPI_INT,
+                        all_out, out_counts, out_displs, HYPRE_MPI_INT, node_comm);
+   hypre_MPI_Allgatherv(my_in, 3*num_in, HYPRE_MPI_INT,
+                        all_in, in_counts, in_displs, HYPRE_MPI_INT, node_comm);
+
+   /*-----------------------------------------------------------------
+    * Receives from processes on this node and from other nodes
+    *-----------------------------------------------------------------*/
+
+   sched -> num_local  = 0;
+   sched -> num_remote = 0;
+   for (i = 0; i < num_in; i++)
+   {
+      if (leader[my_in[3*i]] == my_leader)
+      {
+         sched -> num_local++;
+      }
+      else
+      {
+         sched -> num_remote++;
+      }
+   }
+   sched -> local_rank = hypre_TAlloc(HYPRE_Int, sched -> num_local, HYPRE_MEMORY_HOST);
+   sched -> local_src  = hypre_TAlloc(HYPRE_Int, sched -> num_local, HYPRE_MEMORY_HOST);
+   sched -> local_dst  = hypre_TAlloc(HYPRE_Int, sched -> num_local, HYPRE_MEMORY_HOST);
+   sched -> local_len  = hypre_TAlloc(HYPRE_Int, sched -> num_local, HYPRE_MEMORY_HOST);
+   sched -> remote_dst = hypre_TAlloc(HYPRE_Int, sched -> num_remote, HYPRE_MEMORY_HOST);
+   sched -> remote_len = hypre_TAlloc(HYPRE_Int, sched -> num_remote, HYPRE_MEMORY_HOST);
+
+   sched -> num_local  = 0;
+   sched -> num_remote = 0;
+   for (i = 0; i < num_in; i++)
+   {
+      s = my_in[3*i];
+      if (leader[s] == my_leader)
+      {
+         r = nrank[s];
+         for (k = out_displs[r]; k < out_displs[r+1]; k += 3)
+         {
+            if (all_out[k] == my_id)
+            {
+               break;
+            }
+         }
+         if (k == out_displs[r+1])
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Inconsistent communication package!\n");
+            k = out_displs[r];
+         }
+         j = sched -> num_local++;
+         sched -> local_rank[j] = r;
+         sched -> local_src[j]  = all_out[k+1];
+         sched -> local_dst[j]  = my_in[3*i+1];
+         sched -> local_len[j]  = my_in[3*i+2];
+      }
+      else
+      {
+         j = sched -> num_remote++;
+         sched -> remote_dst[j] = my_in[3*i+1];
+         sched -> remote_len[j] = my_in[3*i+2];
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Aggregated sends: the pieces of all processes on this node to the
+    * nodes handled by this process, in the order (sender, receiver)
+    *-----------------------------------------------------------------*/
+
+   num_pieces = 0;
+   for (k = 0; k < out_displs[node_size]; k += 3)
+   {
+      L = leader[all_out[k]];
+      if (L != my_leader && nrank[my_active[L % num_active]] == node_rank)
+      {
+         num_pieces++;
+      }
+   }
+   key1   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   key2   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   p_rank = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   p_off  = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   p_len  = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   perm   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (r = 0; r < node_size; r++)
+   {
+      for (k = out_displs[r]; k < out_displs[r+1]; k += 3)
+      {
+         L = leader[all_out[k]];
+         if (L != my_leader && nrank[my_active[L % num_active]] == node_rank)
+         {
+            key1[j]   = L;
+            key2[j]   = j;
+            p_rank[j] = r;
+            p_off[j]  = all_out[k+1];
+            p_len[j]  = all_out[k+2];
+            j++;
+         }
+      }
+   }
+   hypre_ParCSRNodeSortPieces(num_pieces, key1, key2, perm);
+
+   num_msgs = 0;
+   for (i = 0; i < num_pieces; i++)
+   {
+      if (i == 0 || key1[perm[i]] != key1[perm[i-1]])
+      {
+         num_msgs++;
+      }
+   }
+   sched -> num_agg_sends   = num_msgs;
+   sched -> agg_send_procs  = hypre_TAlloc(HYPRE_Int, num_msgs, HYPRE_MEMORY_HOST);
+   sched -> agg_send_starts = hypre_TAlloc(HYPRE_Int, num_msgs+1, HYPRE_MEMORY_HOST);
+   sched -> agg_send_rank   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   sched -> agg_send_off    = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   sched -> agg_send_len    = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   sched -> agg_send_size   = 0;
+
+   num_msgs = 0;
+   for (i = 0; i < num_pieces; i++)
+   {
+      j = perm[i];
+      if (i == 0 || key1[j] != key1[perm[i-1]])
+      {
+         L = key1[j];
+         q = by_node_starts[L] + my_leader % (by_node_starts[L+1] - by_node_starts[L]);
+         sched -> agg_send_procs[num_msgs]  = by_node[q];
+         sched -> agg_send_starts[num_msgs] = i;
+         num_msgs++;
+      }
+      sched -> agg_send_rank[i] = p_rank[j];
+      sched -> agg_send_off[i]  = p_off[j];
+      sched -> agg_send_len[i]  = p_len[j];
+      sched -> agg_send_size   += p_len[j];
+   }
+   sched -> agg_send_starts[num_msgs] = num_pieces;
+
+   hypre_TFree(key1, HYPRE_MEMORY_HOST);
+   hypre_TFree(key2, HYPRE_MEMORY_HOST);
+   hypre_TFree(p_rank, HYPRE_MEMORY_HOST);
+   hypre_TFree(p_off, HYPRE_MEMORY_HOST);
+   hypre_TFree(p_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * Aggregated receives: the pieces for all processes on this node from
+    * the nodes handled by this process, in the same order as they are
+    * sent.  Node ranks follow global ranks, so ordering by the node rank
+    * of the receiver is ordering by its global rank.
+    *-----------------------------------------------------------------*/
+
+   num_pieces = 0;
+   for (k = 0; k < in_displs[node_size]; k += 3)
+   {
+      L = leader[all_in[k]];
+      if (L != my_leader && nrank[my_active[L % num_active]] == node_rank)
+      {
+         num_pieces++;
+      }
+   }
+   key1   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   key2   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   p_rank = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   p_off  = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   p_len  = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   perm   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (q = 0; q < node_size; q++)
+   {
+      for (k = in_displs[q]; k < in_displs[q+1]; k += 3)
+      {
+         s = all_in[k];
+         L = leader[s];
+         if (L != my_leader && nrank[my_active[L % num_active]] == node_rank)
+         {
+            key1[j]   = L;
+            key2[j]   = nrank[s]*node_size + q;
+            p_rank[j] = q;
+            p_off[j]  = all_in[k+1];
+            p_len[j]  = all_in[k+2];
+            j++;
+         }
+      }
+   }
+   hypre_ParCSRNodeSortPieces(num_pieces, key1, key2, perm);
+
+   num_msgs = 0;
+   for (i = 0; i < num_pieces; i++)
+   {
+      if (i == 0 || key1[perm[i]] != key1[perm[i-1]])
+      {
+         num_msgs++;
+      }
+   }
+   sched -> num_agg_recvs   = num_msgs;
+   sched -> agg_recv_procs  = hypre_TAlloc(HYPRE_Int, num_msgs, HYPRE_MEMORY_HOST);
+   sched -> agg_recv_starts = hypre_TAlloc(HYPRE_Int, num_msgs+1, HYPRE_MEMORY_HOST);
+   sched -> agg_recv_rank   = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   sched -> agg_recv_off    = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   sched -> agg_recv_len    = hypre_TAlloc(HYPRE_Int, num_pieces, HYPRE_MEMORY_HOST);
+   sched -> agg_recv_size   = 0;
+
+   num_msgs = 0;
+   for (i = 0; i < num_pieces; i++)
+   {
+      j = perm[i];
+      if (i == 0 || key1[j] != key1[perm[i-1]])
+      {
+         L = key1[j];
+         q = by_node_starts[L] + my_leader % (by_node_starts[L+1] - by_node_starts[L]);
+         sched -> agg_recv_procs[num_msgs]  = by_node[q];
+         sched -> agg_recv_starts[num_msgs] = i;
+         num_msgs++;
+      }
+      sched -> agg_recv_rank[i] = p_rank[j];
+      sched -> agg_recv_off[i]  = p_off[j];
+      sched -> agg_recv_len[i]  = p_len[j];
+      sched -> agg_recv_size   += p_len[j];
+   }
+   sched -> agg_recv_starts[num_msgs] = num_pieces;
+
+   hypre_TFree(key1, HYPRE_MEMORY_HOST);
+   hypre_TFree(key2, HYPRE_MEMORY_HOST);
+   hypre_TFree(p_rank, HYPRE_MEMORY_HOST);
+   hypre_TFree(p_off, HYPRE_MEMORY_HOST);
+   hypre_TFree(p_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+
+   sched -> agg_send_buf = hypre_TAlloc(char, sched -> agg_send_size * elem_size,
+                                        HYPRE_MEMORY_HOST);
+   sched -> agg_recv_buf = hypre_TAlloc(char, sched -> agg_recv_size * elem_size,
+                                        HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * Processes of this node sharing a segment with this process
+    *-----------------------------------------------------------------*/
+
+   marker = hypre_CTAlloc(HYPRE_Int, node_size, HYPRE_MEMORY_HOST);
+
+   /* out segments read by this process */
+   for (i = 0; i < sched -> num_local; i++)
+   {
+      marker[sched -> local_rank[i]] = 1;
+   }
+   for (i = 0; i < sched -> agg_send_starts[sched -> num_agg_sends]; i++)
+   {
+      marker[sched -> agg_send_rank[i]] = 1;
+   }
+   sched -> num_sources = hypre_ParCSRNodeRankList(node_size, node_rank, marker,
+                                                   &(sched -> sources));
+
+   /* processes reading the out segment of this process: its receivers on
+    * this node and the aggregators of its pieces for other nodes */
+   for (q = 0; q < node_size; q++)
+   {
+      for (k = in_displs[q]; k < in_displs[q+1]; k += 3)
+      {
+         s = all_in[k];
+         if (leader[s] == my_leader && nrank[s] == node_rank)
+         {
+            marker[q] = 1;
+         }
+      }
+   }
+   for (i = 0; i < num_out; i++)
+   {
+      L = leader[my_out[3*i]];
+      if (L != my_leader)
+      {
+         marker[nrank[my_active[L % num_active]]] = 1;
+      }
+   }
+   sched -> num_readers = hypre_ParCSRNodeRankList(node_size, node_rank, marker,
+                                                   &(sched -> readers));
+
+   /* aggregators writing to the in segment of this process */
+   for (i = 0; i < num_in; i++)
+   {
+      L = leader[my_in[3*i]];
+      if (L != my_leader)
+      {
+         marker[nrank[my_active[L % num_active]]] = 1;
+      }
+   }
+   sched -> num_writers = hypre_ParCSRNodeRankList(node_size, node_rank, marker,
+                                                   &(sched -> writers));
+
+   /* in segments written by this process */
+   for (i = 0; i < sched -> agg_recv_starts[sched -> num_agg_recvs]; i++)
+   {
+      marker[sched -> agg_recv_rank[i]] = 1;
+   }
+   sched -> num_targets = hypre_ParCSRNodeRankList(node_size, node_rank, marker,
+                                                   &(sched -> targets));
+
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(my_out, HYPRE_MEMORY_HOST);
+   hypre_TFree(my_in, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_out, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_in, HYPRE_MEMORY_HOST);
+   hypre_TFree(out_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(out_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(in_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(in_displs, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+static void
+hypre_ParCSRNodeScheduleDestroy( hypre_ParCSRNodeSchedule *sched )
+{
+   hypre_TFree(sched -> local_rank, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> local_src, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> local_dst, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> local_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> remote_dst, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> remote_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_send_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_send_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_send_rank, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_send_off, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_send_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_recv_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_recv_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_recv_rank, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_recv_off, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_recv_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_send_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> agg_recv_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> readers, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> writers, HYPRE_MEMORY_HOST);
+   hypre_TFree(sched -> targets, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeNotify
+ *
+ * Sends a zero-byte message with the given tag (offset by the tag of the
+ * comm_pkg) to the num node ranks in ranks.  Updates of the window by this
+ * process are made visible first.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRNodeNotify( hypre_ParCSRCommNode *node,
+                        HYPRE_Int             num,
+                        HYPRE_Int            *ranks,
+                        HYPRE_Int             tag,
+                        hypre_MPI_Request    *requests )
+{
+   HYPRE_Int i;
+
+   hypre_MPI_Win_sync(node -> win);
+   for (i = 0; i < num; i++)
+   {
+      hypre_MPI_Isend(NULL, 0, hypre_MPI_BYTE, ranks[i], tag + node -> tag, node -> comm,
+                      &requests[i]);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeExpect
+ *
+ * Posts the receives of the zero-byte messages of hypre_ParCSRNodeNotify.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRNodeExpect( hypre_ParCSRCommNode *node,
+                        HYPRE_Int             num,
+                        HYPRE_Int            *ranks,
+                        HYPRE_Int             tag,
+                        hypre_MPI_Request    *requests )
+{
+   HYPRE_Int i;
+
+   for (i = 0; i < num; i++)
+   {
+      hypre_MPI_Irecv(NULL, 0, hypre_MPI_BYTE, ranks[i], tag + node -> tag, node -> comm,
+                      &requests[i]);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeWait
+ *
+ * Waits for the num zero-byte messages of hypre_ParCSRNodeExpect in
+ * requests, then makes the updates of the window they announce visible to
+ * this process.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRNodeWait( hypre_ParCSRCommNode *node,
+                      HYPRE_Int             num,
+                      hypre_MPI_Request    *requests )
+{
+   if (num)
+   {
+      hypre_MPI_Waitall(num, requests, hypre_MPI_STATUSES_IGNORE);
+   }
+   hypre_MPI_Win_sync(node -> win);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeSendAggregated
+ *
+ * Gathers the aggregated messages of sched from the out segments and sends
+ * them.  The out segments of sched -> sources must be filled, and their
+ * updates made visible with hypre_ParCSRNodeWait.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRNodeSendAggregated( hypre_ParCSRCommNode     *node,
+                                hypre_ParCSRNodeSchedule *sched,
+                                MPI_Comm                  comm,
+                                size_t                    elem_size,
+                                hypre_MPI_Request        *requests )
+{
+   HYPRE_Int  i, k, pos, len;
+   char      *buf;
+
+   pos = 0;
+   for (i = 0; i < sched -> num_agg_sends; i++)
+   {
+      buf = sched -> agg_send_buf + pos*elem_size;
+      len = 0;
+      for (k = sched -> agg_send_starts[i]; k < sched -> agg_send_starts[i+1]; k++)
+      {
+         hypre_TMemcpy(buf + len*elem_size,
+                       node -> out_segs[sched -> agg_send_rank[k]] + sched -> agg_send_off[k]*elem_size,
+                       char, sched -> agg_send_len[k]*elem_size,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         len += sched -> agg_send_len[k];
+      }
+      hypre_MPI_Isend(buf, (HYPRE_Int) (len*elem_size), hypre_MPI_BYTE,
+                      sched -> agg_send_procs[i], HYPRE_NODE_COMM_TAG + node -> tag, comm,
+                      &requests[i]);
+      pos += len;
+   }
+
+   node -> sent = 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeArenaCreate, hypre_ParCSRNodeArenaDestroy
+ *
+ * An arena is a shared window of capacity bytes per process of the node.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRNodeArena *
+hypre_ParCSRNodeArenaCreate( hypre_ParCSRNodeComm *node_comm,
+                             size_t                capacity )
+{
+   hypre_ParCSRNodeArena *arena = hypre_CTAlloc(hypre_ParCSRNodeArena, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Aint         size;
+   HYPRE_Int              r, disp_unit;
+   char                  *base;
+
+   hypre_MPI_Win_allocate_shared((hypre_MPI_Aint) capacity, 1, hypre_MPI_INFO_NULL,
+                                 node_comm -> comm, &base, &(arena -> win));
+   hypre_MPI_Win_lock_all(0, arena -> win);
+
+   arena -> bases = hypre_TAlloc(char *, node_comm -> size, HYPRE_MEMORY_HOST);
+   for (r = 0; r < node_comm -> size; r++)
+   {
+      hypre_MPI_Win_shared_query(arena -> win, r, &size, &disp_unit, &(arena -> bases[r]));
+   }
+   arena -> capacity = capacity;
+
+   return arena;
+}
+
+static void
+hypre_ParCSRNodeArenaDestroy( hypre_ParCSRNodeArena *arena )
+{
+   hypre_MPI_Win_unlock_all(arena -> win);
+   hypre_MPI_Win_free(&(arena -> win));
+   hypre_TFree(arena -> bases, HYPRE_MEMORY_HOST);
+   hypre_TFree(arena, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeArenaReserve
+ *
+ * Reserves size bytes per process for a comm_pkg and returns the arena and
+ * the offset of the reserved bytes in the window memory of this process.
+ * A new arena is started if the current one is full on any process of the
+ * node.  Collective on the node communicator.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRNodeArena *
+hypre_ParCSRNodeArenaReserve( hypre_ParCSRNodeComm *node_comm,
+                              size_t                size,
+                              size_t               *offset_ptr )
+{
+   hypre_ParCSRNodeArena *arena = node_comm -> arena;
+   HYPRE_Int              full, any_full;
+
+   size = (size + HYPRE_NODE_ALIGN - 1) / HYPRE_NODE_ALIGN * HYPRE_NODE_ALIGN;
+   full = (!arena || arena -> used + size > arena -> capacity);
+   hypre_MPI_Allreduce(&full, &any_full, 1, HYPRE_MPI_INT, hypre_MPI_MAX, node_comm -> comm);
+   if (any_full)
+   {
+      /* the current arena is left to the comm_pkgs still using it */
+      if (arena && !(arena -> ref_count))
+      {
+         hypre_ParCSRNodeArenaDestroy(arena);
+      }
+      arena = hypre_ParCSRNodeArenaCreate(node_comm,
+                                          hypre_max(size, (size_t) HYPRE_NODE_ARENA_SIZE));
+      node_comm -> arena = arena;
+   }
+
+   *offset_ptr = arena -> used;
+   arena -> used += size;
+   arena -> ref_count++;
+
+   return arena;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeArenaRelease
+ *
+ * Releases the segments of a comm_pkg.  Arenas are freed when no comm_pkg
+ * uses them anymore, except for the current one, which is reused from the
+ * start.  Collective on the node communicator if the arena is freed.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRNodeArenaRelease( hypre_ParCSRNodeComm  *node_comm,
+                              hypre_ParCSRNodeArena *arena )
+{
+   if (--(arena -> ref_count) == 0)
+   {
+      if (arena == node_comm -> arena)
+      {
+         arena -> used = 0;
+      }
+      else
+      {
+         hypre_ParCSRNodeArenaDestroy(arena);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommDeleteAttr
+ *
+ * Frees the node communicator when its attribute is deleted by
+ * hypre_ParCSRNodeCommRelease.  If MPI deletes the attribute (because the
+ * parent communicator is freed) while comm_pkgs still use it, it is left to
+ * them, since MPI may no longer be able to free its windows.
+ *--------------------------------------------------------------------------*/
+
+static hypre_int
+hypre_ParCSRNodeCommDeleteAttr( hypre_MPI_Comm  comm,
+                                hypre_int       keyval,
+                                void           *attr_val,
+                                void           *extra_state )
+{
+   hypre_ParCSRNodeComm *node_comm = (hypre_ParCSRNodeComm *) attr_val;
+
+   if (!(node_comm -> ref_count))
+   {
+      if (node_comm -> arena)
+      {
+         hypre_ParCSRNodeArenaDestroy(node_comm -> arena);
+      }
+      hypre_MPI_Comm_free(&(node_comm -> comm));
+      hypre_TFree(node_comm, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_MPI_SUCCESS;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeCommGet, hypre_ParCSRNodeCommRelease
+ *
+ * Returns a reference to the node communicator cached with comm, creating it
+ * if no comm_pkg of comm holds one.  Releasing the last reference frees it.
+ * Both are collective on comm.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRNodeComm *
+hypre_ParCSRNodeCommGet( MPI_Comm comm )
+{
+   hypre_ParCSRNodeComm *node_comm;
+   HYPRE_Int             my_id, found;
+
+   if (hypre_ParCSRNodeCommKeyval == hypre_MPI_KEYVAL_INVALID)
+   {
+      hypre_MPI_Comm_create_keyval(hypre_MPI_COMM_NULL_COPY_FN, hypre_ParCSRNodeCommDeleteAttr,
+                                   &hypre_ParCSRNodeCommKeyval, NULL);
+   }
+
+   hypre_MPI_Comm_get_attr(comm, hypre_ParCSRNodeCommKeyval, &node_comm, &found);
+   if (!found)
+   {
+      node_comm = hypre_CTAlloc(hypre_ParCSRNodeComm, 1, HYPRE_MEMORY_HOST);
+      hypre_MPI_Comm_rank(comm, &my_id);
+      hypre_MPI_Comm_split_type(comm, hypre_MPI_COMM_TYPE_SHARED, my_id,
+                                hypre_MPI_INFO_NULL, &(node_comm -> comm));
+      hypre_MPI_Comm_rank(node_comm -> comm, &(node_comm -> rank));
+      hypre_MPI_Comm_size(node_comm -> comm, &(node_comm -> size));
+      node_comm -> leader = my_id;
+      hypre_MPI_Bcast(&(node_comm -> leader), 1, HYPRE_MPI_INT, 0, node_comm -> comm);
+      hypre_MPI_Comm_set_attr(comm, hypre_ParCSRNodeCommKeyval, node_comm);
+   }
+   node_comm -> ref_count++;
+
+   return node_comm;
+}
+
+static void
+hypre_ParCSRNodeCommRelease( MPI_Comm              comm,
+                             hypre_ParCSRNodeComm *node_comm )
+{
+   if (--(node_comm -> ref_count) == 0)
+   {
+      hypre_MPI_Comm_delete_attr(comm, hypre_ParCSRNodeCommKeyval);
+   }
+}
+
+#endif /* HYPRE_USING_NODE_AWARE_MPI */
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNode
+ *
+ * Sets up the node-aware exchange for comm_pkg if enabled with
+ * HYPRE_SetCommNodeAware.  Must be called by all processes of the
+ * communicator of comm_pkg after the send and receive information is set.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNode( hypre_ParCSRCommPkg *comm_pkg )
+{
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   MPI_Comm               comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int              num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int              num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int              send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int              recv_size = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+   hypre_ParCSRNodeComm  *node_comm;
+   hypre_ParCSRCommNode  *node;
+
+   HYPRE_Int             *leader, *nrank, *by_node, *by_node_starts, *info;
+   HYPRE_Int              my_id, num_procs, max_active, active, tag;
+   HYPRE_Int              p, r;
+   size_t                 elem_size, seg_size, offset, *segs;
+
+   if (!hypre_HandleCommNodeAware(hypre_handle()) || hypre_ParCSRCommPkgNode(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+   if (num_procs == 1)
+   {
+      return hypre_error_flag;
+   }
+
+   node_comm = hypre_ParCSRNodeCommGet(comm);
+   tag = 4*(node_comm -> num_pkgs % HYPRE_NODE_NUM_TAGS);
+   node_comm -> num_pkgs++;
+
+   /*-----------------------------------------------------------------
+    * Node leader and node rank of every process.  Processes without
+    * neighbors may skip the exchanges with comm_pkg (see, e.g., the RAP
+    * setup), so they are not active in the node-aware exchange.
+    *-----------------------------------------------------------------*/
+
+   active = (num_sends + num_recvs > 0);
+
+   info = hypre_TAlloc(HYPRE_Int, 3*num_procs, HYPRE_MEMORY_HOST);
+   leader = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   nrank  = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   by_node = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   by_node_starts = hypre_CTAlloc(HYPRE_Int, num_procs+1, HYPRE_MEMORY_HOST);
+
+   info[3*my_id]   = node_comm -> leader;
+   info[3*my_id+1] = node_comm -> rank;
+   info[3*my_id+2] = active;
+   hypre_MPI_Allgather(&info[3*my_id], 3, HYPRE_MPI_INT, info, 3, HYPRE_MPI_INT, comm);
+
+   for (p = 0; p < num_procs; p++)
+   {
+      leader[p] = info[3*p];
+      nrank[p]  = info[3*p+1];
+      if (info[3*p+2])
+      {
+         by_node_starts[leader[p]+1]++;
+      }
+   }
+   max_active = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      max_active = hypre_max(max_active, by_node_starts[p+1]);
+      by_node_starts[p+1] += by_node_starts[p];
+   }
+   /* active processes of each node in the order of their ranks */
+   for (p = 0; p < num_procs; p++)
+   {
+      if (info[3*p+2])
+      {
+         by_node[by_node_starts[leader[p]]++] = p;
+      }
+   }
+   for (p = num_procs; p > 0; p--)
+   {
+      by_node_starts[p] = by_node_starts[p-1];
+   }
+   by_node_starts[0] = 0;
+
+   /* nothing to gain if no node has two active processes; all processes of
+      a node keep the node information otherwise, to share its arenas */
+   if (max_active > 1)
+   {
+      node = hypre_CTAlloc(hypre_ParCSRCommNode, 1, HYPRE_MEMORY_HOST);
+      node -> node_comm = node_comm;
+      node -> comm = node_comm -> comm;
+      node -> rank = node_comm -> rank;
+      node -> size = node_comm -> size;
+      node -> tag  = tag;
+
+      /*--------------------------------------------------------------
+       * An out and an in segment per process in the current arena
+       *--------------------------------------------------------------*/
+
+      elem_size = hypre_max(sizeof(HYPRE_Complex), sizeof(HYPRE_BigInt));
+      seg_size  = (size_t) hypre_max(send_size, recv_size) * elem_size;
+
+      node -> arena = hypre_ParCSRNodeArenaReserve(node_comm, 2*seg_size, &offset);
+      node -> win = node -> arena -> win;
+
+      segs = hypre_TAlloc(size_t, 2*(node -> size), HYPRE_MEMORY_HOST);
+      segs[2*(node -> rank)]   = offset;
+      segs[2*(node -> rank)+1] = seg_size;
+      hypre_MPI_Allgather(&segs[2*(node -> rank)], (HYPRE_Int) (2*sizeof(size_t)), hypre_MPI_BYTE,
+                          segs, (HYPRE_Int) (2*sizeof(size_t)), hypre_MPI_BYTE, node -> comm);
+
+      node -> out_segs = hypre_TAlloc(char *, node -> size, HYPRE_MEMORY_HOST);
+      node -> in_segs  = hypre_TAlloc(char *, node -> size, HYPRE_MEMORY_HOST);
+      for (r = 0; r < node -> size; r++)
+      {
+         node -> out_segs[r] = node -> arena -> bases[r] + segs[2*r];
+         node -> in_segs[r]  = node -> out_segs[r] + segs[2*r+1];
+      }
+      hypre_TFree(segs, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRNodeScheduleSetup(node, my_id, leader, nrank, by_node, by_node_starts,
+                                    num_sends,
+                                    hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                    hypre_ParCSRCommPkgSendMapStarts(comm_pkg),
+                                    num_recvs,
+                                    hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                    hypre_ParCSRCommPkgRecvVecStarts(comm_pkg),
+                                    elem_size, &(node -> sched[0]));
+      hypre_ParCSRNodeScheduleSetup(node, my_id, leader, nrank, by_node, by_node_starts,
+                                    num_recvs,
+                                    hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                    hypre_ParCSRCommPkgRecvVecStarts(comm_pkg),
+                                    num_sends,
+                                    hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                    hypre_ParCSRCommPkgSendMapStarts(comm_pkg),
+                                    elem_size, &(node -> sched[1]));
+
+      hypre_ParCSRCommPkgNode(comm_pkg) = node;
+   }
+   else
+   {
+      hypre_ParCSRNodeCommRelease(comm, node_comm);
+   }
+
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+   hypre_TFree(leader, HYPRE_MEMORY_HOST);
+   hypre_TFree(nrank, HYPRE_MEMORY_HOST);
+   hypre_TFree(by_node, HYPRE_MEMORY_HOST);
+   hypre_TFree(by_node_starts, HYPRE_MEMORY_HOST);
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgDestroyNode
+ *
+ * Frees the node-aware exchange information of comm_pkg.  Must be called by
+ * all processes of the node, in the order the comm_pkgs were created.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNode( hypre_ParCSRCommPkg *comm_pkg )
+{
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+   hypre_ParCSRCommNode *node = hypre_ParCSRCommPkgNode(comm_pkg);
+
+   if (node)
+   {
+      if (node -> num_pending)
+      {
+         hypre_MPI_Waitall(node -> num_pending, node -> pending, hypre_MPI_STATUSES_IGNORE);
+      }
+      hypre_TFree(node -> pending, HYPRE_MEMORY_HOST);
+      hypre_ParCSRNodeScheduleDestroy(&(node -> sched[0]));
+      hypre_ParCSRNodeScheduleDestroy(&(node -> sched[1]));
+      hypre_TFree(node -> out_segs, HYPRE_MEMORY_HOST);
+      hypre_TFree(node -> in_segs, HYPRE_MEMORY_HOST);
+      hypre_ParCSRNodeArenaRelease(node -> node_comm, node -> arena);
+      hypre_ParCSRNodeCommRelease(hypre_ParCSRCommPkgComm(comm_pkg), node -> node_comm);
+      hypre_TFree(node, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgNode(comm_pkg) = NULL;
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreateNode
+ *
+ * Starts a node-aware exchange for job 1, 2, 11, 12, 21 or 22 with host
+ * data.  Returns NULL if comm_pkg has no node information, if another
+ * node-aware exchange with comm_pkg is active, or for other jobs, in which
+ * case the standard exchange is to be used.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle *
+hypre_ParCSRCommHandleCreateNode( HYPRE_Int            job,
+                                  hypre_ParCSRCommPkg *comm_pkg,
+                                  void                *send_data,
+                                  void                *recv_data )
+{
+   MPI_Comm                  comm = hypre_ParCSRCommPkgComm(comm_pkg);
+   hypre_ParCSRCommNode     *node = hypre_ParCSRCommPkgNode(comm_pkg);
+   hypre_ParCSRNodeSchedule *sched;
+   hypre_ParCSRCommHandle   *comm_handle;
+   hypre_MPI_Request        *requests;
+   HYPRE_Int                 num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                 num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   hypre_MPI_Request        *sources_ready;
+   HYPRE_Int                 num_entries, num_requests, ready;
+   HYPRE_Int                 i, k, pos, len;
+   size_t                    elem_size;
+
+   if (!node || node -> busy)
+   {
+      return NULL;
+   }
+
+   switch (job)
+   {
+      case 1:
+      case 2:
+         elem_size = sizeof(HYPRE_Complex);
+         break;
+      case 11:
+      case 12:
+         elem_size = sizeof(HYPRE_Int);
+         break;
+      case 21:
+      case 22:
+         elem_size = sizeof(HYPRE_BigInt);
+         break;
+      default:
+         return NULL;
+   }
+
+   if (job % 10 == 1)
+   {
+      sched = &(node -> sched[0]);
+      num_entries = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   }
+   else
+   {
+      sched = &(node -> sched[1]);
+      num_entries = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+   }
+   node -> busy = 1;
+   node -> sent = 0;
+
+   /* traffic counters: the aggregated messages to other nodes are the
+      only messages with data */
+   hypre_parcsr_comm_num_messages += sched -> num_agg_sends;
+   hypre_parcsr_comm_num_bytes    += (HYPRE_Real) (sched -> agg_send_size * elem_size);
+
+   /* the segments of this process may still be read, or written to, by
+      processes completing the previous exchange */
+   if (node -> num_pending)
+   {
+      hypre_ParCSRNodeWait(node, node -> num_pending, node -> pending);
+      node -> num_pending = 0;
+   }
+
+   /* requests: aggregated receives and sends, filled messages from the
+      sources and to the readers of the out segment, from the writers and
+      to the targets of the in segments */
+   num_requests = sched -> num_agg_recvs + sched -> num_agg_sends +
+                  sched -> num_sources + sched -> num_readers +
+                  sched -> num_writers + sched -> num_targets;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   sources_ready = requests + sched -> num_agg_recvs + sched -> num_agg_sends;
+
+   /* post the receives of the aggregated messages */
+   pos = 0;
+   for (i = 0; i < sched -> num_agg_recvs; i++)
+   {
+      len = 0;
+      for (k = sched -> agg_recv_starts[i]; k < sched -> agg_recv_starts[i+1]; k++)
+      {
+         len += sched -> agg_recv_len[k];
+      }
+      hypre_MPI_Irecv(sched -> agg_recv_buf + pos*elem_size, (HYPRE_Int) (len*elem_size),
+                      hypre_MPI_BYTE, sched -> agg_recv_procs[i],
+                      HYPRE_NODE_COMM_TAG + node -> tag, comm, &requests[i]);
+      pos += len;
+   }
+   hypre_ParCSRNodeExpect(node, sched -> num_sources, sched -> sources, HYPRE_NODE_OUT_TAG,
+                          sources_ready);
+   hypre_ParCSRNodeExpect(node, sched -> num_writers, sched -> writers, HYPRE_NODE_IN_TAG,
+                          sources_ready + sched -> num_sources + sched -> num_readers);
+
+   /* publish the send buffer */
+   hypre_TMemcpy(node -> out_segs[node -> rank], send_data, char, num_entries*elem_size,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_ParCSRNodeNotify(node, sched -> num_readers, sched -> readers, HYPRE_NODE_OUT_TAG,
+                          sources_ready + sched -> num_sources);
+
+   /* gather and send the aggregated messages now if the out segments they
+      are gathered from are already filled, otherwise when completing */
+   hypre_MPI_Testall(sched -> num_sources, sources_ready, &ready, hypre_MPI_STATUSES_IGNORE);
+   if (ready)
+   {
+      hypre_MPI_Win_sync(node -> win);
+      hypre_ParCSRNodeSendAggregated(node, sched, comm, elem_size,
+                                     requests + sched -> num_agg_recvs);
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data;
+   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+   hypre_ParCSRCommHandleNodeJob(comm_handle)            = job;
+
+   return comm_handle;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleDestroyNode
+ *
+ * Completes a node-aware exchange started by hypre_ParCSRCommHandleCreateNode.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommHandleDestroyNode( hypre_ParCSRCommHandle *comm_handle )
+{
+   hypre_ParCSRCommPkg      *comm_pkg  = hypre_ParCSRCommHandleCommPkg(comm_handle);
+   hypre_ParCSRCommNode     *node      = hypre_ParCSRCommPkgNode(comm_pkg);
+   HYPRE_Int                 job       = hypre_ParCSRCommHandleNodeJob(comm_handle);
+   char                     *recv_data = (char *) hypre_ParCSRCommHandleRecvData(comm_handle);
+   char                     *in_seg    = node -> in_segs[node -> rank];
+   hypre_MPI_Request        *requests  = hypre_ParCSRCommHandleRequests(comm_handle);
+   hypre_MPI_Request        *filled, *from_writers, *pending;
+   hypre_ParCSRNodeSchedule *sched;
+   HYPRE_Int                 num_agg, num_filled;
+   HYPRE_Int                 i, k, pos;
+   size_t                    elem_size;
+
+   if (job == 1 || job == 2)
+   {
+      elem_size = sizeof(HYPRE_Complex);
+   }
+   else if (job == 11 || job == 12)
+   {
+      elem_size = sizeof(HYPRE_Int);
+   }
+   else
+   {
+      elem_size = sizeof(HYPRE_BigInt);
+   }
+   sched = (job % 10 == 1) ? &(node -> sched[0]) : &(node -> sched[1]);
+
+   num_agg      = sched -> num_agg_recvs + sched -> num_agg_sends;
+   filled       = requests + num_agg;
+   from_writers = filled + sched -> num_sources + sched -> num_readers;
+
+   /* aggregated messages that could not be sent when starting */
+   if (!(node -> sent))
+   {
+      hypre_ParCSRNodeWait(node, sched -> num_sources, filled);
+      hypre_ParCSRNodeSendAggregated(node, sched, hypre_ParCSRCommPkgComm(comm_pkg),
+                                     elem_size, requests + sched -> num_agg_recvs);
+   }
+
+   if (num_agg)
+   {
+      hypre_MPI_Waitall(num_agg, requests, hypre_MPI_STATUSES_IGNORE);
+   }
+
+   /* scatter the aggregated messages to the in segments */
+   pos = 0;
+   for (i = 0; i < sched -> num_agg_recvs; i++)
+   {
+      for (k = sched -> agg_recv_starts[i]; k < sched -> agg_recv_starts[i+1]; k++)
+      {
+         hypre_TMemcpy(node -> in_segs[sched -> agg_recv_rank[k]] + sched -> agg_recv_off[k]*elem_size,
+                       sched -> agg_recv_buf + pos*elem_size,
+                       char, sched -> agg_recv_len[k]*elem_size,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         pos += sched -> agg_recv_len[k];
+      }
+   }
+   hypre_ParCSRNodeNotify(node, sched -> num_targets, sched -> targets, HYPRE_NODE_IN_TAG,
+                          from_writers + sched -> num_writers);
+
+   /* wait until the out segments of the sources and the in segment of this
+      process are filled */
+   num_filled = sched -> num_sources + sched -> num_readers +
+                sched -> num_writers + sched -> num_targets;
+   hypre_ParCSRNodeWait(node, num_filled, filled);
+
+   /* data from this node */
+   for (i = 0; i < sched -> num_local; i++)
+   {
+      hypre_TMemcpy(recv_data + sched -> local_dst[i]*elem_size,
+                    node -> out_segs[sched -> local_rank[i]] + sched -> local_src[i]*elem_size,
+                    char, sched -> local_len[i]*elem_size,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   /* data from other nodes */
+   for (i = 0; i < sched -> num_remote; i++)
+   {
+      hypre_TMemcpy(recv_data + sched -> remote_dst[i]*elem_size,
+                    in_seg + sched -> remote_dst[i]*elem_size,
+                    char, sched -> remote_len[i]*elem_size,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   /* the segments may be filled again by the next exchange once the
+      processes accessing them are done: tell the sources and writers, and
+      expect the readers and targets (waited for in the next exchange) */
+   node -> num_pending = num_filled;
+   node -> pending = hypre_TReAlloc(node -> pending, hypre_MPI_Request, num_filled,
+                                    HYPRE_MEMORY_HOST);
+   pending = node -> pending;
+   hypre_ParCSRNodeNotify(node, sched -> num_sources, sched -> sources,
+                          HYPRE_NODE_DONE_TAG, pending);
+   pending += sched -> num_sources;
+   hypre_ParCSRNodeNotify(node, sched -> num_writers, sched -> writers,
+                          HYPRE_NODE_DONE_TAG, pending);
+   pending += sched -> num_writers;
+   hypre_ParCSRNodeExpect(node, sched -> num_readers, sched -> readers,
+                          HYPRE_NODE_DONE_TAG, pending);
+   pending += sched -> num_readers;
+   hypre_ParCSRNodeExpect(node, sched -> num_targets, sched -> targets,
+                          HYPRE_NODE_DONE_TAG, pending);
+
+   node -> busy = 0;
+
+   hypre_TFree(hypre_ParCSRCommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
+   hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+#endif /* HYPRE_USING_NODE_AWARE_MPI */
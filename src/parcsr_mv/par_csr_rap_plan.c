@@ -0,0 +1,890 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Galerkin product RAP = P^T A P with a cached structure, for matrices whose
+ * values change while their sparsity patterns do not
+ * (see hypre_ParCSRRAPPlan in par_csr_matrix.h).
+ *
+ * hypre_ParCSRRAPPlanCreate does the symbolic work once: the rows of P
+ * needed by A_offd, the transpose of P, the patterns of the local products
+ * and the position in RAP of every entry they produce.
+ * hypre_ParCSRRAPPlanCompute then only exchanges and multiplies values.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanRowPositions
+ *
+ * Finds the positions in row 'row' of RAP of the columns in cols
+ * (c >= 0 is column c of RAP_diag, c < 0 is column -c-1 of RAP_offd).
+ * The markers must be -1 on entry and are reset on exit.  Returns the
+ * number of columns that are not in the pattern of RAP.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRRAPPlanRowPositions( hypre_CSRMatrix *RAP_diag,
+                                 hypre_CSRMatrix *RAP_offd,
+                                 HYPRE_Int        row,
+                                 HYPRE_Int        num_cols,
+                                 HYPRE_Int       *cols,
+                                 HYPRE_Int       *pos,
+                                 HYPRE_Int       *marker_diag,
+                                 HYPRE_Int       *marker_offd )
+{
+   HYPRE_Int *RAP_diag_i = hypre_CSRMatrixI(RAP_diag);
+   HYPRE_Int *RAP_diag_j = hypre_CSRMatrixJ(RAP_diag);
+   HYPRE_Int *RAP_offd_i = hypre_CSRMatrixI(RAP_offd);
+   HYPRE_Int *RAP_offd_j = hypre_CSRMatrixJ(RAP_offd);
+   HYPRE_Int  num_missing = 0;
+   HYPRE_Int  j, c;
+
+   for (j = RAP_diag_i[row]; j < RAP_diag_i[row+1]; j++)
+   {
+      marker_diag[RAP_diag_j[j]] = j;
+   }
+   for (j = RAP_offd_i[row]; j < RAP_offd_i[row+1]; j++)
+   {
+      marker_offd[RAP_offd_j[j]] = j;
+   }
+
+   for (j = 0; j < num_cols; j++)
+   {
+      c = cols[j];
+      if (c >= 0 && marker_diag[c] >= 0)
+      {
+         pos[j] = marker_diag[c];
+      }
+      else if (c < 0 && marker_offd[-c-1] >= 0)
+      {
+         pos[j] = -marker_offd[-c-1] - 1;
+      }
+      else
+      {
+         pos[j] = 0;
+         num_missing++;
+      }
+   }
+
+   for (j = RAP_diag_i[row]; j < RAP_diag_i[row+1]; j++)
+   {
+      marker_diag[RAP_diag_j[j]] = -1;
+   }
+   for (j = RAP_offd_i[row]; j < RAP_offd_i[row+1]; j++)
+   {
+      marker_offd[RAP_offd_j[j]] = -1;
+   }
+
+   return num_missing;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanCreate
+ *
+ * Sets up the computation of the values of RAP = P^T A P for the current
+ * patterns of A, P and RAP.  Returns NULL if the pattern of RAP does not
+ * contain the one of P^T A P on some process.  Collective.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRRAPPlan *
+hypre_ParCSRRAPPlanCreate( hypre_ParCSRMatrix *A,
+                           hypre_ParCSRMatrix *P,
+                           hypre_ParCSRMatrix *RAP )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+
+   hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix *P_diag   = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int       *P_diag_i = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j = hypre_CSRMatrixJ(P_diag);
+   hypre_CSRMatrix *P_offd   = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int       *P_offd_i = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Int        num_cols_P = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_BigInt    *col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_BigInt     first_col_P = hypre_ParCSRMatrixFirstColDiag(P);
+   HYPRE_BigInt     last_col_P = first_col_P + (HYPRE_BigInt) num_cols_P - 1;
+
+   hypre_CSRMatrix *RAP_diag = hypre_ParCSRMatrixDiag(RAP);
+   hypre_CSRMatrix *RAP_offd = hypre_ParCSRMatrixOffd(RAP);
+   HYPRE_Int        num_cols_offd_RAP = hypre_CSRMatrixNumCols(RAP_offd);
+   HYPRE_BigInt    *col_map_offd_RAP = hypre_ParCSRMatrixColMapOffd(RAP);
+
+   hypre_ParCSRCommPkg *comm_pkg_A, *comm_pkg_P, *comm_pkg;
+
+   hypre_ParCSRRAPPlan *plan;
+   hypre_CSRMatrix     *A_loc, *P_loc, *P_ext, *PT, *C;
+   hypre_CSRMatrix     *C_ext, *C_int;
+   HYPRE_Int           *A_loc_i, *A_loc_j, *P_loc_i, *P_loc_j, *PT_i, *PT_j, *PT_perm;
+   HYPRE_Int           *P_ext_i, *C_i, *C_j, *C_ext_i, *C_int_i;
+   HYPRE_BigInt        *P_ext_j, *C_ext_j, *C_int_j, *col_map_ext;
+   HYPRE_Int           *P_send_i, *map_offd_P, *ext_to_offd_RAP;
+   HYPRE_Int           *marker_diag, *marker_offd, *cols;
+   HYPRE_Int           *send_procs, *send_map_starts, *send_map_elmts;
+   HYPRE_Int           *recv_procs, *recv_vec_starts;
+   HYPRE_Int            num_sends, num_recvs, num_rows_send, num_rows_ext;
+   HYPRE_Int            num_cols_ext, num_nonzeros_P, num_nonzeros_ext;
+   HYPRE_Int            num_rows_C_int, max_row_size;
+   HYPRE_Int            i, j, k, jj, row, num_missing, all_found;
+   HYPRE_BigInt         big_col;
+   void                *request;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   if (!hypre_ParCSRMatrixCommPkg(P))
+   {
+      hypre_MatvecCommPkgCreate(P);
+   }
+   comm_pkg_A = hypre_ParCSRMatrixCommPkg(A);
+   comm_pkg_P = hypre_ParCSRMatrixCommPkg(P);
+
+   plan = hypre_CTAlloc(hypre_ParCSRRAPPlan, 1, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * A_loc = [A_diag A_offd]
+    *-----------------------------------------------------------------------*/
+
+   plan -> num_cols_offd_A = num_cols_offd_A;
+   plan -> col_map_offd_A  = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_A, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(plan -> col_map_offd_A, hypre_ParCSRMatrixColMapOffd(A), HYPRE_BigInt,
+                 num_cols_offd_A, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   A_loc = hypre_CSRMatrixCreate(num_rows, num_rows + num_cols_offd_A,
+                                 A_diag_i[num_rows] + A_offd_i[num_rows]);
+   hypre_CSRMatrixInitialize_v2(A_loc, 0, HYPRE_MEMORY_HOST);
+   A_loc_i = hypre_CSRMatrixI(A_loc);
+   A_loc_j = hypre_CSRMatrixJ(A_loc);
+
+   A_loc_i[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      k = A_loc_i[i];
+      for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+      {
+         A_loc_j[k++] = A_diag_j[j];
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i+1]; j++)
+      {
+         A_loc_j[k++] = num_rows + A_offd_j[j];
+      }
+      A_loc_i[i+1] = k;
+   }
+   plan -> A_loc = A_loc;
+
+   /*-----------------------------------------------------------------------
+    * Pattern of P_ext and the external columns of P_loc = [P; P_ext]
+    *-----------------------------------------------------------------------*/
+
+   hypre_ParcsrGetExternalRowsInit(P, num_cols_offd_A, plan -> col_map_offd_A,
+                                   comm_pkg_A, 0, &request);
+   P_ext = hypre_ParcsrGetExternalRowsWait(request);
+   P_ext_i = hypre_CSRMatrixI(P_ext);
+   P_ext_j = hypre_CSRMatrixBigJ(P_ext);
+   num_rows_ext = hypre_CSRMatrixNumRows(P_ext);
+   num_nonzeros_ext = P_ext_i[num_rows_ext];
+
+   col_map_ext = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_P + num_nonzeros_ext,
+                              HYPRE_MEMORY_HOST);
+   num_cols_ext = 0;
+   for (i = 0; i < num_cols_offd_P; i++)
+   {
+      col_map_ext[num_cols_ext++] = col_map_offd_P[i];
+   }
+   for (j = 0; j < num_nonzeros_ext; j++)
+   {
+      if (P_ext_j[j] < first_col_P || P_ext_j[j] > last_col_P)
+      {
+         col_map_ext[num_cols_ext++] = P_ext_j[j];
+      }
+   }
+   if (num_cols_ext > 1)
+   {
+      hypre_BigQsort0(col_map_ext, 0, num_cols_ext - 1);
+      for (i = 1, k = 1; i < num_cols_ext; i++)
+      {
+         if (col_map_ext[i] != col_map_ext[k-1])
+         {
+            col_map_ext[k++] = col_map_ext[i];
+         }
+      }
+      num_cols_ext = k;
+   }
+   plan -> num_cols_ext = num_cols_ext;
+   plan -> col_map_ext  = col_map_ext;
+
+   map_offd_P = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_P; i++)
+   {
+      map_offd_P[i] = hypre_BigBinarySearch(col_map_ext, col_map_offd_P[i], num_cols_ext);
+   }
+
+   num_nonzeros_P = P_diag_i[num_rows] + P_offd_i[num_rows];
+   P_loc = hypre_CSRMatrixCreate(num_rows + num_rows_ext, num_cols_P + num_cols_ext,
+                                 num_nonzeros_P + num_nonzeros_ext);
+   hypre_CSRMatrixInitialize_v2(P_loc, 0, HYPRE_MEMORY_HOST);
+   P_loc_i = hypre_CSRMatrixI(P_loc);
+   P_loc_j = hypre_CSRMatrixJ(P_loc);
+
+   P_loc_i[0] = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      k = P_loc_i[i];
+      for (j = P_diag_i[i]; j < P_diag_i[i+1]; j++)
+      {
+         P_loc_j[k++] = P_diag_j[j];
+      }
+      for (j = P_offd_i[i]; j < P_offd_i[i+1]; j++)
+      {
+         P_loc_j[k++] = num_cols_P + map_offd_P[P_offd_j[j]];
+      }
+      P_loc_i[i+1] = k;
+   }
+   for (i = 0; i < num_rows_ext; i++)
+   {
+      k = P_loc_i[num_rows + i];
+      for (j = P_ext_i[i]; j < P_ext_i[i+1]; j++)
+      {
+         big_col = P_ext_j[j];
+         if (big_col >= first_col_P && big_col <= last_col_P)
+         {
+            P_loc_j[k++] = (HYPRE_Int) (big_col - first_col_P);
+         }
+         else
+         {
+            P_loc_j[k++] = num_cols_P + hypre_BigBinarySearch(col_map_ext, big_col, num_cols_ext);
+         }
+      }
+      P_loc_i[num_rows + i + 1] = k;
+   }
+   plan -> P_loc = P_loc;
+
+   /*-----------------------------------------------------------------------
+    * Value exchange for P_ext: the rows of P are sent as in
+    * hypre_ParcsrGetExternalRowsInit and received into the bottom of P_loc
+    *-----------------------------------------------------------------------*/
+
+   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+   send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg_A);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_A);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A);
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+   recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg_A);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_A);
+   num_rows_send   = send_map_starts[num_sends];
+
+   plan -> num_rows_P_send = num_rows_send;
+   plan -> P_send_rows = hypre_TAlloc(HYPRE_Int, num_rows_send, HYPRE_MEMORY_HOST);
+   P_send_i = hypre_TAlloc(HYPRE_Int, num_rows_send + 1, HYPRE_MEMORY_HOST);
+   P_send_i[0] = 0;
+   for (i = 0; i < num_rows_send; i++)
+   {
+      row = send_map_elmts[i];
+      plan -> P_send_rows[i] = row;
+      P_send_i[i+1] = P_send_i[i] + P_diag_i[row+1] - P_diag_i[row]
+                                  + P_offd_i[row+1] - P_offd_i[row];
+   }
+   plan -> P_send_i = P_send_i;
+   plan -> P_send_data = hypre_TAlloc(HYPRE_Complex, P_send_i[num_rows_send], HYPRE_MEMORY_HOST);
+
+   comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(comm_pkg)     = comm;
+   hypre_ParCSRCommPkgNumSends(comm_pkg) = num_sends;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg) = num_recvs;
+   if (num_sends)
+   {
+      hypre_ParCSRCommPkgSendProcs(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg), send_procs, HYPRE_Int, num_sends,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   if (num_recvs)
+   {
+      hypre_ParCSRCommPkgRecvProcs(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(comm_pkg), recv_procs, HYPRE_Int, num_recvs,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_sends; i++)
+   {
+      hypre_ParCSRCommPkgSendMapStart(comm_pkg, i) = P_send_i[send_map_starts[i]];
+   }
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_recvs; i++)
+   {
+      hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i) = P_ext_i[recv_vec_starts[i]];
+   }
+   plan -> P_ext_comm_pkg = comm_pkg;
+
+   hypre_CSRMatrixDestroy(P_ext);
+
+   /*-----------------------------------------------------------------------
+    * PT = transpose of the local rows of P_loc, with the position in P_loc
+    * of each of its entries
+    *-----------------------------------------------------------------------*/
+
+   PT = hypre_CSRMatrixCreate(num_cols_P + num_cols_ext, num_rows, num_nonzeros_P);
+   hypre_CSRMatrixInitialize_v2(PT, 0, HYPRE_MEMORY_HOST);
+   PT_i = hypre_CSRMatrixI(PT);
+   PT_j = hypre_CSRMatrixJ(PT);
+   PT_perm = hypre_TAlloc(HYPRE_Int, num_nonzeros_P, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < num_nonzeros_P; j++)
+   {
+      PT_i[P_loc_j[j] + 1]++;
+   }
+   for (i = 0; i < num_cols_P + num_cols_ext; i++)
+   {
+      PT_i[i+1] += PT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (j = P_loc_i[i]; j < P_loc_i[i+1]; j++)
+      {
+         k = PT_i[P_loc_j[j]]++;
+         PT_j[k] = i;
+         PT_perm[k] = j;
+      }
+   }
+   for (i = num_cols_P + num_cols_ext; i > 0; i--)
+   {
+      PT_i[i] = PT_i[i-1];
+   }
+   PT_i[0] = 0;
+   plan -> PT = PT;
+   plan -> PT_perm = PT_perm;
+
+   /*-----------------------------------------------------------------------
+    * Patterns of Q = A_loc P_loc and C = PT Q
+    *-----------------------------------------------------------------------*/
+
+   plan -> Q = hypre_CSRMatrixMultiplyHostSymbolic(A_loc, P_loc);
+   C = hypre_CSRMatrixMultiplyHostSymbolic(PT, plan -> Q);
+   C_i = hypre_CSRMatrixI(C);
+   C_j = hypre_CSRMatrixJ(C);
+   plan -> C = C;
+
+   /*-----------------------------------------------------------------------
+    * C_ext: the rows of C for the columns of P_offd.  Their pattern is sent
+    * once to the owners (C_int), the values are sent with C_ext_comm_pkg.
+    *-----------------------------------------------------------------------*/
+
+   plan -> num_rows_C_ext = num_cols_offd_P;
+   plan -> C_ext_rows = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+   C_ext_i = hypre_TAlloc(HYPRE_Int, num_cols_offd_P + 1, HYPRE_MEMORY_HOST);
+   C_ext_i[0] = 0;
+   for (i = 0; i < num_cols_offd_P; i++)
+   {
+      row = num_cols_P + map_offd_P[i];
+      plan -> C_ext_rows[i] = row;
+      C_ext_i[i+1] = C_ext_i[i] + C_i[row+1] - C_i[row];
+   }
+
+   C_ext = hypre_CSRMatrixCreate(num_cols_offd_P, hypre_ParCSRMatrixGlobalNumCols(P),
+                                 C_ext_i[num_cols_offd_P]);
+   hypre_CSRMatrixMemoryLocation(C_ext) = HYPRE_MEMORY_HOST;
+   C_ext_j = hypre_TAlloc(HYPRE_BigInt, C_ext_i[num_cols_offd_P], HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixI(C_ext)    = C_ext_i;
+   hypre_CSRMatrixBigJ(C_ext) = C_ext_j;
+   hypre_CSRMatrixData(C_ext) = hypre_CTAlloc(HYPRE_Complex, C_ext_i[num_cols_offd_P],
+                                              HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_P; i++)
+   {
+      row = plan -> C_ext_rows[i];
+      k = C_ext_i[i];
+      for (j = C_i[row]; j < C_i[row+1]; j++)
+      {
+         C_ext_j[k++] = C_j[j] < num_cols_P ? first_col_P + (HYPRE_BigInt) C_j[j] :
+                        col_map_ext[C_j[j] - num_cols_P];
+      }
+   }
+
+   hypre_ExchangeExternalRowsInit(C_ext, comm_pkg_P, &request);
+   C_int = hypre_ExchangeExternalRowsWait(request);
+
+   num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg_P);
+   send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg_P);
+   send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg_P);
+   send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_P);
+   num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg_P);
+   recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg_P);
+   recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_P);
+   num_rows_C_int  = send_map_starts[num_sends];
+
+   C_int_i = hypre_CSRMatrixI(C_int);
+   C_int_j = hypre_CSRMatrixBigJ(C_int);
+
+   plan -> C_ext_i    = C_ext_i;
+   plan -> C_ext_data = hypre_CSRMatrixData(C_ext);
+   hypre_CSRMatrixI(C_ext)    = NULL;
+   hypre_CSRMatrixData(C_ext) = NULL;
+   hypre_CSRMatrixDestroy(C_ext);
+
+   plan -> num_rows_C_int = num_rows_C_int;
+   plan -> C_int_rows = hypre_TAlloc(HYPRE_Int, num_rows_C_int, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(plan -> C_int_rows, send_map_elmts, HYPRE_Int, num_rows_C_int,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   plan -> C_int_i    = C_int_i;
+   plan -> C_int_data = hypre_CSRMatrixData(C_int);
+
+   /* the direction of the exchange is the one of the transpose matvec with P */
+   comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(comm_pkg)     = comm;
+   hypre_ParCSRCommPkgNumSends(comm_pkg) = num_recvs;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg) = num_sends;
+   if (num_recvs)
+   {
+      hypre_ParCSRCommPkgSendProcs(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg), recv_procs, HYPRE_Int, num_recvs,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   if (num_sends)
+   {
+      hypre_ParCSRCommPkgRecvProcs(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(comm_pkg), send_procs, HYPRE_Int, num_sends,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_recvs; i++)
+   {
+      hypre_ParCSRCommPkgSendMapStart(comm_pkg, i) = C_ext_i[recv_vec_starts[i]];
+   }
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_sends; i++)
+   {
+      hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i) = C_int_i[send_map_starts[i]];
+   }
+   plan -> C_ext_comm_pkg = comm_pkg;
+
+   /*-----------------------------------------------------------------------
+    * Positions in RAP of the entries of the local rows of C and of C_int
+    *-----------------------------------------------------------------------*/
+
+   ext_to_offd_RAP = hypre_TAlloc(HYPRE_Int, num_cols_ext, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_ext; i++)
+   {
+      ext_to_offd_RAP[i] = hypre_BigBinarySearch(col_map_offd_RAP, col_map_ext[i],
+                                                 num_cols_offd_RAP);
+   }
+
+   max_row_size = 0;
+   for (i = 0; i < num_cols_P; i++)
+   {
+      max_row_size = hypre_max(max_row_size, C_i[i+1] - C_i[i]);
+   }
+   for (i = 0; i < num_rows_C_int; i++)
+   {
+      max_row_size = hypre_max(max_row_size, C_int_i[i+1] - C_int_i[i]);
+   }
+
+   cols = hypre_TAlloc(HYPRE_Int, max_row_size, HYPRE_MEMORY_HOST);
+   marker_diag = hypre_TAlloc(HYPRE_Int, num_cols_P, HYPRE_MEMORY_HOST);
+   /* the last entry of marker_offd stands for the columns not in RAP_offd */
+   marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_offd_RAP + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_P; i++)
+   {
+      marker_diag[i] = -1;
+   }
+   for (i = 0; i <= num_cols_offd_RAP; i++)
+   {
+      marker_offd[i] = -1;
+   }
+
+   plan -> C_pos = hypre_TAlloc(HYPRE_Int, C_i[num_cols_P], HYPRE_MEMORY_HOST);
+   plan -> C_int_pos = hypre_TAlloc(HYPRE_Int, C_int_i[num_rows_C_int], HYPRE_MEMORY_HOST);
+
+   num_missing = 0;
+   for (i = 0; i < num_cols_P; i++)
+   {
+      for (j = C_i[i], jj = 0; j < C_i[i+1]; j++)
+      {
+         k = C_j[j];
+         if (k < num_cols_P)
+         {
+            cols[jj++] = k;
+         }
+         else if (ext_to_offd_RAP[k - num_cols_P] >= 0)
+         {
+            cols[jj++] = -ext_to_offd_RAP[k - num_cols_P] - 1;
+         }
+         else
+         {
+            /* a column that is not in RAP_offd */
+            cols[jj++] = -num_cols_offd_RAP - 1;
+            num_missing++;
+         }
+      }
+      num_missing += hypre_ParCSRRAPPlanRowPositions(RAP_diag, RAP_offd, i, jj, cols,
+                                                     plan -> C_pos + C_i[i],
+                                                     marker_diag, marker_offd);
+   }
+
+   for (i = 0; i < num_rows_C_int; i++)
+   {
+      for (j = C_int_i[i], jj = 0; j < C_int_i[i+1]; j++)
+      {
+         big_col = C_int_j[j];
+         if (big_col >= first_col_P && big_col <= last_col_P)
+         {
+            cols[jj++] = (HYPRE_Int) (big_col - first_col_P);
+         }
+         else
+         {
+            k = hypre_BigBinarySearch(col_map_offd_RAP, big_col, num_cols_offd_RAP);
+            if (k < 0)
+            {
+               k = num_cols_offd_RAP;
+               num_missing++;
+            }
+            cols[jj++] = -k - 1;
+         }
+      }
+      num_missing += hypre_ParCSRRAPPlanRowPositions(RAP_diag, RAP_offd,
+                                                     plan -> C_int_rows[i], jj, cols,
+                                                     plan -> C_int_pos + C_int_i[i],
+                                                     marker_diag, marker_offd);
+   }
+
+   hypre_TFree(hypre_CSRMatrixBigJ(C_int), HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixI(C_int)    = NULL;
+   hypre_CSRMatrixBigJ(C_int) = NULL;
+   hypre_CSRMatrixData(C_int) = NULL;
+   hypre_CSRMatrixDestroy(C_int);
+
+   hypre_TFree(map_offd_P, HYPRE_MEMORY_HOST);
+   hypre_TFree(ext_to_offd_RAP, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_diag, HYPRE_MEMORY_HOST);
+   hypre_TFree(marker_offd, HYPRE_MEMORY_HOST);
+
+   k = (num_missing == 0);
+   hypre_MPI_Allreduce(&k, &all_found, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!all_found)
+   {
+      hypre_ParCSRRAPPlanDestroy(plan);
+      return NULL;
+   }
+
+   return plan;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanDestroy( hypre_ParCSRRAPPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(plan -> col_map_offd_A, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(plan -> A_loc);
+      hypre_CSRMatrixDestroy(plan -> P_loc);
+      hypre_TFree(plan -> col_map_ext, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(plan -> PT);
+      hypre_TFree(plan -> PT_perm, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(plan -> Q);
+      hypre_CSRMatrixDestroy(plan -> C);
+
+      if (plan -> P_ext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> P_ext_comm_pkg);
+      }
+      hypre_TFree(plan -> P_send_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> P_send_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> P_send_data, HYPRE_MEMORY_HOST);
+
+      if (plan -> C_ext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(plan -> C_ext_comm_pkg);
+      }
+      hypre_TFree(plan -> C_ext_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_ext_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_ext_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_int_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_int_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_int_data, HYPRE_MEMORY_HOST);
+
+      hypre_TFree(plan -> C_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan -> C_int_pos, HYPRE_MEMORY_HOST);
+
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanMatchesA
+ *
+ * Returns 1 if A has the sparsity pattern the plan was created for, on all
+ * processes.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanMatchesA( hypre_ParCSRRAPPlan *plan,
+                             hypre_ParCSRMatrix  *A )
+{
+   MPI_Comm         comm     = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_BigInt    *col_map_offd = hypre_ParCSRMatrixColMapOffd(A);
+
+   hypre_CSRMatrix *A_loc;
+   HYPRE_Int       *A_loc_i, *A_loc_j;
+   HYPRE_Int        i, j, k, match, all_match;
+
+   match = (plan != NULL);
+
+   if (match)
+   {
+      A_loc   = plan -> A_loc;
+      A_loc_i = hypre_CSRMatrixI(A_loc);
+      A_loc_j = hypre_CSRMatrixJ(A_loc);
+
+      match = ( hypre_CSRMatrixNumRows(A_loc) == num_rows &&
+                plan -> num_cols_offd_A == num_cols_offd &&
+                hypre_CSRMatrixNumNonzeros(A_loc) == A_diag_i[num_rows] + A_offd_i[num_rows] );
+   }
+
+   for (i = 0; match && i < num_cols_offd; i++)
+   {
+      match = (plan -> col_map_offd_A[i] == col_map_offd[i]);
+   }
+
+   for (i = 0; match && i < num_rows; i++)
+   {
+      k = A_loc_i[i];
+      if (A_loc_i[i+1] - k != A_diag_i[i+1] - A_diag_i[i] + A_offd_i[i+1] - A_offd_i[i])
+      {
+         match = 0;
+         break;
+      }
+      for (j = A_diag_i[i]; match && j < A_diag_i[i+1]; j++)
+      {
+         match = (A_loc_j[k++] == A_diag_j[j]);
+      }
+      for (j = A_offd_i[i]; match && j < A_offd_i[i+1]; j++)
+      {
+         match = (A_loc_j[k++] == num_rows + A_offd_j[j]);
+      }
+   }
+
+   hypre_MPI_Allreduce(&match, &all_match, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   return all_match;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPPlanCompute
+ *
+ * Computes the values of RAP = P^T A P in place.  A, P and RAP must have
+ * the patterns the plan was created for.  Collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPPlanCompute( hypre_ParCSRRAPPlan *plan,
+                            hypre_ParCSRMatrix  *A,
+                            hypre_ParCSRMatrix  *P,
+                            hypre_ParCSRMatrix  *RAP )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Complex   *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix *P_diag      = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int       *P_diag_i    = hypre_CSRMatrixI(P_diag);
+   HYPRE_Complex   *P_diag_data = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix *P_offd      = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int       *P_offd_i    = hypre_CSRMatrixI(P_offd);
+   HYPRE_Complex   *P_offd_data = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int        num_cols_P  = hypre_CSRMatrixNumCols(P_diag);
+
+   hypre_CSRMatrix *RAP_diag      = hypre_ParCSRMatrixDiag(RAP);
+   HYPRE_Complex   *RAP_diag_data = hypre_CSRMatrixData(RAP_diag);
+   hypre_CSRMatrix *RAP_offd      = hypre_ParCSRMatrixOffd(RAP);
+   HYPRE_Complex   *RAP_offd_data = hypre_CSRMatrixData(RAP_offd);
+
+   HYPRE_Int       *A_loc_i    = hypre_CSRMatrixI(plan -> A_loc);
+   HYPRE_Complex   *A_loc_data = hypre_CSRMatrixData(plan -> A_loc);
+   HYPRE_Int       *P_loc_i    = hypre_CSRMatrixI(plan -> P_loc);
+   HYPRE_Complex   *P_loc_data = hypre_CSRMatrixData(plan -> P_loc);
+   HYPRE_Complex   *PT_data    = hypre_CSRMatrixData(plan -> PT);
+   HYPRE_Int       *PT_perm    = plan -> PT_perm;
+   HYPRE_Int        PT_nnz     = hypre_CSRMatrixNumNonzeros(plan -> PT);
+   HYPRE_Int       *C_i        = hypre_CSRMatrixI(plan -> C);
+   HYPRE_Complex   *C_data     = hypre_CSRMatrixData(plan -> C);
+   HYPRE_Int       *C_pos      = plan -> C_pos;
+
+   HYPRE_Int        num_rows_P_send = plan -> num_rows_P_send;
+   HYPRE_Int       *P_send_rows     = plan -> P_send_rows;
+   HYPRE_Int       *P_send_i        = plan -> P_send_i;
+   HYPRE_Complex   *P_send_data     = plan -> P_send_data;
+   HYPRE_Int        num_rows_C_ext  = plan -> num_rows_C_ext;
+   HYPRE_Int       *C_ext_rows      = plan -> C_ext_rows;
+   HYPRE_Int       *C_ext_i         = plan -> C_ext_i;
+   HYPRE_Complex   *C_ext_data      = plan -> C_ext_data;
+   HYPRE_Int        num_rows_C_int  = plan -> num_rows_C_int;
+   HYPRE_Int       *C_int_i         = plan -> C_int_i;
+   HYPRE_Complex   *C_int_data      = plan -> C_int_data;
+   HYPRE_Int       *C_int_pos       = plan -> C_int_pos;
+
+   hypre_ParCSRCommHandle *comm_handle;
+
+   HYPRE_Int        i, j, k, row, p;
+
+   /*-----------------------------------------------------------------------
+    * Start the exchange of the values of P_ext and copy the local values
+    * of A and P meanwhile
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k,row) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_P_send; i++)
+   {
+      row = P_send_rows[i];
+      k = P_send_i[i];
+      for (j = P_diag_i[row]; j < P_diag_i[row+1]; j++)
+      {
+         P_send_data[k++] = P_diag_data[j];
+      }
+      for (j = P_offd_i[row]; j < P_offd_i[row+1]; j++)
+      {
+         P_send_data[k++] = P_offd_data[j];
+      }
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, plan -> P_ext_comm_pkg, P_send_data,
+                                              P_loc_data + P_loc_i[num_rows]);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      k = A_loc_i[i];
+      for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+      {
+         A_loc_data[k++] = A_diag_data[j];
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i+1]; j++)
+      {
+         A_loc_data[k++] = A_offd_data[j];
+      }
+
+      k = P_loc_i[i];
+      for (j = P_diag_i[i]; j < P_diag_i[i+1]; j++)
+      {
+         P_loc_data[k++] = P_diag_data[j];
+      }
+      for (j = P_offd_i[i]; j < P_offd_i[i+1]; j++)
+      {
+         P_loc_data[k++] = P_offd_data[j];
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < PT_nnz; j++)
+   {
+      PT_data[j] = P_loc_data[PT_perm[j]];
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /*-----------------------------------------------------------------------
+    * Local products
+    *-----------------------------------------------------------------------*/
+
+   hypre_CSRMatrixMultiplyHostNumeric(plan -> A_loc, plan -> P_loc, plan -> Q);
+   hypre_CSRMatrixMultiplyHostNumeric(plan -> PT, plan -> Q, plan -> C);
+
+   /*-----------------------------------------------------------------------
+    * Send C_ext to the owners and add the local rows of C into RAP
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,k,row) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows_C_ext; i++)
+   {
+      row = C_ext_rows[i];
+      k = C_ext_i[i];
+      for (j = C_i[row]; j < C_i[row+1]; j++)
+      {
+         C_ext_data[k++] = C_data[j];
+      }
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, plan -> C_ext_comm_pkg, C_ext_data, C_int_data);
+
+   hypre_Memset(RAP_diag_data, 0, hypre_CSRMatrixNumNonzeros(RAP_diag) * sizeof(HYPRE_Complex),
+                HYPRE_MEMORY_HOST);
+   hypre_Memset(RAP_offd_data, 0, hypre_CSRMatrixNumNonzeros(RAP_offd) * sizeof(HYPRE_Complex),
+                HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,p) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols_P; i++)
+   {
+      for (j = C_i[i]; j < C_i[i+1]; j++)
+      {
+         p = C_pos[j];
+         if (p >= 0)
+         {
+            RAP_diag_data[p] += C_data[j];
+         }
+         else
+         {
+            RAP_offd_data[-p-1] += C_data[j];
+         }
+      }
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /* rows received from different processes can go to the same row of RAP */
+   for (j = 0; j < C_int_i[num_rows_C_int]; j++)
+   {
+      p = C_int_pos[j];
+      if (p >= 0)
+      {
+         RAP_diag_data[p] += C_int_data[j];
+      }
+      else
+      {
+         RAP_offd_data[-p-1] += C_int_data[j];
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -183,6 +183,24 @@ hypre_ParVectorSetPartitioningOwner( hypre_ParVector *vector,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorSetMultiVecStorageMethod
+ * see hypre_SeqVectorSetMultiVecStorageMethod
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorSetMultiVecStorageMethod( hypre_ParVector *vector,
+                                         HYPRE_Int        method )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return hypre_SeqVectorSetMultiVecStorageMethod(hypre_ParVectorLocalVector(vector), method);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorSetNumVectors
  * call before calling hypre_ParVectorInitialize
@@ -307,6 +325,132 @@ hypre_ParVectorPrint( hypre_ParVector  *vector,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintBinary
+ *
+ * Writes the local part of the vector to "<file_name>.bin.<myid>" in the
+ * binary format described in hypre_binary_io.h.  After the header, the file
+ * contains the HYPRE_BigInt values global_size, first_index, last_index + 1
+ * followed by the local data array.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintBinary( hypre_ParVector  *vector,
+                            const char       *file_name )
+{
+   hypre_Vector  *local_vector;
+   HYPRE_BigInt   info_big[3];
+   HYPRE_Int      my_id, num_procs;
+   char           new_file_name[255];
+   FILE          *fp;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   local_vector = hypre_ParVectorLocalVector(vector);
+
+   /* multivector code not written yet */
+   if (hypre_VectorNumVectors(local_vector) != 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   info_big[0] = hypre_ParVectorGlobalSize(vector);
+   info_big[1] = hypre_ParVectorFirstIndex(vector);
+   info_big[2] = hypre_ParVectorLastIndex(vector) + 1;
+
+   hypre_MPI_Comm_rank(hypre_ParVectorComm(vector), &my_id);
+   hypre_MPI_Comm_size(hypre_ParVectorComm(vector), &num_procs);
+   hypre_sprintf(new_file_name, "%s.bin.%05d", file_name, my_id);
+   if ((fp = fopen(new_file_name, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_BinaryWriteHeader(fp, hypre_BINARY_PAR_VECTOR, num_procs);
+   hypre_BinaryWrite(fp, info_big, 3*sizeof(HYPRE_BigInt), HYPRE_MEMORY_HOST);
+   hypre_BinaryWrite(fp, hypre_VectorData(local_vector),
+                     hypre_VectorSize(local_vector)*sizeof(HYPRE_Complex),
+                     hypre_VectorMemoryLocation(local_vector));
+
+   fclose(fp);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadBinary
+ *
+ * Reads a vector written by hypre_ParVectorPrintBinary.  If any process fails
+ * to read its file, all processes return NULL.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParVector *
+hypre_ParVectorReadBinary( MPI_Comm    comm,
+                           const char *file_name )
+{
+   hypre_ParVector     *vector;
+   hypre_Vector        *local_vector;
+   hypre_BinaryReader   reader;
+   HYPRE_BigInt         info_big[3];
+   HYPRE_BigInt        *partitioning;
+   HYPRE_Int            my_id, num_procs;
+   HYPRE_Int            ok = 1;
+   char                 new_file_name[255];
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   hypre_sprintf(new_file_name, "%s.bin.%05d", file_name, my_id);
+   if (hypre_BinaryReaderOpen(&reader, new_file_name, hypre_BINARY_PAR_VECTOR, num_procs) ||
+       hypre_BinaryRead(&reader, info_big, 3*sizeof(HYPRE_BigInt), HYPRE_MEMORY_HOST))
+   {
+      ok = 0;
+   }
+   if (!hypre_BinaryAllOK(comm, ok))
+   {
+      hypre_BinaryReaderClose(&reader);
+      return NULL;
+   }
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   partitioning = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+   partitioning[0] = info_big[1];
+   partitioning[1] = info_big[2];
+#else
+   partitioning = hypre_CTAlloc(HYPRE_BigInt, num_procs+1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&info_big[1], 1, HYPRE_MPI_BIG_INT,
+                       partitioning, 1, HYPRE_MPI_BIG_INT, comm);
+   partitioning[num_procs] = info_big[0];
+#endif
+
+   vector = hypre_ParVectorCreate(comm, info_big[0], partitioning);
+   hypre_ParVectorInitialize(vector);
+
+   local_vector = hypre_ParVectorLocalVector(vector);
+   if (hypre_BinaryRead(&reader, hypre_VectorData(local_vector),
+                        hypre_VectorSize(local_vector)*sizeof(HYPRE_Complex),
+                        hypre_VectorMemoryLocation(local_vector)))
+   {
+      ok = 0;
+   }
+
+   hypre_BinaryReaderClose(&reader);
+
+   if (!hypre_BinaryAllOK(comm, ok))
+   {
+      hypre_ParVectorDestroy(vector);
+      return NULL;
+   }
+
+   return vector;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorSetConstantValues
  *--------------------------------------------------------------------------*/
@@ -500,6 +644,119 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorAxpyInnerProd
+ * y = y + alpha*x, and returns <z, y> (z may be y)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParVectorAxpyInnerProd( HYPRE_Complex    alpha,
+                              hypre_ParVector *x,
+                              hypre_ParVector *y,
+                              hypre_ParVector *z )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x);
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector *z_local = hypre_ParVectorLocalVector(z);
+
+   HYPRE_Real result = 0.0;
+   HYPRE_Real local_result = hypre_SeqVectorAxpyInnerProd(alpha, x_local, y_local, z_local);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(&local_result, &result, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProd2
+ * result[0] = <x, y> and result[1] = <x, z> with a single reduction
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProd2( hypre_ParVector *x,
+                           hypre_ParVector *y,
+                           hypre_ParVector *z,
+                           HYPRE_Real      *result )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x);
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector *z_local = hypre_ParVectorLocalVector(z);
+   HYPRE_Real    local_result[2];
+
+   hypre_SeqVectorInnerProd2(x_local, y_local, z_local, local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, 2, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorAxpby
+ * y = alpha*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorAxpby( HYPRE_Complex    alpha,
+                      hypre_ParVector *x,
+                      HYPRE_Complex    beta,
+                      hypre_ParVector *y )
+{
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+   return hypre_SeqVectorAxpby(alpha, x_local, beta, y_local);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProdMulti
+ * result[j] = <x_j, y_j> for each vector j of the multivectors x and y,
+ * with a single reduction
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProdMulti( hypre_ParVector *x,
+                               hypre_ParVector *y,
+                               HYPRE_Real      *result )
+{
+   MPI_Comm      comm        = hypre_ParVectorComm(x);
+   hypre_Vector *x_local     = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local     = hypre_ParVectorLocalVector(y);
+   HYPRE_Int     num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Real   *local_result;
+
+   local_result = hypre_TAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   hypre_SeqVectorInnerProdMulti(x_local, y_local, local_result);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, num_vectors, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -286,192 +286,10 @@ hypre_CSRMatrixBigAdd( hypre_CSRMatrix *A,
 
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMultiply
- * multiplies two CSR Matrices A and B and returns a CSR Matrix C;
- * Note: The routine does not check for 0-elements which might be generated
- *       through cancellation of elements in A and B or already contained
- in A and B. To remove those, use hypre_CSRMatrixDeleteZeros
+ * multiplies two CSR Matrices A and B and returns a CSR Matrix C
+ * (see csr_spgemm_host.c for the host version)
  *--------------------------------------------------------------------------*/
 
-hypre_CSRMatrix*
-hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
-                             hypre_CSRMatrix *B)
-{
-   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
-   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
-   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
-   HYPRE_Int         nrows_A  = hypre_CSRMatrixNumRows(A);
-   HYPRE_Int         ncols_A  = hypre_CSRMatrixNumCols(A);
-   HYPRE_Complex    *B_data   = hypre_CSRMatrixData(B);
-   HYPRE_Int        *B_i      = hypre_CSRMatrixI(B);
-   HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
-   HYPRE_Int         nrows_B  = hypre_CSRMatrixNumRows(B);
-   HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
-   hypre_CSRMatrix  *C;
-   HYPRE_Complex    *C_data;
-   HYPRE_Int        *C_i;
-   HYPRE_Int        *C_j;
-
-   HYPRE_Int         ia, ib, ic, ja, jb, num_nonzeros=0;
-   HYPRE_Int         row_start, counter;
-   HYPRE_Complex     a_entry, b_entry;
-   HYPRE_Int         allsquare = 0;
-   HYPRE_Int         max_num_threads;
-   HYPRE_Int         *jj_count;
-
-   HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
-   HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
-
-   /* RL: TODO cannot guarantee, maybe should never assert
-   hypre_assert(memory_location_A == memory_location_B);
-   */
-
-   /* RL: in the case of A=H, B=D, or A=D, B=H, let C = D,
-    * not sure if this is the right thing to do.
-    * Also, need something like this in other places
-    * TODO */
-   HYPRE_MemoryLocation memory_location_C = hypre_max(memory_location_A, memory_location_B);
-
-   if (ncols_A != nrows_B)
-   {
-      hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Warning! incompatible matrix dimensions!\n");
-      return NULL;
-   }
-
-   if (nrows_A == ncols_B)
-   {
-      allsquare = 1;
-   }
-
-   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A+1, memory_location_C);
-
-   max_num_threads = hypre_NumThreads();
-
-   jj_count = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel private(ia, ib, ic, ja, jb, num_nonzeros, row_start, counter, a_entry, b_entry)
-#endif
-   {
-      HYPRE_Int *B_marker = NULL;
-      HYPRE_Int ns, ne, ii, jj;
-      HYPRE_Int size, rest, num_threads;
-      HYPRE_Int i1;
-      ii = hypre_GetThreadNum();
-      num_threads = hypre_NumActiveThreads();
-
-      size = nrows_A/num_threads;
-      rest = nrows_A - size*num_threads;
-      if (ii < rest)
-      {
-         ns = ii*size+ii;
-         ne = (ii+1)*size+ii+1;
-      }
-      else
-      {
-         ns = ii*size+rest;
-         ne = (ii+1)*size+rest;
-      }
-
-      B_marker = hypre_CTAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
-
-      for (ib = 0; ib < ncols_B; ib++)
-         B_marker[ib] = -1;
-
-      num_nonzeros = 0;
-      for (ic = ns; ic < ne; ic++)
-      {
-         C_i[ic] = num_nonzeros;
-         if (allsquare)
-         {
-            B_marker[ic] = ic;
-            num_nonzeros++;
-         }
-         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
-         {
-            ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
-            {
-               jb = B_j[ib];
-               if (B_marker[jb] != ic)
-               {
-                  B_marker[jb] = ic;
-                  num_nonzeros++;
-               }
-            }
-         }
-      }
-      jj_count[ii] = num_nonzeros;
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp barrier
-#endif
-
-      if (ii)
-      {
-         jj = jj_count[0];
-         for (i1 = 1; i1 < ii; i1++)
-            jj += jj_count[i1];
-
-         for (i1 = ns; i1 < ne; i1++)
-            C_i[i1] += jj;
-      }
-      else
-      {
-         C_i[nrows_A] = 0;
-         for (i1 = 0; i1 < num_threads; i1++)
-            C_i[nrows_A] += jj_count[i1];
-
-         C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
-         hypre_CSRMatrixI(C) = C_i;
-         hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
-         C_j = hypre_CSRMatrixJ(C);
-         C_data = hypre_CSRMatrixData(C);
-      }
-
-#ifdef HYPRE_USING_OPENMP
-#pragma omp barrier
-#endif
-
-      for (ib = 0; ib < ncols_B; ib++)
-         B_marker[ib] = -1;
-
-      counter = C_i[ns];
-      for (ic = ns; ic < ne; ic++)
-      {
-         row_start = C_i[ic];
-         if (allsquare)
-         {
-            B_marker[ic] = counter;
-            C_data[counter] = 0;
-            C_j[counter] = ic;
-            counter++;
-         }
-         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
-         {
-            ja = A_j[ia];
-            a_entry = A_data[ia];
-            for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
-            {
-               jb = B_j[ib];
-               b_entry = B_data[ib];
-               if (B_marker[jb] < row_start)
-               {
-                  B_marker[jb] = counter;
-                  C_j[B_marker[jb]] = jb;
-                  C_data[B_marker[jb]] = a_entry*b_entry;
-                  counter++;
-               }
-               else
-                  C_data[B_marker[jb]] += a_entry*b_entry;
-            }
-         }
-      }
-      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
-   } /*end parallel region */
-   hypre_TFree(jj_count, HYPRE_MEMORY_HOST);
-   return C;
-}
-
 hypre_CSRMatrix*
 hypre_CSRMatrixMultiply( hypre_CSRMatrix *A,
                          hypre_CSRMatrix *B)
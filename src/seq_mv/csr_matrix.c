@@ -31,6 +31,7 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    matrix = hypre_CTAlloc(hypre_CSRMatrix, 1, HYPRE_MEMORY_HOST);
 
    hypre_CSRMatrixData(matrix)           = NULL;
+   hypre_CSRMatrixDataFlt(matrix)        = NULL;
    hypre_CSRMatrixI(matrix)              = NULL;
    hypre_CSRMatrixJ(matrix)              = NULL;
    hypre_CSRMatrixBigJ(matrix)           = NULL;
@@ -62,10 +63,12 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSELLDestroy(hypre_CSRMatrixSell(matrix));
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
          hypre_TFree(hypre_CSRMatrixData(matrix), memory_location);
+         hypre_TFree(hypre_CSRMatrixDataFlt(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(hypre_CSRMatrixJ(matrix),    memory_location);
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
       }
@@ -16,6 +16,59 @@
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) shadow of a CSR Matrix
+ *
+ * Rows are sorted by length within windows of sigma rows and grouped in
+ * chunks of C rows.  Each chunk is stored column-major and padded to the
+ * length of its longest row, so that the matvec inner loop runs over the C
+ * rows of a chunk with unit stride.
+ *--------------------------------------------------------------------------*/
+
+/* Number of rows per chunk; fixed at compile time so that the chunk loops
+ * can be vectorized */
+#ifndef HYPRE_SELL_CHUNK_SIZE
+#define HYPRE_SELL_CHUNK_SIZE 8
+#endif
+
+/* Default sorting window */
+#define HYPRE_SELL_SIGMA      256
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      num_cols;
+   HYPRE_Int      sigma;
+   HYPRE_Int      num_chunks;
+   HYPRE_Int      num_stored;   /* number of stored entries, padding included */
+
+   HYPRE_Int     *chunk_ptr;    /* start of each chunk in col/data */
+   HYPRE_Int     *chunk_len;    /* width (longest row) of each chunk */
+   HYPRE_Int     *chunk_rows;   /* number of non-empty rows of each chunk */
+   HYPRE_Int     *row_perm;     /* original row of each slot, -1 for padding */
+   HYPRE_Int     *col;
+   HYPRE_Complex *data;
+
+   /* CSR arrays the shadow was built from, used to detect a stale shadow */
+   HYPRE_Int     *csr_i;
+   HYPRE_Int     *csr_j;
+   HYPRE_Complex *csr_data;
+   HYPRE_Int      csr_num_nonzeros;
+
+} hypre_CSRMatrixSELL;
+
+#define hypre_CSRMatrixSELLNumRows(sell)      ((sell) -> num_rows)
+#define hypre_CSRMatrixSELLNumCols(sell)      ((sell) -> num_cols)
+#define hypre_CSRMatrixSELLSigma(sell)        ((sell) -> sigma)
+#define hypre_CSRMatrixSELLNumChunks(sell)    ((sell) -> num_chunks)
+#define hypre_CSRMatrixSELLNumStored(sell)    ((sell) -> num_stored)
+#define hypre_CSRMatrixSELLChunkPtr(sell)     ((sell) -> chunk_ptr)
+#define hypre_CSRMatrixSELLChunkLen(sell)     ((sell) -> chunk_len)
+#define hypre_CSRMatrixSELLChunkRows(sell)    ((sell) -> chunk_rows)
+#define hypre_CSRMatrixSELLRowPerm(sell)      ((sell) -> row_perm)
+#define hypre_CSRMatrixSELLCol(sell)          ((sell) -> col)
+#define hypre_CSRMatrixSELLData(sell)         ((sell) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -36,6 +89,10 @@ typedef struct
 
    HYPRE_Complex *data;
 
+   /* single precision values, used instead of `data' (which is then NULL)
+    * after hypre_CSRMatrixConvertToFloat */
+   hypre_float   *data_flt;
+
    /* for compressing rows in matrix multiplication  */
    HYPRE_Int     *rownnz;
    HYPRE_Int      num_rownnz;
@@ -43,6 +100,13 @@ typedef struct
    /* memory location of arrays i, j, data */
    HYPRE_MemoryLocation      memory_location;
 
+   /* SELL-C-sigma copy used by the host matvec (built on demand).
+    * hypre_CSRMatrixSetupSELL only detects replaced arrays: every routine
+    * that changes the values of the matrix in place has to update the copy
+    * with hypre_CSRMatrixSELLUpdateValues or drop it with
+    * hypre_CSRMatrixSELLInvalidate */
+   hypre_CSRMatrixSELL      *sell;
+
 } hypre_CSRMatrix;
 
 /*--------------------------------------------------------------------------
@@ -50,6 +114,7 @@ typedef struct
  *--------------------------------------------------------------------------*/
 
 #define hypre_CSRMatrixData(matrix)           ((matrix) -> data)
+#define hypre_CSRMatrixDataFlt(matrix)        ((matrix) -> data_flt)
 #define hypre_CSRMatrixI(matrix)              ((matrix) -> i)
 #define hypre_CSRMatrixJ(matrix)              ((matrix) -> j)
 #define hypre_CSRMatrixBigJ(matrix)           ((matrix) -> big_j)
@@ -60,6 +125,7 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)      ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)       ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix) ((matrix) -> memory_location)
+#define hypre_CSRMatrixSell(matrix)           ((matrix) -> sell)
 
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
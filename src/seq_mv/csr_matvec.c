@@ -416,6 +416,19 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixDataFlt(A))
+   {
+      ierr = hypre_CSRMatrixMatvecFltHost(alpha, A, x, beta, b, y, offset);
+   }
+   else if (hypre_CSRMatrixMatvecUseSpMM(x, y, offset))
+   {
+      ierr = hypre_CSRMatrixSpMMHost(alpha, A, x, beta, b, y);
+   }
+   else if (hypre_CSRMatrixMatvecUseSELL(A, x, offset))
+   {
+      ierr = hypre_CSRMatrixMatvecSELLHost(alpha, A, x, beta, b, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -686,6 +699,19 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if (hypre_CSRMatrixDataFlt(A))
+   {
+      ierr = hypre_CSRMatrixMatvecTFltHost(alpha, A, x, beta, y);
+   }
+   else if (hypre_CSRMatrixMatvecUseSpMM(x, y, 0))
+   {
+      ierr = hypre_CSRMatrixSpMMTHost(alpha, A, x, beta, y);
+   }
+   else if (hypre_CSRMatrixMatvecUseSELL(A, x, 0))
+   {
+      ierr = hypre_CSRMatrixMatvecTSELLHost(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
@@ -0,0 +1,348 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single precision value storage and matvec functions for hypre_CSRMatrix.
+ *
+ * After hypre_CSRMatrixConvertToFloat, the matrix keeps its pattern (i, j)
+ * but its values are held in data_flt and data is NULL.  The kernels below
+ * read the single precision values and accumulate in HYPRE_Complex, so only
+ * the traffic for the matrix values is reduced; vectors stay in full
+ * precision.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToFloat
+ *
+ * Replaces the values of A by a single precision copy.  Only done for host
+ * matrices that own their data; otherwise A is left unchanged.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *A )
+{
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE)
+   HYPRE_Complex *A_data = hypre_CSRMatrixData(A);
+   HYPRE_Int      num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_MemoryLocation memory_location = hypre_CSRMatrixMemoryLocation(A);
+   hypre_float   *A_data_flt;
+   HYPRE_Int      i;
+
+   if (hypre_CSRMatrixDataFlt(A) || !hypre_CSRMatrixOwnsData(A) ||
+       hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   /* always allocate (at least one entry), so that data_flt != NULL tells the
+    * storage precision also for matrices without nonzeros */
+   A_data_flt = hypre_TAlloc(hypre_float, hypre_max(num_nonzeros, 1), HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      A_data_flt[i] = (hypre_float) A_data[i];
+   }
+
+   hypre_CSRMatrixSELLInvalidate(A);
+
+   hypre_TFree(A_data, memory_location);
+   hypre_CSRMatrixData(A)    = NULL;
+   hypre_CSRMatrixDataFlt(A) = A_data_flt;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToDouble
+ *
+ * Restores full precision values of a matrix converted with
+ * hypre_CSRMatrixConvertToFloat (the rounded values are kept).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToDouble( hypre_CSRMatrix *A )
+{
+   hypre_float   *A_data_flt = hypre_CSRMatrixDataFlt(A);
+   HYPRE_Int      num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Complex *A_data;
+   HYPRE_Int      i;
+
+   if (!A_data_flt)
+   {
+      return hypre_error_flag;
+   }
+
+   A_data = hypre_TAlloc(HYPRE_Complex, num_nonzeros, hypre_CSRMatrixMemoryLocation(A));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      A_data[i] = (HYPRE_Complex) A_data_flt[i];
+   }
+
+   hypre_TFree(A_data_flt, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDataFlt(A) = NULL;
+   hypre_CSRMatrixData(A)    = A_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecFltHost
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] for a matrix
+ * with single precision values
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecFltHost( HYPRE_Complex    alpha,
+                              hypre_CSRMatrix *A,
+                              hypre_Vector    *x,
+                              HYPRE_Complex    beta,
+                              hypre_Vector    *b,
+                              hypre_Vector    *y,
+                              HYPRE_Int        offset )
+{
+   hypre_float      *A_data   = hypre_CSRMatrixDataFlt(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *b_data = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data = hypre_VectorData(y) + offset;
+   HYPRE_Int         x_size = hypre_VectorSize(x);
+   HYPRE_Int         b_size = hypre_VectorSize(b) - offset;
+   HYPRE_Int         y_size = hypre_VectorSize(y) - offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Complex     tempx;
+   HYPRE_Int         i, jj, jv, iy, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+   hypre_assert( num_vectors == hypre_VectorNumVectors(b) );
+
+   if (num_cols != x_size)
+      ierr = 1;
+
+   if (num_rows != y_size || num_rows != b_size)
+      ierr = 2;
+
+   if (num_cols != x_size && (num_rows != y_size || num_rows != b_size))
+      ierr = 3;
+
+   if (alpha == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows*num_vectors; i++)
+         y_data[i] = beta*b_data[i];
+
+      return ierr;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   if (num_vectors == 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            tempx += A_data[jj] * x_data[A_j[jj]];
+         }
+         y_data[i] = (beta == 0.0) ? alpha*tempx : alpha*tempx + beta*b_data[i];
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,jv,iy,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               tempx += A_data[jj] * x_data[A_j[jj]*idxstride_x + jv*vecstride_x];
+            }
+            iy = i*idxstride_y + jv*vecstride_y;
+            y_data[iy] = (beta == 0.0) ? alpha*tempx : alpha*tempx + beta*b_data[iy];
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTFltHost
+ *
+ * y = alpha*A^T*x + beta*y for a matrix with single precision values
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTFltHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *y )
+{
+   hypre_float      *A_data    = hypre_CSRMatrixDataFlt(A);
+   HYPRE_Int        *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols  = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+   HYPRE_Int         x_size = hypre_VectorSize(x);
+   HYPRE_Int         y_size = hypre_VectorSize(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+
+   HYPRE_Complex    *y_data_expand;
+   HYPRE_Complex     xi;
+   HYPRE_Int         my_thread_num, ye_offset;
+   HYPRE_Int         i, j, jv, jj, num_threads;
+   HYPRE_Int         ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   if (num_rows != x_size)
+      ierr = 1;
+
+   if (num_cols != y_size)
+      ierr = 2;
+
+   if (num_rows != x_size && num_cols != y_size)
+      ierr = 3;
+
+   /*-----------------------------------------------------------------------
+    * y = beta*y
+    *-----------------------------------------------------------------------*/
+
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols*num_vectors; i++)
+         y_data[i] = (beta == 0.0) ? 0.0 : beta*y_data[i];
+   }
+
+   if (alpha == 0.0)
+   {
+      return ierr;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /*-----------------------------------------------------------------
+    * y += alpha*A^T*x
+    *-----------------------------------------------------------------*/
+
+   num_threads = hypre_NumThreads();
+   if (num_threads > 1 && num_vectors == 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,jj,j,xi,my_thread_num,ye_offset)
+#endif
+      {
+         my_thread_num = hypre_GetThreadNum();
+         ye_offset = y_size*my_thread_num;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            xi = alpha*x_data[i];
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               y_data_expand[ye_offset + A_j[jj]] += A_data[jj] * xi;
+            }
+         }
+
+         /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j*y_size + i];
+            }
+         }
+      } /* end parallel threaded region */
+
+      hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      /* multiple vector case is not threaded */
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            xi = alpha*x_data[i*idxstride_x + jv*vecstride_x];
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               y_data[A_j[jj]*idxstride_y + jv*vecstride_y] += A_data[jj] * xi;
+            }
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
@@ -0,0 +1,587 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma storage and matvec functions for hypre_CSRMatrix class.
+ *
+ * The SELL copy of a CSR matrix is built on demand by the host matvec when
+ * HYPRE_SetSpMVUseSELL(1) has been called, and is cached on the matrix.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+#define SELL_C HYPRE_SELL_CHUNK_SIZE
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSELLCreate
+ *
+ * Builds the SELL-C-sigma copy of A.  Rows are sorted by decreasing length
+ * inside windows of sigma rows (sigma is rounded up to a multiple of C), so
+ * the empty rows of a chunk are its last ones.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrixSELL *
+hypre_CSRMatrixSELLCreate( hypre_CSRMatrix *A,
+                           HYPRE_Int        sigma )
+{
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+
+   hypre_CSRMatrixSELL *sell;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *chunk_rows, *row_perm, *row_key;
+   HYPRE_Int         num_chunks, num_slots, num_stored;
+   HYPRE_Int         c, l, r, w, n, len, rows;
+
+   if (sigma < SELL_C)
+   {
+      sigma = SELL_C;
+   }
+   sigma = ((sigma + SELL_C - 1) / SELL_C) * SELL_C;
+
+   num_chunks = (num_rows + SELL_C - 1) / SELL_C;
+   num_slots  = num_chunks * SELL_C;
+
+   sell = hypre_CTAlloc(hypre_CSRMatrixSELL, 1, HYPRE_MEMORY_HOST);
+
+   chunk_ptr = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_TAlloc(HYPRE_Int, num_chunks,     HYPRE_MEMORY_HOST);
+   chunk_rows = hypre_TAlloc(HYPRE_Int, num_chunks,    HYPRE_MEMORY_HOST);
+   row_perm  = hypre_TAlloc(HYPRE_Int, num_slots,      HYPRE_MEMORY_HOST);
+   row_key   = hypre_TAlloc(HYPRE_Int, sigma,          HYPRE_MEMORY_HOST);
+
+   /* local sorting of the rows by decreasing length */
+   for (w = 0; w < num_rows; w += sigma)
+   {
+      n = hypre_min(sigma, num_rows - w);
+      for (r = 0; r < n; r++)
+      {
+         row_perm[w + r] = w + r;
+         row_key[r] = A_i[w + r] - A_i[w + r + 1];
+      }
+      hypre_qsort2i(row_key, &row_perm[w], 0, n - 1);
+   }
+   for (r = num_rows; r < num_slots; r++)
+   {
+      row_perm[r] = -1;
+   }
+   hypre_TFree(row_key, HYPRE_MEMORY_HOST);
+
+   /* chunk widths, non-empty rows and offsets */
+   chunk_ptr[0] = 0;
+   for (c = 0; c < num_chunks; c++)
+   {
+      len  = 0;
+      rows = 0;
+      for (l = 0; l < SELL_C; l++)
+      {
+         r = row_perm[c * SELL_C + l];
+         if (r >= 0 && A_i[r + 1] > A_i[r])
+         {
+            len = hypre_max(len, A_i[r + 1] - A_i[r]);
+            rows++;
+         }
+      }
+      chunk_len[c]  = len;
+      chunk_rows[c] = rows;
+      chunk_ptr[c + 1] = chunk_ptr[c] + len * SELL_C;
+   }
+   num_stored = chunk_ptr[num_chunks];
+
+   hypre_CSRMatrixSELLNumRows(sell)   = num_rows;
+   hypre_CSRMatrixSELLNumCols(sell)   = hypre_CSRMatrixNumCols(A);
+   hypre_CSRMatrixSELLSigma(sell)     = sigma;
+   hypre_CSRMatrixSELLNumChunks(sell) = num_chunks;
+   hypre_CSRMatrixSELLNumStored(sell) = num_stored;
+   hypre_CSRMatrixSELLChunkPtr(sell)  = chunk_ptr;
+   hypre_CSRMatrixSELLChunkLen(sell)  = chunk_len;
+   hypre_CSRMatrixSELLChunkRows(sell) = chunk_rows;
+   hypre_CSRMatrixSELLRowPerm(sell)   = row_perm;
+   hypre_CSRMatrixSELLCol(sell)       = hypre_TAlloc(HYPRE_Int,     num_stored, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixSELLData(sell)      = hypre_TAlloc(HYPRE_Complex, num_stored, HYPRE_MEMORY_HOST);
+
+   sell -> csr_i            = A_i;
+   sell -> csr_j            = hypre_CSRMatrixJ(A);
+   sell -> csr_data         = hypre_CSRMatrixData(A);
+   sell -> csr_num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+
+   hypre_CSRMatrixSELLFill(sell, A, 1);
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSELLFill
+ *
+ * Copies the values (and, if fill_col, the column indices) of A into the
+ * SELL layout.  Padding entries get value 0 and repeat the last column index
+ * of their row, so they only read x entries the row already reads.  Empty
+ * rows use column 0; the matvecs discard their sums (see chunk_rows).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSELLFill( hypre_CSRMatrixSELL *sell,
+                         hypre_CSRMatrix     *A,
+                         HYPRE_Int            fill_col )
+{
+   HYPRE_Int        *A_i        = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j        = hypre_CSRMatrixJ(A);
+   HYPRE_Complex    *A_data     = hypre_CSRMatrixData(A);
+   HYPRE_Int         num_chunks = hypre_CSRMatrixSELLNumChunks(sell);
+   HYPRE_Int        *chunk_ptr  = hypre_CSRMatrixSELLChunkPtr(sell);
+   HYPRE_Int        *chunk_len  = hypre_CSRMatrixSELLChunkLen(sell);
+   HYPRE_Int        *row_perm   = hypre_CSRMatrixSELLRowPerm(sell);
+   HYPRE_Int        *S_col      = hypre_CSRMatrixSELLCol(sell);
+   HYPRE_Complex    *S_data     = hypre_CSRMatrixSELLData(sell);
+   HYPRE_Int         c, l, k, r, len, pos, last;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c, l, k, r, len, pos, last) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      for (l = 0; l < SELL_C; l++)
+      {
+         r   = row_perm[c * SELL_C + l];
+         len = (r >= 0) ? A_i[r + 1] - A_i[r] : 0;
+         pos = chunk_ptr[c] + l;
+
+         for (k = 0; k < len; k++, pos += SELL_C)
+         {
+            S_data[pos] = A_data[A_i[r] + k];
+            if (fill_col)
+            {
+               S_col[pos] = A_j[A_i[r] + k];
+            }
+         }
+         last = (len > 0) ? A_j[A_i[r + 1] - 1] : 0;
+         for (k = len; k < chunk_len[c]; k++, pos += SELL_C)
+         {
+            S_data[pos] = 0.0;
+            if (fill_col)
+            {
+               S_col[pos] = last;
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSELLDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSELLDestroy( hypre_CSRMatrixSELL *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_CSRMatrixSELLChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSELLChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSELLChunkRows(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSELLRowPerm(sell),  HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSELLCol(sell),      HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CSRMatrixSELLData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetupSELL
+ *
+ * Builds the SELL copy of A if it does not exist, or if the CSR arrays of A
+ * have been replaced since it was built.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetupSELL( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSELL *sell = hypre_CSRMatrixSell(A);
+
+   if ( sell &&
+        ( sell -> csr_i            != hypre_CSRMatrixI(A)           ||
+          sell -> csr_j            != hypre_CSRMatrixJ(A)           ||
+          sell -> csr_data         != hypre_CSRMatrixData(A)        ||
+          sell -> csr_num_nonzeros != hypre_CSRMatrixNumNonzeros(A) ||
+          hypre_CSRMatrixSELLNumRows(sell) != hypre_CSRMatrixNumRows(A) ||
+          hypre_CSRMatrixSELLNumCols(sell) != hypre_CSRMatrixNumCols(A) ) )
+   {
+      hypre_CSRMatrixSELLDestroy(sell);
+      sell = NULL;
+   }
+
+   if (!sell)
+   {
+      hypre_CSRMatrixSell(A) = hypre_CSRMatrixSELLCreate(A, HYPRE_SELL_SIGMA);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSELLInvalidate
+ *
+ * Drops the SELL copy of A (if any); the next SELL matvec rebuilds it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSELLInvalidate( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSELLDestroy(hypre_CSRMatrixSell(A));
+   hypre_CSRMatrixSell(A) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSELLUpdateValues
+ *
+ * Must be called when the values of A are modified in place and A may
+ * carry a SELL copy.  hypre_CSRMatrixSetupSELL only detects replaced
+ * arrays, not changed values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSELLUpdateValues( hypre_CSRMatrix *A )
+{
+   hypre_CSRMatrixSELL *sell = hypre_CSRMatrixSell(A);
+
+   if (!sell)
+   {
+      return hypre_error_flag;
+   }
+
+   if ( sell -> csr_i            != hypre_CSRMatrixI(A)    ||
+        sell -> csr_j            != hypre_CSRMatrixJ(A)    ||
+        sell -> csr_num_nonzeros != hypre_CSRMatrixNumNonzeros(A) )
+   {
+      /* the pattern changed: drop the copy, it is rebuilt when needed */
+      return hypre_CSRMatrixSELLInvalidate(A);
+   }
+
+   sell -> csr_data = hypre_CSRMatrixData(A);
+   hypre_CSRMatrixSELLFill(sell, A, 0);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecUseSELL
+ *
+ * Returns 1 if y = alpha*A*x + beta*b (or the transpose) should go through
+ * the SELL kernels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecUseSELL( hypre_CSRMatrix *A,
+                              hypre_Vector    *x,
+                              HYPRE_Int        offset )
+{
+   if ( !hypre_HandleSpMVUseSELL(hypre_handle()) )
+   {
+      return 0;
+   }
+
+   return ( offset == 0 &&
+            hypre_VectorNumVectors(x) == 1 &&
+            hypre_CSRMatrixNumRows(A) >= SELL_C &&
+            hypre_CSRMatrixNumNonzeros(A) > 0 &&
+            hypre_CSRMatrixI(A) != NULL &&
+            hypre_CSRMatrixJ(A) != NULL );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSELLHost
+ *
+ * y = alpha*A*x + beta*b using the SELL copy of A (single vector)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSELLHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *b_data = hypre_VectorData(b);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+   HYPRE_Int         x_size = hypre_VectorSize(x);
+   HYPRE_Int         b_size = hypre_VectorSize(b);
+   HYPRE_Int         y_size = hypre_VectorSize(y);
+
+   hypre_CSRMatrixSELL *sell;
+   HYPRE_Int         num_chunks;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *chunk_rows, *row_perm, *S_col;
+   HYPRE_Complex    *S_data;
+
+   HYPRE_Complex     sum[SELL_C];
+   HYPRE_Int        *col, *perm;
+   HYPRE_Complex    *data;
+   HYPRE_Int         i, c, k, l, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   /* see hypre_CSRMatrixMatvecOutOfPlaceHost for the meaning of ierr */
+   if (num_cols != x_size)
+   {
+      ierr = 1;
+   }
+   if (num_rows != y_size || num_rows != b_size)
+   {
+      ierr = 2;
+   }
+   if (num_cols != x_size && (num_rows != y_size || num_rows != b_size))
+   {
+      ierr = 3;
+   }
+
+   if (alpha == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         y_data[i] = beta * b_data[i];
+      }
+
+      return ierr;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   hypre_CSRMatrixSetupSELL(A);
+
+   sell       = hypre_CSRMatrixSell(A);
+   num_chunks = hypre_CSRMatrixSELLNumChunks(sell);
+   chunk_ptr  = hypre_CSRMatrixSELLChunkPtr(sell);
+   chunk_len  = hypre_CSRMatrixSELLChunkLen(sell);
+   chunk_rows = hypre_CSRMatrixSELLChunkRows(sell);
+   row_perm   = hypre_CSRMatrixSELLRowPerm(sell);
+   S_col      = hypre_CSRMatrixSELLCol(sell);
+   S_data     = hypre_CSRMatrixSELLData(sell);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c, k, l, sum, col, data, perm) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      col  = S_col  + chunk_ptr[c];
+      data = S_data + chunk_ptr[c];
+      perm = row_perm + c * SELL_C;
+
+      for (l = 0; l < SELL_C; l++)
+      {
+         sum[l] = 0.0;
+      }
+
+      /* one column of the chunk at a time: unit stride in col and data */
+      for (k = 0; k < chunk_len[c]; k++)
+      {
+         for (l = 0; l < SELL_C; l++)
+         {
+            sum[l] += data[l] * x_data[col[l]];
+         }
+         col  += SELL_C;
+         data += SELL_C;
+      }
+
+      /* empty rows only met padding entries */
+      for (l = chunk_rows[c]; l < SELL_C; l++)
+      {
+         sum[l] = 0.0;
+      }
+
+      if (beta == 0.0)
+      {
+         for (l = 0; l < SELL_C; l++)
+         {
+            if (perm[l] >= 0)
+            {
+               y_data[perm[l]] = alpha * sum[l];
+            }
+         }
+      }
+      else
+      {
+         for (l = 0; l < SELL_C; l++)
+         {
+            if (perm[l] >= 0)
+            {
+               y_data[perm[l]] = alpha * sum[l] + beta * b_data[perm[l]];
+            }
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSELLHost
+ *
+ * y = alpha*A^T*x + beta*y using the SELL copy of A (single vector)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSELLHost( HYPRE_Complex    alpha,
+                                hypre_CSRMatrix *A,
+                                hypre_Vector    *x,
+                                HYPRE_Complex    beta,
+                                hypre_Vector    *y )
+{
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+   HYPRE_Int         x_size = hypre_VectorSize(x);
+   HYPRE_Int         y_size = hypre_VectorSize(y);
+
+   hypre_CSRMatrixSELL *sell;
+   HYPRE_Int         num_chunks;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *chunk_rows, *row_perm, *S_col;
+   HYPRE_Complex    *S_data;
+
+   HYPRE_Complex     xl[SELL_C];
+   HYPRE_Complex    *y_data_expand = NULL, *y_t;
+   HYPRE_Int        *col, *perm;
+   HYPRE_Complex    *data;
+   HYPRE_Int         num_threads, my_thread_num;
+   HYPRE_Int         i, j, c, k, l, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   /* see hypre_CSRMatrixMatvecTHost for the meaning of ierr */
+   if (num_rows != x_size)
+   {
+      ierr = 1;
+   }
+   if (num_cols != y_size)
+   {
+      ierr = 2;
+   }
+   if (num_rows != x_size && num_cols != y_size)
+   {
+      ierr = 3;
+   }
+
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols; i++)
+      {
+         y_data[i] = (beta == 0.0) ? 0.0 : beta * y_data[i];
+      }
+   }
+
+   if (alpha == 0.0)
+   {
+      return ierr;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   hypre_CSRMatrixSetupSELL(A);
+
+   sell       = hypre_CSRMatrixSell(A);
+   num_chunks = hypre_CSRMatrixSELLNumChunks(sell);
+   chunk_ptr  = hypre_CSRMatrixSELLChunkPtr(sell);
+   chunk_len  = hypre_CSRMatrixSELLChunkLen(sell);
+   chunk_rows = hypre_CSRMatrixSELLChunkRows(sell);
+   row_perm   = hypre_CSRMatrixSELLRowPerm(sell);
+   S_col      = hypre_CSRMatrixSELLCol(sell);
+   S_data     = hypre_CSRMatrixSELLData(sell);
+
+   num_threads = hypre_NumThreads();
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads * num_cols, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j, c, k, l, xl, col, data, perm, y_t, my_thread_num)
+#endif
+   {
+      my_thread_num = hypre_GetThreadNum();
+      y_t = (num_threads > 1) ? y_data_expand + my_thread_num * num_cols : y_data;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (c = 0; c < num_chunks; c++)
+      {
+         col  = S_col  + chunk_ptr[c];
+         data = S_data + chunk_ptr[c];
+         perm = row_perm + c * SELL_C;
+
+         for (l = 0; l < SELL_C; l++)
+         {
+            xl[l] = (l < chunk_rows[c]) ? alpha * x_data[perm[l]] : 0.0;
+         }
+
+         for (k = 0; k < chunk_len[c]; k++)
+         {
+            for (l = 0; l < SELL_C; l++)
+            {
+               y_t[col[l]] += data[l] * xl[l];
+            }
+            col  += SELL_C;
+            data += SELL_C;
+         }
+      }
+
+      if (num_threads > 1)
+      {
+         /* implied barrier */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_cols; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j * num_cols + i];
+            }
+         }
+      }
+   } /* end parallel threaded region */
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+#undef SELL_C
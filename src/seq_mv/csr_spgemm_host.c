@@ -0,0 +1,606 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Host sparse matrix-matrix multiplication C = A*B.
+ *
+ * The rows of A are distributed to the threads by the number of products
+ * (an upper bound of the row length of C) instead of by the number of rows.
+ * Each row is accumulated in a small hash table that stays in cache if its
+ * upper bound is small compared to the number of columns of B, and in a
+ * dense marker array otherwise.  Both accumulators produce the columns of a
+ * row of C in the order of their first appearance with the diagonal first
+ * for square products, and add the products in the same order, so the
+ * result does not depend on the accumulator or the number of threads.
+ *
+ * The product can be split into a symbolic phase, which computes the
+ * sparsity pattern of C, and a numeric phase, which computes its values
+ * for a given pattern.  The numeric phase alone can be repeated when the
+ * values, but not the patterns, of A and B change.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* maximum number of entries in a hash table */
+#define HYPRE_SPGEMM_HASH_SIZE_MAX 4096
+#define HYPRE_SPGEMM_HASH_SIZE_MIN 32
+
+/* phases of hypre_CSRMatrixMultiplyHostRows */
+#define HYPRE_SPGEMM_COUNT   0   /* row lengths of C */
+#define HYPRE_SPGEMM_FILL    1   /* column indices (and values) of C */
+#define HYPRE_SPGEMM_NUMERIC 2   /* values of C for a given pattern */
+
+/*--------------------------------------------------------------------------
+ * hypre_SpGemmHashSize
+ *
+ * Returns the size of the hash table for a row with at most row_bound
+ * entries, or 0 if the dense accumulator is to be used.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_SpGemmHashSize( HYPRE_Int row_bound,
+                      HYPRE_Int ncols_B )
+{
+   HYPRE_Int size = HYPRE_SPGEMM_HASH_SIZE_MIN;
+
+   /* the dense marker array fits in cache as well */
+   if (ncols_B <= HYPRE_SPGEMM_HASH_SIZE_MAX)
+   {
+      return 0;
+   }
+
+   while (size < 2*row_bound)
+   {
+      size *= 2;
+   }
+
+   return (size <= HYPRE_SPGEMM_HASH_SIZE_MAX) ? size : 0;
+}
+
+static inline HYPRE_Int
+hypre_SpGemmHash( HYPRE_Int key,
+                  HYPRE_Int mask )
+{
+   return (HYPRE_Int) (((unsigned int) key * 2654435761u) & (unsigned int) mask);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostRows
+ *
+ * Processes rows ns to ne-1 of C = A*B in the given phase.  For
+ * HYPRE_SPGEMM_COUNT, the length of row i of C is returned in C_i[i+1].
+ * For HYPRE_SPGEMM_FILL, C_i must be complete and C_j (and C_data if not
+ * NULL) are filled.  For HYPRE_SPGEMM_NUMERIC, C_i and C_j must be complete
+ * and C_data is filled.  marker (of size ncols_B, initialized to -1) is
+ * only needed if a row uses the dense accumulator, hash_keys and hash_pos
+ * must have at least HYPRE_SPGEMM_HASH_SIZE_MAX entries.  Returns the number
+ * of products of B not found in the pattern of C (NUMERIC phase).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMultiplyHostRows( HYPRE_Int      phase,
+                                 HYPRE_Int      ns,
+                                 HYPRE_Int      ne,
+                                 HYPRE_Int     *A_i,
+                                 HYPRE_Int     *A_j,
+                                 HYPRE_Complex *A_data,
+                                 HYPRE_Int     *B_i,
+                                 HYPRE_Int     *B_j,
+                                 HYPRE_Complex *B_data,
+                                 HYPRE_Int      ncols_B,
+                                 HYPRE_Int      allsquare,
+                                 HYPRE_Int     *row_bound,
+                                 HYPRE_Int     *C_i,
+                                 HYPRE_Int     *C_j,
+                                 HYPRE_Complex *C_data,
+                                 HYPRE_Int     *marker,
+                                 HYPRE_Int     *hash_keys,
+                                 HYPRE_Int     *hash_pos )
+{
+   HYPRE_Int      ic, ia, ib, ja, jb, k, h;
+   HYPRE_Int      hash_size, mask, pos, row_start, p;
+   HYPRE_Int      num_missing = 0;
+   HYPRE_Complex  a_entry;
+
+   /* positions only need to increase from row to row */
+   pos = (phase == HYPRE_SPGEMM_COUNT) ? 0 : C_i[ns];
+
+   for (ic = ns; ic < ne; ic++)
+   {
+      hash_size = hypre_SpGemmHashSize(row_bound[ic], ncols_B);
+      mask = hash_size - 1;
+      for (h = 0; h < hash_size; h++)
+      {
+         hash_keys[h] = -1;
+      }
+
+      row_start = pos;
+
+      /* the given pattern, or the diagonal first for square products */
+      if (phase == HYPRE_SPGEMM_NUMERIC)
+      {
+         for (k = C_i[ic]; k < C_i[ic+1]; k++)
+         {
+            jb = C_j[k];
+            if (hash_size)
+            {
+               h = hypre_SpGemmHash(jb, mask);
+               while (hash_keys[h] != -1 && hash_keys[h] != jb)
+               {
+                  h = (h + 1) & mask;
+               }
+               hash_keys[h] = jb;
+               hash_pos[h]  = k;
+            }
+            else
+            {
+               marker[jb] = k;
+            }
+            C_data[k] = 0.0;
+         }
+         pos = C_i[ic+1];
+      }
+      else if (allsquare)
+      {
+         if (hash_size)
+         {
+            h = hypre_SpGemmHash(ic, mask);
+            hash_keys[h] = ic;
+            hash_pos[h]  = pos;
+         }
+         else
+         {
+            marker[ic] = pos;
+         }
+         if (phase == HYPRE_SPGEMM_FILL)
+         {
+            C_j[pos] = ic;
+            if (C_data)
+            {
+               C_data[pos] = 0.0;
+            }
+         }
+         pos++;
+      }
+
+      for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+      {
+         ja = A_j[ia];
+         a_entry = A_data ? A_data[ia] : 0.0;
+         for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+         {
+            jb = B_j[ib];
+
+            /* look up jb, p < 0 if it is new in this row */
+            if (hash_size)
+            {
+               h = hypre_SpGemmHash(jb, mask);
+               while (hash_keys[h] != -1 && hash_keys[h] != jb)
+               {
+                  h = (h + 1) & mask;
+               }
+               p = (hash_keys[h] == jb) ? hash_pos[h] : -1;
+            }
+            else
+            {
+               p = (marker[jb] < row_start) ? -1 : marker[jb];
+            }
+
+            if (p < 0)
+            {
+               if (phase == HYPRE_SPGEMM_NUMERIC)
+               {
+                  num_missing++;
+                  continue;
+               }
+               p = pos++;
+               if (hash_size)
+               {
+                  hash_keys[h] = jb;
+                  hash_pos[h]  = p;
+               }
+               else
+               {
+                  marker[jb] = p;
+               }
+               if (phase == HYPRE_SPGEMM_FILL)
+               {
+                  C_j[p] = jb;
+                  if (C_data)
+                  {
+                     C_data[p] = a_entry*B_data[ib];
+                  }
+               }
+            }
+            else if (C_data)
+            {
+               C_data[p] += a_entry*B_data[ib];
+            }
+         }
+      }
+
+      if (phase == HYPRE_SPGEMM_COUNT)
+      {
+         C_i[ic+1] = pos - row_start;
+      }
+   }
+
+   return num_missing;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SplitRowsByWork
+ *
+ * Splits nrows rows into num_parts ranges of consecutive rows with about the
+ * same work: part p takes rows part[p] to part[p+1]-1.  work[i] is the work
+ * of rows 0 to i-1 (work has nrows+1 entries).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SplitRowsByWork( HYPRE_Int  nrows,
+                       HYPRE_Int *work,
+                       HYPRE_Int  num_parts,
+                       HYPRE_Int *part )
+{
+   HYPRE_Int  p;
+
+   part[0] = 0;
+   for (p = 1; p < num_parts; p++)
+   {
+      part[p] = (HYPRE_Int) (hypre_LowerBound(work, work + nrows + 1,
+                                              (HYPRE_Int) (((HYPRE_Real) work[nrows]*p)/num_parts)) - work);
+      part[p] = hypre_max(part[p-1], hypre_min(part[p], nrows));
+   }
+   part[num_parts] = nrows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostPartition
+ *
+ * Computes the number of products of every row of A*B in row_bound and
+ * splits the rows into num_threads ranges with about the same number of
+ * products: thread t takes rows part[t] to part[t+1]-1.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMultiplyHostPartition( hypre_CSRMatrix *A,
+                                      hypre_CSRMatrix *B,
+                                      HYPRE_Int        allsquare,
+                                      HYPRE_Int        num_threads,
+                                      HYPRE_Int       *row_bound,
+                                      HYPRE_Int       *part )
+{
+   HYPRE_Int   *A_i     = hypre_CSRMatrixI(A);
+   HYPRE_Int   *A_j     = hypre_CSRMatrixJ(A);
+   HYPRE_Int    nrows_A = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int   *B_i     = hypre_CSRMatrixI(B);
+   HYPRE_Int   *work;
+   HYPRE_Int    i, ia;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, ia) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nrows_A; i++)
+   {
+      row_bound[i] = allsquare;
+      for (ia = A_i[i]; ia < A_i[i+1]; ia++)
+      {
+         row_bound[i] += B_i[A_j[ia]+1] - B_i[A_j[ia]];
+      }
+   }
+
+   /* work[i] is the number of products in rows 0 to i-1 */
+   work = hypre_TAlloc(HYPRE_Int, nrows_A+1, HYPRE_MEMORY_HOST);
+   work[0] = 0;
+   for (i = 0; i < nrows_A; i++)
+   {
+      work[i+1] = work[i] + row_bound[i] + 1;
+   }
+
+   hypre_SplitRowsByWork(nrows_A, work, num_threads, part);
+
+   hypre_TFree(work, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostCore
+ *
+ * Computes the pattern of C = A*B, and its values if compute_values is set.
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix *
+hypre_CSRMatrixMultiplyHostCore( hypre_CSRMatrix *A,
+                                 hypre_CSRMatrix *B,
+                                 HYPRE_Int        compute_values )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         nrows_A  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         ncols_A  = hypre_CSRMatrixNumCols(A);
+   HYPRE_Complex    *B_data   = hypre_CSRMatrixData(B);
+   HYPRE_Int        *B_i      = hypre_CSRMatrixI(B);
+   HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
+   HYPRE_Int         nrows_B  = hypre_CSRMatrixNumRows(B);
+   HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
+   hypre_CSRMatrix  *C;
+   HYPRE_Complex    *C_data = NULL;
+   HYPRE_Int        *C_i;
+   HYPRE_Int        *C_j = NULL;
+
+   HYPRE_Int         allsquare = 0;
+   HYPRE_Int         num_threads;
+   HYPRE_Int        *row_bound, *part, *thread_nnz;
+
+   /* RL: in the case of A=H, B=D, or A=D, B=H, let C = D,
+    * not sure if this is the right thing to do.
+    * Also, need something like this in other places
+    * TODO */
+   HYPRE_MemoryLocation memory_location_C = hypre_max(hypre_CSRMatrixMemoryLocation(A),
+                                                      hypre_CSRMatrixMemoryLocation(B));
+
+   if (ncols_A != nrows_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Warning! incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   if (nrows_A == ncols_B)
+   {
+      allsquare = 1;
+   }
+
+   C_i = hypre_CTAlloc(HYPRE_Int, nrows_A+1, memory_location_C);
+
+   num_threads = hypre_NumThreads();
+   row_bound = hypre_TAlloc(HYPRE_Int, nrows_A, HYPRE_MEMORY_HOST);
+   part = hypre_TAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+   thread_nnz = hypre_TAlloc(HYPRE_Int, num_threads, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMultiplyHostPartition(A, B, allsquare, num_threads, row_bound, part);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+   {
+      HYPRE_Int  ii = hypre_GetThreadNum();
+      HYPRE_Int  ns = part[ii];
+      HYPRE_Int  ne = part[ii+1];
+      HYPRE_Int *marker = NULL;
+      HYPRE_Int *hash_keys, *hash_pos;
+      HYPRE_Int  i, offset;
+
+      hash_keys = hypre_TAlloc(HYPRE_Int, HYPRE_SPGEMM_HASH_SIZE_MAX, HYPRE_MEMORY_HOST);
+      hash_pos  = hypre_TAlloc(HYPRE_Int, HYPRE_SPGEMM_HASH_SIZE_MAX, HYPRE_MEMORY_HOST);
+      for (i = ns; i < ne; i++)
+      {
+         if (!hypre_SpGemmHashSize(row_bound[i], ncols_B))
+         {
+            marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+            break;
+         }
+      }
+
+      /*-----------------------------------------------------------------
+       * Row lengths of C
+       *-----------------------------------------------------------------*/
+
+      if (marker)
+      {
+         for (i = 0; i < ncols_B; i++)
+         {
+            marker[i] = -1;
+         }
+      }
+      hypre_CSRMatrixMultiplyHostRows(HYPRE_SPGEMM_COUNT, ns, ne, A_i, A_j, NULL,
+                                      B_i, B_j, NULL, ncols_B, allsquare, row_bound,
+                                      C_i, NULL, NULL, marker, hash_keys, hash_pos);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      /* the rows of a thread are contiguous */
+      offset = 0;
+      for (i = ns; i < ne; i++)
+      {
+         offset += C_i[i+1];
+      }
+      thread_nnz[ii] = offset;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      offset = 0;
+      for (i = 0; i < ii; i++)
+      {
+         offset += thread_nnz[i];
+      }
+      for (i = ns; i < ne; i++)
+      {
+         offset += C_i[i+1];
+         C_i[i+1] = offset;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      if (ii == 0)
+      {
+         C = hypre_CSRMatrixCreate(nrows_A, ncols_B, C_i[nrows_A]);
+         hypre_CSRMatrixI(C) = C_i;
+         hypre_CSRMatrixInitialize_v2(C, 0, memory_location_C);
+         C_j = hypre_CSRMatrixJ(C);
+         C_data = compute_values ? hypre_CSRMatrixData(C) : NULL;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp barrier
+#endif
+
+      /*-----------------------------------------------------------------
+       * Column indices and values of C
+       *-----------------------------------------------------------------*/
+
+      if (marker)
+      {
+         for (i = 0; i < ncols_B; i++)
+         {
+            marker[i] = -1;
+         }
+      }
+      hypre_CSRMatrixMultiplyHostRows(HYPRE_SPGEMM_FILL, ns, ne, A_i, A_j, A_data,
+                                      B_i, B_j, B_data, ncols_B, allsquare, row_bound,
+                                      C_i, C_j, C_data, marker, hash_keys, hash_pos);
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_pos, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   hypre_TFree(row_bound, HYPRE_MEMORY_HOST);
+   hypre_TFree(part, HYPRE_MEMORY_HOST);
+   hypre_TFree(thread_nnz, HYPRE_MEMORY_HOST);
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHost
+ * multiplies two CSR Matrices A and B and returns a CSR Matrix C;
+ * Note: The routine does not check for 0-elements which might be generated
+ *       through cancellation of elements in A and B or already contained
+ in A and B. To remove those, use hypre_CSRMatrixDeleteZeros
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
+                             hypre_CSRMatrix *B )
+{
+   return hypre_CSRMatrixMultiplyHostCore(A, B, 1);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostSymbolic
+ * returns a CSR Matrix C with the sparsity pattern of A*B (the same as the
+ * one returned by hypre_CSRMatrixMultiplyHost) and zero values.  The values
+ * are computed with hypre_CSRMatrixMultiplyHostNumeric.
+ *--------------------------------------------------------------------------*/
+
+hypre_CSRMatrix*
+hypre_CSRMatrixMultiplyHostSymbolic( hypre_CSRMatrix *A,
+                                     hypre_CSRMatrix *B )
+{
+   return hypre_CSRMatrixMultiplyHostCore(A, B, 0);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyHostNumeric
+ * computes the values of C = A*B, where C has the sparsity pattern computed
+ * by hypre_CSRMatrixMultiplyHostSymbolic for matrices with the same
+ * patterns as A and B.  Products outside of the pattern of C are an error.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMultiplyHostNumeric( hypre_CSRMatrix *A,
+                                    hypre_CSRMatrix *B,
+                                    hypre_CSRMatrix *C )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         nrows_A  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Complex    *B_data   = hypre_CSRMatrixData(B);
+   HYPRE_Int        *B_i      = hypre_CSRMatrixI(B);
+   HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
+   HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
+   HYPRE_Complex    *C_data   = hypre_CSRMatrixData(C);
+   HYPRE_Int        *C_i      = hypre_CSRMatrixI(C);
+   HYPRE_Int        *C_j      = hypre_CSRMatrixJ(C);
+
+   HYPRE_Int         num_threads, i;
+   HYPRE_Int         num_missing = 0;
+   HYPRE_Int        *row_bound, *part;
+
+   if (hypre_CSRMatrixNumCols(A) != hypre_CSRMatrixNumRows(B) ||
+       hypre_CSRMatrixNumRows(C) != nrows_A ||
+       hypre_CSRMatrixNumCols(C) != ncols_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Warning! incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   num_threads = hypre_NumThreads();
+   row_bound = hypre_TAlloc(HYPRE_Int, nrows_A, HYPRE_MEMORY_HOST);
+   part = hypre_TAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMultiplyHostPartition(A, B, nrows_A == ncols_B, num_threads,
+                                        row_bound, part);
+
+   /* the hash tables also hold the entries of C that are not products */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nrows_A; i++)
+   {
+      row_bound[i] = hypre_max(row_bound[i], C_i[i+1] - C_i[i]);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel num_threads(num_threads) reduction(+:num_missing)
+#endif
+   {
+      HYPRE_Int  ii = hypre_GetThreadNum();
+      HYPRE_Int  ns = part[ii];
+      HYPRE_Int  ne = part[ii+1];
+      HYPRE_Int *marker = NULL;
+      HYPRE_Int *hash_keys, *hash_pos;
+      HYPRE_Int  j;
+
+      hash_keys = hypre_TAlloc(HYPRE_Int, HYPRE_SPGEMM_HASH_SIZE_MAX, HYPRE_MEMORY_HOST);
+      hash_pos  = hypre_TAlloc(HYPRE_Int, HYPRE_SPGEMM_HASH_SIZE_MAX, HYPRE_MEMORY_HOST);
+      for (j = ns; j < ne; j++)
+      {
+         if (!hypre_SpGemmHashSize(row_bound[j], ncols_B))
+         {
+            marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+            for (j = 0; j < ncols_B; j++)
+            {
+               marker[j] = -1;
+            }
+            break;
+         }
+      }
+
+      num_missing += hypre_CSRMatrixMultiplyHostRows(HYPRE_SPGEMM_NUMERIC, ns, ne,
+                                                     A_i, A_j, A_data,
+                                                     B_i, B_j, B_data, ncols_B, 0, row_bound,
+                                                     C_i, C_j, C_data, marker,
+                                                     hash_keys, hash_pos);
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_pos, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   hypre_TFree(row_bound, HYPRE_MEMORY_HOST);
+   hypre_TFree(part, HYPRE_MEMORY_HOST);
+
+   if (num_missing)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Sparsity pattern of A*B is not contained in the one of C!\n");
+   }
+
+   return hypre_error_flag;
+}
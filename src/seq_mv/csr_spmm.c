@@ -0,0 +1,297 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Sparse matrix times multivector (SpMM) functions for hypre_CSRMatrix class.
+ *
+ * The kernels work on multivectors stored row-wise (multivec_storage_method
+ * 1, see vector.h): the num_vectors values of a row are next to each other,
+ * so each nonzero of the matrix is loaded once and applied to all vectors.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/* number of vectors handled in one pass over a row */
+#define SPMM_NV 32
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorIsRowwise
+ *
+ * Returns 1 if v is a multivector whose values are stored row-wise.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SeqVectorIsRowwise( hypre_Vector *v )
+{
+   HYPRE_Int num_vectors = hypre_VectorNumVectors(v);
+
+   return ( num_vectors > 1 &&
+            hypre_VectorVectorStride(v) == 1 &&
+            hypre_VectorIndexStride(v) == num_vectors );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecUseSpMM
+ *
+ * Returns 1 if the product of A with x (result in y) should go through the
+ * SpMM kernels below.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecUseSpMM( hypre_Vector *x,
+                              hypre_Vector *y,
+                              HYPRE_Int     offset )
+{
+   return ( offset == 0 &&
+            hypre_SeqVectorIsRowwise(x) &&
+            hypre_SeqVectorIsRowwise(y) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMHost
+ *
+ * y = alpha*A*x + beta*b for row-wise multivectors x, b and y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSpMMHost( HYPRE_Complex    alpha,
+                         hypre_CSRMatrix *A,
+                         hypre_Vector    *x,
+                         HYPRE_Complex    beta,
+                         hypre_Vector    *b,
+                         hypre_Vector    *y )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *b_data = hypre_VectorData(b);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+
+   HYPRE_Complex     tmp[SPMM_NV];
+   HYPRE_Complex     a_ij, *xj, *yi, *bi;
+   HYPRE_Int         i, jj, jv, jv0, nv, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+   hypre_assert( num_vectors == hypre_VectorNumVectors(b) );
+
+   if (num_cols != hypre_VectorSize(x))
+      ierr = 1;
+
+   if (num_rows != hypre_VectorSize(y) || num_rows != hypre_VectorSize(b))
+      ierr = 2;
+
+   if (num_cols != hypre_VectorSize(x) &&
+       (num_rows != hypre_VectorSize(y) || num_rows != hypre_VectorSize(b)))
+      ierr = 3;
+
+   if (alpha == 0.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows*num_vectors; i++)
+         y_data[i] = beta*b_data[i];
+
+      return ierr;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,jv,jv0,nv,tmp,a_ij,xj,yi,bi) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      yi = y_data + i*num_vectors;
+      bi = b_data + i*num_vectors;
+
+      for (jv0 = 0; jv0 < num_vectors; jv0 += SPMM_NV)
+      {
+         nv = hypre_min(SPMM_NV, num_vectors - jv0);
+
+         for (jv = 0; jv < nv; jv++)
+         {
+            tmp[jv] = 0.0;
+         }
+
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            a_ij = A_data[jj];
+            xj   = x_data + A_j[jj]*num_vectors + jv0;
+            for (jv = 0; jv < nv; jv++)
+            {
+               tmp[jv] += a_ij * xj[jv];
+            }
+         }
+
+         if (beta == 0.0)
+         {
+            for (jv = 0; jv < nv; jv++)
+            {
+               yi[jv0 + jv] = alpha*tmp[jv];
+            }
+         }
+         else
+         {
+            for (jv = 0; jv < nv; jv++)
+            {
+               yi[jv0 + jv] = alpha*tmp[jv] + beta*bi[jv0 + jv];
+            }
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSpMMTHost
+ *
+ * y = alpha*A^T*x + beta*y for row-wise multivectors x and y.  With more
+ * than one thread, each thread accumulates into its own copy of y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSpMMTHost( HYPRE_Complex    alpha,
+                          hypre_CSRMatrix *A,
+                          hypre_Vector    *x,
+                          HYPRE_Complex    beta,
+                          hypre_Vector    *y )
+{
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         y_len = num_cols*num_vectors;
+
+   HYPRE_Complex    *y_data_expand, *yt;
+   HYPRE_Complex     tmp[SPMM_NV];
+   HYPRE_Complex     a_ij, *xi, *yj;
+   HYPRE_Int         i, j, jj, jv, jv0, nv, my_thread_num, num_threads;
+   HYPRE_Int         ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   if (num_rows != hypre_VectorSize(x))
+      ierr = 1;
+
+   if (num_cols != hypre_VectorSize(y))
+      ierr = 2;
+
+   if (num_rows != hypre_VectorSize(x) && num_cols != hypre_VectorSize(y))
+      ierr = 3;
+
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_len; i++)
+         y_data[i] = (beta == 0.0) ? 0.0 : beta*y_data[i];
+   }
+
+   if (alpha == 0.0)
+   {
+      return ierr;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   num_threads = hypre_NumThreads();
+   y_data_expand = NULL;
+   if (num_threads > 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_len, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j,jj,jv,jv0,nv,tmp,a_ij,xi,yj,yt,my_thread_num)
+#endif
+   {
+      my_thread_num = hypre_GetThreadNum();
+      yt = y_data_expand ? y_data_expand + my_thread_num*y_len : y_data;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         xi = x_data + i*num_vectors;
+
+         for (jv0 = 0; jv0 < num_vectors; jv0 += SPMM_NV)
+         {
+            nv = hypre_min(SPMM_NV, num_vectors - jv0);
+
+            for (jv = 0; jv < nv; jv++)
+            {
+               tmp[jv] = alpha*xi[jv0 + jv];
+            }
+
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               a_ij = A_data[jj];
+               yj   = yt + A_j[jj]*num_vectors + jv0;
+               for (jv = 0; jv < nv; jv++)
+               {
+                  yj[jv] += a_ij * tmp[jv];
+               }
+            }
+         }
+      }
+
+      if (y_data_expand)
+      {
+         /* implied barrier */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_len; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j*y_len + i];
+            }
+         }
+      }
+   }
+
+   hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
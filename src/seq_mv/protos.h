@@ -9,7 +9,6 @@
 hypre_CSRMatrix *hypre_CSRMatrixAddHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
-hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A , HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A , hypre_CSRMatrix **AT , HYPRE_Int data );
@@ -73,6 +72,34 @@ HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hyp
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y , HYPRE_Int *CF_marker_x , HYPRE_Int *CF_marker_y , HYPRE_Int fpt );
 
+/* csr_spgemm_host.c */
+HYPRE_Int hypre_SplitRowsByWork ( HYPRE_Int nrows , HYPRE_Int *work , HYPRE_Int num_parts , HYPRE_Int *part );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHostSymbolic ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
+HYPRE_Int hypre_CSRMatrixMultiplyHostNumeric ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , hypre_CSRMatrix *C );
+
+/* csr_matvec_sell.c */
+hypre_CSRMatrixSELL *hypre_CSRMatrixSELLCreate( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSELLFill( hypre_CSRMatrixSELL *sell, hypre_CSRMatrix *A, HYPRE_Int fill_col );
+HYPRE_Int hypre_CSRMatrixSELLDestroy( hypre_CSRMatrixSELL *sell );
+HYPRE_Int hypre_CSRMatrixSetupSELL( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSELLInvalidate( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSELLUpdateValues( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecUseSELL( hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecSELLHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSELLHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_spmm.c */
+HYPRE_Int hypre_CSRMatrixMatvecUseSpMM( hypre_Vector *x, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixSpMMHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixSpMMTHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_matvec_flt.c */
+HYPRE_Int hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixConvertToDouble( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecFltHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTFltHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 HYPRE_Int hypre_CSRMatrixMatvecMaskedDevice(HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int *mask, HYPRE_Int size_of_mask);
@@ -153,6 +180,7 @@ HYPRE_Int hypre_SeqVectorDestroy ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorInitialize_v2( hypre_Vector *vector, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_SeqVectorInitialize ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorSetDataOwner ( hypre_Vector *vector , HYPRE_Int owns_data );
+HYPRE_Int hypre_SeqVectorSetMultiVecStorageMethod( hypre_Vector *vector, HYPRE_Int method );
 hypre_Vector *hypre_SeqVectorRead ( char *file_name );
 HYPRE_Int hypre_SeqVectorPrint ( hypre_Vector *vector , char *file_name );
 HYPRE_Int hypre_SeqVectorSetConstantValues ( hypre_Vector *v , HYPRE_Complex value );
@@ -165,6 +193,10 @@ HYPRE_Int hypre_SeqVectorScale( HYPRE_Complex alpha, hypre_Vector *y );
 
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x , hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorInnerProdMulti( hypre_Vector *x, hypre_Vector *y, HYPRE_Real *result );
+HYPRE_Real hypre_SeqVectorAxpyInnerProd ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y , hypre_Vector *z );
+HYPRE_Int hypre_SeqVectorInnerProd2 ( hypre_Vector *x , hypre_Vector *y , hypre_Vector *z , HYPRE_Real *result );
+HYPRE_Int hypre_SeqVectorAxpby ( HYPRE_Complex alpha , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd8(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
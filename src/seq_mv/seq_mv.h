@@ -36,6 +36,59 @@ extern "C" {
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) shadow of a CSR Matrix
+ *
+ * Rows are sorted by length within windows of sigma rows and grouped in
+ * chunks of C rows.  Each chunk is stored column-major and padded to the
+ * length of its longest row, so that the matvec inner loop runs over the C
+ * rows of a chunk with unit stride.
+ *--------------------------------------------------------------------------*/
+
+/* Number of rows per chunk; fixed at compile time so that the chunk loops
+ * can be vectorized */
+#ifndef HYPRE_SELL_CHUNK_SIZE
+#define HYPRE_SELL_CHUNK_SIZE 8
+#endif
+
+/* Default sorting window */
+#define HYPRE_SELL_SIGMA      256
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      num_cols;
+   HYPRE_Int      sigma;
+   HYPRE_Int      num_chunks;
+   HYPRE_Int      num_stored;   /* number of stored entries, padding included */
+
+   HYPRE_Int     *chunk_ptr;    /* start of each chunk in col/data */
+   HYPRE_Int     *chunk_len;    /* width (longest row) of each chunk */
+   HYPRE_Int     *chunk_rows;   /* number of non-empty rows of each chunk */
+   HYPRE_Int     *row_perm;     /* original row of each slot, -1 for padding */
+   HYPRE_Int     *col;
+   HYPRE_Complex *data;
+
+   /* CSR arrays the shadow was built from, used to detect a stale shadow */
+   HYPRE_Int     *csr_i;
+   HYPRE_Int     *csr_j;
+   HYPRE_Complex *csr_data;
+   HYPRE_Int      csr_num_nonzeros;
+
+} hypre_CSRMatrixSELL;
+
+#define hypre_CSRMatrixSELLNumRows(sell)      ((sell) -> num_rows)
+#define hypre_CSRMatrixSELLNumCols(sell)      ((sell) -> num_cols)
+#define hypre_CSRMatrixSELLSigma(sell)        ((sell) -> sigma)
+#define hypre_CSRMatrixSELLNumChunks(sell)    ((sell) -> num_chunks)
+#define hypre_CSRMatrixSELLNumStored(sell)    ((sell) -> num_stored)
+#define hypre_CSRMatrixSELLChunkPtr(sell)     ((sell) -> chunk_ptr)
+#define hypre_CSRMatrixSELLChunkLen(sell)     ((sell) -> chunk_len)
+#define hypre_CSRMatrixSELLChunkRows(sell)    ((sell) -> chunk_rows)
+#define hypre_CSRMatrixSELLRowPerm(sell)      ((sell) -> row_perm)
+#define hypre_CSRMatrixSELLCol(sell)          ((sell) -> col)
+#define hypre_CSRMatrixSELLData(sell)         ((sell) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -56,6 +109,10 @@ typedef struct
 
    HYPRE_Complex *data;
 
+   /* single precision values, used instead of `data' (which is then NULL)
+    * after hypre_CSRMatrixConvertToFloat */
+   hypre_float   *data_flt;
+
    /* for compressing rows in matrix multiplication  */
    HYPRE_Int     *rownnz;
    HYPRE_Int      num_rownnz;
@@ -63,6 +120,13 @@ typedef struct
    /* memory location of arrays i, j, data */
    HYPRE_MemoryLocation      memory_location;
 
+   /* SELL-C-sigma copy used by the host matvec (built on demand).
+    * hypre_CSRMatrixSetupSELL only detects replaced arrays: every routine
+    * that changes the values of the matrix in place has to update the copy
+    * with hypre_CSRMatrixSELLUpdateValues or drop it with
+    * hypre_CSRMatrixSELLInvalidate */
+   hypre_CSRMatrixSELL      *sell;
+
 } hypre_CSRMatrix;
 
 /*--------------------------------------------------------------------------
@@ -70,6 +134,7 @@ typedef struct
  *--------------------------------------------------------------------------*/
 
 #define hypre_CSRMatrixData(matrix)           ((matrix) -> data)
+#define hypre_CSRMatrixDataFlt(matrix)        ((matrix) -> data_flt)
 #define hypre_CSRMatrixI(matrix)              ((matrix) -> i)
 #define hypre_CSRMatrixJ(matrix)              ((matrix) -> j)
 #define hypre_CSRMatrixBigJ(matrix)           ((matrix) -> big_j)
@@ -80,6 +145,7 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)      ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)       ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix) ((matrix) -> memory_location)
+#define hypre_CSRMatrixSell(matrix)           ((matrix) -> sell)
 
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
@@ -266,7 +332,6 @@ typedef struct
 hypre_CSRMatrix *hypre_CSRMatrixAddHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixBigAdd ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
-hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixMultiply ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
 hypre_CSRMatrix *hypre_CSRMatrixDeleteZeros ( hypre_CSRMatrix *A , HYPRE_Real tol );
 HYPRE_Int hypre_CSRMatrixTransposeHost ( hypre_CSRMatrix *A , hypre_CSRMatrix **AT , HYPRE_Int data );
@@ -330,6 +395,34 @@ HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hyp
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y , HYPRE_Int *CF_marker_x , HYPRE_Int *CF_marker_y , HYPRE_Int fpt );
 
+/* csr_spgemm_host.c */
+HYPRE_Int hypre_SplitRowsByWork ( HYPRE_Int nrows , HYPRE_Int *work , HYPRE_Int num_parts , HYPRE_Int *part );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHost ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
+hypre_CSRMatrix *hypre_CSRMatrixMultiplyHostSymbolic ( hypre_CSRMatrix *A , hypre_CSRMatrix *B );
+HYPRE_Int hypre_CSRMatrixMultiplyHostNumeric ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , hypre_CSRMatrix *C );
+
+/* csr_matvec_sell.c */
+hypre_CSRMatrixSELL *hypre_CSRMatrixSELLCreate( hypre_CSRMatrix *A, HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSELLFill( hypre_CSRMatrixSELL *sell, hypre_CSRMatrix *A, HYPRE_Int fill_col );
+HYPRE_Int hypre_CSRMatrixSELLDestroy( hypre_CSRMatrixSELL *sell );
+HYPRE_Int hypre_CSRMatrixSetupSELL( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSELLInvalidate( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSELLUpdateValues( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecUseSELL( hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecSELLHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixMatvecTSELLHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_spmm.c */
+HYPRE_Int hypre_CSRMatrixMatvecUseSpMM( hypre_Vector *x, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixSpMMHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y );
+HYPRE_Int hypre_CSRMatrixSpMMTHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
+/* csr_matvec_flt.c */
+HYPRE_Int hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixConvertToDouble( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecFltHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTFltHost( HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y );
+
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 HYPRE_Int hypre_CSRMatrixMatvecMaskedDevice(HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *b, hypre_Vector *y, HYPRE_Int *mask, HYPRE_Int size_of_mask);
@@ -410,6 +503,7 @@ HYPRE_Int hypre_SeqVectorDestroy ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorInitialize_v2( hypre_Vector *vector, HYPRE_MemoryLocation memory_location );
 HYPRE_Int hypre_SeqVectorInitialize ( hypre_Vector *vector );
 HYPRE_Int hypre_SeqVectorSetDataOwner ( hypre_Vector *vector , HYPRE_Int owns_data );
+HYPRE_Int hypre_SeqVectorSetMultiVecStorageMethod( hypre_Vector *vector, HYPRE_Int method );
 hypre_Vector *hypre_SeqVectorRead ( char *file_name );
 HYPRE_Int hypre_SeqVectorPrint ( hypre_Vector *vector , char *file_name );
 HYPRE_Int hypre_SeqVectorSetConstantValues ( hypre_Vector *v , HYPRE_Complex value );
@@ -422,6 +516,10 @@ HYPRE_Int hypre_SeqVectorScale( HYPRE_Complex alpha, hypre_Vector *y );
 
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x , hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorInnerProdMulti( hypre_Vector *x, hypre_Vector *y, HYPRE_Real *result );
+HYPRE_Real hypre_SeqVectorAxpyInnerProd ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y , hypre_Vector *z );
+HYPRE_Int hypre_SeqVectorInnerProd2 ( hypre_Vector *x , hypre_Vector *y , hypre_Vector *z , HYPRE_Real *result );
+HYPRE_Int hypre_SeqVectorAxpby ( HYPRE_Complex alpha , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd8(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
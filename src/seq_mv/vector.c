@@ -142,6 +142,43 @@ hypre_SeqVectorSetDataOwner( hypre_Vector *vector,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorSetMultiVecStorageMethod
+ * 0 stores the vectors one after the other (column-wise), 1 stores the
+ * values of each index next to each other (row-wise, see vector.h).
+ * If the vector has been initialized, the strides are updated; the data
+ * is not reordered.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorSetMultiVecStorageMethod( hypre_Vector *vector,
+                                         HYPRE_Int     method )
+{
+   if (method != 0 && method != 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_VectorMultiVecStorageMethod(vector) = method;
+
+   if (hypre_VectorData(vector))
+   {
+      if (method == 0)
+      {
+         hypre_VectorVectorStride(vector) = hypre_VectorSize(vector);
+         hypre_VectorIndexStride(vector) = 1;
+      }
+      else
+      {
+         hypre_VectorVectorStride(vector) = 1;
+         hypre_VectorIndexStride(vector) = hypre_VectorNumVectors(vector);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * ReadVector
  *--------------------------------------------------------------------------*/
@@ -607,6 +644,216 @@ hypre_SeqVectorInnerProd( hypre_Vector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdMulti
+ * result[j] = <x_j, y_j> for each vector j of the multivectors x and y
+ * (either storage method).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorInnerProdMulti( hypre_Vector *x,
+                               hypre_Vector *y,
+                               HYPRE_Real   *result )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int      idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int      vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int      idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Real     res;
+   HYPRE_Int      i, j;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      res = 0.0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) reduction(+:res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         res += hypre_conj(y_data[j*vecstride_y + i*idxstride_y]) *
+                x_data[j*vecstride_x + i*idxstride_x];
+      }
+      result[j] = res;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpyInnerProd
+ * y = y + alpha*x, and returns <z, y> computed in the same pass over y
+ * (z may be y).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorAxpyInnerProd( HYPRE_Complex alpha,
+                              hypre_Vector *x,
+                              hypre_Vector *y,
+                              hypre_Vector *z )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_SeqVectorAxpy(alpha, x, y);
+
+   return hypre_SeqVectorInnerProd(z, y);
+#else
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Complex *z_data = hypre_VectorData(z);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+   HYPRE_Real     result = 0.0;
+   HYPRE_Int      i;
+
+   size *= hypre_VectorNumVectors(x);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] += alpha * x_data[i];
+      result += hypre_conj(y_data[i]) * z_data[i];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProd2
+ * result[0] = <x, y> and result[1] = <x, z> in one pass over x
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorInnerProd2( hypre_Vector *x,
+                           hypre_Vector *y,
+                           hypre_Vector *z,
+                           HYPRE_Real   *result )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   result[0] = hypre_SeqVectorInnerProd(x, y);
+   result[1] = hypre_SeqVectorInnerProd(x, z);
+#else
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Complex *z_data = hypre_VectorData(z);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+   HYPRE_Real     res0 = 0.0, res1 = 0.0;
+   HYPRE_Int      i;
+
+   size *= hypre_VectorNumVectors(x);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) reduction(+:res0,res1) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      res0 += hypre_conj(y_data[i]) * x_data[i];
+      res1 += hypre_conj(z_data[i]) * x_data[i];
+   }
+
+   result[0] = res0;
+   result[1] = res1;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpby
+ * y = alpha*x + beta*y (y is not read if beta is zero)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorAxpby( HYPRE_Complex alpha,
+                      hypre_Vector *x,
+                      HYPRE_Complex beta,
+                      hypre_Vector *y )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   if (beta == 0.0)
+   {
+      hypre_SeqVectorCopy(x, y);
+      hypre_SeqVectorScale(alpha, y);
+   }
+   else
+   {
+      hypre_SeqVectorScale(beta, y);
+      hypre_SeqVectorAxpy(alpha, x, y);
+   }
+#else
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+   HYPRE_Int      i;
+
+   size *= hypre_VectorNumVectors(x);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   if (beta == 0.0)
+   {
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         y_data[i] = alpha * x_data[i];
+      }
+   }
+   else
+   {
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < size; i++)
+      {
+         y_data[i] = alpha * x_data[i] + beta * y_data[i];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+#endif
+
+   return hypre_error_flag;
+}
+
 //TODO
 
 /*--------------------------------------------------------------------------
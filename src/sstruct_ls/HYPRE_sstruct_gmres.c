@@ -25,6 +25,9 @@ HYPRE_SStructGMRESCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   hypre_GMRESFunctionsSetFusedOps(
+      gmres_functions, hypre_SStructKrylovAxpyInnerProd,
+      hypre_SStructKrylovInnerProd2, hypre_SStructKrylovAxpby );
 
    *solver = ( (HYPRE_SStructSolver) hypre_GMRESCreate( gmres_functions ) );
 
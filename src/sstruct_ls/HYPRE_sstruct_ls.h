@@ -839,6 +839,91 @@ HYPRE_SStructDiagScale(HYPRE_SStructSolver solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name SStruct Pipelined PCG Solver
+ *
+ * These routines should be used in conjunction with the generic interface in
+ * \ref KrylovSolvers.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int
+HYPRE_SStructPipelinedPCGCreate(MPI_Comm             comm,
+                                HYPRE_SStructSolver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int
+HYPRE_SStructPipelinedPCGDestroy(HYPRE_SStructSolver solver);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetup(HYPRE_SStructSolver solver,
+                               HYPRE_SStructMatrix A,
+                               HYPRE_SStructVector b,
+                               HYPRE_SStructVector x);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSolve(HYPRE_SStructSolver solver,
+                               HYPRE_SStructMatrix A,
+                               HYPRE_SStructVector b,
+                               HYPRE_SStructVector x);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetTol(HYPRE_SStructSolver solver,
+                                HYPRE_Real          tol);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetAbsoluteTol(HYPRE_SStructSolver solver,
+                                        HYPRE_Real          tol);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetMaxIter(HYPRE_SStructSolver solver,
+                                    HYPRE_Int           max_iter);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetTwoNorm(HYPRE_SStructSolver solver,
+                                    HYPRE_Int           two_norm);
+
+/**
+ * (Optional) Replace the recurred residual and auxiliary vectors by their
+ * explicitly computed values every {\tt replace\_period} iterations.
+ **/
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetResidualReplacement(HYPRE_SStructSolver solver,
+                                                HYPRE_Int           replace_period);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetPrecond(HYPRE_SStructSolver          solver,
+                                    HYPRE_PtrToSStructSolverFcn  precond,
+                                    HYPRE_PtrToSStructSolverFcn  precond_setup,
+                                    void                        *precond_solver);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetLogging(HYPRE_SStructSolver solver,
+                                    HYPRE_Int           logging);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetPrintLevel(HYPRE_SStructSolver solver,
+                                       HYPRE_Int           level);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGGetNumIterations(HYPRE_SStructSolver  solver,
+                                          HYPRE_Int           *num_iterations);
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGGetFinalRelativeResidualNorm(HYPRE_SStructSolver  solver,
+                                                      HYPRE_Real          *norm);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -24,6 +24,9 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(
+      pcg_functions, hypre_SStructKrylovAxpyInnerProd,
+      hypre_SStructKrylovInnerProd2, hypre_SStructKrylovAxpby );
 
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
 
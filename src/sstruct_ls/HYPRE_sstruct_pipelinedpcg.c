@@ -0,0 +1,179 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_sstruct_ls.h"
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGCreate( MPI_Comm             comm,
+                                 HYPRE_SStructSolver *solver )
+{
+   hypre_PipelinedPCGFunctions * pcg_functions =
+      hypre_PipelinedPCGFunctionsCreate(
+         hypre_CAlloc, hypre_SStructKrylovFree, hypre_SStructKrylovCommInfo,
+         hypre_SStructKrylovCreateVector,
+         hypre_SStructKrylovDestroyVector, hypre_SStructKrylovMatvecCreate,
+         hypre_SStructKrylovMatvec, hypre_SStructKrylovMatvecDestroy,
+         hypre_SStructKrylovInnerProd, hypre_SStructKrylovInnerProdLocal,
+         hypre_SStructKrylovIAllreduce, hypre_SStructKrylovCopyVector,
+         hypre_SStructKrylovClearVector, hypre_SStructKrylovAxpy,
+         hypre_SStructKrylovAxpby,
+         hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
+
+   *solver = ( (HYPRE_SStructSolver) hypre_PipelinedPCGCreate( pcg_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGDestroy( HYPRE_SStructSolver solver )
+{
+   return( hypre_PipelinedPCGDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetup( HYPRE_SStructSolver solver,
+                                HYPRE_SStructMatrix A,
+                                HYPRE_SStructVector b,
+                                HYPRE_SStructVector x )
+{
+   return( HYPRE_PipelinedPCGSetup( (HYPRE_Solver) solver,
+                                    (HYPRE_Matrix) A,
+                                    (HYPRE_Vector) b,
+                                    (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSolve( HYPRE_SStructSolver solver,
+                                HYPRE_SStructMatrix A,
+                                HYPRE_SStructVector b,
+                                HYPRE_SStructVector x )
+{
+   return( HYPRE_PipelinedPCGSolve( (HYPRE_Solver) solver,
+                                    (HYPRE_Matrix) A,
+                                    (HYPRE_Vector) b,
+                                    (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetTol( HYPRE_SStructSolver solver,
+                                 HYPRE_Real          tol )
+{
+   return( HYPRE_PipelinedPCGSetTol( (HYPRE_Solver) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetAbsoluteTol( HYPRE_SStructSolver solver,
+                                         HYPRE_Real          tol )
+{
+   return( HYPRE_PipelinedPCGSetAbsoluteTol( (HYPRE_Solver) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetMaxIter( HYPRE_SStructSolver solver,
+                                     HYPRE_Int           max_iter )
+{
+   return( HYPRE_PipelinedPCGSetMaxIter( (HYPRE_Solver) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetTwoNorm( HYPRE_SStructSolver solver,
+                                     HYPRE_Int           two_norm )
+{
+   return( HYPRE_PipelinedPCGSetTwoNorm( (HYPRE_Solver) solver, two_norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetResidualReplacement( HYPRE_SStructSolver solver,
+                                                 HYPRE_Int           replace_period )
+{
+   return( HYPRE_PipelinedPCGSetResidualReplacement( (HYPRE_Solver) solver,
+                                                     replace_period ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetPrecond( HYPRE_SStructSolver          solver,
+                                     HYPRE_PtrToSStructSolverFcn  precond,
+                                     HYPRE_PtrToSStructSolverFcn  precond_setup,
+                                     void                        *precond_data )
+{
+   return( HYPRE_PipelinedPCGSetPrecond( (HYPRE_Solver) solver,
+                                         (HYPRE_PtrToSolverFcn) precond,
+                                         (HYPRE_PtrToSolverFcn) precond_setup,
+                                         (HYPRE_Solver) precond_data ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetLogging( HYPRE_SStructSolver solver,
+                                     HYPRE_Int           logging )
+{
+   return( HYPRE_PipelinedPCGSetLogging( (HYPRE_Solver) solver, logging ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGSetPrintLevel( HYPRE_SStructSolver solver,
+                                        HYPRE_Int           level )
+{
+   return( HYPRE_PipelinedPCGSetPrintLevel( (HYPRE_Solver) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGGetNumIterations( HYPRE_SStructSolver  solver,
+                                           HYPRE_Int           *num_iterations )
+{
+   return( HYPRE_PipelinedPCGGetNumIterations( (HYPRE_Solver) solver,
+                                               num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructPipelinedPCGGetFinalRelativeResidualNorm( HYPRE_SStructSolver  solver,
+                                                       HYPRE_Real          *norm )
+{
+   return( HYPRE_PipelinedPCGGetFinalRelativeResidualNorm( (HYPRE_Solver) solver,
+                                                           norm ) );
+}
@@ -453,6 +453,22 @@ HYPRE_Int HYPRE_SStructPCGGetResidual ( HYPRE_SStructSolver solver , void **resi
 HYPRE_Int HYPRE_SStructDiagScaleSetup ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector y , HYPRE_SStructVector x );
 HYPRE_Int HYPRE_SStructDiagScale ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector y , HYPRE_SStructVector x );
 
+/* HYPRE_sstruct_pipelinedpcg.c */
+HYPRE_Int HYPRE_SStructPipelinedPCGCreate ( MPI_Comm comm , HYPRE_SStructSolver *solver );
+HYPRE_Int HYPRE_SStructPipelinedPCGDestroy ( HYPRE_SStructSolver solver );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetup ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
+HYPRE_Int HYPRE_SStructPipelinedPCGSolve ( HYPRE_SStructSolver solver , HYPRE_SStructMatrix A , HYPRE_SStructVector b , HYPRE_SStructVector x );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetTol ( HYPRE_SStructSolver solver , HYPRE_Real tol );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetAbsoluteTol ( HYPRE_SStructSolver solver , HYPRE_Real tol );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetMaxIter ( HYPRE_SStructSolver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetTwoNorm ( HYPRE_SStructSolver solver , HYPRE_Int two_norm );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetResidualReplacement ( HYPRE_SStructSolver solver , HYPRE_Int replace_period );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetPrecond ( HYPRE_SStructSolver solver , HYPRE_PtrToSStructSolverFcn precond , HYPRE_PtrToSStructSolverFcn precond_setup , void *precond_data );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetLogging ( HYPRE_SStructSolver solver , HYPRE_Int logging );
+HYPRE_Int HYPRE_SStructPipelinedPCGSetPrintLevel ( HYPRE_SStructSolver solver , HYPRE_Int level );
+HYPRE_Int HYPRE_SStructPipelinedPCGGetNumIterations ( HYPRE_SStructSolver solver , HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_SStructPipelinedPCGGetFinalRelativeResidualNorm ( HYPRE_SStructSolver solver , HYPRE_Real *norm );
+
 /* HYPRE_sstruct_split.c */
 HYPRE_Int HYPRE_SStructSplitCreate ( MPI_Comm comm , HYPRE_SStructSolver *solver_ptr );
 HYPRE_Int HYPRE_SStructSplitDestroy ( HYPRE_SStructSolver solver );
@@ -501,11 +517,16 @@ void *hypre_SStructKrylovMatvecCreate ( void *A , void *x );
 HYPRE_Int hypre_SStructKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_SStructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_SStructKrylovInnerProd ( void *x , void *y );
+HYPRE_Real hypre_SStructKrylovInnerProdLocal ( void *x , void *y );
 HYPRE_Int hypre_SStructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_SStructKrylovClearVector ( void *x );
 HYPRE_Int hypre_SStructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
 HYPRE_Int hypre_SStructKrylovAxpy ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Real hypre_SStructKrylovAxpyInnerProd ( HYPRE_Complex alpha , void *x , void *y , void *z );
+HYPRE_Int hypre_SStructKrylovInnerProd2 ( void *x , void *y , void *z , HYPRE_Real *result );
+HYPRE_Int hypre_SStructKrylovAxpby ( HYPRE_Complex alpha , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_SStructKrylovCommInfo ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
+HYPRE_Int hypre_SStructKrylovIAllreduce ( void *A , HYPRE_Real *send_data , HYPRE_Real *recv_data , HYPRE_Int count , hypre_MPI_Request *request );
 
 /* maxwell_grad.c */
 hypre_ParCSRMatrix *hypre_Maxwell_Grad ( hypre_SStructGrid *grid );
@@ -214,6 +214,21 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SStructKrylovInnerProdLocal( void *x,
+                                   void *y )
+{
+   HYPRE_Real result;
+
+   hypre_SStructInnerProdLocal( (hypre_SStructVector *) x,
+                                (hypre_SStructVector *) y, &result );
+
+   return result;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -258,6 +273,51 @@ hypre_SStructKrylovAxpy( HYPRE_Complex alpha,
                                (hypre_SStructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SStructKrylovAxpyInnerProd( HYPRE_Complex alpha,
+                                  void   *x,
+                                  void   *y,
+                                  void   *z )
+{
+   HYPRE_Real result;
+
+   hypre_SStructAxpyInnerProd( alpha, (hypre_SStructVector *) x,
+                               (hypre_SStructVector *) y,
+                               (hypre_SStructVector *) z, &result );
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProd2( void       *x,
+                               void       *y,
+                               void       *z,
+                               HYPRE_Real *result )
+{
+   return ( hypre_SStructInnerProd2( (hypre_SStructVector *) x,
+                                     (hypre_SStructVector *) y,
+                                     (hypre_SStructVector *) z, result ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovAxpby( HYPRE_Complex alpha,
+                          void         *x,
+                          HYPRE_Complex beta,
+                          void         *y )
+{
+   return ( hypre_SStructAxpby( alpha, (hypre_SStructVector *) x, beta,
+                                (hypre_SStructVector *) y ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -272,3 +332,18 @@ hypre_SStructKrylovCommInfo( void  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovIAllreduce( void              *A,
+                               HYPRE_Real        *send_data,
+                               HYPRE_Real        *recv_data,
+                               HYPRE_Int          count,
+                               hypre_MPI_Request *request )
+{
+   MPI_Comm comm = hypre_SStructMatrixComm((hypre_SStructMatrix *) A);
+
+   return ( hypre_MPI_Iallreduce(send_data, recv_data, count, HYPRE_MPI_REAL,
+                                 hypre_MPI_SUM, comm, request) );
+}
@@ -80,3 +80,128 @@ hypre_SStructAxpy( HYPRE_Complex        alpha,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructAxpyInnerProd
+ *
+ * y = y + alpha*x, and returns <z, y> in result_ptr.  The inner product is
+ * reduced once over all parts and variables.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructAxpyInnerProd( HYPRE_Complex        alpha,
+                            hypre_SStructVector *x,
+                            hypre_SStructVector *y,
+                            hypre_SStructVector *z,
+                            HYPRE_Real          *result_ptr )
+{
+   HYPRE_Int    nparts = hypre_SStructVectorNParts(x);
+   HYPRE_Real   local_result;
+   HYPRE_Int    part, nvars, var;
+
+   HYPRE_Int    x_object_type= hypre_SStructVectorObjectType(x);
+
+   if (x_object_type != hypre_SStructVectorObjectType(y) ||
+       x_object_type != hypre_SStructVectorObjectType(z))
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
+   {
+      hypre_SStructPVector *px, *py, *pz;
+
+      local_result = 0.0;
+      for (part = 0; part < nparts; part++)
+      {
+         px = hypre_SStructVectorPVector(x, part);
+         py = hypre_SStructVectorPVector(y, part);
+         pz = hypre_SStructVectorPVector(z, part);
+         nvars = hypre_SStructPVectorNVars(px);
+         for (var = 0; var < nvars; var++)
+         {
+            local_result +=
+               hypre_StructAxpyInnerProdLocal(alpha,
+                                              hypre_SStructPVectorSVector(px, var),
+                                              hypre_SStructPVectorSVector(py, var),
+                                              hypre_SStructPVectorSVector(pz, var));
+         }
+      }
+
+      hypre_MPI_Allreduce(&local_result, result_ptr, 1, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, hypre_SStructVectorComm(x));
+   }
+
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *x_par;
+      hypre_ParVector  *y_par;
+      hypre_ParVector  *z_par;
+
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+      hypre_SStructVectorConvert(z, &z_par);
+
+      *result_ptr = hypre_ParVectorAxpyInnerProd(alpha, x_par, y_par, z_par);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructAxpby
+ *
+ * y = alpha*x + beta*y (y is not read if beta is zero)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructAxpby( HYPRE_Complex        alpha,
+                    hypre_SStructVector *x,
+                    HYPRE_Complex        beta,
+                    hypre_SStructVector *y )
+{
+   HYPRE_Int nparts = hypre_SStructVectorNParts(x);
+   HYPRE_Int part, nvars, var;
+
+   HYPRE_Int    x_object_type= hypre_SStructVectorObjectType(x);
+   HYPRE_Int    y_object_type= hypre_SStructVectorObjectType(y);
+
+   if (x_object_type != y_object_type)
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
+   {
+      hypre_SStructPVector *px, *py;
+
+      for (part = 0; part < nparts; part++)
+      {
+         px = hypre_SStructVectorPVector(x, part);
+         py = hypre_SStructVectorPVector(y, part);
+         nvars = hypre_SStructPVectorNVars(px);
+         for (var = 0; var < nvars; var++)
+         {
+            hypre_StructAxpby(alpha, hypre_SStructPVectorSVector(px, var),
+                              beta, hypre_SStructPVectorSVector(py, var));
+         }
+      }
+   }
+
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *x_par;
+      hypre_ParVector  *y_par;
+
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+
+      hypre_ParVectorAxpby(alpha, x_par, beta, y_par);
+   }
+
+   return hypre_error_flag;
+}
@@ -91,3 +91,133 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructInnerProd2
+ *
+ * result[0] = <x, y> and result[1] = <x, z> with a single reduction over
+ * all parts and variables.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructInnerProd2( hypre_SStructVector *x,
+                         hypre_SStructVector *y,
+                         hypre_SStructVector *z,
+                         HYPRE_Real          *result )
+{
+   HYPRE_Int    nparts = hypre_SStructVectorNParts(x);
+   HYPRE_Real   local_result[2];
+   HYPRE_Int    part, nvars, var;
+
+   HYPRE_Int    x_object_type= hypre_SStructVectorObjectType(x);
+
+   if (x_object_type != hypre_SStructVectorObjectType(y) ||
+       x_object_type != hypre_SStructVectorObjectType(z))
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
+   {
+      hypre_SStructPVector *px, *py, *pz;
+
+      local_result[0] = 0.0;
+      local_result[1] = 0.0;
+      for (part = 0; part < nparts; part++)
+      {
+         px = hypre_SStructVectorPVector(x, part);
+         py = hypre_SStructVectorPVector(y, part);
+         pz = hypre_SStructVectorPVector(z, part);
+         nvars = hypre_SStructPVectorNVars(px);
+         for (var = 0; var < nvars; var++)
+         {
+            local_result[0] +=
+               hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(px, var),
+                                          hypre_SStructPVectorSVector(py, var));
+            local_result[1] +=
+               hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(px, var),
+                                          hypre_SStructPVectorSVector(pz, var));
+         }
+      }
+
+      hypre_MPI_Allreduce(local_result, result, 2, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, hypre_SStructVectorComm(x));
+   }
+
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *x_par;
+      hypre_ParVector  *y_par;
+      hypre_ParVector  *z_par;
+
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+      hypre_SStructVectorConvert(z, &z_par);
+
+      hypre_ParVectorInnerProd2(x_par, y_par, z_par, result);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructInnerProdLocal
+ *
+ * Contribution of the calling process to <x,y>; no communication.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructInnerProdLocal( hypre_SStructVector *x,
+                             hypre_SStructVector *y,
+                             HYPRE_Real          *result_ptr )
+{
+   HYPRE_Int    nparts = hypre_SStructVectorNParts(x);
+   HYPRE_Real   result;
+   HYPRE_Int    part, nvars, var;
+
+   HYPRE_Int    x_object_type= hypre_SStructVectorObjectType(x);
+
+   if (x_object_type != hypre_SStructVectorObjectType(y))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   result = 0.0;
+
+   if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
+   {
+      hypre_SStructPVector *px, *py;
+
+      for (part = 0; part < nparts; part++)
+      {
+         px = hypre_SStructVectorPVector(x, part);
+         py = hypre_SStructVectorPVector(y, part);
+         nvars = hypre_SStructPVectorNVars(px);
+         for (var = 0; var < nvars; var++)
+         {
+            result +=
+               hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(px, var),
+                                          hypre_SStructPVectorSVector(py, var));
+         }
+      }
+   }
+
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *x_par;
+      hypre_ParVector  *y_par;
+
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+
+      result = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x_par),
+                                        hypre_ParVectorLocalVector(y_par));
+   }
+
+   *result_ptr = result;
+
+   return hypre_error_flag;
+}
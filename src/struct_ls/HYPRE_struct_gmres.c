@@ -24,6 +24,9 @@ HYPRE_StructGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_GMRESFunctionsSetFusedOps(
+      gmres_functions, hypre_StructKrylovAxpyInnerProd,
+      hypre_StructKrylovInnerProd2, hypre_StructKrylovAxpby );
 
    *solver = ( (HYPRE_StructSolver) hypre_GMRESCreate( gmres_functions ) );
 
@@ -288,6 +288,19 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
                                  HYPRE_Int          skip_relax);
 
+/**
+ * (Optional) Do up to {\tt tblock\_depth} Jacobi sweeps (relaxation types 0
+ * and 1) per ghost exchange.  The sweeps of a group move through the grid
+ * together as a wavefront, using ghost layers {\tt tblock\_depth} deep, so a
+ * group of sweeps reads the matrix from memory once.  This helps when relaxation is limited by memory
+ * bandwidth, and costs a copy of the matrix with the deeper ghost layers on
+ * each level.  Values less than 2 (the default is 0) turn this off.  The
+ * depth is limited by the neighbor distance of the grid (8 by default).
+ * Applies to matrices with variable coefficients only.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetTemporalBlocking(HYPRE_StructSolver solver,
+                                        HYPRE_Int          tblock_depth);
+
 /*
  * RE-VISIT
  **/
@@ -595,6 +608,77 @@ HYPRE_Int HYPRE_StructDiagScale(HYPRE_StructSolver solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Struct Pipelined PCG Solver
+ *
+ * These routines should be used in conjunction with the generic interface in
+ * \ref KrylovSolvers.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_StructPipelinedPCGCreate(MPI_Comm            comm,
+                                         HYPRE_StructSolver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_StructPipelinedPCGDestroy(HYPRE_StructSolver solver);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetup(HYPRE_StructSolver solver,
+                                        HYPRE_StructMatrix A,
+                                        HYPRE_StructVector b,
+                                        HYPRE_StructVector x);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSolve(HYPRE_StructSolver solver,
+                                        HYPRE_StructMatrix A,
+                                        HYPRE_StructVector b,
+                                        HYPRE_StructVector x);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetTol(HYPRE_StructSolver solver,
+                                         HYPRE_Real         tol);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetAbsoluteTol(HYPRE_StructSolver solver,
+                                                 HYPRE_Real         tol);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetMaxIter(HYPRE_StructSolver solver,
+                                             HYPRE_Int          max_iter);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetTwoNorm(HYPRE_StructSolver solver,
+                                             HYPRE_Int          two_norm);
+
+/**
+ * (Optional) Replace the recurred residual and auxiliary vectors by their
+ * explicitly computed values every {\tt replace\_period} iterations.
+ **/
+HYPRE_Int HYPRE_StructPipelinedPCGSetResidualReplacement(HYPRE_StructSolver solver,
+                                                         HYPRE_Int          replace_period);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetPrecond(HYPRE_StructSolver         solver,
+                                             HYPRE_PtrToStructSolverFcn precond,
+                                             HYPRE_PtrToStructSolverFcn precond_setup,
+                                             HYPRE_StructSolver         precond_solver);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetLogging(HYPRE_StructSolver solver,
+                                             HYPRE_Int          logging);
+
+HYPRE_Int HYPRE_StructPipelinedPCGSetPrintLevel(HYPRE_StructSolver solver,
+                                                HYPRE_Int          level);
+
+HYPRE_Int HYPRE_StructPipelinedPCGGetNumIterations(HYPRE_StructSolver  solver,
+                                                   HYPRE_Int          *num_iterations);
+
+HYPRE_Int HYPRE_StructPipelinedPCGGetFinalRelativeResidualNorm(HYPRE_StructSolver  solver,
+                                                               HYPRE_Real         *norm);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -29,6 +29,9 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(
+      pcg_functions, hypre_StructKrylovAxpyInnerProd,
+      hypre_StructKrylovInnerProd2, hypre_StructKrylovAxpby );
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -250,6 +250,23 @@ HYPRE_StructPFMGGetSkipRelax( HYPRE_StructSolver solver,
    return( hypre_PFMGGetSkipRelax( (void *) solver, skip_relax) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetTemporalBlocking( HYPRE_StructSolver solver,
+                                     HYPRE_Int          tblock_depth )
+{
+   return( hypre_PFMGSetTemporalBlocking( (void *) solver, tblock_depth) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetTemporalBlocking( HYPRE_StructSolver solver,
+                                     HYPRE_Int        * tblock_depth )
+{
+   return( hypre_PFMGGetTemporalBlocking( (void *) solver, tblock_depth) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
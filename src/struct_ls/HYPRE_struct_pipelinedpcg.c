@@ -0,0 +1,165 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
+{
+   hypre_PipelinedPCGFunctions * pcg_functions =
+      hypre_PipelinedPCGFunctionsCreate(
+         hypre_CAlloc, hypre_StructKrylovFree,
+         hypre_StructKrylovCommInfo,
+         hypre_StructKrylovCreateVector,
+         hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
+         hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
+         hypre_StructKrylovInnerProd, hypre_StructKrylovInnerProdLocal,
+         hypre_StructKrylovIAllreduce, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovClearVector, hypre_StructKrylovAxpy,
+         hypre_StructKrylovAxpby,
+         hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+
+   *solver = ( (HYPRE_StructSolver) hypre_PipelinedPCGCreate( pcg_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGDestroy( HYPRE_StructSolver solver )
+{
+   return( hypre_PipelinedPCGDestroy( (void *) solver ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetup( HYPRE_StructSolver solver,
+                               HYPRE_StructMatrix A,
+                               HYPRE_StructVector b,
+                               HYPRE_StructVector x      )
+{
+   return( HYPRE_PipelinedPCGSetup( (HYPRE_Solver) solver,
+                                    (HYPRE_Matrix) A,
+                                    (HYPRE_Vector) b,
+                                    (HYPRE_Vector) x ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSolve( HYPRE_StructSolver solver,
+                               HYPRE_StructMatrix A,
+                               HYPRE_StructVector b,
+                               HYPRE_StructVector x      )
+{
+   return( HYPRE_PipelinedPCGSolve( (HYPRE_Solver) solver,
+                                    (HYPRE_Matrix) A,
+                                    (HYPRE_Vector) b,
+                                    (HYPRE_Vector) x ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetTol( HYPRE_StructSolver solver,
+                                HYPRE_Real         tol    )
+{
+   return( HYPRE_PipelinedPCGSetTol( (HYPRE_Solver) solver, tol ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetAbsoluteTol( HYPRE_StructSolver solver,
+                                        HYPRE_Real         tol    )
+{
+   return( HYPRE_PipelinedPCGSetAbsoluteTol( (HYPRE_Solver) solver, tol ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetMaxIter( HYPRE_StructSolver solver,
+                                    HYPRE_Int          max_iter )
+{
+   return( HYPRE_PipelinedPCGSetMaxIter( (HYPRE_Solver) solver, max_iter ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetTwoNorm( HYPRE_StructSolver solver,
+                                    HYPRE_Int          two_norm )
+{
+   return( HYPRE_PipelinedPCGSetTwoNorm( (HYPRE_Solver) solver, two_norm ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetResidualReplacement( HYPRE_StructSolver solver,
+                                                HYPRE_Int          replace_period )
+{
+   return( HYPRE_PipelinedPCGSetResidualReplacement( (HYPRE_Solver) solver,
+                                                     replace_period ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetPrecond( HYPRE_StructSolver         solver,
+                                    HYPRE_PtrToStructSolverFcn precond,
+                                    HYPRE_PtrToStructSolverFcn precond_setup,
+                                    HYPRE_StructSolver         precond_solver )
+{
+   return( HYPRE_PipelinedPCGSetPrecond( (HYPRE_Solver) solver,
+                                         (HYPRE_PtrToSolverFcn) precond,
+                                         (HYPRE_PtrToSolverFcn) precond_setup,
+                                         (HYPRE_Solver) precond_solver ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetLogging( HYPRE_StructSolver solver,
+                                    HYPRE_Int          logging )
+{
+   return( HYPRE_PipelinedPCGSetLogging( (HYPRE_Solver) solver, logging ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGSetPrintLevel( HYPRE_StructSolver solver,
+                                       HYPRE_Int      print_level )
+{
+   return( HYPRE_PipelinedPCGSetPrintLevel( (HYPRE_Solver) solver, print_level ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGGetNumIterations( HYPRE_StructSolver  solver,
+                                          HYPRE_Int          *num_iterations )
+{
+   return( HYPRE_PipelinedPCGGetNumIterations( (HYPRE_Solver) solver,
+                                               num_iterations ) );
+}
+
+/*==========================================================================*/
+
+HYPRE_Int
+HYPRE_StructPipelinedPCGGetFinalRelativeResidualNorm( HYPRE_StructSolver  solver,
+                                                      HYPRE_Real         *norm   )
+{
+   return( HYPRE_PipelinedPCGGetFinalRelativeResidualNorm( (HYPRE_Solver) solver,
+                                                           norm ) );
+}
@@ -198,6 +198,7 @@ hypre_CycRedCreateCoarseOp( hypre_StructMatrix *A,
       Ac_num_ghost[2*cdir + 1] = 1;
    }
    hypre_StructMatrixSetNumGhost(Ac, Ac_num_ghost);
+   hypre_StructMatrixSetDataAlignment(Ac, hypre_StructMatrixDataAlignment(A));
 
    hypre_StructMatrixInitializeShell(Ac);
 
@@ -617,6 +618,7 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
       x_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(x_l[l+1], x_num_ghost);
+      hypre_StructVectorSetDataAlignment(x_l[l+1], hypre_StructVectorDataAlignment(x));
       hypre_StructVectorInitializeShell(x_l[l+1]);
       hypre_StructVectorSetDataSize(x_l[l+1], &data_size, &data_size_const);
    }
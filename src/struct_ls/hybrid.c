@@ -463,6 +463,9 @@ hypre_HybridSolveUsePCG( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(
+      pcg_functions, hypre_StructKrylovAxpyInnerProd,
+      hypre_StructKrylovInnerProd2, hypre_StructKrylovAxpby );
    krylov_solver = hypre_PCGCreate( pcg_functions );
 
    hypre_PCGSetTol(krylov_solver, tol);
@@ -502,6 +505,9 @@ hypre_HybridSolveUseGMRES( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_GMRESFunctionsSetFusedOps(
+      gmres_functions, hypre_StructKrylovAxpyInnerProd,
+      hypre_StructKrylovInnerProd2, hypre_StructKrylovAxpby );
    krylov_solver = hypre_GMRESCreate( gmres_functions );
 
    hypre_GMRESSetTol(krylov_solver, tol);
@@ -41,6 +41,7 @@ hypre_StructKrylovCreateVector( void *vvector )
    new_vector = hypre_StructVectorCreate( hypre_StructVectorComm(vector),
                                           hypre_StructVectorGrid(vector) );
    hypre_StructVectorSetNumGhost(new_vector, num_ghost);
+   hypre_StructVectorSetDataAlignment(new_vector, hypre_StructVectorDataAlignment(vector));
    hypre_StructVectorInitialize(new_vector);
    hypre_StructVectorAssemble(new_vector);
 
@@ -65,6 +66,7 @@ hypre_StructKrylovCreateVectorArray(HYPRE_Int n, void *vvector )
                                hypre_StructVectorGrid(vector),
                                (HYPRE_StructVector *) &new_vector[i] );
       hypre_StructVectorSetNumGhost(new_vector[i], num_ghost);
+      hypre_StructVectorSetDataAlignment(new_vector[i], hypre_StructVectorDataAlignment(vector));
       HYPRE_StructVectorInitialize((HYPRE_StructVector) new_vector[i]);
       HYPRE_StructVectorAssemble((HYPRE_StructVector) new_vector[i]);
    }
@@ -137,6 +139,17 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructKrylovInnerProdLocal( void *x,
+                                  void *y )
+{
+   return ( hypre_StructInnerProdLocal( (hypre_StructVector *) x,
+                                        (hypre_StructVector *) y ) );
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -181,6 +194,47 @@ hypre_StructKrylovAxpy( HYPRE_Complex alpha,
                               (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructKrylovAxpyInnerProd( HYPRE_Complex alpha,
+                                 void   *x,
+                                 void   *y,
+                                 void   *z )
+{
+   return ( hypre_StructAxpyInnerProd( alpha, (hypre_StructVector *) x,
+                                       (hypre_StructVector *) y,
+                                       (hypre_StructVector *) z ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProd2( void       *x,
+                              void       *y,
+                              void       *z,
+                              HYPRE_Real *result )
+{
+   return ( hypre_StructInnerProd2( (hypre_StructVector *) x,
+                                    (hypre_StructVector *) y,
+                                    (hypre_StructVector *) z, result ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovAxpby( HYPRE_Complex alpha,
+                         void         *x,
+                         HYPRE_Complex beta,
+                         void         *y )
+{
+   return ( hypre_StructAxpby( alpha, (hypre_StructVector *) x, beta,
+                               (hypre_StructVector *) y ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -221,3 +275,18 @@ hypre_StructKrylovCommInfo( void  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovIAllreduce( void              *A,
+                              HYPRE_Real        *send_data,
+                              HYPRE_Real        *recv_data,
+                              HYPRE_Int          count,
+                              hypre_MPI_Request *request )
+{
+   MPI_Comm comm = hypre_StructMatrixComm((hypre_StructMatrix *) A);
+
+   return ( hypre_MPI_Iallreduce(send_data, recv_data, count, HYPRE_MPI_REAL,
+                                 hypre_MPI_SUM, comm, request) );
+}
@@ -37,6 +37,7 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> num_pre_relax)    = 1;
    (pfmg_data -> num_post_relax)   = 1;
    (pfmg_data -> skip_relax)       = 1;
+   (pfmg_data -> tblock_depth)     = 0;
    (pfmg_data -> logging)          = 0;
    (pfmg_data -> print_level)      = 0;
 
@@ -404,6 +405,31 @@ hypre_PFMGGetSkipRelax( void *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetTemporalBlocking( void *pfmg_vdata,
+                               HYPRE_Int  tblock_depth )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> tblock_depth) = tblock_depth;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetTemporalBlocking( void *pfmg_vdata,
+                               HYPRE_Int *tblock_depth )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *tblock_depth = (pfmg_data -> tblock_depth);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
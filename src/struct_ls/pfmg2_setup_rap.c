@@ -22,6 +22,17 @@
    hypre_IndexD(out_index, cdir) = hypre_IndexD(in_index, 0);   \
    cdir = (cdir + 1) % 2;
 
+/*--------------------------------------------------------------------------
+ * Target number of coarse points per tile in hypre_PFMG2BuildRAP.  Device
+ * builds compute each box in one launch.
+ *--------------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#define hypre_PFMG2RAPTileVolume 0
+#else
+#define hypre_PFMG2RAPTileVolume 4096
+#endif
+
 /*--------------------------------------------------------------------------
  * Sets up new coarse grid operator stucture.
  *--------------------------------------------------------------------------*/
@@ -147,10 +158,157 @@ hypre_PFMG2CreateRAPOp( hypre_StructMatrix *R,
  * hypre_PFMG2BuildRAPNoSym to build the upper triangular part of RAP
  * (excluding the diagonal). So using symmetric storage, only the
  * first routine would be called. With full storage both would need to
- * be called.
+ * be called. hypre_PFMG2BuildRAP calls one or both of them tile by tile.
+ *
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMG2RAPTileSize
  *
+ * Size of the tiles of cgrid_box: whole lines in the first dimension, and
+ * as many of them as fit into hypre_PFMG2RAPTileVolume points.
  *--------------------------------------------------------------------------*/
 
+static void
+hypre_PFMG2RAPTileSize( hypre_Box   *cgrid_box,
+                        hypre_Index  tile_size )
+{
+   hypre_BoxGetSize(cgrid_box, tile_size);
+   tile_size[1] = hypre_min(tile_size[1],
+                            hypre_max(1, hypre_PFMG2RAPTileVolume / tile_size[0]));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMG2BuildRAP
+ *
+ * Builds RAP, both triangular parts if A is not symmetric.  With variable
+ * coefficients, the coarse boxes are cut into tiles of about
+ * hypre_PFMG2RAPTileVolume points (whole lines in the first dimension), and
+ * both parts are computed for one tile before moving to the next, as in
+ * hypre_PFMG3BuildRAP.  The tiles are distributed over the OpenMP threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMG2BuildRAP( hypre_StructMatrix *A,
+                     hypre_StructMatrix *P,
+                     hypre_StructMatrix *R,
+                     HYPRE_Int           cdir,
+                     hypre_Index         cindex,
+                     hypre_Index         cstride,
+                     hypre_StructMatrix *RAP     )
+{
+   hypre_StructGrid     *fgrid     = hypre_StructMatrixGrid(A);
+   HYPRE_Int            *fgrid_ids = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid     *cgrid     = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray       *cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int            *cgrid_ids = hypre_StructGridIDs(cgrid);
+   HYPRE_Int             symmetric = hypre_StructMatrixSymmetric(A);
+   HYPRE_Int             constant_coefficient;
+
+   hypre_Box            *cgrid_box;
+   hypre_Box            *tile;
+   hypre_BoxArray       *tiles;
+   HYPRE_Int            *tile_cboxnums;
+   HYPRE_Int            *tile_fboxnums;
+   HYPRE_Int             num_tiles;
+   hypre_Index           tile_size;
+   HYPRE_Int             fi, ci, j, t;
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(RAP);
+
+   /*----------------------------------------------------------
+    * Count the tiles.  Boxes that are not tiled are computed
+    * here.
+    *----------------------------------------------------------*/
+
+   num_tiles = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (constant_coefficient == 1 || hypre_PFMG2RAPTileVolume == 0)
+      {
+         hypre_PFMG2BuildRAPSymBox(ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP);
+         if (!symmetric)
+         {
+            hypre_PFMG2BuildRAPNoSymBox(ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP);
+         }
+      }
+      else if (hypre_BoxVolume(cgrid_box) > 0)
+      {
+         hypre_PFMG2RAPTileSize(cgrid_box, tile_size);
+         num_tiles += (hypre_BoxSizeD(cgrid_box, 1) + tile_size[1] - 1) / tile_size[1];
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Cut the coarse boxes into tiles
+    *----------------------------------------------------------*/
+
+   tiles         = hypre_BoxArrayCreate(num_tiles, 2);
+   tile_cboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+   tile_fboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+
+   t = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (constant_coefficient == 1 || hypre_PFMG2RAPTileVolume == 0 ||
+          hypre_BoxVolume(cgrid_box) == 0)
+      {
+         continue;
+      }
+
+      hypre_PFMG2RAPTileSize(cgrid_box, tile_size);
+      for (j = hypre_BoxIMinD(cgrid_box, 1); j <= hypre_BoxIMaxD(cgrid_box, 1); j += tile_size[1])
+      {
+         tile = hypre_BoxArrayBox(tiles, t);
+         hypre_CopyBox(cgrid_box, tile);
+         hypre_BoxIMinD(tile, 1) = j;
+         hypre_BoxIMaxD(tile, 1) = hypre_min(j + tile_size[1] - 1, hypre_BoxIMaxD(cgrid_box, 1));
+         tile_cboxnums[t] = ci;
+         tile_fboxnums[t] = fi;
+         t++;
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Compute the tiles
+    *----------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t, tile) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_tiles; t++)
+   {
+      tile = hypre_BoxArrayBox(tiles, t);
+      hypre_PFMG2BuildRAPSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                                A, P, R, cdir, cindex, cstride, RAP);
+      if (!symmetric)
+      {
+         hypre_PFMG2BuildRAPNoSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                                     A, P, R, cdir, cindex, cstride, RAP);
+      }
+   }
+
+   hypre_BoxArrayDestroy(tiles);
+   hypre_TFree(tile_cboxnums, HYPRE_MEMORY_HOST);
+   hypre_TFree(tile_fboxnums, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_PFMG2BuildRAPSym( hypre_StructMatrix *A,
                         hypre_StructMatrix *P,
@@ -160,9 +318,6 @@ hypre_PFMG2BuildRAPSym( hypre_StructMatrix *A,
                         hypre_Index         cstride,
                         hypre_StructMatrix *RAP     )
 {
-   hypre_StructStencil  *fine_stencil;
-   HYPRE_Int             fine_stencil_size;
-
    hypre_StructGrid     *fgrid;
    HYPRE_Int            *fgrid_ids;
    hypre_StructGrid     *cgrid;
@@ -173,9 +328,6 @@ hypre_PFMG2BuildRAPSym( hypre_StructMatrix *A,
    HYPRE_Int             constant_coefficient_A;
    HYPRE_Int             fi, ci;
 
-   fine_stencil = hypre_StructMatrixStencil(A);
-   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
-
    fgrid = hypre_StructMatrixGrid(A);
    fgrid_ids = hypre_StructGridIDs(fgrid);
 
@@ -205,62 +357,95 @@ hypre_PFMG2BuildRAPSym( hypre_StructMatrix *A,
          fi++;
       }
 
-      /*-----------------------------------------------------------------
-       * Switch statement to direct control to apropriate BoxLoop depending
-       * on stencil size. Default is full 9-point.
-       *-----------------------------------------------------------------*/
+      hypre_PFMG2BuildRAPSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                                A, P, R, cdir, cindex, cstride, RAP);
+   } /* end ForBoxI */
 
-      switch (fine_stencil_size)
-      {
+   return hypre_error_flag;
+}
 
-         /*--------------------------------------------------------------
-          * Loop for symmetric 5-point fine grid operator; produces a
-          * symmetric 9-point coarse grid operator. We calculate only the
-          * lower triangular stencil entries: (southwest, south, southeast,
-          * west, and center).
-          *--------------------------------------------------------------*/
+/*--------------------------------------------------------------------------
+ * hypre_PFMG2BuildRAPSymBox
+ *
+ * Lower triangular (plus diagonal) coefficients of RAP on cgrid_box, which
+ * is box ci of the coarse grid or a part of it.  Box fi of the fine grid is
+ * the one that box ci was coarsened from.
+ *--------------------------------------------------------------------------*/
 
-         case 5:
+HYPRE_Int
+hypre_PFMG2BuildRAPSymBox( HYPRE_Int           ci,
+                           HYPRE_Int           fi,
+                           hypre_Box          *cgrid_box,
+                           hypre_StructMatrix *A,
+                           hypre_StructMatrix *P,
+                           hypre_StructMatrix *R,
+                           HYPRE_Int           cdir,
+                           hypre_Index         cindex,
+                           hypre_Index         cstride,
+                           hypre_StructMatrix *RAP     )
+{
+   hypre_StructStencil  *fine_stencil;
+   HYPRE_Int             fine_stencil_size;
+   HYPRE_Int             constant_coefficient;
 
-            if ( constant_coefficient==1 )
-            {
-               hypre_PFMG2BuildRAPSym_onebox_FSS5_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            else
-            {
-               hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+   fine_stencil = hypre_StructMatrixStencil(A);
+   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(RAP);
 
-            break;
+   /*-----------------------------------------------------------------
+    * Switch statement to direct control to apropriate BoxLoop depending
+    * on stencil size. Default is full 9-point.
+    *-----------------------------------------------------------------*/
 
-            /*--------------------------------------------------------------
-             * Loop for symmetric 9-point fine grid operator; produces a
-             * symmetric 9-point coarse grid operator. We calculate only the
-             * lower triangular stencil entries: (southwest, south, southeast,
-             * west, and center).
-             *--------------------------------------------------------------*/
+   switch (fine_stencil_size)
+   {
 
-         default:
+      /*--------------------------------------------------------------
+       * Loop for symmetric 5-point fine grid operator; produces a
+       * symmetric 9-point coarse grid operator. We calculate only the
+       * lower triangular stencil entries: (southwest, south, southeast,
+       * west, and center).
+       *--------------------------------------------------------------*/
 
-            if ( constant_coefficient==1 )
-            {
-               hypre_PFMG2BuildRAPSym_onebox_FSS9_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+      case 5:
 
-            else
-            {
-               hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+         if ( constant_coefficient==1 )
+         {
+            hypre_PFMG2BuildRAPSym_onebox_FSS5_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         else
+         {
+            hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
 
-            break;
+         break;
+
+         /*--------------------------------------------------------------
+          * Loop for symmetric 9-point fine grid operator; produces a
+          * symmetric 9-point coarse grid operator. We calculate only the
+          * lower triangular stencil entries: (southwest, south, southeast,
+          * west, and center).
+          *--------------------------------------------------------------*/
 
-      } /* end switch statement */
+      default:
 
-   } /* end ForBoxI */
+         if ( constant_coefficient==1 )
+         {
+            hypre_PFMG2BuildRAPSym_onebox_FSS9_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+
+         else
+         {
+            hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
+
+         break;
+
+   } /* end switch statement */
 
    return hypre_error_flag;
 }
@@ -270,6 +455,7 @@ HYPRE_Int
 hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -282,8 +468,6 @@ hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -296,7 +480,6 @@ hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
    hypre_Box            *P_dbox;
    hypre_Box            *R_dbox;
    hypre_Box            *RAP_dbox;
-   hypre_Box            *cgrid_box;
 
    HYPRE_Real           *pa, *pb;
    HYPRE_Real           *ra, *rb;
@@ -316,13 +499,8 @@ hypre_PFMG2BuildRAPSym_onebox_FSS5_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
@@ -765,6 +943,7 @@ HYPRE_Int
 hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -777,9 +956,6 @@ hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -815,13 +991,8 @@ hypre_PFMG2BuildRAPSym_onebox_FSS9_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
@@ -1347,9 +1518,6 @@ hypre_PFMG2BuildRAPNoSym( hypre_StructMatrix *A,
                           hypre_StructMatrix *RAP     )
 {
 
-   hypre_StructStencil  *fine_stencil;
-   HYPRE_Int             fine_stencil_size;
-
    hypre_StructGrid     *fgrid;
    HYPRE_Int            *fgrid_ids;
    hypre_StructGrid     *cgrid;
@@ -1358,9 +1526,6 @@ hypre_PFMG2BuildRAPNoSym( hypre_StructMatrix *A,
    HYPRE_Int             fi, ci;
    HYPRE_Int             constant_coefficient;
 
-   fine_stencil = hypre_StructMatrixStencil(A);
-   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
-
    fgrid = hypre_StructMatrixGrid(A);
    fgrid_ids = hypre_StructGridIDs(fgrid);
 
@@ -1391,61 +1556,93 @@ hypre_PFMG2BuildRAPNoSym( hypre_StructMatrix *A,
          fi++;
       }
 
-      /*-----------------------------------------------------------------
-       * Switch statement to direct control to appropriate BoxLoop depending
-       * on stencil size. Default is full 27-point.
-       *-----------------------------------------------------------------*/
+      hypre_PFMG2BuildRAPNoSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                                  A, P, R, cdir, cindex, cstride, RAP);
+   } /* end ForBoxI */
 
-      switch (fine_stencil_size)
-      {
+   return hypre_error_flag;
+}
 
-         /*--------------------------------------------------------------
-          * Loop for 5-point fine grid operator; produces upper triangular
-          * part of 9-point coarse grid operator - excludes diagonal.
-          * stencil entries: (northeast, north, northwest, and east)
-          *--------------------------------------------------------------*/
+/*--------------------------------------------------------------------------
+ * hypre_PFMG2BuildRAPNoSymBox
+ *
+ * Upper triangular coefficients of RAP on cgrid_box (see
+ * hypre_PFMG2BuildRAPSymBox).
+ *--------------------------------------------------------------------------*/
 
-         case 5:
+HYPRE_Int
+hypre_PFMG2BuildRAPNoSymBox( HYPRE_Int           ci,
+                             HYPRE_Int           fi,
+                             hypre_Box          *cgrid_box,
+                             hypre_StructMatrix *A,
+                             hypre_StructMatrix *P,
+                             hypre_StructMatrix *R,
+                             HYPRE_Int           cdir,
+                             hypre_Index         cindex,
+                             hypre_Index         cstride,
+                             hypre_StructMatrix *RAP     )
+{
+   hypre_StructStencil  *fine_stencil;
+   HYPRE_Int             fine_stencil_size;
+   HYPRE_Int             constant_coefficient;
 
-            if ( constant_coefficient==1 )
-            {
-               hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+   fine_stencil = hypre_StructMatrixStencil(A);
+   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(RAP);
 
-            else
-            {
-               hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+   /*-----------------------------------------------------------------
+    * Switch statement to direct control to appropriate BoxLoop depending
+    * on stencil size. Default is full 27-point.
+    *-----------------------------------------------------------------*/
 
-            break;
+   switch (fine_stencil_size)
+   {
 
-            /*--------------------------------------------------------------
-             * Loop for 9-point fine grid operator; produces upper triangular
-             * part of 9-point coarse grid operator - excludes diagonal.
-             * stencil entries: (northeast, north, northwest, and east)
-             *--------------------------------------------------------------*/
+      /*--------------------------------------------------------------
+       * Loop for 5-point fine grid operator; produces upper triangular
+       * part of 9-point coarse grid operator - excludes diagonal.
+       * stencil entries: (northeast, north, northwest, and east)
+       *--------------------------------------------------------------*/
 
-         default:
+      case 5:
 
-            if ( constant_coefficient==1 )
-            {
-               hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+         if ( constant_coefficient==1 )
+         {
+            hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
 
-            else
-            {
-               hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+         else
+         {
+            hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
 
-            break;
+         break;
 
-      } /* end switch statement */
+         /*--------------------------------------------------------------
+          * Loop for 9-point fine grid operator; produces upper triangular
+          * part of 9-point coarse grid operator - excludes diagonal.
+          * stencil entries: (northeast, north, northwest, and east)
+          *--------------------------------------------------------------*/
 
-   } /* end ForBoxI */
+      default:
+
+         if ( constant_coefficient==1 )
+         {
+            hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+
+         else
+         {
+            hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
+
+         break;
+
+   } /* end switch statement */
 
    return hypre_error_flag;
 }
@@ -1455,6 +1652,7 @@ HYPRE_Int
 hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -1467,9 +1665,6 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -1502,9 +1697,6 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
 /*   fi = 0;
@@ -1515,8 +1707,6 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS5_CC0(
      fi++;
      }
 */
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
@@ -1920,6 +2110,7 @@ HYPRE_Int
 hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -1932,9 +2123,6 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -1968,9 +2156,6 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
 /*   fi = 0;
@@ -1981,8 +2166,6 @@ hypre_PFMG2BuildRAPNoSym_onebox_FSS9_CC0(
      fi++;
      }
 */
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
@@ -23,6 +23,17 @@
    hypre_IndexD(out_index, cdir) = hypre_IndexD(in_index, 1);   \
    cdir = (cdir + 1) % 3;
 
+/*--------------------------------------------------------------------------
+ * Target number of coarse points per tile in hypre_PFMG3BuildRAP.  Device
+ * builds compute each box in one launch.
+ *--------------------------------------------------------------------------*/
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#define hypre_PFMG3RAPTileVolume 0
+#else
+#define hypre_PFMG3RAPTileVolume 4096
+#endif
+
 /*--------------------------------------------------------------------------
  *  Sets up new coarse grid operator stucture.
  *--------------------------------------------------------------------------*/
@@ -167,9 +178,171 @@ hypre_PFMG3CreateRAPOp( hypre_StructMatrix *R,
  * hypre_PFMG3BuildRAPNoSym to build the upper triangular part of RAP
  * (excluding the diagonal). So using symmetric storage, only the first
  * routine would be called. With full storage both would need to be called.
+ * hypre_PFMG3BuildRAP calls one or both of them tile by tile.
+ *
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMG3RAPTileSize
  *
+ * Size of the tiles of cgrid_box: whole lines in the first dimension, and
+ * as many of them as fit into hypre_PFMG3RAPTileVolume points.
  *--------------------------------------------------------------------------*/
 
+static void
+hypre_PFMG3RAPTileSize( hypre_Box   *cgrid_box,
+                        hypre_Index  tile_size )
+{
+   hypre_BoxGetSize(cgrid_box, tile_size);
+   tile_size[1] = hypre_min(tile_size[1],
+                            hypre_max(1, hypre_PFMG3RAPTileVolume / tile_size[0]));
+   tile_size[2] = hypre_min(tile_size[2],
+                            hypre_max(1, hypre_PFMG3RAPTileVolume / (tile_size[0]*tile_size[1])));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMG3BuildRAP
+ *
+ * Builds RAP, both triangular parts if A is not symmetric.  With variable
+ * coefficients, the coarse boxes are cut into tiles of about
+ * hypre_PFMG3RAPTileVolume points (whole lines in the first dimension), and
+ * both parts are computed for one tile before moving to the next.  The
+ * coefficients of A, P and R that a tile needs are then read from memory
+ * once, and the fine grid planes shared by neighboring coarse planes are
+ * still in cache when they are needed again.
+ *
+ * The tiles are distributed over the OpenMP threads.  The BoxLoops of the
+ * kernels are then nested parallel regions, which are inactive, so each
+ * tile is computed by the thread that owns it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMG3BuildRAP( hypre_StructMatrix *A,
+                     hypre_StructMatrix *P,
+                     hypre_StructMatrix *R,
+                     HYPRE_Int           cdir,
+                     hypre_Index         cindex,
+                     hypre_Index         cstride,
+                     hypre_StructMatrix *RAP     )
+{
+   hypre_StructGrid     *fgrid     = hypre_StructMatrixGrid(A);
+   HYPRE_Int            *fgrid_ids = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid     *cgrid     = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray       *cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int            *cgrid_ids = hypre_StructGridIDs(cgrid);
+   HYPRE_Int             symmetric = hypre_StructMatrixSymmetric(A);
+   HYPRE_Int             constant_coefficient;
+
+   hypre_Box            *cgrid_box;
+   hypre_Box            *tile;
+   hypre_BoxArray       *tiles;
+   HYPRE_Int            *tile_cboxnums;
+   HYPRE_Int            *tile_fboxnums;
+   HYPRE_Int             num_tiles;
+   hypre_Index           tile_size;
+   HYPRE_Int             fi, ci, j, k, t;
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(RAP);
+
+   /*----------------------------------------------------------
+    * Count the tiles.  Boxes that are not tiled are computed
+    * here.
+    *----------------------------------------------------------*/
+
+   num_tiles = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (constant_coefficient == 1 || hypre_PFMG3RAPTileVolume == 0)
+      {
+         hypre_PFMG3BuildRAPSymBox(ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP);
+         if (!symmetric)
+         {
+            hypre_PFMG3BuildRAPNoSymBox(ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP);
+         }
+      }
+      else if (hypre_BoxVolume(cgrid_box) > 0)
+      {
+         hypre_PFMG3RAPTileSize(cgrid_box, tile_size);
+         num_tiles += ((hypre_BoxSizeD(cgrid_box, 1) + tile_size[1] - 1) / tile_size[1]) *
+                      ((hypre_BoxSizeD(cgrid_box, 2) + tile_size[2] - 1) / tile_size[2]);
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Cut the coarse boxes into tiles
+    *----------------------------------------------------------*/
+
+   tiles         = hypre_BoxArrayCreate(num_tiles, 3);
+   tile_cboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+   tile_fboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+
+   t = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (constant_coefficient == 1 || hypre_PFMG3RAPTileVolume == 0 ||
+          hypre_BoxVolume(cgrid_box) == 0)
+      {
+         continue;
+      }
+
+      hypre_PFMG3RAPTileSize(cgrid_box, tile_size);
+      for (k = hypre_BoxIMinD(cgrid_box, 2); k <= hypre_BoxIMaxD(cgrid_box, 2); k += tile_size[2])
+      {
+         for (j = hypre_BoxIMinD(cgrid_box, 1); j <= hypre_BoxIMaxD(cgrid_box, 1); j += tile_size[1])
+         {
+            tile = hypre_BoxArrayBox(tiles, t);
+            hypre_CopyBox(cgrid_box, tile);
+            hypre_BoxIMinD(tile, 1) = j;
+            hypre_BoxIMaxD(tile, 1) = hypre_min(j + tile_size[1] - 1, hypre_BoxIMaxD(cgrid_box, 1));
+            hypre_BoxIMinD(tile, 2) = k;
+            hypre_BoxIMaxD(tile, 2) = hypre_min(k + tile_size[2] - 1, hypre_BoxIMaxD(cgrid_box, 2));
+            tile_cboxnums[t] = ci;
+            tile_fboxnums[t] = fi;
+            t++;
+         }
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Compute the tiles
+    *----------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t, tile) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_tiles; t++)
+   {
+      tile = hypre_BoxArrayBox(tiles, t);
+      hypre_PFMG3BuildRAPSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                                A, P, R, cdir, cindex, cstride, RAP);
+      if (!symmetric)
+      {
+         hypre_PFMG3BuildRAPNoSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                                     A, P, R, cdir, cindex, cstride, RAP);
+      }
+   }
+
+   hypre_BoxArrayDestroy(tiles);
+   hypre_TFree(tile_cboxnums, HYPRE_MEMORY_HOST);
+   hypre_TFree(tile_fboxnums, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_PFMG3BuildRAPSym( hypre_StructMatrix *A,
                         hypre_StructMatrix *P,
@@ -179,8 +352,6 @@ hypre_PFMG3BuildRAPSym( hypre_StructMatrix *A,
                         hypre_Index         cstride,
                         hypre_StructMatrix *RAP     )
 {
-   hypre_StructStencil  *fine_stencil;
-   HYPRE_Int             fine_stencil_size;
    hypre_StructGrid     *fgrid;
    HYPRE_Int            *fgrid_ids;
    hypre_StructGrid     *cgrid;
@@ -190,9 +361,6 @@ hypre_PFMG3BuildRAPSym( hypre_StructMatrix *A,
    HYPRE_Int             constant_coefficient;
    HYPRE_Int             constant_coefficient_A;
 
-   fine_stencil = hypre_StructMatrixStencil(A);
-   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
-
    fgrid = hypre_StructMatrixGrid(A);
    fgrid_ids = hypre_StructGridIDs(fgrid);
 
@@ -222,86 +390,119 @@ hypre_PFMG3BuildRAPSym( hypre_StructMatrix *A,
          fi++;
       }
 
-      /*--------------------------------------------------------------------
-       * Switch statement to direct control to apropriate BoxLoop depending
-       * on stencil size. Default is full 27-point.
-       *-----------------------------------------------------------------*/
+      hypre_PFMG3BuildRAPSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                                A, P, R, cdir, cindex, cstride, RAP);
+   } /* end ForBoxI */
 
-      switch (fine_stencil_size)
-      {
+   return hypre_error_flag;
+}
 
-         /*--------------------------------------------------------------
-          * Loop for symmetric 7-point fine grid operator; produces a
-          * symmetric 19-point coarse grid operator. We calculate only the
-          * lower triangular stencil entries: (below-south, below-west,
-          * below-center, below-east, below-north, center-south,
-          * center-west, and center-center).
-          *--------------------------------------------------------------*/
+/*--------------------------------------------------------------------------
+ * hypre_PFMG3BuildRAPSymBox
+ *
+ * Lower triangular (plus diagonal) coefficients of RAP on cgrid_box, which
+ * is box ci of the coarse grid or a part of it.  Box fi of the fine grid is
+ * the one that box ci was coarsened from.
+ *--------------------------------------------------------------------------*/
 
-         case 7:
+HYPRE_Int
+hypre_PFMG3BuildRAPSymBox( HYPRE_Int           ci,
+                           HYPRE_Int           fi,
+                           hypre_Box          *cgrid_box,
+                           hypre_StructMatrix *A,
+                           hypre_StructMatrix *P,
+                           hypre_StructMatrix *R,
+                           HYPRE_Int           cdir,
+                           hypre_Index         cindex,
+                           hypre_Index         cstride,
+                           hypre_StructMatrix *RAP     )
+{
+   hypre_StructStencil  *fine_stencil;
+   HYPRE_Int             fine_stencil_size;
+   HYPRE_Int             constant_coefficient;
 
-            if ( constant_coefficient==1 )
-            {
-               hypre_PFMG3BuildRAPSym_onebox_FSS07_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+   fine_stencil = hypre_StructMatrixStencil(A);
+   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(RAP);
 
-            else
-            {
-               hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            break;
+   /*--------------------------------------------------------------------
+    * Switch statement to direct control to apropriate BoxLoop depending
+    * on stencil size. Default is full 27-point.
+    *-----------------------------------------------------------------*/
 
-            /*--------------------------------------------------------------
-             * Loop for symmetric 19-point fine grid operator; produces a
-             * symmetric 27-point coarse grid operator. We calculate only the
-             * lower triangular stencil entries: (below-southwest, below-south,
-             * below-southeast, below-west, below-center, below-east,
-             * below-northwest, below-north, below-northeast, center-southwest,
-             * center-south, center-southeast, center-west, and center-center).
-             *--------------------------------------------------------------*/
+   switch (fine_stencil_size)
+   {
 
-         case 19:
+      /*--------------------------------------------------------------
+       * Loop for symmetric 7-point fine grid operator; produces a
+       * symmetric 19-point coarse grid operator. We calculate only the
+       * lower triangular stencil entries: (below-south, below-west,
+       * below-center, below-east, below-north, center-south,
+       * center-west, and center-center).
+       *--------------------------------------------------------------*/
 
-            if ( constant_coefficient==1 )
-            {
-               hypre_PFMG3BuildRAPSym_onebox_FSS19_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            else
-            {
-               hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            break;
+      case 7:
 
-            /*--------------------------------------------------------------
-             * Loop for symmetric 27-point fine grid operator; produces a
-             * symmetric 27-point coarse grid operator. We calculate only the
-             * lower triangular stencil entries: (below-southwest, below-south,
-             * below-southeast, below-west, below-center, below-east,
-             * below-northwest, below-north, below-northeast, center-southwest,
-             * center-south, center-southeast, center-west, and center-center).
-             *--------------------------------------------------------------*/
+         if ( constant_coefficient==1 )
+         {
+            hypre_PFMG3BuildRAPSym_onebox_FSS07_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
 
-         default:
+         else
+         {
+            hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         break;
 
-            if ( constant_coefficient==1 )
-            {
-               hypre_PFMG3BuildRAPSym_onebox_FSS27_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            else
-            {
-               hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            break;
+         /*--------------------------------------------------------------
+          * Loop for symmetric 19-point fine grid operator; produces a
+          * symmetric 27-point coarse grid operator. We calculate only the
+          * lower triangular stencil entries: (below-southwest, below-south,
+          * below-southeast, below-west, below-center, below-east,
+          * below-northwest, below-north, below-northeast, center-southwest,
+          * center-south, center-southeast, center-west, and center-center).
+          *--------------------------------------------------------------*/
 
-      } /* end switch statement */
+      case 19:
 
-   } /* end ForBoxI */
+         if ( constant_coefficient==1 )
+         {
+            hypre_PFMG3BuildRAPSym_onebox_FSS19_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         else
+         {
+            hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         break;
+
+         /*--------------------------------------------------------------
+          * Loop for symmetric 27-point fine grid operator; produces a
+          * symmetric 27-point coarse grid operator. We calculate only the
+          * lower triangular stencil entries: (below-southwest, below-south,
+          * below-southeast, below-west, below-center, below-east,
+          * below-northwest, below-north, below-northeast, center-southwest,
+          * center-south, center-southeast, center-west, and center-center).
+          *--------------------------------------------------------------*/
+
+      default:
+
+         if ( constant_coefficient==1 )
+         {
+            hypre_PFMG3BuildRAPSym_onebox_FSS27_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         else
+         {
+            hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         break;
+
+   } /* end switch statement */
 
    return hypre_error_flag;
 }
@@ -313,6 +514,7 @@ HYPRE_Int
 hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -325,9 +527,6 @@ hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -367,13 +566,8 @@ hypre_PFMG3BuildRAPSym_onebox_FSS07_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
@@ -951,6 +1145,7 @@ HYPRE_Int
 hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -963,9 +1158,6 @@ hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -1018,13 +1210,8 @@ hypre_PFMG3BuildRAPSym_onebox_FSS19_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
@@ -1898,6 +2085,7 @@ HYPRE_Int
 hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -1910,9 +2098,6 @@ hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -1974,13 +2159,8 @@ hypre_PFMG3BuildRAPSym_onebox_FSS27_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
@@ -2993,9 +3173,6 @@ hypre_PFMG3BuildRAPNoSym( hypre_StructMatrix *A,
                           hypre_Index         cstride,
                           hypre_StructMatrix *RAP     )
 {
-   hypre_StructStencil  *fine_stencil;
-   HYPRE_Int             fine_stencil_size;
-
    hypre_StructGrid     *fgrid;
    HYPRE_Int            *fgrid_ids;
    hypre_StructGrid     *cgrid;
@@ -3005,9 +3182,6 @@ hypre_PFMG3BuildRAPNoSym( hypre_StructMatrix *A,
    HYPRE_Int             constant_coefficient;
    HYPRE_Int             constant_coefficient_A;
 
-   fine_stencil = hypre_StructMatrixStencil(A);
-   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
-
    fgrid = hypre_StructMatrixGrid(A);
    fgrid_ids = hypre_StructGridIDs(fgrid);
 
@@ -3037,82 +3211,114 @@ hypre_PFMG3BuildRAPNoSym( hypre_StructMatrix *A,
          fi++;
       }
 
-      switch (fine_stencil_size)
-      {
+      hypre_PFMG3BuildRAPNoSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                                  A, P, R, cdir, cindex, cstride, RAP);
+   } /* end ForBoxI */
 
-         /*--------------------------------------------------------------
-          * Loop for 7-point fine grid operator; produces upper triangular
-          * part of 19-point coarse grid operator. stencil entries:
-          * (above-north, above-east, above-center, above-west,
-          * above-south, center-north, and center-east).
-          *--------------------------------------------------------------*/
+   return hypre_error_flag;
+}
 
-         case 7:
+/*--------------------------------------------------------------------------
+ * hypre_PFMG3BuildRAPNoSymBox
+ *
+ * Upper triangular coefficients of RAP on cgrid_box (see
+ * hypre_PFMG3BuildRAPSymBox).
+ *--------------------------------------------------------------------------*/
 
-            if ( constant_coefficient == 1 )
-            {
-               hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            else
-            {
-               hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+HYPRE_Int
+hypre_PFMG3BuildRAPNoSymBox( HYPRE_Int           ci,
+                             HYPRE_Int           fi,
+                             hypre_Box          *cgrid_box,
+                             hypre_StructMatrix *A,
+                             hypre_StructMatrix *P,
+                             hypre_StructMatrix *R,
+                             HYPRE_Int           cdir,
+                             hypre_Index         cindex,
+                             hypre_Index         cstride,
+                             hypre_StructMatrix *RAP     )
+{
+   hypre_StructStencil  *fine_stencil;
+   HYPRE_Int             fine_stencil_size;
+   HYPRE_Int             constant_coefficient;
 
-            break;
+   fine_stencil = hypre_StructMatrixStencil(A);
+   fine_stencil_size = hypre_StructStencilSize(fine_stencil);
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(RAP);
 
-            /*--------------------------------------------------------------
-             * Loop for 19-point fine grid operator; produces upper triangular
-             * part of 27-point coarse grid operator. stencil entries:
-             * (above-northeast, above-north, above-northwest, above-east,
-             * above-center, above-west, above-southeast, above-south,
-             * above-southwest, center-northeast, center-north,
-             * center-northwest, and center-east).
-             *--------------------------------------------------------------*/
+   switch (fine_stencil_size)
+   {
 
-         case 19:
+      /*--------------------------------------------------------------
+       * Loop for 7-point fine grid operator; produces upper triangular
+       * part of 19-point coarse grid operator. stencil entries:
+       * (above-north, above-east, above-center, above-west,
+       * above-south, center-north, and center-east).
+       *--------------------------------------------------------------*/
 
-            if ( constant_coefficient == 1 )
-            {
-               hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            else
-            {
-               hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+      case 7:
 
-            break;
+         if ( constant_coefficient == 1 )
+         {
+            hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         else
+         {
+            hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
 
-            /*--------------------------------------------------------------
-             * Loop for 27-point fine grid operator; produces upper triangular
-             * part of 27-point coarse grid operator. stencil entries:
-             * (above-northeast, above-north, above-northwest, above-east,
-             * above-center, above-west, above-southeast, above-south,
-             * above-southwest, center-northeast, center-north,
-             * center-northwest, and center-east).
-             *--------------------------------------------------------------*/
+         break;
 
-         default:
+         /*--------------------------------------------------------------
+          * Loop for 19-point fine grid operator; produces upper triangular
+          * part of 27-point coarse grid operator. stencil entries:
+          * (above-northeast, above-north, above-northwest, above-east,
+          * above-center, above-west, above-southeast, above-south,
+          * above-southwest, center-northeast, center-north,
+          * center-northwest, and center-east).
+          *--------------------------------------------------------------*/
 
-            if ( constant_coefficient == 1 )
-            {
-               hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC1(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
-            else
-            {
-               hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
-                  ci, fi, A, P, R, cdir, cindex, cstride, RAP );
-            }
+      case 19:
 
-            break;
+         if ( constant_coefficient == 1 )
+         {
+            hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         else
+         {
+            hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
 
-      } /* end switch statement */
+         break;
 
-   } /* end ForBoxI */
+         /*--------------------------------------------------------------
+          * Loop for 27-point fine grid operator; produces upper triangular
+          * part of 27-point coarse grid operator. stencil entries:
+          * (above-northeast, above-north, above-northwest, above-east,
+          * above-center, above-west, above-southeast, above-south,
+          * above-southwest, center-northeast, center-north,
+          * center-northwest, and center-east).
+          *--------------------------------------------------------------*/
+
+      default:
+
+         if ( constant_coefficient == 1 )
+         {
+            hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC1(
+               ci, fi, A, P, R, cdir, cindex, cstride, RAP );
+         }
+         else
+         {
+            hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
+               ci, fi, cgrid_box, A, P, R, cdir, cindex, cstride, RAP );
+         }
+
+         break;
+
+   } /* end switch statement */
 
    return hypre_error_flag;
 }
@@ -3123,6 +3329,7 @@ HYPRE_Int
 hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -3135,9 +3342,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -3173,9 +3377,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
    /* fi = 0;
@@ -3186,7 +3387,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS07_CC0(
       fi++;
       }
    */
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
 
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
@@ -3713,6 +3913,7 @@ HYPRE_Int
 hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -3725,9 +3926,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -3774,9 +3972,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
    /* fi = 0;
@@ -3787,7 +3982,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS19_CC0(
       fi++;
       }
    */
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
 
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
@@ -4613,6 +4807,7 @@ HYPRE_Int
 hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
    HYPRE_Int             ci,
    HYPRE_Int             fi,
+   hypre_Box            *cgrid_box,
    hypre_StructMatrix *A,
    hypre_StructMatrix *P,
    hypre_StructMatrix *R,
@@ -4625,9 +4820,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
    hypre_Index           index;
    hypre_Index           index_temp;
 
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
@@ -4684,9 +4876,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-
    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
 
    /* fi = 0;
@@ -4697,7 +4886,6 @@ hypre_PFMG3BuildRAPNoSym_onebox_FSS27_CC0(
       fi++;
       }
    */
-   cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
 
    cstart = hypre_BoxIMin(cgrid_box);
    hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
@@ -174,6 +174,20 @@ hypre_PFMGRelaxSetJacobiWeight(void  *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTBlockDepth( void      *pfmg_relax_vdata,
+                               HYPRE_Int  tblock_depth )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_PointRelaxSetTBlockDepth((pfmg_relax_data -> relax_data), tblock_depth);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -73,6 +73,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight= (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             tblock_depth =     (pfmg_data -> tblock_depth);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -400,6 +401,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    tx_l[0] = hypre_StructVectorCreate(comm, grid_l[0]);
    hypre_StructVectorSetNumGhost(tx_l[0], x_num_ghost);
+   hypre_StructVectorSetDataAlignment(tx_l[0], hypre_StructVectorDataAlignment(x));
    hypre_StructVectorInitializeShell(tx_l[0]);
 
    hypre_StructVectorSetDataSize(tx_l[0], &data_size, &data_size_const);
@@ -409,6 +411,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       cdir = cdir_l[l];
 
       P_l[l]  = hypre_PFMGCreateInterpOp(A_l[l], P_grid_l[l+1], cdir, rap_type);
+      hypre_StructMatrixSetDataAlignment(P_l[l], hypre_StructMatrixDataAlignment(A));
       hypre_StructMatrixInitializeShell(P_l[l]);
       data_size += hypre_StructMatrixDataSize(P_l[l]);
       data_size_const += hypre_StructMatrixDataConstSize(P_l[l]);
@@ -432,22 +435,26 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
       A_l[l+1] = hypre_PFMGCreateRAPOp(RT_l[l], A_l[l], P_l[l],
                                        grid_l[l+1], cdir, rap_type);
+      hypre_StructMatrixSetDataAlignment(A_l[l+1], hypre_StructMatrixDataAlignment(A));
       hypre_StructMatrixInitializeShell(A_l[l+1]);
       data_size += hypre_StructMatrixDataSize(A_l[l+1]);
       data_size_const += hypre_StructMatrixDataConstSize(A_l[l+1]);
 
       b_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(b_l[l+1], b_num_ghost);
+      hypre_StructVectorSetDataAlignment(b_l[l+1], hypre_StructVectorDataAlignment(b));
       hypre_StructVectorInitializeShell(b_l[l+1]);
       hypre_StructVectorSetDataSize(b_l[l+1], &data_size, &data_size_const);
 
       x_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(x_l[l+1], x_num_ghost);
+      hypre_StructVectorSetDataAlignment(x_l[l+1], hypre_StructVectorDataAlignment(x));
       hypre_StructVectorInitializeShell(x_l[l+1]);
       hypre_StructVectorSetDataSize(x_l[l+1], &data_size, &data_size_const);
 
       tx_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(tx_l[l+1], x_num_ghost);
+      hypre_StructVectorSetDataAlignment(tx_l[l+1], hypre_StructVectorDataAlignment(x));
       hypre_StructVectorInitializeShell(tx_l[l+1]);
 #if defined(HYPRE_USING_CUDA)
       if (l+1 == num_level_GPU)
@@ -658,6 +665,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   hypre_PFMGRelaxSetTBlockDepth(relax_data_l[0], tblock_depth);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
@@ -678,6 +686,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            hypre_PFMGRelaxSetTBlockDepth(relax_data_l[l], tblock_depth);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
          }
       }
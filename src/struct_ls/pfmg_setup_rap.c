@@ -146,30 +146,22 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
       {
          case 2:
             /*--------------------------------------------------------------------
-             *    Set lower triangular (+ diagonal) coefficients
+             *    Set lower triangular (+ diagonal) coefficients, and for
+             *    non-symmetric A the upper triangular coefficients as well,
+             *    one coarse tile at a time
              *--------------------------------------------------------------------*/
-            hypre_PFMG2BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
-
-            /*--------------------------------------------------------------------
-             *    For non-symmetric A, set upper triangular coefficients as well
-             *--------------------------------------------------------------------*/
-            if(!hypre_StructMatrixSymmetric(A))
-               hypre_PFMG2BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
+            hypre_PFMG2BuildRAP(A, P, R, cdir, cindex, cstride, Ac_tmp);
 
             break;
 
          case 3:
 
             /*--------------------------------------------------------------------
-             *    Set lower triangular (+ diagonal) coefficients
-             *--------------------------------------------------------------------*/
-            hypre_PFMG3BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
-
-            /*--------------------------------------------------------------------
-             *    For non-symmetric A, set upper triangular coefficients as well
+             *    Set lower triangular (+ diagonal) coefficients, and for
+             *    non-symmetric A the upper triangular coefficients as well,
+             *    one coarse tile at a time
              *--------------------------------------------------------------------*/
-            if(!hypre_StructMatrixSymmetric(A))
-               hypre_PFMG3BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
+            hypre_PFMG3BuildRAP(A, P, R, cdir, cindex, cstride, Ac_tmp);
 
             break;
       }
@@ -202,7 +194,7 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
    {
      if (constant_coefficient == 0)
      {
-        hypre_TMemcpy(hypre_StructMatrixDataConst(Ac),hypre_StructMatrixData(Ac_tmp),HYPRE_Complex,hypre_StructMatrixDataSize(Ac_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
+        hypre_TMemcpy(hypre_StructMatrixDataConst(Ac),hypre_StructMatrixData(Ac_tmp),HYPRE_Complex,hypre_StructMatrixDataUsedSize(Ac_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
      }
      else if (constant_coefficient == 1)
      {
@@ -214,7 +206,7 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
         hypre_StructStencil *stencil_c       = hypre_StructMatrixStencil(Ac);
         HYPRE_Int stencil_size  = hypre_StructStencilSize(stencil_c);
         HYPRE_Complex       *Acdiag = hypre_StructMatrixDataConst(Ac) + stencil_size;
-        hypre_TMemcpy(Acdiag, hypre_StructMatrixData(Ac_tmp),HYPRE_Complex,hypre_StructMatrixDataSize(Ac_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
+        hypre_TMemcpy(Acdiag, hypre_StructMatrixData(Ac_tmp),HYPRE_Complex,hypre_StructMatrixDataUsedSize(Ac_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
      }
 
       hypre_HandleStructExecPolicy(hypre_handle()) = data_location_Ac == HYPRE_MEMORY_DEVICE ? HYPRE_EXEC_DEVICE : HYPRE_EXEC_HOST;
@@ -43,6 +43,9 @@ typedef struct
 
    hypre_ComputePkg      **compute_pkgs;
 
+   HYPRE_Int               tblock_depth;  /* max Jacobi sweeps per exchange */
+   void                   *tblock_data;
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -83,6 +86,8 @@ hypre_PointRelaxCreate( MPI_Comm  comm )
    (relax_data -> x)                = NULL;
    (relax_data -> t)                = NULL;
    (relax_data -> compute_pkgs)     = NULL;
+   (relax_data -> tblock_depth)     = 0;
+   (relax_data -> tblock_data)      = NULL;
 
    hypre_SetIndex3(stride, 1, 1, 1);
    hypre_SetIndex3(indices[0], 0, 0, 0);
@@ -123,6 +128,7 @@ hypre_PointRelaxDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_StructVectorDestroy(relax_data -> t);
       hypre_TFree(relax_data -> compute_pkgs, HYPRE_MEMORY_HOST);
+      hypre_PointRelaxTBlockDestroy(relax_data -> tblock_data);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -184,6 +190,7 @@ hypre_PointRelaxSetup( void               *relax_vdata,
       t = hypre_StructVectorCreate(hypre_StructVectorComm(b),
                                    hypre_StructVectorGrid(b));
       hypre_StructVectorSetNumGhost(t, hypre_StructVectorNumGhost(b));
+      hypre_StructVectorSetDataAlignment(t, hypre_StructVectorDataAlignment(b));
       hypre_StructVectorInitialize(t);
       hypre_StructVectorAssemble(t);
       (relax_data -> t) = t;
@@ -284,6 +291,21 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    (relax_data -> diag_rank)    = diag_rank;
    (relax_data -> compute_pkgs) = compute_pkgs;
 
+   /*----------------------------------------------------------
+    * Set up temporal blocking (plain Jacobi pointset only)
+    *----------------------------------------------------------*/
+
+   hypre_PointRelaxTBlockDestroy(relax_data -> tblock_data);
+   (relax_data -> tblock_data) = NULL;
+   if ( (relax_data -> tblock_depth) > 1 && num_pointsets == 1 &&
+        pointset_sizes[0] == 1 &&
+        hypre_IndexEqual(pointset_strides[0], 1, ndim) &&
+        hypre_IndexEqual(pointset_indices[0][0], 0, ndim) )
+   {
+      (relax_data -> tblock_data) =
+         hypre_PointRelaxTBlockCreate(A, (relax_data -> tblock_depth));
+   }
+
    /*-----------------------------------------------------
     * Compute flops
     *-----------------------------------------------------*/
@@ -386,6 +408,18 @@ hypre_PointRelax( void               *relax_vdata,
       return hypre_error_flag;
    }
 
+   /* temporally blocked Jacobi sweeps */
+   if ( (relax_data -> tblock_data) && tol == 0.0 )
+   {
+      hypre_PointRelaxTBlock((relax_data -> tblock_data), b, x,
+                             weight, max_iter, zero_guess);
+      (relax_data -> num_iterations) = max_iter;
+
+      hypre_IncFLOPCount(relax_data -> flops);
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
    if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(x, 0);
 
@@ -1312,6 +1346,25 @@ hypre_PointRelaxSetWeight( void    *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxSetTBlockDepth
+ *
+ * Do up to depth plain Jacobi sweeps per ghost exchange (temporal blocking,
+ * see point_relax_tblock.c).  Values less than 2 turn it off.  Takes effect
+ * at the next setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxSetTBlockDepth( void      *relax_vdata,
+                                HYPRE_Int  depth )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   (relax_data -> tblock_depth) = depth;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
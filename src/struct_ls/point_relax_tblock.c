@@ -0,0 +1,593 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Temporally blocked (weighted) Jacobi for hypre_PointRelax
+ *
+ * Up to `depth' Jacobi sweeps are done per ghost exchange.  The matrix, the
+ * right-hand side and the iterate are kept in copies with depth*r ghost
+ * layers (r is the stencil radius), so every process can redo the sweeps of
+ * its neighbors on the ghost layers instead of exchanging after each sweep.
+ *
+ * The sweeps of a group move through the box as a wavefront along the last
+ * dimension: when sweep 1 is done on plane z, sweep 2 is done on plane z-r,
+ * sweep 3 on plane z-2r, and so on.  The planes of the matrix are then still
+ * in cache when the later sweeps reach them, so the matrix is read from
+ * memory once per group of sweeps instead of once per sweep.  The iterates of
+ * the intermediate sweeps are kept in small ring buffers of 2r+1 planes.  In
+ * 3D, the boxes are also cut into tiles in the second dimension so that the
+ * planes stay small; sweep k of a group of m sweeps is done on the tile grown
+ * by (m-k)*r, so neighboring tiles redo some of the work on their borders.
+ *
+ * The price is a copy of the matrix with the deeper ghost layers.  Only the
+ * plain Jacobi pointset (one pointset, unit stride) with variable coefficients
+ * in 2D and 3D is supported; hypre_PointRelaxTBlockCreate returns NULL
+ * otherwise.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+/* tile size in the second dimension (3D only) */
+#define hypre_TBlockTileSize 32
+
+/* ring buffer slot of plane z */
+#define hypre_TBlockSlot(z, nslots) ((((z) % (nslots)) + (nslots)) % (nslots))
+
+typedef struct
+{
+   HYPRE_Int               depth;       /* max number of sweeps per exchange */
+   HYPRE_Int               radius;      /* stencil radius */
+
+   hypre_StructMatrix     *A;           /* A, b and x with depth*radius ghosts */
+   hypre_StructVector     *b;
+   hypre_StructVector     *x;
+   hypre_CommPkg          *comm_pkg;
+   HYPRE_Int               diag_rank;
+
+   HYPRE_Int               num_tiles;
+   hypre_BoxArray         *tiles;
+   HYPRE_Int              *tile_boxnums;
+
+   HYPRE_Int               work_size;   /* size of the ring buffers of a thread */
+   HYPRE_Real             *work;
+
+} hypre_PointRelaxTBlockData;
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxTBlockCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PointRelaxTBlockCreate( hypre_StructMatrix *A,
+                              HYPRE_Int           depth )
+{
+   hypre_PointRelaxTBlockData *tblock_data;
+
+   MPI_Comm               comm    = hypre_StructMatrixComm(A);
+   hypre_StructGrid      *grid    = hypre_StructMatrixGrid(A);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int              ndim    = hypre_StructMatrixNDim(A);
+   hypre_IndexRef         max_distance = hypre_StructGridMaxDistance(grid);
+   hypre_IndexRef         periodic     = hypre_StructGridPeriodic(grid);
+   hypre_Box             *bounding_box = hypre_StructGridBoundingBox(grid);
+   hypre_BoxArray        *boxes   = hypre_StructGridBoxes(grid);
+
+   hypre_StructMatrix    *Aw;
+   hypre_StructVector    *bw, *xw;
+   hypre_CommInfo        *comm_info;
+   hypre_CommPkg         *comm_pkg;
+   HYPRE_Int              num_ghost[2*HYPRE_MAXDIM];
+   hypre_Index            diag_index;
+
+   hypre_BoxArray        *tiles;
+   HYPRE_Int             *tile_boxnums;
+   HYPRE_Int              num_tiles, work_size, plane, ilo;
+
+   hypre_Box             *box, *tile;
+   hypre_Box             *A_dbox, *Aw_dbox;
+   HYPRE_Real            *Ap, *Awp;
+   hypre_IndexRef         start;
+   hypre_Index            stride, loop_size;
+   HYPRE_Int              radius, ghost, diag_rank;
+   HYPRE_Int              i, d, si, t;
+
+   if (depth < 2 || ndim < 2 || hypre_StructMatrixConstantCoefficient(A) != 0)
+   {
+      return NULL;
+   }
+
+   hypre_SetIndex(diag_index, 0);
+   diag_rank = hypre_StructStencilElementRank(stencil, diag_index);
+   if (diag_rank < 0)
+   {
+      return NULL;
+   }
+
+   radius = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         radius = hypre_max(radius, hypre_abs(hypre_IndexD(stencil_shape[si], d)));
+      }
+   }
+   if (radius == 0)
+   {
+      return NULL;
+   }
+
+   /* the ghost layers must not reach further than the neighbor information
+      kept by the grid, nor further than one period of a periodic dimension
+      (they are filled from the images one period away).  If the grid does
+      not fill its period, the deeper layers would reach images that are no
+      neighbors of the grid. */
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(max_distance, d) > 0)
+      {
+         depth = hypre_min(depth, hypre_IndexD(max_distance, d) / radius);
+      }
+      if (hypre_IndexD(periodic, d) > 0)
+      {
+         if (hypre_BoxSizeD(bounding_box, d) != hypre_IndexD(periodic, d))
+         {
+            return NULL;
+         }
+         depth = hypre_min(depth, hypre_IndexD(periodic, d) / radius);
+      }
+   }
+   if (depth < 2)
+   {
+      return NULL;
+   }
+   ghost = depth*radius;
+
+   for (d = 0; d < HYPRE_MAXDIM; d++)
+   {
+      num_ghost[2*d]   = (d < ndim) ? ghost : 0;
+      num_ghost[2*d+1] = (d < ndim) ? ghost : 0;
+   }
+
+   /*----------------------------------------------------------
+    * Copy A into a matrix with deeper ghost layers.  Assemble fills the ghost
+    * layers from the neighbors and sets the domain boundary to the identity.
+    *----------------------------------------------------------*/
+
+   Aw = hypre_StructMatrixCreate(comm, grid, stencil);
+   hypre_StructMatrixSetNumGhost(Aw, num_ghost);
+   hypre_StructMatrixInitialize(Aw);
+
+   hypre_SetIndex(stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      Aw_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(Aw), i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap  = hypre_StructMatrixBoxData(A, i, si);
+         Awp = hypre_StructMatrixBoxData(Aw, i, si);
+
+#define DEVICE_VAR is_device_ptr(Awp,Ap)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             A_dbox, start, stride, Ai,
+                             Aw_dbox, start, stride, Awi);
+         {
+            Awp[Awi] = Ap[Ai];
+         }
+         hypre_BoxLoop2End(Ai, Awi);
+#undef DEVICE_VAR
+      }
+   }
+   hypre_StructMatrixAssemble(Aw);
+
+   bw = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(bw, num_ghost);
+   hypre_StructVectorInitialize(bw);
+   hypre_StructVectorAssemble(bw);
+
+   xw = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(xw, num_ghost);
+   hypre_StructVectorInitialize(xw);
+   hypre_StructVectorAssemble(xw);
+
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(xw),
+                       hypre_StructVectorDataSpace(xw), 1, NULL, 0,
+                       comm, &comm_pkg);
+   hypre_CommInfoDestroy(comm_info);
+
+   /*----------------------------------------------------------
+    * Cut the boxes into tiles (in the second dimension, 3D only).  Each
+    * thread needs depth-1 ring buffers of 2r+1 planes of a tile grown by
+    * (depth-1)*r.
+    *----------------------------------------------------------*/
+
+   num_tiles = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (ndim == 3)
+      {
+         num_tiles += (hypre_BoxSizeD(box, 1) + hypre_TBlockTileSize - 1) / hypre_TBlockTileSize;
+      }
+      else
+      {
+         num_tiles++;
+      }
+   }
+
+   tiles        = hypre_BoxArrayCreate(num_tiles, ndim);
+   tile_boxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+   work_size    = 0;
+
+   t = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) == 0)
+      {
+         continue;
+      }
+      ilo = hypre_BoxIMinD(box, 1);
+      while (ilo <= hypre_BoxIMaxD(box, 1))
+      {
+         tile = hypre_BoxArrayBox(tiles, t);
+         hypre_CopyBox(box, tile);
+         if (ndim == 3)
+         {
+            hypre_BoxIMinD(tile, 1) = ilo;
+            hypre_BoxIMaxD(tile, 1) = hypre_min(ilo + hypre_TBlockTileSize - 1,
+                                                hypre_BoxIMaxD(box, 1));
+         }
+         tile_boxnums[t] = i;
+         ilo = hypre_BoxIMaxD(tile, 1) + 1;
+
+         plane = hypre_BoxSizeD(tile, 0) + 2*(depth-1)*radius;
+         if (ndim == 3)
+         {
+            plane *= hypre_BoxSizeD(tile, 1) + 2*(depth-1)*radius;
+         }
+         work_size = hypre_max(work_size, (depth-1)*(2*radius+1)*plane);
+         t++;
+      }
+   }
+   hypre_BoxArraySetSize(tiles, t);
+
+   tblock_data = hypre_CTAlloc(hypre_PointRelaxTBlockData, 1, HYPRE_MEMORY_HOST);
+
+   (tblock_data -> depth)        = depth;
+   (tblock_data -> radius)       = radius;
+   (tblock_data -> A)            = Aw;
+   (tblock_data -> b)            = bw;
+   (tblock_data -> x)            = xw;
+   (tblock_data -> comm_pkg)     = comm_pkg;
+   (tblock_data -> diag_rank)    = diag_rank;
+   (tblock_data -> num_tiles)    = t;
+   (tblock_data -> tiles)        = tiles;
+   (tblock_data -> tile_boxnums) = tile_boxnums;
+   (tblock_data -> work_size)    = work_size;
+   (tblock_data -> work)         = hypre_TAlloc(HYPRE_Real, work_size*hypre_NumThreads(),
+                                                HYPRE_MEMORY_HOST);
+
+   return (void *) tblock_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxTBlockDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxTBlockDestroy( void *tblock_vdata )
+{
+   hypre_PointRelaxTBlockData *tblock_data = (hypre_PointRelaxTBlockData *)tblock_vdata;
+
+   if (tblock_data)
+   {
+      hypre_StructMatrixDestroy(tblock_data -> A);
+      hypre_StructVectorDestroy(tblock_data -> b);
+      hypre_StructVectorDestroy(tblock_data -> x);
+      hypre_CommPkgDestroy(tblock_data -> comm_pkg);
+      hypre_BoxArrayDestroy(tblock_data -> tiles);
+      hypre_TFree(tblock_data -> tile_boxnums, HYPRE_MEMORY_HOST);
+      hypre_TFree(tblock_data -> work, HYPRE_MEMORY_HOST);
+      hypre_TFree(tblock_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxTBlockTile
+ *
+ * Does num_sweeps sweeps on one tile, starting from the values in the ghosted
+ * copy of x, and writes the result for the tile into x.  Sweep k works on the
+ * tile grown by (num_sweeps-k)*radius and, for k < num_sweeps, writes into
+ * ring buffer k.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PointRelaxTBlockTile( hypre_PointRelaxTBlockData *tblock_data,
+                            HYPRE_Int                   num_sweeps,
+                            HYPRE_Real                  weight,
+                            hypre_Box                  *tile,
+                            HYPRE_Int                   bi,
+                            hypre_StructVector         *x,
+                            HYPRE_Real                 *work )
+{
+   hypre_StructMatrix    *A         = (tblock_data -> A);
+   hypre_StructVector    *bw        = (tblock_data -> b);
+   hypre_StructVector    *xw        = (tblock_data -> x);
+   HYPRE_Int              radius    = (tblock_data -> radius);
+   HYPRE_Int              diag_rank = (tblock_data -> diag_rank);
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   hypre_StructStencil   *stencil   = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+
+   /* the wavefront moves along the last dimension */
+   HYPRE_Int              wd     = ndim - 1;
+   HYPRE_Int              nslots = 2*radius + 1;
+   HYPRE_Int              halo   = (num_sweeps-1)*radius;
+
+   hypre_Box             *A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), bi);
+   hypre_Box             *x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), bi);
+   HYPRE_Real           **Ap;
+   HYPRE_Real            *Ad;
+   HYPRE_Real            *bp  = hypre_StructVectorBoxData(bw, bi);
+   HYPRE_Real            *xwp = hypre_StructVectorBoxData(xw, bi);
+   HYPRE_Real            *xp  = hypre_StructVectorBoxData(x, bi);
+   HYPRE_Real            *src, *dst, *sk, *dk, *ak;
+   HYPRE_Real            *a0, *a1, *a2, *a3, *s0, *s1, *s2, *s3;
+   HYPRE_Real             one_minus_weight = 1.0 - weight;
+
+   hypre_Index            index;
+   HYPRE_Int             *A_off, *w_off, *w_dz, *p_off, *off;
+   HYPRE_Int              xlo, ylo, yhi, zlo, zhi, nx, ny, plane;
+   HYPRE_Int              num_off, g, n, p, y, z, k, j, si, Ai, li;
+
+   xlo = hypre_BoxIMinD(tile, 0);
+   zlo = hypre_BoxIMinD(tile, wd);
+   zhi = hypre_BoxIMaxD(tile, wd);
+
+   /* layout of a plane of the ring buffers: the tile grown by halo */
+   nx = hypre_BoxSizeD(tile, 0) + 2*halo;
+   ny = (ndim == 3) ? hypre_BoxSizeD(tile, 1) + 2*halo : 1;
+   plane = nx*ny;
+
+   /* off-diagonal coefficients; offsets into the ghosted copy of x (first
+      sweep), and offsets within a plane and across planes (later sweeps) */
+   Ap    = hypre_TAlloc(HYPRE_Real *, stencil_size, HYPRE_MEMORY_HOST);
+   A_off = hypre_TAlloc(HYPRE_Int, 4*stencil_size, HYPRE_MEMORY_HOST);
+   w_off = A_off + stencil_size;
+   w_dz  = A_off + 2*stencil_size;
+   p_off = A_off + 3*stencil_size;
+   num_off = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (si != diag_rank)
+      {
+         Ap[num_off]    = hypre_StructMatrixBoxData(A, bi, si);
+         A_off[num_off] = hypre_BoxOffsetDistance(A_dbox, stencil_shape[si]);
+         w_off[num_off] = hypre_IndexD(stencil_shape[si], 0);
+         if (ndim == 3)
+         {
+            w_off[num_off] += hypre_IndexD(stencil_shape[si], 1) * nx;
+         }
+         w_dz[num_off]  = hypre_IndexD(stencil_shape[si], wd);
+         num_off++;
+      }
+   }
+   Ad = hypre_StructMatrixBoxData(A, bi, diag_rank);
+
+   hypre_SetIndex(index, 0);
+   for (p = zlo - halo; p <= zhi + halo; p++)
+   {
+      for (k = 1; k <= num_sweeps; k++)
+      {
+         /* sweep k is on plane z of the tile grown by g */
+         g = (num_sweeps-k)*radius;
+         z = p - (k-1)*radius;
+         if (z < zlo - g || z > zhi + g)
+         {
+            continue;
+         }
+
+         if (k == 1)
+         {
+            src = xwp;
+            off = A_off;
+         }
+         else
+         {
+            src = work + (k-2)*nslots*plane;
+            for (si = 0; si < num_off; si++)
+            {
+               p_off[si] = (hypre_TBlockSlot(z + w_dz[si], nslots) -
+                            hypre_TBlockSlot(z, nslots))*plane + w_off[si];
+            }
+            off = p_off;
+         }
+         dst = (k < num_sweeps) ? work + (k-1)*nslots*plane : xp;
+
+         n = hypre_BoxSizeD(tile, 0) + 2*g;
+         ylo = (ndim == 3) ? hypre_BoxIMinD(tile, 1) - g : 0;
+         yhi = (ndim == 3) ? hypre_BoxIMaxD(tile, 1) + g : 0;
+         for (y = ylo; y <= yhi; y++)
+         {
+            hypre_IndexD(index, 0)  = xlo - g;
+            hypre_IndexD(index, 1)  = y;
+            hypre_IndexD(index, wd) = z;
+            Ai = hypre_BoxIndexRank(A_dbox, index);
+            li = (halo - g);
+            if (ndim == 3)
+            {
+               li += (y - hypre_BoxIMinD(tile, 1) + halo)*nx;
+            }
+
+            if (k == 1)
+            {
+               sk = src + Ai;
+            }
+            else
+            {
+               sk = src + hypre_TBlockSlot(z, nslots)*plane + li;
+            }
+            if (k < num_sweeps)
+            {
+               dk = dst + hypre_TBlockSlot(z, nslots)*plane + li;
+            }
+            else
+            {
+               dk = dst + hypre_BoxIndexRank(x_dbox, index);
+            }
+
+            /* dst = b - (A - D) src */
+            for (j = 0; j < n; j++)
+            {
+               dk[j] = bp[Ai + j];
+            }
+            for (si = 0; si < num_off; si += 4)
+            {
+               a0 = Ap[si] + Ai;
+               s0 = sk + off[si];
+               switch (hypre_min(4, num_off - si))
+               {
+                  case 4:
+                     a1 = Ap[si+1] + Ai;  s1 = sk + off[si+1];
+                     a2 = Ap[si+2] + Ai;  s2 = sk + off[si+2];
+                     a3 = Ap[si+3] + Ai;  s3 = sk + off[si+3];
+                     for (j = 0; j < n; j++)
+                     {
+                        dk[j] -= a0[j] * s0[j] + a1[j] * s1[j] + a2[j] * s2[j] + a3[j] * s3[j];
+                     }
+                     break;
+
+                  case 3:
+                     a1 = Ap[si+1] + Ai;  s1 = sk + off[si+1];
+                     a2 = Ap[si+2] + Ai;  s2 = sk + off[si+2];
+                     for (j = 0; j < n; j++)
+                     {
+                        dk[j] -= a0[j] * s0[j] + a1[j] * s1[j] + a2[j] * s2[j];
+                     }
+                     break;
+
+                  case 2:
+                     a1 = Ap[si+1] + Ai;  s1 = sk + off[si+1];
+                     for (j = 0; j < n; j++)
+                     {
+                        dk[j] -= a0[j] * s0[j] + a1[j] * s1[j];
+                     }
+                     break;
+
+                  case 1:
+                     for (j = 0; j < n; j++)
+                     {
+                        dk[j] -= a0[j] * s0[j];
+                     }
+                     break;
+               }
+            }
+
+            /* dst = w D^{-1} dst + (1-w) src */
+            ak = Ad + Ai;
+            for (j = 0; j < n; j++)
+            {
+               dk[j] = weight * dk[j] / ak[j] + one_minus_weight * sk[j];
+            }
+         }
+      }
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(A_off, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxTBlock
+ *
+ * Does num_sweeps weighted Jacobi sweeps on x, in groups of up to depth
+ * sweeps per ghost exchange.  The result is the same as that of num_sweeps
+ * separate sweeps, up to rounding.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxTBlock( void               *tblock_vdata,
+                        hypre_StructVector *b,
+                        hypre_StructVector *x,
+                        HYPRE_Real          weight,
+                        HYPRE_Int           num_sweeps,
+                        HYPRE_Int           zero_guess )
+{
+   hypre_PointRelaxTBlockData *tblock_data = (hypre_PointRelaxTBlockData *)tblock_vdata;
+
+   HYPRE_Int              depth     = (tblock_data -> depth);
+   hypre_StructVector    *bw        = (tblock_data -> b);
+   hypre_StructVector    *xw        = (tblock_data -> x);
+   hypre_CommPkg         *comm_pkg  = (tblock_data -> comm_pkg);
+   HYPRE_Int              num_tiles = (tblock_data -> num_tiles);
+   hypre_BoxArray        *tiles     = (tblock_data -> tiles);
+   HYPRE_Int             *tile_boxnums = (tblock_data -> tile_boxnums);
+   HYPRE_Int              work_size = (tblock_data -> work_size);
+   HYPRE_Real            *work      = (tblock_data -> work);
+
+   hypre_CommHandle      *comm_handle;
+   HYPRE_Int              sweep, num_fused, t;
+
+   /*----------------------------------------------------------
+    * The ghost layers of b are exchanged once
+    *----------------------------------------------------------*/
+
+   hypre_StructCopy(b, bw);
+   hypre_InitializeCommunication(comm_pkg,
+                                 hypre_StructVectorData(bw),
+                                 hypre_StructVectorData(bw), 0, 0,
+                                 &comm_handle);
+   hypre_FinalizeCommunication(comm_handle);
+
+   for (sweep = 0; sweep < num_sweeps; sweep += num_fused)
+   {
+      num_fused = hypre_min(depth, num_sweeps - sweep);
+
+      if (zero_guess && sweep == 0)
+      {
+         hypre_StructVectorSetConstantValues(xw, 0.0);
+      }
+      else
+      {
+         hypre_StructCopy(x, xw);
+      }
+      hypre_InitializeCommunication(comm_pkg,
+                                    hypre_StructVectorData(xw),
+                                    hypre_StructVectorData(xw), 0, 0,
+                                    &comm_handle);
+      hypre_FinalizeCommunication(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_tiles; t++)
+      {
+         hypre_PointRelaxTBlockTile(tblock_data, num_fused, weight,
+                                    hypre_BoxArrayBox(tiles, t), tile_boxnums[t], x,
+                                    work + work_size*hypre_GetThreadNum());
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -179,10 +179,11 @@ hypre_SemiInterp( void               *interp_vdata,
    {
       xc_tmp = hypre_StructVectorCreate(hypre_MPI_COMM_WORLD, cgrid);
       hypre_StructVectorSetNumGhost(xc_tmp, hypre_StructVectorNumGhost(xc));
+      hypre_StructVectorSetDataAlignment(xc_tmp, hypre_StructVectorDataAlignment(xc));
       hypre_StructGridDataLocation(cgrid) = data_location_f;
       hypre_StructVectorInitialize(xc_tmp);
       hypre_StructVectorAssemble(xc_tmp);
-      hypre_TMemcpy(hypre_StructVectorData(xc_tmp), hypre_StructVectorData(xc), HYPRE_Complex,hypre_StructVectorDataSize(xc),HYPRE_MEMORY_DEVICE,HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_StructVectorData(xc_tmp), hypre_StructVectorData(xc), HYPRE_Complex,hypre_StructVectorDataUsedSize(xc),HYPRE_MEMORY_DEVICE,HYPRE_MEMORY_HOST);
    }
    else
    {
@@ -174,6 +174,7 @@ hypre_SemiRestrict( void               *restrict_vdata,
    {
       rc_tmp = hypre_StructVectorCreate(hypre_MPI_COMM_WORLD, cgrid);
       hypre_StructVectorSetNumGhost(rc_tmp, hypre_StructVectorNumGhost(rc));
+      hypre_StructVectorSetDataAlignment(rc_tmp, hypre_StructVectorDataAlignment(rc));
       hypre_StructGridDataLocation(cgrid) = data_location_f;
       hypre_StructVectorInitialize(rc_tmp);
       hypre_StructVectorAssemble(rc_tmp);
@@ -295,7 +296,7 @@ hypre_SemiRestrict( void               *restrict_vdata,
 #if defined(HYPRE_USING_CUDA)
    if (data_location_f != data_location_c)
    {
-      hypre_TMemcpy(hypre_StructVectorData(rc),hypre_StructVectorData(rc_tmp),HYPRE_Complex,hypre_StructVectorDataSize(rc_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
+      hypre_TMemcpy(hypre_StructVectorData(rc),hypre_StructVectorData(rc_tmp),HYPRE_Complex,hypre_StructVectorDataUsedSize(rc_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
       hypre_StructVectorDestroy(rc_tmp);
       hypre_StructGridDataLocation(cgrid) = data_location_c;
    }
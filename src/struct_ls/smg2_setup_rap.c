@@ -135,10 +135,158 @@ hypre_SMG2CreateRAPOp( hypre_StructMatrix *R,
  * hypre_SMG2BuildRAPNoSym to build the upper triangular part of RAP
  * (excluding the diagonal). So using symmetric storage, only the
  * first routine would be called. With full storage both would need to
- * be called.
+ * be called.  hypre_SMG2BuildRAP calls one or both of them tile by tile.
  *
  *--------------------------------------------------------------------------*/
 
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#define hypre_SMG2RAPTileVolume 0
+#else
+#define hypre_SMG2RAPTileVolume 4096
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_SMG2RAPTileSize
+ *
+ * Size of the tiles of cgrid_box: whole lines in the first dimension, and
+ * as many of them as fit into hypre_SMG2RAPTileVolume points.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SMG2RAPTileSize( hypre_Box   *cgrid_box,
+                       hypre_Index  tile_size )
+{
+   hypre_BoxGetSize(cgrid_box, tile_size);
+   tile_size[1] = hypre_min(tile_size[1],
+                            hypre_max(1, hypre_SMG2RAPTileVolume / tile_size[0]));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMG2BuildRAP
+ *
+ * Builds RAP, both triangular parts if A is not symmetric.  The coarse boxes
+ * are cut into tiles of about hypre_SMG2RAPTileVolume points (whole lines
+ * in the first dimension), and both parts are computed for one tile before
+ * moving to the next, as in hypre_PFMG3BuildRAP.  The tiles are distributed
+ * over the OpenMP threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMG2BuildRAP( hypre_StructMatrix *A,
+                    hypre_StructMatrix *PT,
+                    hypre_StructMatrix *R,
+                    hypre_StructMatrix *RAP,
+                    hypre_Index         cindex,
+                    hypre_Index         cstride )
+{
+   hypre_StructGrid     *fgrid     = hypre_StructMatrixGrid(A);
+   HYPRE_Int            *fgrid_ids = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid     *cgrid     = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray       *cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int            *cgrid_ids = hypre_StructGridIDs(cgrid);
+   HYPRE_Int             symmetric = hypre_StructMatrixSymmetric(A);
+
+   hypre_Box            *cgrid_box;
+   hypre_Box            *tile;
+   hypre_BoxArray       *tiles;
+   HYPRE_Int            *tile_cboxnums;
+   HYPRE_Int            *tile_fboxnums;
+   HYPRE_Int             num_tiles;
+   hypre_Index           tile_size;
+   HYPRE_Int             fi, ci, j, t;
+
+   /*----------------------------------------------------------
+    * Count the tiles.  Boxes that are not tiled are computed
+    * here.
+    *----------------------------------------------------------*/
+
+   num_tiles = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (hypre_SMG2RAPTileVolume == 0)
+      {
+         hypre_SMG2BuildRAPSymBox(ci, fi, cgrid_box, A, PT, R, RAP, cindex, cstride);
+         if (!symmetric)
+         {
+            hypre_SMG2BuildRAPNoSymBox(ci, fi, cgrid_box, A, PT, R, RAP, cindex, cstride);
+         }
+      }
+      else if (hypre_BoxVolume(cgrid_box) > 0)
+      {
+         hypre_SMG2RAPTileSize(cgrid_box, tile_size);
+         num_tiles += (hypre_BoxSizeD(cgrid_box, 1) + tile_size[1] - 1) / tile_size[1];
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Cut the coarse boxes into tiles
+    *----------------------------------------------------------*/
+
+   tiles         = hypre_BoxArrayCreate(num_tiles, 2);
+   tile_cboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+   tile_fboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+
+   t = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (hypre_SMG2RAPTileVolume == 0 || hypre_BoxVolume(cgrid_box) == 0)
+      {
+         continue;
+      }
+
+      hypre_SMG2RAPTileSize(cgrid_box, tile_size);
+      for (j = hypre_BoxIMinD(cgrid_box, 1); j <= hypre_BoxIMaxD(cgrid_box, 1); j += tile_size[1])
+      {
+         tile = hypre_BoxArrayBox(tiles, t);
+         hypre_CopyBox(cgrid_box, tile);
+         hypre_BoxIMinD(tile, 1) = j;
+         hypre_BoxIMaxD(tile, 1) = hypre_min(j + tile_size[1] - 1, hypre_BoxIMaxD(cgrid_box, 1));
+         tile_cboxnums[t] = ci;
+         tile_fboxnums[t] = fi;
+         t++;
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Compute the tiles
+    *----------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t, tile) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_tiles; t++)
+   {
+      tile = hypre_BoxArrayBox(tiles, t);
+      hypre_SMG2BuildRAPSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                               A, PT, R, RAP, cindex, cstride);
+      if (!symmetric)
+      {
+         hypre_SMG2BuildRAPNoSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                                    A, PT, R, RAP, cindex, cstride);
+      }
+   }
+
+   hypre_BoxArrayDestroy(tiles);
+   hypre_TFree(tile_cboxnums, HYPRE_MEMORY_HOST);
+   hypre_TFree(tile_fboxnums, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_SMG2BuildRAPSym( hypre_StructMatrix *A,
                        hypre_StructMatrix *PT,
@@ -146,28 +294,66 @@ hypre_SMG2BuildRAPSym( hypre_StructMatrix *A,
                        hypre_StructMatrix *RAP,
                        hypre_Index         cindex,
                        hypre_Index         cstride )
-
 {
+   hypre_StructGrid     *fgrid;
+   HYPRE_Int            *fgrid_ids;
+   hypre_StructGrid     *cgrid;
+   hypre_BoxArray       *cgrid_boxes;
+   HYPRE_Int            *cgrid_ids;
+   HYPRE_Int             fi, ci;
+
+   fgrid = hypre_StructMatrixGrid(A);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+
+   cgrid = hypre_StructMatrixGrid(RAP);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      hypre_SMG2BuildRAPSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                               A, PT, R, RAP, cindex, cstride);
+   } /* end ForBoxI */
+
+   return hypre_error_flag;
+}
 
+/*--------------------------------------------------------------------------
+ * hypre_SMG2BuildRAPSymBox
+ *
+ * Lower triangular (plus diagonal) coefficients of RAP on cgrid_box, which
+ * is box ci of the coarse grid or a part of it.  Box fi of the fine grid is
+ * the one that box ci was coarsened from.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMG2BuildRAPSymBox( HYPRE_Int           ci,
+                          HYPRE_Int           fi,
+                          hypre_Box          *cgrid_box,
+                          hypre_StructMatrix *A,
+                          hypre_StructMatrix *PT,
+                          hypre_StructMatrix *R,
+                          hypre_StructMatrix *RAP,
+                          hypre_Index         cindex,
+                          hypre_Index         cstride )
+{
    hypre_Index           index;
 
    hypre_StructStencil  *fine_stencil;
    HYPRE_Int             fine_stencil_size;
 
-   hypre_StructGrid     *fgrid;
-   HYPRE_Int            *fgrid_ids;
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   HYPRE_Int            *cgrid_ids;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
    hypre_IndexRef        stridef;
    hypre_Index           loop_size;
 
-   HYPRE_Int             fi, ci;
-
    hypre_Box            *A_dbox;
    hypre_Box            *PT_dbox;
    hypre_Box            *R_dbox;
@@ -192,257 +378,239 @@ hypre_SMG2BuildRAPSym( hypre_StructMatrix *A,
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   fgrid = hypre_StructMatrixGrid(A);
-   fgrid_ids = hypre_StructGridIDs(fgrid);
-
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-   cgrid_ids = hypre_StructGridIDs(cgrid);
-
-   fi = 0;
-   hypre_ForBoxI(ci, cgrid_boxes)
+   cstart = hypre_BoxIMin(cgrid_box);
+   hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
+
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+   PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
+   R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+   RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for interpolation operator:
+    * pa is pointer for weight for f-point above c-point
+    * pb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,1,0);
+   pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
+
+   hypre_SetIndex3(index,0,-1,0);
+   pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for restriction operator:
+    * ra is pointer for weight for f-point above c-point
+    * rb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,1,0);
+   ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+   hypre_SetIndex3(index,0,-1,0);
+   rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for 5-point fine grid operator:
+    *
+    * a_cc is pointer for center coefficient
+    * a_cw is pointer for west coefficient
+    * a_ce is pointer for east coefficient
+    * a_cs is pointer for south coefficient
+    * a_cn is pointer for north coefficient
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,0);
+   a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,-1,0,0);
+   a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,1,0,0);
+   a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,0,-1,0);
+   a_cs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,0,1,0);
+   a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 9-point fine grid operator:
+    *
+    * a_csw is pointer for southwest coefficient
+    * a_cse is pointer for southeast coefficient
+    * a_cnw is pointer for northwest coefficient
+    * a_cne is pointer for northeast coefficient
+    *-----------------------------------------------------------------*/
+
+   if(fine_stencil_size > 5)
    {
-      while (fgrid_ids[fi] != cgrid_ids[ci])
-      {
-         fi++;
-      }
-
-      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
-      cstart = hypre_BoxIMin(cgrid_box);
-      hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
-
-      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
-      PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
-      R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
-      RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for interpolation operator:
-       * pa is pointer for weight for f-point above c-point
-       * pb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,1,0);
-      pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
-
-      hypre_SetIndex3(index,0,-1,0);
-      pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for restriction operator:
-       * ra is pointer for weight for f-point above c-point
-       * rb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,1,0);
-      ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
-
-      hypre_SetIndex3(index,0,-1,0);
-      rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for 5-point fine grid operator:
-       *
-       * a_cc is pointer for center coefficient
-       * a_cw is pointer for west coefficient
-       * a_ce is pointer for east coefficient
-       * a_cs is pointer for south coefficient
-       * a_cn is pointer for north coefficient
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,0,0);
-      a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,-1,0,0);
-      a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,1,0,0);
-      a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,0,-1,0);
-      a_cs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,0,1,0);
-      a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 9-point fine grid operator:
-       *
-       * a_csw is pointer for southwest coefficient
-       * a_cse is pointer for southeast coefficient
-       * a_cnw is pointer for northwest coefficient
-       * a_cne is pointer for northeast coefficient
-       *-----------------------------------------------------------------*/
-
-      if(fine_stencil_size > 5)
-      {
-         hypre_SetIndex3(index,-1,-1,0);
-         a_csw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,-1,0);
+      a_csw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,-1,0);
-         a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,-1,0);
+      a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,1,0);
-         a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-      }
+      hypre_SetIndex3(index,-1,1,0);
+      a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   }
 
-      /*-----------------------------------------------------------------
-       * Extract pointers for coarse grid operator - always 9-point:
-       *
-       * We build only the lower triangular part (plus diagonal).
-       *
-       * rap_cc is pointer for center coefficient (etc.)
-       *-----------------------------------------------------------------*/
+   /*-----------------------------------------------------------------
+    * Extract pointers for coarse grid operator - always 9-point:
+    *
+    * We build only the lower triangular part (plus diagonal).
+    *
+    * rap_cc is pointer for center coefficient (etc.)
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,0);
+   rap_cc = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   hypre_SetIndex3(index,-1,0,0);
+   rap_cw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   hypre_SetIndex3(index,0,-1,0);
+   rap_cs = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   hypre_SetIndex3(index,-1,-1,0);
+   rap_csw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   hypre_SetIndex3(index,1,-1,0);
+   rap_cse = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   /*-----------------------------------------------------------------
+    * Define offsets for fine grid stencil and interpolation
+    *
+    * In the BoxLoop below I assume iA and iP refer to data associated
+    * with the point which we are building the stencil for. The below
+    * Offsets are used in refering to data associated with other points.
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,1,0);
+   yOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
+   yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+   hypre_SetIndex3(index,1,0,0);
+   xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+
+   /*-----------------------------------------------------------------
+    * Switch statement to direct control to apropriate BoxLoop depending
+    * on stencil size. Default is full 9-point.
+    *-----------------------------------------------------------------*/
+
+   switch (fine_stencil_size)
+   {
 
-      hypre_SetIndex3(index,0,0,0);
-      rap_cc = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      /*--------------------------------------------------------------
+       * Loop for symmetric 5-point fine grid operator; produces a
+       * symmetric 9-point coarse grid operator. We calculate only the
+       * lower triangular stencil entries: (southwest, south, southeast,
+       * west, and center).
+       *--------------------------------------------------------------*/
 
-      hypre_SetIndex3(index,-1,0,0);
-      rap_cw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      case 5:
 
-      hypre_SetIndex3(index,0,-1,0);
-      rap_cs = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
-      hypre_SetIndex3(index,-1,-1,0);
-      rap_csw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+#define DEVICE_VAR is_device_ptr(rap_csw,rb,a_cw,pa,rap_cs,a_cc,a_cs,rap_cse,a_ce,rap_cw,pb,ra,rap_cc,a_cn)
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - yOffsetA;
+            HYPRE_Int iAp1 = iA + yOffsetA;
+            HYPRE_Int iP1 = iP - yOffsetP - xOffsetP;
+            rap_csw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1];
+
+            iP1 = iP - yOffsetP;
+            rap_cs[iAc] = rb[iR] * a_cc[iAm1] * pa[iP1]
+               +          rb[iR] * a_cs[iAm1]
+               +                   a_cs[iA]   * pa[iP1];
+
+            iP1 = iP - yOffsetP + xOffsetP;
+            rap_cse[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1];
+
+            iP1 = iP - xOffsetP;
+            rap_cw[iAc] =          a_cw[iA]
+               +          rb[iR] * a_cw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cw[iAp1] * pa[iP1];
+
+            rap_cc[iAc] =          a_cc[iA]
+               +          rb[iR] * a_cc[iAm1] * pb[iP]
+               +          ra[iR] * a_cc[iAp1] * pa[iP]
+               +          rb[iR] * a_cn[iAm1]
+               +          ra[iR] * a_cs[iAp1]
+               +                   a_cs[iA]   * pb[iP]
+               +                   a_cn[iA]   * pa[iP];
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
+#undef DEVICE_VAR
 
-      hypre_SetIndex3(index,1,-1,0);
-      rap_cse = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
-
-      /*-----------------------------------------------------------------
-       * Define offsets for fine grid stencil and interpolation
-       *
-       * In the BoxLoop below I assume iA and iP refer to data associated
-       * with the point which we are building the stencil for. The below
-       * Offsets are used in refering to data associated with other points.
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,1,0);
-      yOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
-      yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-      hypre_SetIndex3(index,1,0,0);
-      xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-
-      /*-----------------------------------------------------------------
-       * Switch statement to direct control to apropriate BoxLoop depending
-       * on stencil size. Default is full 9-point.
-       *-----------------------------------------------------------------*/
-
-      switch (fine_stencil_size)
-      {
+         break;
 
          /*--------------------------------------------------------------
-          * Loop for symmetric 5-point fine grid operator; produces a
+          * Loop for symmetric 9-point fine grid operator; produces a
           * symmetric 9-point coarse grid operator. We calculate only the
           * lower triangular stencil entries: (southwest, south, southeast,
           * west, and center).
           *--------------------------------------------------------------*/
 
-         case 5:
-
-            hypre_BoxGetSize(cgrid_box, loop_size);
-
-#define DEVICE_VAR is_device_ptr(rap_csw,rb,a_cw,pa,rap_cs,a_cc,a_cs,rap_cse,a_ce,rap_cw,pb,ra,rap_cc,a_cn)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - yOffsetA;
-               HYPRE_Int iAp1 = iA + yOffsetA;
-               HYPRE_Int iP1 = iP - yOffsetP - xOffsetP;
-               rap_csw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1];
-
-               iP1 = iP - yOffsetP;
-               rap_cs[iAc] = rb[iR] * a_cc[iAm1] * pa[iP1]
-                  +          rb[iR] * a_cs[iAm1]
-                  +                   a_cs[iA]   * pa[iP1];
-
-               iP1 = iP - yOffsetP + xOffsetP;
-               rap_cse[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1];
-
-               iP1 = iP - xOffsetP;
-               rap_cw[iAc] =          a_cw[iA]
-                  +          rb[iR] * a_cw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cw[iAp1] * pa[iP1];
-
-               rap_cc[iAc] =          a_cc[iA]
-                  +          rb[iR] * a_cc[iAm1] * pb[iP]
-                  +          ra[iR] * a_cc[iAp1] * pa[iP]
-                  +          rb[iR] * a_cn[iAm1]
-                  +          ra[iR] * a_cs[iAp1]
-                  +                   a_cs[iA]   * pb[iP]
-                  +                   a_cn[iA]   * pa[iP];
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
-#undef DEVICE_VAR
-
-            break;
-
-            /*--------------------------------------------------------------
-             * Loop for symmetric 9-point fine grid operator; produces a
-             * symmetric 9-point coarse grid operator. We calculate only the
-             * lower triangular stencil entries: (southwest, south, southeast,
-             * west, and center).
-             *--------------------------------------------------------------*/
-
-         default:
+      default:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_csw,rb,a_cw,pa,a_csw,rap_cs,a_cc,a_cs,rap_cse,a_ce,a_cse,rap_cw,pb,ra,a_cnw,rap_cc,a_cn)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - yOffsetA;
-               HYPRE_Int iAp1 = iA + yOffsetA;
-
-               HYPRE_Int iP1 = iP - yOffsetP - xOffsetP;
-               rap_csw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
-                  +           rb[iR] * a_csw[iAm1]
-                  +                    a_csw[iA]  * pa[iP1];
-
-               iP1 = iP - yOffsetP;
-               rap_cs[iAc] = rb[iR] * a_cc[iAm1] * pa[iP1]
-                  +          rb[iR] * a_cs[iAm1]
-                  +                   a_cs[iA]   * pa[iP1];
-
-               iP1 = iP - yOffsetP + xOffsetP;
-               rap_cse[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
-                  +           rb[iR] * a_cse[iAm1]
-                  +                    a_cse[iA]  * pa[iP1];
-
-               iP1 = iP - xOffsetP;
-               rap_cw[iAc] =          a_cw[iA]
-                  +          rb[iR] * a_cw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cw[iAp1] * pa[iP1]
-                  +          rb[iR] * a_cnw[iAm1]
-                  +          ra[iR] * a_csw[iAp1]
-                  +                   a_csw[iA]  * pb[iP1]
-                  +                   a_cnw[iA]  * pa[iP1];
-
-               rap_cc[iAc] =          a_cc[iA]
-                  +          rb[iR] * a_cc[iAm1] * pb[iP]
-                  +          ra[iR] * a_cc[iAp1] * pa[iP]
-                  +          rb[iR] * a_cn[iAm1]
-                  +          ra[iR] * a_cs[iAp1]
-                  +                   a_cs[iA]   * pb[iP]
-                  +                   a_cn[iA]   * pa[iP];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - yOffsetA;
+            HYPRE_Int iAp1 = iA + yOffsetA;
+
+            HYPRE_Int iP1 = iP - yOffsetP - xOffsetP;
+            rap_csw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
+               +           rb[iR] * a_csw[iAm1]
+               +                    a_csw[iA]  * pa[iP1];
+
+            iP1 = iP - yOffsetP;
+            rap_cs[iAc] = rb[iR] * a_cc[iAm1] * pa[iP1]
+               +          rb[iR] * a_cs[iAm1]
+               +                   a_cs[iA]   * pa[iP1];
+
+            iP1 = iP - yOffsetP + xOffsetP;
+            rap_cse[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
+               +           rb[iR] * a_cse[iAm1]
+               +                    a_cse[iA]  * pa[iP1];
+
+            iP1 = iP - xOffsetP;
+            rap_cw[iAc] =          a_cw[iA]
+               +          rb[iR] * a_cw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cw[iAp1] * pa[iP1]
+               +          rb[iR] * a_cnw[iAm1]
+               +          ra[iR] * a_csw[iAp1]
+               +                   a_csw[iA]  * pb[iP1]
+               +                   a_cnw[iA]  * pa[iP1];
+
+            rap_cc[iAc] =          a_cc[iA]
+               +          rb[iR] * a_cc[iAm1] * pb[iP]
+               +          ra[iR] * a_cc[iAp1] * pa[iP]
+               +          rb[iR] * a_cn[iAm1]
+               +          ra[iR] * a_cs[iAp1]
+               +                   a_cs[iA]   * pb[iP]
+               +                   a_cn[iA]   * pa[iP];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-      } /* end switch statement */
+   } /* end switch statement */
 
-   } /* end ForBoxI */
 
    return hypre_error_flag;
 }
@@ -457,28 +625,65 @@ hypre_SMG2BuildRAPNoSym( hypre_StructMatrix *A,
                          hypre_StructMatrix *RAP,
                          hypre_Index         cindex,
                          hypre_Index         cstride )
-
 {
+   hypre_StructGrid     *fgrid;
+   HYPRE_Int            *fgrid_ids;
+   hypre_StructGrid     *cgrid;
+   hypre_BoxArray       *cgrid_boxes;
+   HYPRE_Int            *cgrid_ids;
+   HYPRE_Int             fi, ci;
+
+   fgrid = hypre_StructMatrixGrid(A);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+
+   cgrid = hypre_StructMatrixGrid(RAP);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      hypre_SMG2BuildRAPNoSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                                 A, PT, R, RAP, cindex, cstride);
+   } /* end ForBoxI */
+
+   return hypre_error_flag;
+}
 
+/*--------------------------------------------------------------------------
+ * hypre_SMG2BuildRAPNoSymBox
+ *
+ * Upper triangular coefficients of RAP on cgrid_box (see
+ * hypre_SMG2BuildRAPSymBox).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMG2BuildRAPNoSymBox( HYPRE_Int           ci,
+                            HYPRE_Int           fi,
+                            hypre_Box          *cgrid_box,
+                            hypre_StructMatrix *A,
+                            hypre_StructMatrix *PT,
+                            hypre_StructMatrix *R,
+                            hypre_StructMatrix *RAP,
+                            hypre_Index         cindex,
+                            hypre_Index         cstride )
+{
    hypre_Index             index;
 
    hypre_StructStencil  *fine_stencil;
    HYPRE_Int             fine_stencil_size;
 
-   hypre_StructGrid     *fgrid;
-   HYPRE_Int            *fgrid_ids;
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   HYPRE_Int            *cgrid_ids;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
    hypre_IndexRef        stridef;
    hypre_Index           loop_size;
 
-   HYPRE_Int             fi, ci;
-
    hypre_Box            *A_dbox;
    hypre_Box            *PT_dbox;
    hypre_Box            *R_dbox;
@@ -503,235 +708,217 @@ hypre_SMG2BuildRAPNoSym( hypre_StructMatrix *A,
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   fgrid = hypre_StructMatrixGrid(A);
-   fgrid_ids = hypre_StructGridIDs(fgrid);
-
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-   cgrid_ids = hypre_StructGridIDs(cgrid);
-
-   fi = 0;
-   hypre_ForBoxI(ci, cgrid_boxes)
+   cstart = hypre_BoxIMin(cgrid_box);
+   hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
+
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+   PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
+   R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+   RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for interpolation operator:
+    * pa is pointer for weight for f-point above c-point
+    * pb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,1,0);
+   pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
+
+   hypre_SetIndex3(index,0,-1,0);
+   pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for restriction operator:
+    * ra is pointer for weight for f-point above c-point
+    * rb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,1,0);
+   ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+   hypre_SetIndex3(index,0,-1,0);
+   rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for 5-point fine grid operator:
+    *
+    * a_cc is pointer for center coefficient
+    * a_cw is pointer for west coefficient
+    * a_ce is pointer for east coefficient
+    * a_cs is pointer for south coefficient
+    * a_cn is pointer for north coefficient
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,0);
+   a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,-1,0,0);
+   a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,1,0,0);
+   a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,0,1,0);
+   a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 9-point fine grid operator:
+    *
+    * a_csw is pointer for southwest coefficient
+    * a_cse is pointer for southeast coefficient
+    * a_cnw is pointer for northwest coefficient
+    * a_cne is pointer for northeast coefficient
+    *-----------------------------------------------------------------*/
+
+   if(fine_stencil_size > 5)
    {
-      while (fgrid_ids[fi] != cgrid_ids[ci])
-      {
-         fi++;
-      }
-
-      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
-      cstart = hypre_BoxIMin(cgrid_box);
-      hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
-
-      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
-      PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
-      R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
-      RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for interpolation operator:
-       * pa is pointer for weight for f-point above c-point
-       * pb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,1,0);
-      pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
-
-      hypre_SetIndex3(index,0,-1,0);
-      pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for restriction operator:
-       * ra is pointer for weight for f-point above c-point
-       * rb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,1,0);
-      ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
-
-      hypre_SetIndex3(index,0,-1,0);
-      rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for 5-point fine grid operator:
-       *
-       * a_cc is pointer for center coefficient
-       * a_cw is pointer for west coefficient
-       * a_ce is pointer for east coefficient
-       * a_cs is pointer for south coefficient
-       * a_cn is pointer for north coefficient
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,0,0);
-      a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,-1,0,0);
-      a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,1,0,0);
-      a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,0,1,0);
-      a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 9-point fine grid operator:
-       *
-       * a_csw is pointer for southwest coefficient
-       * a_cse is pointer for southeast coefficient
-       * a_cnw is pointer for northwest coefficient
-       * a_cne is pointer for northeast coefficient
-       *-----------------------------------------------------------------*/
-
-      if(fine_stencil_size > 5)
-      {
-         hypre_SetIndex3(index,1,-1,0);
-         a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-         hypre_SetIndex3(index,-1,1,0);
-         a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-         hypre_SetIndex3(index,1,1,0);
-         a_cne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      }
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for coarse grid operator - always 9-point:
-       *
-       * We build only the upper triangular part.
-       *
-       * rap_ce is pointer for east coefficient (etc.)
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,1,0,0);
-      rap_ce = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,1,-1,0);
+      a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      hypre_SetIndex3(index,0,1,0);
-      rap_cn = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,-1,1,0);
+      a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
       hypre_SetIndex3(index,1,1,0);
-      rap_cne = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      a_cne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      hypre_SetIndex3(index,-1,1,0);
-      rap_cnw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
-
-      /*-----------------------------------------------------------------
-       * Define offsets for fine grid stencil and interpolation
-       *
-       * In the BoxLoop below I assume iA and iP refer to data associated
-       * with the point which we are building the stencil for. The below
-       * Offsets are used in refering to data associated with other points.
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,1,0);
-      yOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
-      yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-      hypre_SetIndex3(index,1,0,0);
-      xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-
-      /*-----------------------------------------------------------------
-       * Switch statement to direct control to apropriate BoxLoop depending
-       * on stencil size. Default is full 27-point.
-       *-----------------------------------------------------------------*/
-
-      switch (fine_stencil_size)
-      {
+   }
 
-         /*--------------------------------------------------------------
-          * Loop for 5-point fine grid operator; produces upper triangular
-          * part of 9-point coarse grid operator - excludes diagonal.
-          * stencil entries: (northeast, north, northwest, and east)
-          *--------------------------------------------------------------*/
+   /*-----------------------------------------------------------------
+    * Extract pointers for coarse grid operator - always 9-point:
+    *
+    * We build only the upper triangular part.
+    *
+    * rap_ce is pointer for east coefficient (etc.)
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,1,0,0);
+   rap_ce = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   hypre_SetIndex3(index,0,1,0);
+   rap_cn = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   hypre_SetIndex3(index,1,1,0);
+   rap_cne = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   hypre_SetIndex3(index,-1,1,0);
+   rap_cnw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+
+   /*-----------------------------------------------------------------
+    * Define offsets for fine grid stencil and interpolation
+    *
+    * In the BoxLoop below I assume iA and iP refer to data associated
+    * with the point which we are building the stencil for. The below
+    * Offsets are used in refering to data associated with other points.
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,1,0);
+   yOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
+   yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+   hypre_SetIndex3(index,1,0,0);
+   xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+
+   /*-----------------------------------------------------------------
+    * Switch statement to direct control to apropriate BoxLoop depending
+    * on stencil size. Default is full 27-point.
+    *-----------------------------------------------------------------*/
+
+   switch (fine_stencil_size)
+   {
 
-         case 5:
+      /*--------------------------------------------------------------
+       * Loop for 5-point fine grid operator; produces upper triangular
+       * part of 9-point coarse grid operator - excludes diagonal.
+       * stencil entries: (northeast, north, northwest, and east)
+       *--------------------------------------------------------------*/
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+      case 5:
+
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,a_ce,pb,rap_cn,a_cc,a_cn,rap_cnw,a_cw,rap_ce,rb,pa)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - yOffsetA;
-               HYPRE_Int iAp1 = iA + yOffsetA;
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - yOffsetA;
+            HYPRE_Int iAp1 = iA + yOffsetA;
 
-               HYPRE_Int iP1 = iP + yOffsetP + xOffsetP;
-               rap_cne[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1];
+            HYPRE_Int iP1 = iP + yOffsetP + xOffsetP;
+            rap_cne[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1];
 
-               iP1 = iP + yOffsetP;
-               rap_cn[iAc] = ra[iR] * a_cc[iAp1] * pb[iP1]
-                  +          ra[iR] * a_cn[iAp1]
-                  +                   a_cn[iA]   * pb[iP1];
+            iP1 = iP + yOffsetP;
+            rap_cn[iAc] = ra[iR] * a_cc[iAp1] * pb[iP1]
+               +          ra[iR] * a_cn[iAp1]
+               +                   a_cn[iA]   * pb[iP1];
 
-               iP1 = iP + yOffsetP - xOffsetP;
-               rap_cnw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1];
+            iP1 = iP + yOffsetP - xOffsetP;
+            rap_cnw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1];
 
-               iP1 = iP + xOffsetP;
-               rap_ce[iAc] =          a_ce[iA]
-                  +          rb[iR] * a_ce[iAm1] * pb[iP1]
-                  +          ra[iR] * a_ce[iAp1] * pa[iP1];
+            iP1 = iP + xOffsetP;
+            rap_ce[iAc] =          a_ce[iA]
+               +          rb[iR] * a_ce[iAm1] * pb[iP1]
+               +          ra[iR] * a_ce[iAp1] * pa[iP1];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-            /*--------------------------------------------------------------
-             * Loop for 9-point fine grid operator; produces upper triangular
-             * part of 9-point coarse grid operator - excludes diagonal.
-             * stencil entries: (northeast, north, northwest, and east)
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------
+          * Loop for 9-point fine grid operator; produces upper triangular
+          * part of 9-point coarse grid operator - excludes diagonal.
+          * stencil entries: (northeast, north, northwest, and east)
+          *--------------------------------------------------------------*/
 
-         default:
-            hypre_BoxGetSize(cgrid_box, loop_size);
+      default:
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_cne,ra,a_ce,pb,a_cne,rap_cn,a_cc,a_cn,rap_cnw,a_cw,a_cnw,rap_ce,rb,pa,a_cse)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - yOffsetA;
-               HYPRE_Int iAp1 = iA + yOffsetA;
-
-               HYPRE_Int iP1 = iP + yOffsetP + xOffsetP;
-               rap_cne[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
-                  +           ra[iR] * a_cne[iAp1]
-                  +                    a_cne[iA]  * pb[iP1];
-
-               iP1 = iP + yOffsetP;
-               rap_cn[iAc] = ra[iR] * a_cc[iAp1] * pb[iP1]
-                  +          ra[iR] * a_cn[iAp1]
-                  +                   a_cn[iA]   * pb[iP1];
-
-               iP1 = iP + yOffsetP - xOffsetP;
-               rap_cnw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
-                  +           ra[iR] * a_cnw[iAp1]
-                  +                    a_cnw[iA]  * pb[iP1];
-
-               iP1 = iP + xOffsetP;
-               rap_ce[iAc] =          a_ce[iA]
-                  +          rb[iR] * a_ce[iAm1] * pb[iP1]
-                  +          ra[iR] * a_ce[iAp1] * pa[iP1]
-                  +          rb[iR] * a_cne[iAm1]
-                  +          ra[iR] * a_cse[iAp1]
-                  +                   a_cse[iA]  * pb[iP1]
-                  +                   a_cne[iA]  * pa[iP1];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - yOffsetA;
+            HYPRE_Int iAp1 = iA + yOffsetA;
+
+            HYPRE_Int iP1 = iP + yOffsetP + xOffsetP;
+            rap_cne[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
+               +           ra[iR] * a_cne[iAp1]
+               +                    a_cne[iA]  * pb[iP1];
+
+            iP1 = iP + yOffsetP;
+            rap_cn[iAc] = ra[iR] * a_cc[iAp1] * pb[iP1]
+               +          ra[iR] * a_cn[iAp1]
+               +                   a_cn[iA]   * pb[iP1];
+
+            iP1 = iP + yOffsetP - xOffsetP;
+            rap_cnw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
+               +           ra[iR] * a_cnw[iAp1]
+               +                    a_cnw[iA]  * pb[iP1];
+
+            iP1 = iP + xOffsetP;
+            rap_ce[iAc] =          a_ce[iA]
+               +          rb[iR] * a_ce[iAm1] * pb[iP1]
+               +          ra[iR] * a_ce[iAp1] * pa[iP1]
+               +          rb[iR] * a_cne[iAm1]
+               +          ra[iR] * a_cse[iAp1]
+               +                   a_cse[iA]  * pb[iP1]
+               +                   a_cne[iA]  * pa[iP1];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-      } /* end switch statement */
+   } /* end switch statement */
 
-   } /* end ForBoxI */
 
    return hypre_error_flag;
 }
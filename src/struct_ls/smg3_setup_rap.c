@@ -213,9 +213,166 @@ hypre_SMG3CreateRAPOp( hypre_StructMatrix *R,
  * hypre_SMG3BuildRAPNoSym to build the upper triangular part of RAP
  * (excluding the diagonal). So using symmetric storage, only the first
  * routine would be called. With full storage both would need to be called.
+ * hypre_SMG3BuildRAP calls one or both of them tile by tile.
  *
  *--------------------------------------------------------------------------*/
 
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#define hypre_SMG3RAPTileVolume 0
+#else
+#define hypre_SMG3RAPTileVolume 4096
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_SMG3RAPTileSize
+ *
+ * Size of the tiles of cgrid_box: whole lines in the first dimension, and
+ * as many of them as fit into hypre_SMG3RAPTileVolume points.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_SMG3RAPTileSize( hypre_Box   *cgrid_box,
+                       hypre_Index  tile_size )
+{
+   hypre_BoxGetSize(cgrid_box, tile_size);
+   tile_size[1] = hypre_min(tile_size[1],
+                            hypre_max(1, hypre_SMG3RAPTileVolume / tile_size[0]));
+   tile_size[2] = hypre_min(tile_size[2],
+                            hypre_max(1, hypre_SMG3RAPTileVolume / (tile_size[0]*tile_size[1])));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMG3BuildRAP
+ *
+ * Builds RAP, both triangular parts if A is not symmetric.  The coarse boxes
+ * are cut into tiles of about hypre_SMG3RAPTileVolume points (whole lines
+ * in the first dimension), and both parts are computed for one tile before
+ * moving to the next, as in hypre_PFMG3BuildRAP.  The tiles are distributed
+ * over the OpenMP threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMG3BuildRAP( hypre_StructMatrix *A,
+                    hypre_StructMatrix *PT,
+                    hypre_StructMatrix *R,
+                    hypre_StructMatrix *RAP,
+                    hypre_Index         cindex,
+                    hypre_Index         cstride )
+{
+   hypre_StructGrid     *fgrid     = hypre_StructMatrixGrid(A);
+   HYPRE_Int            *fgrid_ids = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid     *cgrid     = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray       *cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int            *cgrid_ids = hypre_StructGridIDs(cgrid);
+   HYPRE_Int             symmetric = hypre_StructMatrixSymmetric(A);
+
+   hypre_Box            *cgrid_box;
+   hypre_Box            *tile;
+   hypre_BoxArray       *tiles;
+   HYPRE_Int            *tile_cboxnums;
+   HYPRE_Int            *tile_fboxnums;
+   HYPRE_Int             num_tiles;
+   hypre_Index           tile_size;
+   HYPRE_Int             fi, ci, j, k, t;
+
+   /*----------------------------------------------------------
+    * Count the tiles.  Boxes that are not tiled are computed
+    * here.
+    *----------------------------------------------------------*/
+
+   num_tiles = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (hypre_SMG3RAPTileVolume == 0)
+      {
+         hypre_SMG3BuildRAPSymBox(ci, fi, cgrid_box, A, PT, R, RAP, cindex, cstride);
+         if (!symmetric)
+         {
+            hypre_SMG3BuildRAPNoSymBox(ci, fi, cgrid_box, A, PT, R, RAP, cindex, cstride);
+         }
+      }
+      else if (hypre_BoxVolume(cgrid_box) > 0)
+      {
+         hypre_SMG3RAPTileSize(cgrid_box, tile_size);
+         num_tiles += ((hypre_BoxSizeD(cgrid_box, 1) + tile_size[1] - 1) / tile_size[1]) *
+                      ((hypre_BoxSizeD(cgrid_box, 2) + tile_size[2] - 1) / tile_size[2]);
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Cut the coarse boxes into tiles
+    *----------------------------------------------------------*/
+
+   tiles         = hypre_BoxArrayCreate(num_tiles, 3);
+   tile_cboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+   tile_fboxnums = hypre_TAlloc(HYPRE_Int, num_tiles, HYPRE_MEMORY_HOST);
+
+   t = 0;
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      if (hypre_SMG3RAPTileVolume == 0 || hypre_BoxVolume(cgrid_box) == 0)
+      {
+         continue;
+      }
+
+      hypre_SMG3RAPTileSize(cgrid_box, tile_size);
+      for (k = hypre_BoxIMinD(cgrid_box, 2); k <= hypre_BoxIMaxD(cgrid_box, 2); k += tile_size[2])
+      {
+         for (j = hypre_BoxIMinD(cgrid_box, 1); j <= hypre_BoxIMaxD(cgrid_box, 1); j += tile_size[1])
+         {
+            tile = hypre_BoxArrayBox(tiles, t);
+            hypre_CopyBox(cgrid_box, tile);
+            hypre_BoxIMinD(tile, 1) = j;
+            hypre_BoxIMaxD(tile, 1) = hypre_min(j + tile_size[1] - 1, hypre_BoxIMaxD(cgrid_box, 1));
+            hypre_BoxIMinD(tile, 2) = k;
+            hypre_BoxIMaxD(tile, 2) = hypre_min(k + tile_size[2] - 1, hypre_BoxIMaxD(cgrid_box, 2));
+            tile_cboxnums[t] = ci;
+            tile_fboxnums[t] = fi;
+            t++;
+         }
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Compute the tiles
+    *----------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t, tile) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_tiles; t++)
+   {
+      tile = hypre_BoxArrayBox(tiles, t);
+      hypre_SMG3BuildRAPSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                               A, PT, R, RAP, cindex, cstride);
+      if (!symmetric)
+      {
+         hypre_SMG3BuildRAPNoSymBox(tile_cboxnums[t], tile_fboxnums[t], tile,
+                                    A, PT, R, RAP, cindex, cstride);
+      }
+   }
+
+   hypre_BoxArrayDestroy(tiles);
+   hypre_TFree(tile_cboxnums, HYPRE_MEMORY_HOST);
+   hypre_TFree(tile_fboxnums, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
                        hypre_StructMatrix *PT,
@@ -223,28 +380,66 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
                        hypre_StructMatrix *RAP,
                        hypre_Index         cindex,
                        hypre_Index         cstride )
-
 {
+   hypre_StructGrid     *fgrid;
+   HYPRE_Int            *fgrid_ids;
+   hypre_StructGrid     *cgrid;
+   hypre_BoxArray       *cgrid_boxes;
+   HYPRE_Int            *cgrid_ids;
+   HYPRE_Int             fi, ci;
+
+   fgrid = hypre_StructMatrixGrid(A);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+
+   cgrid = hypre_StructMatrixGrid(RAP);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
 
+      hypre_SMG3BuildRAPSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                               A, PT, R, RAP, cindex, cstride);
+   } /* end ForBoxI */
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMG3BuildRAPSymBox
+ *
+ * Lower triangular (plus diagonal) coefficients of RAP on cgrid_box, which
+ * is box ci of the coarse grid or a part of it.  Box fi of the fine grid is
+ * the one that box ci was coarsened from.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMG3BuildRAPSymBox( HYPRE_Int           ci,
+                          HYPRE_Int           fi,
+                          hypre_Box          *cgrid_box,
+                          hypre_StructMatrix *A,
+                          hypre_StructMatrix *PT,
+                          hypre_StructMatrix *R,
+                          hypre_StructMatrix *RAP,
+                          hypre_Index         cindex,
+                          hypre_Index         cstride )
+{
    hypre_Index           index;
 
    hypre_StructStencil  *fine_stencil;
    HYPRE_Int             fine_stencil_size;
 
-   hypre_StructGrid     *fgrid;
-   HYPRE_Int            *fgrid_ids;
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   HYPRE_Int            *cgrid_ids;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
    hypre_IndexRef        stridef;
    hypre_Index           loop_size;
 
-   HYPRE_Int             fi, ci;
-
    hypre_Box            *A_dbox;
    hypre_Box            *PT_dbox;
    hypre_Box            *R_dbox;
@@ -276,643 +471,625 @@ hypre_SMG3BuildRAPSym( hypre_StructMatrix *A,
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   fgrid = hypre_StructMatrixGrid(A);
-   fgrid_ids = hypre_StructGridIDs(fgrid);
-
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-   cgrid_ids = hypre_StructGridIDs(cgrid);
-
-   fi = 0;
-   hypre_ForBoxI(ci, cgrid_boxes)
+   cstart = hypre_BoxIMin(cgrid_box);
+   hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
+
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+   PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
+   R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+   RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for interpolation operator:
+    * pa is pointer for weight for f-point above c-point
+    * pb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,1);
+   pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
+
+   hypre_SetIndex3(index,0,0,-1);
+   pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for restriction operator:
+    * ra is pointer for weight for f-point above c-point
+    * rb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,1);
+   ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+   hypre_SetIndex3(index,0,0,-1);
+   rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract pointers for 7-point fine grid operator:
+    *
+    * a_cc is pointer for center coefficient
+    * a_cw is pointer for west coefficient in same plane
+    * a_ce is pointer for east coefficient in same plane
+    * a_cs is pointer for south coefficient in same plane
+    * a_cn is pointer for north coefficient in same plane
+    * a_ac is pointer for center coefficient in plane above
+    * a_bc is pointer for center coefficient in plane below
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,0);
+   a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,-1,0,0);
+   a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,1,0,0);
+   a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,0,-1,0);
+   a_cs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,0,1,0);
+   a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,0,0,1);
+   a_ac = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   hypre_SetIndex3(index,0,0,-1);
+   a_bc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 15-point fine grid operator:
+    *
+    * a_aw is pointer for west coefficient in plane above
+    * a_ae is pointer for east coefficient in plane above
+    * a_as is pointer for south coefficient in plane above
+    * a_an is pointer for north coefficient in plane above
+    * a_bw is pointer for west coefficient in plane below
+    * a_be is pointer for east coefficient in plane below
+    * a_bs is pointer for south coefficient in plane below
+    * a_bn is pointer for north coefficient in plane below
+    *-----------------------------------------------------------------*/
+
+   if(fine_stencil_size > 7)
    {
-      while (fgrid_ids[fi] != cgrid_ids[ci])
-      {
-         fi++;
-      }
-
-      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
-
-      cstart = hypre_BoxIMin(cgrid_box);
-      hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
-
-      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
-      PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
-      R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
-      RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for interpolation operator:
-       * pa is pointer for weight for f-point above c-point
-       * pb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,0,1);
-      pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
-
-      hypre_SetIndex3(index,0,0,-1);
-      pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for restriction operator:
-       * ra is pointer for weight for f-point above c-point
-       * rb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,0,1);
-      ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
-
-      hypre_SetIndex3(index,0,0,-1);
-      rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract pointers for 7-point fine grid operator:
-       *
-       * a_cc is pointer for center coefficient
-       * a_cw is pointer for west coefficient in same plane
-       * a_ce is pointer for east coefficient in same plane
-       * a_cs is pointer for south coefficient in same plane
-       * a_cn is pointer for north coefficient in same plane
-       * a_ac is pointer for center coefficient in plane above
-       * a_bc is pointer for center coefficient in plane below
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,0,0);
-      a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,-1,0,0);
-      a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,1,0,0);
-      a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,0,-1,0);
-      a_cs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,0,1,0);
-      a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,0,0,1);
-      a_ac = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      hypre_SetIndex3(index,0,0,-1);
-      a_bc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
-
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 15-point fine grid operator:
-       *
-       * a_aw is pointer for west coefficient in plane above
-       * a_ae is pointer for east coefficient in plane above
-       * a_as is pointer for south coefficient in plane above
-       * a_an is pointer for north coefficient in plane above
-       * a_bw is pointer for west coefficient in plane below
-       * a_be is pointer for east coefficient in plane below
-       * a_bs is pointer for south coefficient in plane below
-       * a_bn is pointer for north coefficient in plane below
-       *-----------------------------------------------------------------*/
-
-      if(fine_stencil_size > 7)
-      {
-         hypre_SetIndex3(index,-1,0,1);
-         a_aw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,0,1);
+      a_aw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,0,-1,1);
-         a_as = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,0,-1,1);
+      a_as = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,0,-1);
-         a_bw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,0,-1);
+      a_bw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,0,-1);
-         a_be = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,0,-1);
+      a_be = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,0,-1,-1);
-         a_bs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,0,-1,-1);
+      a_bs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,0,1,-1);
-         a_bn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,0,1,-1);
+      a_bn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      }
+   }
 
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 19-point fine grid operator:
-       *
-       * a_csw is pointer for southwest coefficient in same plane
-       * a_cse is pointer for southeast coefficient in same plane
-       * a_cnw is pointer for northwest coefficient in same plane
-       * a_cne is pointer for northeast coefficient in same plane
-       *-----------------------------------------------------------------*/
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 19-point fine grid operator:
+    *
+    * a_csw is pointer for southwest coefficient in same plane
+    * a_cse is pointer for southeast coefficient in same plane
+    * a_cnw is pointer for northwest coefficient in same plane
+    * a_cne is pointer for northeast coefficient in same plane
+    *-----------------------------------------------------------------*/
 
-      if(fine_stencil_size > 15)
-      {
-         hypre_SetIndex3(index,-1,-1,0);
-         a_csw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   if(fine_stencil_size > 15)
+   {
+      hypre_SetIndex3(index,-1,-1,0);
+      a_csw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,-1,0);
-         a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,-1,0);
+      a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,1,0);
-         a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,1,0);
+      a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,1,0);
-         a_cne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,1,0);
+      a_cne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      }
+   }
 
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 27-point fine grid operator:
-       *
-       * a_asw is pointer for southwest coefficient in plane above
-       * a_ase is pointer for southeast coefficient in plane above
-       * a_anw is pointer for northwest coefficient in plane above
-       * a_ane is pointer for northeast coefficient in plane above
-       * a_bsw is pointer for southwest coefficient in plane below
-       * a_bse is pointer for southeast coefficient in plane below
-       * a_bnw is pointer for northwest coefficient in plane below
-       * a_bne is pointer for northeast coefficient in plane below
-       *-----------------------------------------------------------------*/
-
-      if(fine_stencil_size > 19)
-      {
-         hypre_SetIndex3(index,-1,-1,1);
-         a_asw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 27-point fine grid operator:
+    *
+    * a_asw is pointer for southwest coefficient in plane above
+    * a_ase is pointer for southeast coefficient in plane above
+    * a_anw is pointer for northwest coefficient in plane above
+    * a_ane is pointer for northeast coefficient in plane above
+    * a_bsw is pointer for southwest coefficient in plane below
+    * a_bse is pointer for southeast coefficient in plane below
+    * a_bnw is pointer for northwest coefficient in plane below
+    * a_bne is pointer for northeast coefficient in plane below
+    *-----------------------------------------------------------------*/
+
+   if(fine_stencil_size > 19)
+   {
+      hypre_SetIndex3(index,-1,-1,1);
+      a_asw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,-1,1);
-         a_ase = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,-1,1);
+      a_ase = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,-1,-1);
-         a_bsw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,-1,-1);
+      a_bsw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,-1,-1);
-         a_bse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,-1,-1);
+      a_bse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,1,-1);
-         a_bnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,1,-1);
+      a_bnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,1,-1);
-         a_bne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,1,-1);
+      a_bne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      }
+   }
 
-      /*-----------------------------------------------------------------
-       * Extract pointers for 15-point coarse grid operator:
-       *
-       * We build only the lower triangular part (plus diagonal).
-       *
-       * rap_cc is pointer for center coefficient (etc.)
-       *-----------------------------------------------------------------*/
+   /*-----------------------------------------------------------------
+    * Extract pointers for 15-point coarse grid operator:
+    *
+    * We build only the lower triangular part (plus diagonal).
+    *
+    * rap_cc is pointer for center coefficient (etc.)
+    *-----------------------------------------------------------------*/
 
-      hypre_SetIndex3(index,0,0,0);
-      rap_cc = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,0,0);
+   rap_cc = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,-1,0,0);
-      rap_cw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,-1,0,0);
+   rap_cw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,0,-1,0);
-      rap_cs = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,-1,0);
+   rap_cs = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,0,0,-1);
-      rap_bc = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,0,-1);
+   rap_bc = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,-1,0,-1);
-      rap_bw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,-1,0,-1);
+   rap_bw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,1,0,-1);
-      rap_be = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,1,0,-1);
+   rap_be = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,0,-1,-1);
-      rap_bs = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,-1,-1);
+   rap_bs = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,0,1,-1);
-      rap_bn = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
-
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 27-point coarse grid operator:
-       *
-       * A 27-point coarse grid operator is produced when the fine grid
-       * stencil is 19 or 27 point.
-       *
-       * We build only the lower triangular part.
-       *
-       * rap_csw is pointer for southwest coefficient in same plane (etc.)
-       *-----------------------------------------------------------------*/
-
-      if(fine_stencil_size > 15)
-      {
-         hypre_SetIndex3(index,-1,-1,0);
-         rap_csw =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,1,-1);
+   rap_bn = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,1,-1,0);
-         rap_cse =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 27-point coarse grid operator:
+    *
+    * A 27-point coarse grid operator is produced when the fine grid
+    * stencil is 19 or 27 point.
+    *
+    * We build only the lower triangular part.
+    *
+    * rap_csw is pointer for southwest coefficient in same plane (etc.)
+    *-----------------------------------------------------------------*/
 
-         hypre_SetIndex3(index,-1,-1,-1);
-         rap_bsw =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   if(fine_stencil_size > 15)
+   {
+      hypre_SetIndex3(index,-1,-1,0);
+      rap_csw =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,1,-1,-1);
-         rap_bse =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,1,-1,0);
+      rap_cse =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,-1,1,-1);
-         rap_bnw =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,-1,-1,-1);
+      rap_bsw =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,1,1,-1);
-         rap_bne =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,1,-1,-1);
+      rap_bse =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      }
+      hypre_SetIndex3(index,-1,1,-1);
+      rap_bnw =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      /*-----------------------------------------------------------------
-       * Define offsets for fine grid stencil and interpolation
-       *
-       * In the BoxLoop below I assume iA and iP refer to data associated
-       * with the point which we are building the stencil for. The below
-       * Offsets are used in refering to data associated with other points.
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,0,1);
-      zOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
-      zOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-      hypre_SetIndex3(index,0,1,0);
-      yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-      hypre_SetIndex3(index,1,0,0);
-      xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+      hypre_SetIndex3(index,1,1,-1);
+      rap_bne =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      /*--------------------------------------------------------------------
-       * Switch statement to direct control to apropriate BoxLoop depending
-       * on stencil size. Default is full 27-point.
-       *-----------------------------------------------------------------*/
+   }
 
-      switch (fine_stencil_size)
-      {
+   /*-----------------------------------------------------------------
+    * Define offsets for fine grid stencil and interpolation
+    *
+    * In the BoxLoop below I assume iA and iP refer to data associated
+    * with the point which we are building the stencil for. The below
+    * Offsets are used in refering to data associated with other points.
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,1);
+   zOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
+   zOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+   hypre_SetIndex3(index,0,1,0);
+   yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+   hypre_SetIndex3(index,1,0,0);
+   xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+
+   /*--------------------------------------------------------------------
+    * Switch statement to direct control to apropriate BoxLoop depending
+    * on stencil size. Default is full 27-point.
+    *-----------------------------------------------------------------*/
+
+   switch (fine_stencil_size)
+   {
 
-         /*--------------------------------------------------------------
-          * Loop for symmetric 7-point fine grid operator; produces a
-          * symmetric 15-point coarse grid operator. We calculate only the
-          * lower triangular stencil entries: (below-south, below-west,
-          * below-center, below-east, below-north, center-south,
-          * center-west, and center-center).
-          *--------------------------------------------------------------*/
+      /*--------------------------------------------------------------
+       * Loop for symmetric 7-point fine grid operator; produces a
+       * symmetric 15-point coarse grid operator. We calculate only the
+       * lower triangular stencil entries: (below-south, below-west,
+       * below-center, below-east, below-north, center-south,
+       * center-west, and center-center).
+       *--------------------------------------------------------------*/
 
-         case 7:
+      case 7:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_bs,rb,a_cs,pa,rap_bw,a_cw,rap_bc,a_bc,a_cc,rap_be,a_ce,rap_bn,a_cn,rap_cs,pb,ra,rap_cw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
 
-               HYPRE_Int iP1 = iP - zOffsetP - yOffsetP;
-               rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1];
+            HYPRE_Int iP1 = iP - zOffsetP - yOffsetP;
+            rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1];
 
-               iP1 = iP - zOffsetP - xOffsetP;
-               rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1];
+            iP1 = iP - zOffsetP - xOffsetP;
+            rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1];
 
-               iP1 = iP - zOffsetP;
-               rap_bc[iAc] =          a_bc[iA]   * pa[iP1]
-                  +          rb[iR] * a_cc[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bc[iAm1];
+            iP1 = iP - zOffsetP;
+            rap_bc[iAc] =          a_bc[iA]   * pa[iP1]
+               +          rb[iR] * a_cc[iAm1] * pa[iP1]
+               +          rb[iR] * a_bc[iAm1];
 
-               iP1 = iP - zOffsetP + xOffsetP;
-               rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1];
+            iP1 = iP - zOffsetP + xOffsetP;
+            rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1];
 
-               iP1 = iP - zOffsetP + yOffsetP;
-               rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1];
+            iP1 = iP - zOffsetP + yOffsetP;
+            rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1];
 
-               iP1 = iP - yOffsetP;
-               rap_cs[iAc] =          a_cs[iA]
-                  +          rb[iR] * a_cs[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cs[iAp1] * pa[iP1];
+            iP1 = iP - yOffsetP;
+            rap_cs[iAc] =          a_cs[iA]
+               +          rb[iR] * a_cs[iAm1] * pb[iP1]
+               +          ra[iR] * a_cs[iAp1] * pa[iP1];
 
-               iP1 = iP - xOffsetP;
-               rap_cw[iAc] =          a_cw[iA]
-                  +          rb[iR] * a_cw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cw[iAp1] * pa[iP1];
+            iP1 = iP - xOffsetP;
+            rap_cw[iAc] =          a_cw[iA]
+               +          rb[iR] * a_cw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cw[iAp1] * pa[iP1];
 
-               rap_cc[iAc] =          a_cc[iA]
-                  +          rb[iR] * a_cc[iAm1] * pb[iP]
-                  +          ra[iR] * a_cc[iAp1] * pa[iP]
-                  +          rb[iR] * a_ac[iAm1]
-                  +          ra[iR] * a_bc[iAp1]
-                  +                   a_bc[iA]   * pb[iP]
-                  +                   a_ac[iA]   * pa[iP];
+            rap_cc[iAc] =          a_cc[iA]
+               +          rb[iR] * a_cc[iAm1] * pb[iP]
+               +          ra[iR] * a_cc[iAp1] * pa[iP]
+               +          rb[iR] * a_ac[iAm1]
+               +          ra[iR] * a_bc[iAp1]
+               +                   a_bc[iA]   * pb[iP]
+               +                   a_ac[iA]   * pa[iP];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-            /*--------------------------------------------------------------
-             * Loop for symmetric 15-point fine grid operator; produces a
-             * symmetric 15-point coarse grid operator. We calculate only the
-             * lower triangular stencil entries: (below-south, below-west,
-             * below-center, below-east, below-north, center-south,
-             * center-west, and center-center).
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------
+          * Loop for symmetric 15-point fine grid operator; produces a
+          * symmetric 15-point coarse grid operator. We calculate only the
+          * lower triangular stencil entries: (below-south, below-west,
+          * below-center, below-east, below-north, center-south,
+          * center-west, and center-center).
+          *--------------------------------------------------------------*/
 
-         case 15:
+      case 15:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_bs,rb,a_cs,pa,a_bs,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bn,a_cn,a_bn,rap_cs,pb,ra,a_as,rap_cw,a_aw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
-
-               HYPRE_Int iP1 = iP - zOffsetP - yOffsetP;
-               rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bs[iAm1]
-                  +                   a_bs[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP - xOffsetP;
-               rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bw[iAm1]
-                  +                   a_bw[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP;
-               rap_bc[iAc] =          a_bc[iA]   * pa[iP1]
-                  +          rb[iR] * a_cc[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bc[iAm1];
-
-               iP1 = iP - zOffsetP + xOffsetP;
-               rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
-                  +          rb[iR] * a_be[iAm1]
-                  +                   a_be[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP + yOffsetP;
-               rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bn[iAm1]
-                  +                   a_bn[iA]   * pa[iP1];
-
-               iP1 = iP - yOffsetP;
-               rap_cs[iAc] =          a_cs[iA]
-                  +          rb[iR] * a_cs[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cs[iAp1] * pa[iP1]
-                  +                   a_bs[iA]   * pb[iP1]
-                  +                   a_as[iA]   * pa[iP1]
-                  +          rb[iR] * a_as[iAm1]
-                  +          ra[iR] * a_bs[iAp1];
-
-               iP1 = iP - xOffsetP;
-               rap_cw[iAc] =          a_cw[iA]
-                  +          rb[iR] * a_cw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cw[iAp1] * pa[iP1]
-                  +                   a_bw[iA]   * pb[iP1]
-                  +                   a_aw[iA]   * pa[iP1]
-                  +          rb[iR] * a_aw[iAm1]
-                  +          ra[iR] * a_bw[iAp1];
-
-               rap_cc[iAc] =          a_cc[iA]
-                  +          rb[iR] * a_cc[iAm1] * pb[iP]
-                  +          ra[iR] * a_cc[iAp1] * pa[iP]
-                  +          rb[iR] * a_ac[iAm1]
-                  +          ra[iR] * a_bc[iAp1]
-                  +                   a_bc[iA]   * pb[iP]
-                  +                   a_ac[iA]   * pa[iP];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
+
+            HYPRE_Int iP1 = iP - zOffsetP - yOffsetP;
+            rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1]
+               +          rb[iR] * a_bs[iAm1]
+               +                   a_bs[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP - xOffsetP;
+            rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
+               +          rb[iR] * a_bw[iAm1]
+               +                   a_bw[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP;
+            rap_bc[iAc] =          a_bc[iA]   * pa[iP1]
+               +          rb[iR] * a_cc[iAm1] * pa[iP1]
+               +          rb[iR] * a_bc[iAm1];
+
+            iP1 = iP - zOffsetP + xOffsetP;
+            rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
+               +          rb[iR] * a_be[iAm1]
+               +                   a_be[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP + yOffsetP;
+            rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1]
+               +          rb[iR] * a_bn[iAm1]
+               +                   a_bn[iA]   * pa[iP1];
+
+            iP1 = iP - yOffsetP;
+            rap_cs[iAc] =          a_cs[iA]
+               +          rb[iR] * a_cs[iAm1] * pb[iP1]
+               +          ra[iR] * a_cs[iAp1] * pa[iP1]
+               +                   a_bs[iA]   * pb[iP1]
+               +                   a_as[iA]   * pa[iP1]
+               +          rb[iR] * a_as[iAm1]
+               +          ra[iR] * a_bs[iAp1];
+
+            iP1 = iP - xOffsetP;
+            rap_cw[iAc] =          a_cw[iA]
+               +          rb[iR] * a_cw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cw[iAp1] * pa[iP1]
+               +                   a_bw[iA]   * pb[iP1]
+               +                   a_aw[iA]   * pa[iP1]
+               +          rb[iR] * a_aw[iAm1]
+               +          ra[iR] * a_bw[iAp1];
+
+            rap_cc[iAc] =          a_cc[iA]
+               +          rb[iR] * a_cc[iAm1] * pb[iP]
+               +          ra[iR] * a_cc[iAp1] * pa[iP]
+               +          rb[iR] * a_ac[iAm1]
+               +          ra[iR] * a_bc[iAp1]
+               +                   a_bc[iA]   * pb[iP]
+               +                   a_ac[iA]   * pa[iP];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-            /*--------------------------------------------------------------
-             * Loop for symmetric 19-point fine grid operator; produces a
-             * symmetric 27-point coarse grid operator. We calculate only the
-             * lower triangular stencil entries: (below-southwest, below-south,
-             * below-southeast, below-west, below-center, below-east,
-             * below-northwest, below-north, below-northeast, center-southwest,
-             * center-south, center-southeast, center-west, and center-center).
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------
+          * Loop for symmetric 19-point fine grid operator; produces a
+          * symmetric 27-point coarse grid operator. We calculate only the
+          * lower triangular stencil entries: (below-southwest, below-south,
+          * below-southeast, below-west, below-center, below-east,
+          * below-northwest, below-north, below-northeast, center-southwest,
+          * center-south, center-southeast, center-west, and center-center).
+          *--------------------------------------------------------------*/
 
-         case 19:
+      case 19:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,a_csw,pa,rap_bs,a_cs,a_bs,rap_bse,a_cse,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bnw,a_cnw,rap_bn,a_cn,a_bn,rap_bne,a_cne,rap_csw,pb,ra,rap_cs,a_as,rap_cse,rap_cw,a_aw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
-
-               HYPRE_Int iP1 = iP - zOffsetP - yOffsetP - xOffsetP;
-               rap_bsw[iAc] = rb[iR] * a_csw[iAm1] * pa[iP1];
-
-               iP1 = iP - zOffsetP - yOffsetP;
-               rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bs[iAm1]
-                  +                   a_bs[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP - yOffsetP + xOffsetP;
-               rap_bse[iAc] = rb[iR] * a_cse[iAm1] * pa[iP1];
-
-               iP1 = iP - zOffsetP - xOffsetP;
-               rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bw[iAm1]
-                  +                   a_bw[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP;
-               rap_bc[iAc] =          a_bc[iA] * pa[iP1]
-                  +          rb[iR] * a_cc[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bc[iAm1];
-
-               iP1 = iP - zOffsetP + xOffsetP;
-               rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
-                  +          rb[iR] * a_be[iAm1]
-                  +                   a_be[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP + yOffsetP - xOffsetP;
-               rap_bnw[iAc] = rb[iR] * a_cnw[iAm1] * pa[iP1];
-
-               iP1 = iP - zOffsetP + yOffsetP;
-               rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bn[iAm1]
-                  +                   a_bn[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP + yOffsetP + xOffsetP;
-               rap_bne[iAc] = rb[iR] * a_cne[iAm1] * pa[iP1];
-
-               iP1 = iP - yOffsetP - xOffsetP;
-               rap_csw[iAc] =         a_csw[iA]
-                  +          rb[iR] * a_csw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_csw[iAp1] * pa[iP1];
-
-               iP1 = iP - yOffsetP;
-               rap_cs[iAc] =          a_cs[iA]
-                  +          rb[iR] * a_cs[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cs[iAp1] * pa[iP1]
-                  +                   a_bs[iA]   * pb[iP1]
-                  +                   a_as[iA]   * pa[iP1]
-                  +          rb[iR] * a_as[iAm1]
-                  +          ra[iR] * a_bs[iAp1];
-
-               iP1 = iP - yOffsetP + xOffsetP;
-               rap_cse[iAc] =          a_cse[iA]
-                  +          rb[iR] * a_cse[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cse[iAp1] * pa[iP1];
-
-               iP1 = iP - xOffsetP;
-               rap_cw[iAc] =          a_cw[iA]
-                  +          rb[iR] * a_cw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cw[iAp1] * pa[iP1]
-                  +                   a_bw[iA]   * pb[iP1]
-                  +                   a_aw[iA]   * pa[iP1]
-                  +          rb[iR] * a_aw[iAm1]
-                  +          ra[iR] * a_bw[iAp1];
-
-               rap_cc[iAc] =          a_cc[iA]
-                  +          rb[iR] * a_cc[iAm1] * pb[iP]
-                  +          ra[iR] * a_cc[iAp1] * pa[iP]
-                  +          rb[iR] * a_ac[iAm1]
-                  +          ra[iR] * a_bc[iAp1]
-                  +                   a_bc[iA]   * pb[iP]
-                  +                   a_ac[iA]   * pa[iP];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
+
+            HYPRE_Int iP1 = iP - zOffsetP - yOffsetP - xOffsetP;
+            rap_bsw[iAc] = rb[iR] * a_csw[iAm1] * pa[iP1];
+
+            iP1 = iP - zOffsetP - yOffsetP;
+            rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1]
+               +          rb[iR] * a_bs[iAm1]
+               +                   a_bs[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP - yOffsetP + xOffsetP;
+            rap_bse[iAc] = rb[iR] * a_cse[iAm1] * pa[iP1];
+
+            iP1 = iP - zOffsetP - xOffsetP;
+            rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
+               +          rb[iR] * a_bw[iAm1]
+               +                   a_bw[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP;
+            rap_bc[iAc] =          a_bc[iA] * pa[iP1]
+               +          rb[iR] * a_cc[iAm1] * pa[iP1]
+               +          rb[iR] * a_bc[iAm1];
+
+            iP1 = iP - zOffsetP + xOffsetP;
+            rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
+               +          rb[iR] * a_be[iAm1]
+               +                   a_be[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP + yOffsetP - xOffsetP;
+            rap_bnw[iAc] = rb[iR] * a_cnw[iAm1] * pa[iP1];
+
+            iP1 = iP - zOffsetP + yOffsetP;
+            rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1]
+               +          rb[iR] * a_bn[iAm1]
+               +                   a_bn[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP + yOffsetP + xOffsetP;
+            rap_bne[iAc] = rb[iR] * a_cne[iAm1] * pa[iP1];
+
+            iP1 = iP - yOffsetP - xOffsetP;
+            rap_csw[iAc] =         a_csw[iA]
+               +          rb[iR] * a_csw[iAm1] * pb[iP1]
+               +          ra[iR] * a_csw[iAp1] * pa[iP1];
+
+            iP1 = iP - yOffsetP;
+            rap_cs[iAc] =          a_cs[iA]
+               +          rb[iR] * a_cs[iAm1] * pb[iP1]
+               +          ra[iR] * a_cs[iAp1] * pa[iP1]
+               +                   a_bs[iA]   * pb[iP1]
+               +                   a_as[iA]   * pa[iP1]
+               +          rb[iR] * a_as[iAm1]
+               +          ra[iR] * a_bs[iAp1];
+
+            iP1 = iP - yOffsetP + xOffsetP;
+            rap_cse[iAc] =          a_cse[iA]
+               +          rb[iR] * a_cse[iAm1] * pb[iP1]
+               +          ra[iR] * a_cse[iAp1] * pa[iP1];
+
+            iP1 = iP - xOffsetP;
+            rap_cw[iAc] =          a_cw[iA]
+               +          rb[iR] * a_cw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cw[iAp1] * pa[iP1]
+               +                   a_bw[iA]   * pb[iP1]
+               +                   a_aw[iA]   * pa[iP1]
+               +          rb[iR] * a_aw[iAm1]
+               +          ra[iR] * a_bw[iAp1];
+
+            rap_cc[iAc] =          a_cc[iA]
+               +          rb[iR] * a_cc[iAm1] * pb[iP]
+               +          ra[iR] * a_cc[iAp1] * pa[iP]
+               +          rb[iR] * a_ac[iAm1]
+               +          ra[iR] * a_bc[iAp1]
+               +                   a_bc[iA]   * pb[iP]
+               +                   a_ac[iA]   * pa[iP];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-            /*--------------------------------------------------------------
-             * Loop for symmetric 27-point fine grid operator; produces a
-             * symmetric 27-point coarse grid operator. We calculate only the
-             * lower triangular stencil entries: (below-southwest, below-south,
-             * below-southeast, below-west, below-center, below-east,
-             * below-northwest, below-north, below-northeast, center-southwest,
-             * center-south, center-southeast, center-west, and center-center).
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------
+          * Loop for symmetric 27-point fine grid operator; produces a
+          * symmetric 27-point coarse grid operator. We calculate only the
+          * lower triangular stencil entries: (below-southwest, below-south,
+          * below-southeast, below-west, below-center, below-east,
+          * below-northwest, below-north, below-northeast, center-southwest,
+          * center-south, center-southeast, center-west, and center-center).
+          *--------------------------------------------------------------*/
 
-         default:
+      default:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_bsw,rb,a_csw,pa,a_bsw,rap_bs,a_cs,a_bs,rap_bse,a_cse,a_bse,rap_bw,a_cw,a_bw,rap_bc,a_bc,a_cc,rap_be,a_ce,a_be,rap_bnw,a_cnw,a_bnw,rap_bn,a_cn,a_bn,rap_bne,a_cne,a_bne,rap_csw,pb,ra,a_asw,rap_cs,a_as,rap_cse,a_ase,rap_cw,a_aw,rap_cc,a_ac)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
-
-               HYPRE_Int iP1 = iP - zOffsetP - yOffsetP - xOffsetP;
-               rap_bsw[iAc] = rb[iR] * a_csw[iAm1] * pa[iP1]
-                  +           rb[iR] * a_bsw[iAm1]
-                  +                    a_bsw[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP - yOffsetP;
-               rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bs[iAm1]
-                  +                   a_bs[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP - yOffsetP + xOffsetP;
-               rap_bse[iAc] = rb[iR] * a_cse[iAm1] * pa[iP1]
-                  +           rb[iR] * a_bse[iAm1]
-                  +                    a_bse[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP - xOffsetP;
-               rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bw[iAm1]
-                  +                   a_bw[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP;
-               rap_bc[iAc] =          a_bc[iA] * pa[iP1]
-                  +          rb[iR] * a_cc[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bc[iAm1];
-
-               iP1 = iP - zOffsetP + xOffsetP;
-               rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
-                  +          rb[iR] * a_be[iAm1]
-                  +                   a_be[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP + yOffsetP - xOffsetP;
-               rap_bnw[iAc] = rb[iR] * a_cnw[iAm1] * pa[iP1]
-                  +           rb[iR] * a_bnw[iAm1]
-                  +                    a_bnw[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP + yOffsetP;
-               rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1]
-                  +          rb[iR] * a_bn[iAm1]
-                  +                   a_bn[iA]   * pa[iP1];
-
-               iP1 = iP - zOffsetP + yOffsetP + xOffsetP;
-               rap_bne[iAc] = rb[iR] * a_cne[iAm1] * pa[iP1]
-                  +           rb[iR] * a_bne[iAm1]
-                  +                    a_bne[iA]   * pa[iP1];
-
-               iP1 = iP - yOffsetP - xOffsetP;
-               rap_csw[iAc] =          a_csw[iA]
-                  +          rb[iR] * a_csw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_csw[iAp1] * pa[iP1]
-                  +                   a_bsw[iA]   * pb[iP1]
-                  +                   a_asw[iA]   * pa[iP1]
-                  +          rb[iR] * a_asw[iAm1]
-                  +          ra[iR] * a_bsw[iAp1];
-
-               iP1 = iP - yOffsetP;
-               rap_cs[iAc] =          a_cs[iA]
-                  +          rb[iR] * a_cs[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cs[iAp1] * pa[iP1]
-                  +                   a_bs[iA]   * pb[iP1]
-                  +                   a_as[iA]   * pa[iP1]
-                  +          rb[iR] * a_as[iAm1]
-                  +          ra[iR] * a_bs[iAp1];
-
-               iP1 = iP - yOffsetP + xOffsetP;
-               rap_cse[iAc] =          a_cse[iA]
-                  +          rb[iR] * a_cse[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cse[iAp1] * pa[iP1]
-                  +                   a_bse[iA]   * pb[iP1]
-                  +                   a_ase[iA]   * pa[iP1]
-                  +          rb[iR] * a_ase[iAm1]
-                  +          ra[iR] * a_bse[iAp1];
-
-               iP1 = iP - xOffsetP;
-               rap_cw[iAc] =          a_cw[iA]
-                  +          rb[iR] * a_cw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cw[iAp1] * pa[iP1]
-                  +                   a_bw[iA]   * pb[iP1]
-                  +                   a_aw[iA]   * pa[iP1]
-                  +          rb[iR] * a_aw[iAm1]
-                  +          ra[iR] * a_bw[iAp1];
-
-               rap_cc[iAc] =          a_cc[iA]
-                  +          rb[iR] * a_cc[iAm1] * pb[iP]
-                  +          ra[iR] * a_cc[iAp1] * pa[iP]
-                  +          rb[iR] * a_ac[iAm1]
-                  +          ra[iR] * a_bc[iAp1]
-                  +                   a_bc[iA]   * pb[iP]
-                  +                   a_ac[iA]   * pa[iP];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
+
+            HYPRE_Int iP1 = iP - zOffsetP - yOffsetP - xOffsetP;
+            rap_bsw[iAc] = rb[iR] * a_csw[iAm1] * pa[iP1]
+               +           rb[iR] * a_bsw[iAm1]
+               +                    a_bsw[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP - yOffsetP;
+            rap_bs[iAc] = rb[iR] * a_cs[iAm1] * pa[iP1]
+               +          rb[iR] * a_bs[iAm1]
+               +                   a_bs[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP - yOffsetP + xOffsetP;
+            rap_bse[iAc] = rb[iR] * a_cse[iAm1] * pa[iP1]
+               +           rb[iR] * a_bse[iAm1]
+               +                    a_bse[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP - xOffsetP;
+            rap_bw[iAc] = rb[iR] * a_cw[iAm1] * pa[iP1]
+               +          rb[iR] * a_bw[iAm1]
+               +                   a_bw[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP;
+            rap_bc[iAc] =          a_bc[iA] * pa[iP1]
+               +          rb[iR] * a_cc[iAm1] * pa[iP1]
+               +          rb[iR] * a_bc[iAm1];
+
+            iP1 = iP - zOffsetP + xOffsetP;
+            rap_be[iAc] = rb[iR] * a_ce[iAm1] * pa[iP1]
+               +          rb[iR] * a_be[iAm1]
+               +                   a_be[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP + yOffsetP - xOffsetP;
+            rap_bnw[iAc] = rb[iR] * a_cnw[iAm1] * pa[iP1]
+               +           rb[iR] * a_bnw[iAm1]
+               +                    a_bnw[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP + yOffsetP;
+            rap_bn[iAc] = rb[iR] * a_cn[iAm1] * pa[iP1]
+               +          rb[iR] * a_bn[iAm1]
+               +                   a_bn[iA]   * pa[iP1];
+
+            iP1 = iP - zOffsetP + yOffsetP + xOffsetP;
+            rap_bne[iAc] = rb[iR] * a_cne[iAm1] * pa[iP1]
+               +           rb[iR] * a_bne[iAm1]
+               +                    a_bne[iA]   * pa[iP1];
+
+            iP1 = iP - yOffsetP - xOffsetP;
+            rap_csw[iAc] =          a_csw[iA]
+               +          rb[iR] * a_csw[iAm1] * pb[iP1]
+               +          ra[iR] * a_csw[iAp1] * pa[iP1]
+               +                   a_bsw[iA]   * pb[iP1]
+               +                   a_asw[iA]   * pa[iP1]
+               +          rb[iR] * a_asw[iAm1]
+               +          ra[iR] * a_bsw[iAp1];
+
+            iP1 = iP - yOffsetP;
+            rap_cs[iAc] =          a_cs[iA]
+               +          rb[iR] * a_cs[iAm1] * pb[iP1]
+               +          ra[iR] * a_cs[iAp1] * pa[iP1]
+               +                   a_bs[iA]   * pb[iP1]
+               +                   a_as[iA]   * pa[iP1]
+               +          rb[iR] * a_as[iAm1]
+               +          ra[iR] * a_bs[iAp1];
+
+            iP1 = iP - yOffsetP + xOffsetP;
+            rap_cse[iAc] =          a_cse[iA]
+               +          rb[iR] * a_cse[iAm1] * pb[iP1]
+               +          ra[iR] * a_cse[iAp1] * pa[iP1]
+               +                   a_bse[iA]   * pb[iP1]
+               +                   a_ase[iA]   * pa[iP1]
+               +          rb[iR] * a_ase[iAm1]
+               +          ra[iR] * a_bse[iAp1];
+
+            iP1 = iP - xOffsetP;
+            rap_cw[iAc] =          a_cw[iA]
+               +          rb[iR] * a_cw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cw[iAp1] * pa[iP1]
+               +                   a_bw[iA]   * pb[iP1]
+               +                   a_aw[iA]   * pa[iP1]
+               +          rb[iR] * a_aw[iAm1]
+               +          ra[iR] * a_bw[iAp1];
+
+            rap_cc[iAc] =          a_cc[iA]
+               +          rb[iR] * a_cc[iAm1] * pb[iP]
+               +          ra[iR] * a_cc[iAp1] * pa[iP]
+               +          rb[iR] * a_ac[iAm1]
+               +          ra[iR] * a_bc[iAp1]
+               +                   a_bc[iA]   * pb[iP]
+               +                   a_ac[iA]   * pa[iP];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-      } /* end switch statement */
+   } /* end switch statement */
 
-   } /* end ForBoxI */
 
    return hypre_error_flag;
 }
@@ -927,28 +1104,65 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
                          hypre_StructMatrix *RAP,
                          hypre_Index         cindex,
                          hypre_Index         cstride )
-
 {
+   hypre_StructGrid     *fgrid;
+   HYPRE_Int            *fgrid_ids;
+   hypre_StructGrid     *cgrid;
+   hypre_BoxArray       *cgrid_boxes;
+   HYPRE_Int            *cgrid_ids;
+   HYPRE_Int             fi, ci;
+
+   fgrid = hypre_StructMatrixGrid(A);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+
+   cgrid = hypre_StructMatrixGrid(RAP);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
 
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      hypre_SMG3BuildRAPNoSymBox(ci, fi, hypre_BoxArrayBox(cgrid_boxes, ci),
+                                 A, PT, R, RAP, cindex, cstride);
+   } /* end ForBoxI */
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SMG3BuildRAPNoSymBox
+ *
+ * Upper triangular coefficients of RAP on cgrid_box (see
+ * hypre_SMG3BuildRAPSymBox).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SMG3BuildRAPNoSymBox( HYPRE_Int           ci,
+                            HYPRE_Int           fi,
+                            hypre_Box          *cgrid_box,
+                            hypre_StructMatrix *A,
+                            hypre_StructMatrix *PT,
+                            hypre_StructMatrix *R,
+                            hypre_StructMatrix *RAP,
+                            hypre_Index         cindex,
+                            hypre_Index         cstride )
+{
    hypre_Index           index;
 
    hypre_StructStencil  *fine_stencil;
    HYPRE_Int             fine_stencil_size;
 
-   hypre_StructGrid     *fgrid;
-   HYPRE_Int            *fgrid_ids;
-   hypre_StructGrid     *cgrid;
-   hypre_BoxArray       *cgrid_boxes;
-   HYPRE_Int            *cgrid_ids;
-   hypre_Box            *cgrid_box;
    hypre_IndexRef        cstart;
    hypre_Index           stridec;
    hypre_Index           fstart;
    hypre_IndexRef        stridef;
    hypre_Index           loop_size;
 
-   HYPRE_Int             fi, ci;
-
    hypre_Box            *A_dbox;
    hypre_Box            *PT_dbox;
    hypre_Box            *R_dbox;
@@ -980,607 +1194,589 @@ hypre_SMG3BuildRAPNoSym( hypre_StructMatrix *A,
    stridef = cstride;
    hypre_SetIndex3(stridec, 1, 1, 1);
 
-   fgrid = hypre_StructMatrixGrid(A);
-   fgrid_ids = hypre_StructGridIDs(fgrid);
-
-   cgrid = hypre_StructMatrixGrid(RAP);
-   cgrid_boxes = hypre_StructGridBoxes(cgrid);
-   cgrid_ids = hypre_StructGridIDs(cgrid);
-
-   fi = 0;
-   hypre_ForBoxI(ci, cgrid_boxes)
-   {
-      while (fgrid_ids[fi] != cgrid_ids[ci])
-      {
-         fi++;
-      }
+   cstart = hypre_BoxIMin(cgrid_box);
+   hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
 
-      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+   PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
+   R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+   RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
 
-      cstart = hypre_BoxIMin(cgrid_box);
-      hypre_StructMapCoarseToFine(cstart, cindex, cstride, fstart);
+   /*-----------------------------------------------------------------
+    * Extract pointers for interpolation operator:
+    * pa is pointer for weight for f-point above c-point
+    * pb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
 
-      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
-      PT_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(PT), fi);
-      R_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
-      RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
+   hypre_SetIndex3(index,0,0,1);
+   pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
 
-      /*-----------------------------------------------------------------
-       * Extract pointers for interpolation operator:
-       * pa is pointer for weight for f-point above c-point
-       * pb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
+   hypre_SetIndex3(index,0,0,-1);
+   pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
 
-      hypre_SetIndex3(index,0,0,1);
-      pa = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
 
-      hypre_SetIndex3(index,0,0,-1);
-      pb = hypre_StructMatrixExtractPointerByIndex(PT, fi, index);
+   /*-----------------------------------------------------------------
+    * Extract pointers for restriction operator:
+    * ra is pointer for weight for f-point above c-point
+    * rb is pointer for weight for f-point below c-point
+    *-----------------------------------------------------------------*/
 
+   hypre_SetIndex3(index,0,0,1);
+   ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
 
-      /*-----------------------------------------------------------------
-       * Extract pointers for restriction operator:
-       * ra is pointer for weight for f-point above c-point
-       * rb is pointer for weight for f-point below c-point
-       *-----------------------------------------------------------------*/
+   hypre_SetIndex3(index,0,0,-1);
+   rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
 
-      hypre_SetIndex3(index,0,0,1);
-      ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
 
-      hypre_SetIndex3(index,0,0,-1);
-      rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+   /*-----------------------------------------------------------------
+    * Extract pointers for 7-point fine grid operator:
+    *
+    * a_cc is pointer for center coefficient
+    * a_cw is pointer for west coefficient in same plane
+    * a_ce is pointer for east coefficient in same plane
+    * a_cs is pointer for south coefficient in same plane
+    * a_cn is pointer for north coefficient in same plane
+    * a_ac is pointer for center coefficient in plane above
+    * a_bc is pointer for center coefficient in plane below
+    *-----------------------------------------------------------------*/
 
+   hypre_SetIndex3(index,0,0,0);
+   a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      /*-----------------------------------------------------------------
-       * Extract pointers for 7-point fine grid operator:
-       *
-       * a_cc is pointer for center coefficient
-       * a_cw is pointer for west coefficient in same plane
-       * a_ce is pointer for east coefficient in same plane
-       * a_cs is pointer for south coefficient in same plane
-       * a_cn is pointer for north coefficient in same plane
-       * a_ac is pointer for center coefficient in plane above
-       * a_bc is pointer for center coefficient in plane below
-       *-----------------------------------------------------------------*/
+   hypre_SetIndex3(index,-1,0,0);
+   a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      hypre_SetIndex3(index,0,0,0);
-      a_cc = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   hypre_SetIndex3(index,1,0,0);
+   a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      hypre_SetIndex3(index,-1,0,0);
-      a_cw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   hypre_SetIndex3(index,0,-1,0);
+   a_cs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      hypre_SetIndex3(index,1,0,0);
-      a_ce = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   hypre_SetIndex3(index,0,1,0);
+   a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      hypre_SetIndex3(index,0,-1,0);
-      a_cs = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   hypre_SetIndex3(index,0,0,1);
+   a_ac = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      hypre_SetIndex3(index,0,1,0);
-      a_cn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 15-point fine grid operator:
+    *
+    * a_aw is pointer for west coefficient in plane above
+    * a_ae is pointer for east coefficient in plane above
+    * a_as is pointer for south coefficient in plane above
+    * a_an is pointer for north coefficient in plane above
+    * a_bw is pointer for west coefficient in plane below
+    * a_be is pointer for east coefficient in plane below
+    * a_bs is pointer for south coefficient in plane below
+    * a_bn is pointer for north coefficient in plane below
+    *-----------------------------------------------------------------*/
 
-      hypre_SetIndex3(index,0,0,1);
-      a_ac = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   if(fine_stencil_size > 7)
+   {
+      hypre_SetIndex3(index,-1,0,1);
+      a_aw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 15-point fine grid operator:
-       *
-       * a_aw is pointer for west coefficient in plane above
-       * a_ae is pointer for east coefficient in plane above
-       * a_as is pointer for south coefficient in plane above
-       * a_an is pointer for north coefficient in plane above
-       * a_bw is pointer for west coefficient in plane below
-       * a_be is pointer for east coefficient in plane below
-       * a_bs is pointer for south coefficient in plane below
-       * a_bn is pointer for north coefficient in plane below
-       *-----------------------------------------------------------------*/
+      hypre_SetIndex3(index,1,0,1);
+      a_ae = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      if(fine_stencil_size > 7)
-      {
-         hypre_SetIndex3(index,-1,0,1);
-         a_aw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,0,-1,1);
+      a_as = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,0,1);
-         a_ae = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,0,1,1);
+      a_an = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,0,-1,1);
-         a_as = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,0,-1);
+      a_be = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,0,1,1);
-         a_an = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,0,1,-1);
+      a_bn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,0,-1);
-         a_be = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   }
 
-         hypre_SetIndex3(index,0,1,-1);
-         a_bn = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 19-point fine grid operator:
+    *
+    * a_csw is pointer for southwest coefficient in same plane
+    * a_cse is pointer for southeast coefficient in same plane
+    * a_cnw is pointer for northwest coefficient in same plane
+    * a_cne is pointer for northeast coefficient in same plane
+    *-----------------------------------------------------------------*/
 
-      }
+   if(fine_stencil_size > 15)
+   {
+      hypre_SetIndex3(index,-1,-1,0);
+      a_csw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 19-point fine grid operator:
-       *
-       * a_csw is pointer for southwest coefficient in same plane
-       * a_cse is pointer for southeast coefficient in same plane
-       * a_cnw is pointer for northwest coefficient in same plane
-       * a_cne is pointer for northeast coefficient in same plane
-       *-----------------------------------------------------------------*/
+      hypre_SetIndex3(index,1,-1,0);
+      a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      if(fine_stencil_size > 15)
-      {
-         hypre_SetIndex3(index,-1,-1,0);
-         a_csw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,1,0);
+      a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,-1,0);
-         a_cse = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,1,0);
+      a_cne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,1,0);
-         a_cnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   }
 
-         hypre_SetIndex3(index,1,1,0);
-         a_cne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 27-point fine grid operator:
+    *
+    * a_asw is pointer for southwest coefficient in plane above
+    * a_ase is pointer for southeast coefficient in plane above
+    * a_anw is pointer for northwest coefficient in plane above
+    * a_ane is pointer for northeast coefficient in plane above
+    * a_bsw is pointer for southwest coefficient in plane below
+    * a_bse is pointer for southeast coefficient in plane below
+    * a_bnw is pointer for northwest coefficient in plane below
+    * a_bne is pointer for northeast coefficient in plane below
+    *-----------------------------------------------------------------*/
+
+   if(fine_stencil_size > 19)
+   {
+      hypre_SetIndex3(index,-1,-1,1);
+      a_asw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      }
+      hypre_SetIndex3(index,1,-1,1);
+      a_ase = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 27-point fine grid operator:
-       *
-       * a_asw is pointer for southwest coefficient in plane above
-       * a_ase is pointer for southeast coefficient in plane above
-       * a_anw is pointer for northwest coefficient in plane above
-       * a_ane is pointer for northeast coefficient in plane above
-       * a_bsw is pointer for southwest coefficient in plane below
-       * a_bse is pointer for southeast coefficient in plane below
-       * a_bnw is pointer for northwest coefficient in plane below
-       * a_bne is pointer for northeast coefficient in plane below
-       *-----------------------------------------------------------------*/
-
-      if(fine_stencil_size > 19)
-      {
-         hypre_SetIndex3(index,-1,-1,1);
-         a_asw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,1,1);
+      a_anw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,-1,1);
-         a_ase = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,1,1);
+      a_ane = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,1,1);
-         a_anw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,-1,1,-1);
+      a_bnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,1,1,1);
-         a_ane = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+      hypre_SetIndex3(index,1,1,-1);
+      a_bne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
 
-         hypre_SetIndex3(index,-1,1,-1);
-         a_bnw = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   }
 
-         hypre_SetIndex3(index,1,1,-1);
-         a_bne = hypre_StructMatrixExtractPointerByIndex(A, fi, index);
+   /*-----------------------------------------------------------------
+    * Extract pointers for 15-point coarse grid operator:
+    *
+    * We build only the upper triangular part (excluding diagonal).
+    *
+    * rap_ce is pointer for east coefficient in same plane (etc.)
+    *-----------------------------------------------------------------*/
 
-      }
+   hypre_SetIndex3(index,1,0,0);
+   rap_ce = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      /*-----------------------------------------------------------------
-       * Extract pointers for 15-point coarse grid operator:
-       *
-       * We build only the upper triangular part (excluding diagonal).
-       *
-       * rap_ce is pointer for east coefficient in same plane (etc.)
-       *-----------------------------------------------------------------*/
+   hypre_SetIndex3(index,0,1,0);
+   rap_cn = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,1,0,0);
-      rap_ce = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,0,1);
+   rap_ac = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,0,1,0);
-      rap_cn = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,-1,0,1);
+   rap_aw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,0,0,1);
-      rap_ac = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,1,0,1);
+   rap_ae = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,-1,0,1);
-      rap_aw = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,-1,1);
+   rap_as = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,1,0,1);
-      rap_ae = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   hypre_SetIndex3(index,0,1,1);
+   rap_an = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      hypre_SetIndex3(index,0,-1,1);
-      rap_as = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   /*-----------------------------------------------------------------
+    * Extract additional pointers for 27-point coarse grid operator:
+    *
+    * A 27-point coarse grid operator is produced when the fine grid
+    * stencil is 19 or 27 point.
+    *
+    * We build only the upper triangular part.
+    *
+    * rap_cnw is pointer for northwest coefficient in same plane (etc.)
+    *-----------------------------------------------------------------*/
 
-      hypre_SetIndex3(index,0,1,1);
-      rap_an = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
-
-      /*-----------------------------------------------------------------
-       * Extract additional pointers for 27-point coarse grid operator:
-       *
-       * A 27-point coarse grid operator is produced when the fine grid
-       * stencil is 19 or 27 point.
-       *
-       * We build only the upper triangular part.
-       *
-       * rap_cnw is pointer for northwest coefficient in same plane (etc.)
-       *-----------------------------------------------------------------*/
-
-      if(fine_stencil_size > 15)
-      {
-         hypre_SetIndex3(index,-1,1,0);
-         rap_cnw =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+   if(fine_stencil_size > 15)
+   {
+      hypre_SetIndex3(index,-1,1,0);
+      rap_cnw =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,1,1,0);
-         rap_cne =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,1,1,0);
+      rap_cne =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,-1,-1,1);
-         rap_asw =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,-1,-1,1);
+      rap_asw =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,1,-1,1);
-         rap_ase =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,1,-1,1);
+      rap_ase =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,-1,1,1);
-         rap_anw =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,-1,1,1);
+      rap_anw =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-         hypre_SetIndex3(index,1,1,1);
-         rap_ane =
-            hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+      hypre_SetIndex3(index,1,1,1);
+      rap_ane =
+         hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
 
-      }
+   }
 
-      /*-----------------------------------------------------------------
-       * Define offsets for fine grid stencil and interpolation
-       *
-       * In the BoxLoop below I assume iA and iP refer to data associated
-       * with the point which we are building the stencil for. The below
-       * Offsets are used in refering to data associated with other points.
-       *-----------------------------------------------------------------*/
-
-      hypre_SetIndex3(index,0,0,1);
-      zOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
-      zOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-      hypre_SetIndex3(index,0,1,0);
-      yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-      hypre_SetIndex3(index,1,0,0);
-      xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
-
-      /*-----------------------------------------------------------------
-       * Switch statement to direct control to apropriate BoxLoop depending
-       * on stencil size. Default is full 27-point.
-       *-----------------------------------------------------------------*/
-
-      switch (fine_stencil_size)
-      {
+   /*-----------------------------------------------------------------
+    * Define offsets for fine grid stencil and interpolation
+    *
+    * In the BoxLoop below I assume iA and iP refer to data associated
+    * with the point which we are building the stencil for. The below
+    * Offsets are used in refering to data associated with other points.
+    *-----------------------------------------------------------------*/
+
+   hypre_SetIndex3(index,0,0,1);
+   zOffsetA = hypre_BoxOffsetDistance(A_dbox,index);
+   zOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+   hypre_SetIndex3(index,0,1,0);
+   yOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+   hypre_SetIndex3(index,1,0,0);
+   xOffsetP = hypre_BoxOffsetDistance(PT_dbox,index);
+
+   /*-----------------------------------------------------------------
+    * Switch statement to direct control to apropriate BoxLoop depending
+    * on stencil size. Default is full 27-point.
+    *-----------------------------------------------------------------*/
+
+   switch (fine_stencil_size)
+   {
 
-         /*--------------------------------------------------------------
-          * Loop for 7-point fine grid operator; produces upper triangular
-          * part of 15-point coarse grid operator. stencil entries:
-          * (above-north, above-east, above-center, above-west,
-          * above-south, center-north, and center-east).
-          *--------------------------------------------------------------*/
+      /*--------------------------------------------------------------
+       * Loop for 7-point fine grid operator; produces upper triangular
+       * part of 15-point coarse grid operator. stencil entries:
+       * (above-north, above-east, above-center, above-west,
+       * above-south, center-north, and center-east).
+       *--------------------------------------------------------------*/
 
-         case 7:
+      case 7:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_an,ra,a_cn,pb,rap_ae,a_ce,rap_ac,a_ac,a_cc,rap_aw,a_cw,rap_as,a_cs,rap_cn,rb,pa,rap_ce)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
 
-               HYPRE_Int iP1 = iP + zOffsetP + yOffsetP;
-               rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1];
+            HYPRE_Int iP1 = iP + zOffsetP + yOffsetP;
+            rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1];
 
-               iP1 = iP + zOffsetP + xOffsetP;
-               rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1];
+            iP1 = iP + zOffsetP + xOffsetP;
+            rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1];
 
-               iP1 = iP + zOffsetP;
-               rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
-                  +          ra[iR] * a_cc[iAp1] * pb[iP1]
-                  +          ra[iR] * a_ac[iAp1];
+            iP1 = iP + zOffsetP;
+            rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
+               +          ra[iR] * a_cc[iAp1] * pb[iP1]
+               +          ra[iR] * a_ac[iAp1];
 
-               iP1 = iP + zOffsetP - xOffsetP;
-               rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1];
+            iP1 = iP + zOffsetP - xOffsetP;
+            rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1];
 
-               iP1 = iP + zOffsetP - yOffsetP;
-               rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1];
+            iP1 = iP + zOffsetP - yOffsetP;
+            rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1];
 
-               iP1 = iP + yOffsetP;
-               rap_cn[iAc] =          a_cn[iA]
-                  +          rb[iR] * a_cn[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cn[iAp1] * pa[iP1];
+            iP1 = iP + yOffsetP;
+            rap_cn[iAc] =          a_cn[iA]
+               +          rb[iR] * a_cn[iAm1] * pb[iP1]
+               +          ra[iR] * a_cn[iAp1] * pa[iP1];
 
-               iP1 = iP + xOffsetP;
-               rap_ce[iAc] =          a_ce[iA]
-                  +          rb[iR] * a_ce[iAm1] * pb[iP1]
-                  +          ra[iR] * a_ce[iAp1] * pa[iP1];
+            iP1 = iP + xOffsetP;
+            rap_ce[iAc] =          a_ce[iA]
+               +          rb[iR] * a_ce[iAm1] * pb[iP1]
+               +          ra[iR] * a_ce[iAp1] * pa[iP1];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-            /*--------------------------------------------------------------
-             * Loop for 15-point fine grid operator; produces upper triangular
-             * part of 15-point coarse grid operator. stencil entries:
-             * (above-north, above-east, above-center, above-west,
-             * above-south, center-north, and center-east).
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------
+          * Loop for 15-point fine grid operator; produces upper triangular
+          * part of 15-point coarse grid operator. stencil entries:
+          * (above-north, above-east, above-center, above-west,
+          * above-south, center-north, and center-east).
+          *--------------------------------------------------------------*/
 
-         case 15:
+      case 15:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_an,ra,a_cn,pb,a_an,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_as,a_cs,a_as,rap_cn,rb,pa,a_bn,rap_ce,a_be)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
-
-               HYPRE_Int iP1 = iP + zOffsetP + yOffsetP;
-               rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1]
-                  +          ra[iR] * a_an[iAp1]
-                  +                   a_an[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP + xOffsetP;
-               rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
-                  +          ra[iR] * a_ae[iAp1]
-                  +                   a_ae[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP;
-               rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
-                  +          ra[iR] * a_cc[iAp1] * pb[iP1]
-                  +          ra[iR] * a_ac[iAp1];
-
-               iP1 = iP + zOffsetP - xOffsetP;
-               rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
-                  +          ra[iR] * a_aw[iAp1]
-                  +                   a_aw[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP - yOffsetP;
-               rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1]
-                  +          ra[iR] * a_as[iAp1]
-                  +                   a_as[iA]   * pb[iP1];
-
-               iP1 = iP + yOffsetP;
-               rap_cn[iAc] =          a_cn[iA]
-                  +          rb[iR] * a_cn[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cn[iAp1] * pa[iP1]
-                  +                   a_bn[iA]   * pb[iP1]
-                  +                   a_an[iA]   * pa[iP1]
-                  +          rb[iR] * a_an[iAm1]
-                  +          ra[iR] * a_bn[iAp1];
-
-               iP1 = iP + xOffsetP;
-               rap_ce[iAc] =          a_ce[iA]
-                  +          rb[iR] * a_ce[iAm1] * pb[iP1]
-                  +          ra[iR] * a_ce[iAp1] * pa[iP1]
-                  +                   a_be[iA]   * pb[iP1]
-                  +                   a_ae[iA]   * pa[iP1]
-                  +          rb[iR] * a_ae[iAm1]
-                  +          ra[iR] * a_be[iAp1];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
+
+            HYPRE_Int iP1 = iP + zOffsetP + yOffsetP;
+            rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1]
+               +          ra[iR] * a_an[iAp1]
+               +                   a_an[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP + xOffsetP;
+            rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
+               +          ra[iR] * a_ae[iAp1]
+               +                   a_ae[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP;
+            rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
+               +          ra[iR] * a_cc[iAp1] * pb[iP1]
+               +          ra[iR] * a_ac[iAp1];
+
+            iP1 = iP + zOffsetP - xOffsetP;
+            rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
+               +          ra[iR] * a_aw[iAp1]
+               +                   a_aw[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP - yOffsetP;
+            rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1]
+               +          ra[iR] * a_as[iAp1]
+               +                   a_as[iA]   * pb[iP1];
+
+            iP1 = iP + yOffsetP;
+            rap_cn[iAc] =          a_cn[iA]
+               +          rb[iR] * a_cn[iAm1] * pb[iP1]
+               +          ra[iR] * a_cn[iAp1] * pa[iP1]
+               +                   a_bn[iA]   * pb[iP1]
+               +                   a_an[iA]   * pa[iP1]
+               +          rb[iR] * a_an[iAm1]
+               +          ra[iR] * a_bn[iAp1];
+
+            iP1 = iP + xOffsetP;
+            rap_ce[iAc] =          a_ce[iA]
+               +          rb[iR] * a_ce[iAm1] * pb[iP1]
+               +          ra[iR] * a_ce[iAp1] * pa[iP1]
+               +                   a_be[iA]   * pb[iP1]
+               +                   a_ae[iA]   * pa[iP1]
+               +          rb[iR] * a_ae[iAm1]
+               +          ra[iR] * a_be[iAp1];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
 
-            /*--------------------------------------------------------------
-             * Loop for 19-point fine grid operator; produces upper triangular
-             * part of 27-point coarse grid operator. stencil entries:
-             * (above-northeast, above-north, above-northwest, above-east,
-             * above-center, above-west, above-southeast, above-south,
-             * above-southwest, center-northeast, center-north,
-             * center-northwest, and center-east).
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------
+          * Loop for 19-point fine grid operator; produces upper triangular
+          * part of 27-point coarse grid operator. stencil entries:
+          * (above-northeast, above-north, above-northwest, above-east,
+          * above-center, above-west, above-southeast, above-south,
+          * above-southwest, center-northeast, center-north,
+          * center-northwest, and center-east).
+          *--------------------------------------------------------------*/
 
-         case 19:
+      case 19:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,a_cne,pb,rap_an,a_cn,a_an,rap_anw,a_cnw,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_ase,a_cse,rap_as,a_cs,a_as,rap_asw,a_csw,rap_cne,rb,pa,rap_cn,a_bn,rap_cnw,rap_ce,a_be)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
-
-               HYPRE_Int  iP1 = iP + zOffsetP + yOffsetP + xOffsetP;
-               rap_ane[iAc] = ra[iR] * a_cne[iAp1] * pb[iP1];
-
-               iP1 = iP + zOffsetP + yOffsetP;
-               rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1]
-                  +          ra[iR] * a_an[iAp1]
-                  +                   a_an[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP + yOffsetP - xOffsetP;
-               rap_anw[iAc] = ra[iR] * a_cnw[iAp1] * pb[iP1];
-
-               iP1 = iP + zOffsetP + xOffsetP;
-               rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
-                  +          ra[iR] * a_ae[iAp1]
-                  +                   a_ae[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP;
-               rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
-                  +          ra[iR] * a_cc[iAp1] * pb[iP1]
-                  +          ra[iR] * a_ac[iAp1];
-
-               iP1 = iP + zOffsetP - xOffsetP;
-               rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
-                  +          ra[iR] * a_aw[iAp1]
-                  +                   a_aw[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP - yOffsetP + xOffsetP;
-               rap_ase[iAc] = ra[iR] * a_cse[iAp1] * pb[iP1];
-
-               iP1 = iP + zOffsetP - yOffsetP;
-               rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1]
-                  +          ra[iR] * a_as[iAp1]
-                  +                   a_as[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP - yOffsetP - xOffsetP;
-               rap_asw[iAc] = ra[iR] * a_csw[iAp1] * pb[iP1];
-
-               iP1 = iP + yOffsetP + xOffsetP;
-               rap_cne[iAc] =         a_cne[iA]
-                  +          rb[iR] * a_cne[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cne[iAp1] * pa[iP1];
-
-               iP1 = iP + yOffsetP;
-               rap_cn[iAc] =          a_cn[iA]
-                  +          rb[iR] * a_cn[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cn[iAp1] * pa[iP1]
-                  +                   a_bn[iA]   * pb[iP1]
-                  +                   a_an[iA]   * pa[iP1]
-                  +          rb[iR] * a_an[iAm1]
-                  +          ra[iR] * a_bn[iAp1];
-
-               iP1 = iP + yOffsetP - xOffsetP;
-               rap_cnw[iAc] =         a_cnw[iA]
-                  +          rb[iR] * a_cnw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cnw[iAp1] * pa[iP1];
-
-               iP1 = iP + xOffsetP;
-               rap_ce[iAc] =          a_ce[iA]
-                  +          rb[iR] * a_ce[iAm1] * pb[iP1]
-                  +          ra[iR] * a_ce[iAp1] * pa[iP1]
-                  +                   a_be[iA]   * pb[iP1]
-                  +                   a_ae[iA]   * pa[iP1]
-                  +          rb[iR] * a_ae[iAm1]
-                  +          ra[iR] * a_be[iAp1];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
+
+            HYPRE_Int  iP1 = iP + zOffsetP + yOffsetP + xOffsetP;
+            rap_ane[iAc] = ra[iR] * a_cne[iAp1] * pb[iP1];
+
+            iP1 = iP + zOffsetP + yOffsetP;
+            rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1]
+               +          ra[iR] * a_an[iAp1]
+               +                   a_an[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP + yOffsetP - xOffsetP;
+            rap_anw[iAc] = ra[iR] * a_cnw[iAp1] * pb[iP1];
+
+            iP1 = iP + zOffsetP + xOffsetP;
+            rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
+               +          ra[iR] * a_ae[iAp1]
+               +                   a_ae[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP;
+            rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
+               +          ra[iR] * a_cc[iAp1] * pb[iP1]
+               +          ra[iR] * a_ac[iAp1];
+
+            iP1 = iP + zOffsetP - xOffsetP;
+            rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
+               +          ra[iR] * a_aw[iAp1]
+               +                   a_aw[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP - yOffsetP + xOffsetP;
+            rap_ase[iAc] = ra[iR] * a_cse[iAp1] * pb[iP1];
+
+            iP1 = iP + zOffsetP - yOffsetP;
+            rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1]
+               +          ra[iR] * a_as[iAp1]
+               +                   a_as[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP - yOffsetP - xOffsetP;
+            rap_asw[iAc] = ra[iR] * a_csw[iAp1] * pb[iP1];
+
+            iP1 = iP + yOffsetP + xOffsetP;
+            rap_cne[iAc] =         a_cne[iA]
+               +          rb[iR] * a_cne[iAm1] * pb[iP1]
+               +          ra[iR] * a_cne[iAp1] * pa[iP1];
+
+            iP1 = iP + yOffsetP;
+            rap_cn[iAc] =          a_cn[iA]
+               +          rb[iR] * a_cn[iAm1] * pb[iP1]
+               +          ra[iR] * a_cn[iAp1] * pa[iP1]
+               +                   a_bn[iA]   * pb[iP1]
+               +                   a_an[iA]   * pa[iP1]
+               +          rb[iR] * a_an[iAm1]
+               +          ra[iR] * a_bn[iAp1];
+
+            iP1 = iP + yOffsetP - xOffsetP;
+            rap_cnw[iAc] =         a_cnw[iA]
+               +          rb[iR] * a_cnw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cnw[iAp1] * pa[iP1];
+
+            iP1 = iP + xOffsetP;
+            rap_ce[iAc] =          a_ce[iA]
+               +          rb[iR] * a_ce[iAm1] * pb[iP1]
+               +          ra[iR] * a_ce[iAp1] * pa[iP1]
+               +                   a_be[iA]   * pb[iP1]
+               +                   a_ae[iA]   * pa[iP1]
+               +          rb[iR] * a_ae[iAm1]
+               +          ra[iR] * a_be[iAp1];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-            /*--------------------------------------------------------------
-             * Loop for 27-point fine grid operator; produces upper triangular
-             * part of 27-point coarse grid operator. stencil entries:
-             * (above-northeast, above-north, above-northwest, above-east,
-             * above-center, above-west, above-southeast, above-south,
-             * above-southwest, center-northeast, center-north,
-             * center-northwest, and center-east).
-             *--------------------------------------------------------------*/
+         /*--------------------------------------------------------------
+          * Loop for 27-point fine grid operator; produces upper triangular
+          * part of 27-point coarse grid operator. stencil entries:
+          * (above-northeast, above-north, above-northwest, above-east,
+          * above-center, above-west, above-southeast, above-south,
+          * above-southwest, center-northeast, center-north,
+          * center-northwest, and center-east).
+          *--------------------------------------------------------------*/
 
-         default:
+      default:
 
-            hypre_BoxGetSize(cgrid_box, loop_size);
+         hypre_BoxGetSize(cgrid_box, loop_size);
 
 #define DEVICE_VAR is_device_ptr(rap_ane,ra,a_cne,pb,a_ane,rap_an,a_cn,a_an,rap_anw,a_cnw,a_anw,rap_ae,a_ce,a_ae,rap_ac,a_ac,a_cc,rap_aw,a_cw,a_aw,rap_ase,a_cse,a_ase,rap_as,a_cs,a_as,rap_asw,a_csw,a_asw,rap_cne,rb,pa,a_bne,rap_cn,a_bn,rap_cnw,a_bnw,rap_ce,a_be)
-            hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
-                                PT_dbox,  cstart, stridec, iP,
-                                R_dbox,   cstart, stridec, iR,
-                                A_dbox,   fstart, stridef, iA,
-                                RAP_dbox, cstart, stridec, iAc);
-            {
-               HYPRE_Int iAm1 = iA - zOffsetA;
-               HYPRE_Int iAp1 = iA + zOffsetA;
-
-               HYPRE_Int iP1 = iP + zOffsetP + yOffsetP + xOffsetP;
-               rap_ane[iAc] = ra[iR] * a_cne[iAp1] * pb[iP1]
-                  +           ra[iR] * a_ane[iAp1]
-                  +                    a_ane[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP + yOffsetP;
-               rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1]
-                  +          ra[iR] * a_an[iAp1]
-                  +                   a_an[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP + yOffsetP - xOffsetP;
-               rap_anw[iAc] = ra[iR] * a_cnw[iAp1] * pb[iP1]
-                  +           ra[iR] * a_anw[iAp1]
-                  +                    a_anw[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP + xOffsetP;
-               rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
-                  +          ra[iR] * a_ae[iAp1]
-                  +                   a_ae[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP;
-               rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
-                  +          ra[iR] * a_cc[iAp1] * pb[iP1]
-                  +          ra[iR] * a_ac[iAp1];
-
-               iP1 = iP + zOffsetP - xOffsetP;
-               rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
-                  +          ra[iR] * a_aw[iAp1]
-                  +                   a_aw[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP - yOffsetP + xOffsetP;
-               rap_ase[iAc] = ra[iR] * a_cse[iAp1] * pb[iP1]
-                  +           ra[iR] * a_ase[iAp1]
-                  +                    a_ase[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP - yOffsetP;
-               rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1]
-                  +          ra[iR] * a_as[iAp1]
-                  +                   a_as[iA]   * pb[iP1];
-
-               iP1 = iP + zOffsetP - yOffsetP - xOffsetP;
-               rap_asw[iAc] = ra[iR] * a_csw[iAp1] * pb[iP1]
-                  +           ra[iR] * a_asw[iAp1]
-                  +                    a_asw[iA]   * pb[iP1];
-
-
-               iP1 = iP + yOffsetP + xOffsetP;
-               rap_cne[iAc] =         a_cne[iA]
-                  +          rb[iR] * a_cne[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cne[iAp1] * pa[iP1]
-                  +                   a_bne[iA]   * pb[iP1]
-                  +                   a_ane[iA]   * pa[iP1]
-                  +          rb[iR] * a_ane[iAm1]
-                  +          ra[iR] * a_bne[iAp1];
-
-               iP1 = iP + yOffsetP;
-               rap_cn[iAc] =          a_cn[iA]
-                  +          rb[iR] * a_cn[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cn[iAp1] * pa[iP1]
-                  +                   a_bn[iA]   * pb[iP1]
-                  +                   a_an[iA]   * pa[iP1]
-                  +          rb[iR] * a_an[iAm1]
-                  +          ra[iR] * a_bn[iAp1];
-
-               iP1 = iP + yOffsetP - xOffsetP;
-               rap_cnw[iAc] =         a_cnw[iA]
-                  +          rb[iR] * a_cnw[iAm1] * pb[iP1]
-                  +          ra[iR] * a_cnw[iAp1] * pa[iP1]
-                  +                   a_bnw[iA]   * pb[iP1]
-                  +                   a_anw[iA]   * pa[iP1]
-                  +          rb[iR] * a_anw[iAm1]
-                  +          ra[iR] * a_bnw[iAp1];
-
-               iP1 = iP + xOffsetP;
-               rap_ce[iAc] =          a_ce[iA]
-                  +          rb[iR] * a_ce[iAm1] * pb[iP1]
-                  +          ra[iR] * a_ce[iAp1] * pa[iP1]
-                  +                   a_be[iA]   * pb[iP1]
-                  +                   a_ae[iA]   * pa[iP1]
-                  +          rb[iR] * a_ae[iAm1]
-                  +          ra[iR] * a_be[iAp1];
+         hypre_BoxLoop4Begin(hypre_StructMatrixNDim(A), loop_size,
+                             PT_dbox,  cstart, stridec, iP,
+                             R_dbox,   cstart, stridec, iR,
+                             A_dbox,   fstart, stridef, iA,
+                             RAP_dbox, cstart, stridec, iAc);
+         {
+            HYPRE_Int iAm1 = iA - zOffsetA;
+            HYPRE_Int iAp1 = iA + zOffsetA;
+
+            HYPRE_Int iP1 = iP + zOffsetP + yOffsetP + xOffsetP;
+            rap_ane[iAc] = ra[iR] * a_cne[iAp1] * pb[iP1]
+               +           ra[iR] * a_ane[iAp1]
+               +                    a_ane[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP + yOffsetP;
+            rap_an[iAc] = ra[iR] * a_cn[iAp1] * pb[iP1]
+               +          ra[iR] * a_an[iAp1]
+               +                   a_an[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP + yOffsetP - xOffsetP;
+            rap_anw[iAc] = ra[iR] * a_cnw[iAp1] * pb[iP1]
+               +           ra[iR] * a_anw[iAp1]
+               +                    a_anw[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP + xOffsetP;
+            rap_ae[iAc] = ra[iR] * a_ce[iAp1] * pb[iP1]
+               +          ra[iR] * a_ae[iAp1]
+               +                   a_ae[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP;
+            rap_ac[iAc] =          a_ac[iA]   * pb[iP1]
+               +          ra[iR] * a_cc[iAp1] * pb[iP1]
+               +          ra[iR] * a_ac[iAp1];
+
+            iP1 = iP + zOffsetP - xOffsetP;
+            rap_aw[iAc] = ra[iR] * a_cw[iAp1] * pb[iP1]
+               +          ra[iR] * a_aw[iAp1]
+               +                   a_aw[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP - yOffsetP + xOffsetP;
+            rap_ase[iAc] = ra[iR] * a_cse[iAp1] * pb[iP1]
+               +           ra[iR] * a_ase[iAp1]
+               +                    a_ase[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP - yOffsetP;
+            rap_as[iAc] = ra[iR] * a_cs[iAp1] * pb[iP1]
+               +          ra[iR] * a_as[iAp1]
+               +                   a_as[iA]   * pb[iP1];
+
+            iP1 = iP + zOffsetP - yOffsetP - xOffsetP;
+            rap_asw[iAc] = ra[iR] * a_csw[iAp1] * pb[iP1]
+               +           ra[iR] * a_asw[iAp1]
+               +                    a_asw[iA]   * pb[iP1];
+
+
+            iP1 = iP + yOffsetP + xOffsetP;
+            rap_cne[iAc] =         a_cne[iA]
+               +          rb[iR] * a_cne[iAm1] * pb[iP1]
+               +          ra[iR] * a_cne[iAp1] * pa[iP1]
+               +                   a_bne[iA]   * pb[iP1]
+               +                   a_ane[iA]   * pa[iP1]
+               +          rb[iR] * a_ane[iAm1]
+               +          ra[iR] * a_bne[iAp1];
+
+            iP1 = iP + yOffsetP;
+            rap_cn[iAc] =          a_cn[iA]
+               +          rb[iR] * a_cn[iAm1] * pb[iP1]
+               +          ra[iR] * a_cn[iAp1] * pa[iP1]
+               +                   a_bn[iA]   * pb[iP1]
+               +                   a_an[iA]   * pa[iP1]
+               +          rb[iR] * a_an[iAm1]
+               +          ra[iR] * a_bn[iAp1];
+
+            iP1 = iP + yOffsetP - xOffsetP;
+            rap_cnw[iAc] =         a_cnw[iA]
+               +          rb[iR] * a_cnw[iAm1] * pb[iP1]
+               +          ra[iR] * a_cnw[iAp1] * pa[iP1]
+               +                   a_bnw[iA]   * pb[iP1]
+               +                   a_anw[iA]   * pa[iP1]
+               +          rb[iR] * a_anw[iAm1]
+               +          ra[iR] * a_bnw[iAp1];
+
+            iP1 = iP + xOffsetP;
+            rap_ce[iAc] =          a_ce[iA]
+               +          rb[iR] * a_ce[iAm1] * pb[iP1]
+               +          ra[iR] * a_ce[iAp1] * pa[iP1]
+               +                   a_be[iA]   * pb[iP1]
+               +                   a_ae[iA]   * pa[iP1]
+               +          rb[iR] * a_ae[iAm1]
+               +          ra[iR] * a_be[iAp1];
 
-            }
-            hypre_BoxLoop4End(iP, iR, iA, iAc);
+         }
+         hypre_BoxLoop4End(iP, iR, iA, iAc);
 #undef DEVICE_VAR
 
-            break;
+         break;
 
-      } /* end switch statement */
+   } /* end switch statement */
 
-   } /* end ForBoxI */
 
    return hypre_error_flag;
 }
@@ -217,11 +217,13 @@ hypre_SMGSetup( void               *smg_vdata,
 
    tb_l[0] = hypre_StructVectorCreate(comm, grid_l[0]);
    hypre_StructVectorSetNumGhost(tb_l[0], hypre_StructVectorNumGhost(b));
+   hypre_StructVectorSetDataAlignment(tb_l[0], hypre_StructVectorDataAlignment(b));
    hypre_StructVectorInitializeShell(tb_l[0]);
    hypre_StructVectorSetDataSize(tb_l[0], &data_size, &data_size_const);
 
    tx_l[0] = hypre_StructVectorCreate(comm, grid_l[0]);
    hypre_StructVectorSetNumGhost(tx_l[0], hypre_StructVectorNumGhost(x));
+   hypre_StructVectorSetDataAlignment(tx_l[0], hypre_StructVectorDataAlignment(x));
    hypre_StructVectorInitializeShell(tx_l[0]);
    hypre_StructVectorSetDataSize(tx_l[0], &data_size, &data_size_const);
 
@@ -229,6 +231,7 @@ hypre_SMGSetup( void               *smg_vdata,
    {
       PT_l[l]  = hypre_SMGCreateInterpOp(A_l[l], PT_grid_l[l+1], cdir);
 
+      hypre_StructMatrixSetDataAlignment(PT_l[l], hypre_StructMatrixDataAlignment(A));
       hypre_StructMatrixInitializeShell(PT_l[l]);
       data_size += hypre_StructMatrixDataSize(PT_l[l]);
       data_size_const += hypre_StructMatrixDataConstSize(PT_l[l]);
@@ -251,26 +254,31 @@ hypre_SMGSetup( void               *smg_vdata,
       }
 
       A_l[l+1] = hypre_SMGCreateRAPOp(R_l[l], A_l[l], PT_l[l], grid_l[l+1]);
+      hypre_StructMatrixSetDataAlignment(A_l[l+1], hypre_StructMatrixDataAlignment(A));
       hypre_StructMatrixInitializeShell(A_l[l+1]);
       data_size += hypre_StructMatrixDataSize(A_l[l+1]);
       data_size_const += hypre_StructMatrixDataConstSize(A_l[l+1]);
 
       b_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(b_l[l+1], b_num_ghost);
+      hypre_StructVectorSetDataAlignment(b_l[l+1], hypre_StructVectorDataAlignment(b));
       hypre_StructVectorInitializeShell(b_l[l+1]);
       hypre_StructVectorSetDataSize(b_l[l+1], &data_size, &data_size_const);
 
       x_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(x_l[l+1], x_num_ghost);
+      hypre_StructVectorSetDataAlignment(x_l[l+1], hypre_StructVectorDataAlignment(x));
       hypre_StructVectorInitializeShell(x_l[l+1]);
       hypre_StructVectorSetDataSize(x_l[l+1], &data_size, &data_size_const);
 
       tb_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(tb_l[l+1], hypre_StructVectorNumGhost(b));
+      hypre_StructVectorSetDataAlignment(tb_l[l+1], hypre_StructVectorDataAlignment(b));
       hypre_StructVectorInitializeShell(tb_l[l+1]);
 
       tx_l[l+1] = hypre_StructVectorCreate(comm, grid_l[l+1]);
       hypre_StructVectorSetNumGhost(tx_l[l+1], hypre_StructVectorNumGhost(x));
+      hypre_StructVectorSetDataAlignment(tx_l[l+1], hypre_StructVectorDataAlignment(x));
       hypre_StructVectorInitializeShell(tx_l[l+1]);
 #if defined(HYPRE_USING_CUDA)
       if (l+1 == num_level_GPU)
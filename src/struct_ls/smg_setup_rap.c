@@ -112,16 +112,14 @@ hypre_SMGSetupRAPOp( hypre_StructMatrix *R,
       case 2:
 
          /*--------------------------------------------------------------------
-          *    Set lower triangular (+ diagonal) coefficients
+          *    Set lower triangular (+ diagonal) coefficients, and for
+          *    non-symmetric A the upper triangular coefficients as well,
+          *    one coarse tile at a time
           *--------------------------------------------------------------------*/
-         hypre_SMG2BuildRAPSym(A, PT, R, Ac_tmp, cindex, cstride);
+         hypre_SMG2BuildRAP(A, PT, R, Ac_tmp, cindex, cstride);
 
-         /*--------------------------------------------------------------------
-          *    For non-symmetric A, set upper triangular coefficients as well
-          *--------------------------------------------------------------------*/
          if(!hypre_StructMatrixSymmetric(A))
          {
-            hypre_SMG2BuildRAPNoSym(A, PT, R, Ac_tmp, cindex, cstride);
             /*-----------------------------------------------------------------
              *    Collapse stencil for periodic probems on coarsest grid.
              *-----------------------------------------------------------------*/
@@ -140,16 +138,14 @@ hypre_SMGSetupRAPOp( hypre_StructMatrix *R,
       case 3:
 
          /*--------------------------------------------------------------------
-          *    Set lower triangular (+ diagonal) coefficients
+          *    Set lower triangular (+ diagonal) coefficients, and for
+          *    non-symmetric A the upper triangular coefficients as well,
+          *    one coarse tile at a time
           *--------------------------------------------------------------------*/
-         hypre_SMG3BuildRAPSym(A, PT, R, Ac_tmp, cindex, cstride);
+         hypre_SMG3BuildRAP(A, PT, R, Ac_tmp, cindex, cstride);
 
-         /*--------------------------------------------------------------------
-          *    For non-symmetric A, set upper triangular coefficients as well
-          *--------------------------------------------------------------------*/
          if(!hypre_StructMatrixSymmetric(A))
          {
-            hypre_SMG3BuildRAPNoSym(A, PT, R, Ac_tmp, cindex, cstride);
             /*-----------------------------------------------------------------
              *    Collapse stencil for periodic probems on coarsest grid.
              *-----------------------------------------------------------------*/
@@ -193,7 +189,7 @@ hypre_SMGSetupRAPOp( hypre_StructMatrix *R,
    if (data_location_A != data_location_Ac)
    {
 
-     hypre_TMemcpy(hypre_StructMatrixDataConst(Ac), hypre_StructMatrixData(Ac_tmp),HYPRE_Complex,hypre_StructMatrixDataSize(Ac_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
+     hypre_TMemcpy(hypre_StructMatrixDataConst(Ac), hypre_StructMatrixData(Ac_tmp),HYPRE_Complex,hypre_StructMatrixDataUsedSize(Ac_tmp),HYPRE_MEMORY_HOST,HYPRE_MEMORY_DEVICE);
       hypre_SetDeviceOff();
       hypre_StructGridDataLocation(hypre_StructMatrixGrid(Ac)) = data_location_Ac;
       hypre_StructMatrixAssemble(Ac);
@@ -45,6 +45,22 @@ HYPRE_StructMatrixInitialize( HYPRE_StructMatrix matrix )
    return ( hypre_StructMatrixInitialize(matrix) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixInitializeAligned( HYPRE_StructMatrix matrix,
+                                     HYPRE_Int          alignment )
+{
+   hypre_StructMatrixSetDataAlignment(matrix, alignment);
+   if (hypre_error_flag)
+   {
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructMatrixInitialize(matrix) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -389,6 +405,34 @@ HYPRE_StructMatrixPrint( const char         *filename,
    return ( hypre_StructMatrixPrint(filename, matrix, all) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixPrintBinary( const char         *filename,
+                               HYPRE_StructMatrix  matrix )
+{
+   return ( hypre_StructMatrixPrintBinary(filename, matrix) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixReadBinary( MPI_Comm            comm,
+                              const char         *filename,
+                              HYPRE_StructMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *matrix = (HYPRE_StructMatrix) hypre_StructMatrixReadBinary(comm, filename);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -47,6 +47,23 @@ HYPRE_StructVectorInitialize( HYPRE_StructVector vector )
    return ( hypre_StructVectorInitialize(vector) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorInitializeAligned
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorInitializeAligned( HYPRE_StructVector vector,
+                                     HYPRE_Int          alignment )
+{
+   hypre_StructVectorSetDataAlignment(vector, alignment);
+   if (hypre_error_flag)
+   {
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructVectorInitialize(vector) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructVectorSetValues
  *--------------------------------------------------------------------------*/
@@ -299,6 +316,36 @@ HYPRE_StructVectorPrint( const char         *filename,
    return ( hypre_StructVectorPrint(filename, vector, all) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorPrintBinary( const char         *filename,
+                               HYPRE_StructVector  vector )
+{
+   return ( hypre_StructVectorPrintBinary(filename, vector) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorReadBinary( MPI_Comm            comm,
+                              const char         *filename,
+                              HYPRE_StructVector *vector )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   *vector = (HYPRE_StructVector) hypre_StructVectorReadBinary(comm, filename);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructVectorSetNumGhost
  *--------------------------------------------------------------------------*/
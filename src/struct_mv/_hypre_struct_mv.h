@@ -1454,7 +1454,11 @@ typedef struct hypre_StructMatrix_struct
    HYPRE_Complex        *data_const;                /* Pointer to constant matrix data */
    HYPRE_Complex       **stencil_data;              /* Pointer for each stencil */
    HYPRE_Int             data_alloced;              /* Boolean used for freeing data */
-   HYPRE_Int             data_size;                 /* Size of variable matrix data */
+   HYPRE_Int             data_shift;                /* Offset of data from the allocated
+                                                       memory (see data_alignment) */
+   HYPRE_Int             data_size;                 /* Size of variable matrix data,
+                                                       including data_alignment-1
+                                                       coefficients of slack */
    HYPRE_Int             data_const_size;           /* Size of constant matrix data */
    HYPRE_Int           **data_indices;              /* num-boxes by stencil-size array
                                                        of indices into the data array.
@@ -1469,6 +1473,11 @@ typedef struct hypre_StructMatrix_struct
    HYPRE_Int             symmetric;                 /* Is the matrix symmetric */
    HYPRE_Int            *symm_elements;             /* Which elements are "symmetric" */
    HYPRE_Int             num_ghost[2*HYPRE_MAXDIM]; /* Num ghost layers in each direction */
+   HYPRE_Int             data_alignment;            /* Data lines are padded to a multiple
+                                                       of this many coefficients, and data
+                                                       is placed so that the first grid
+                                                       point of each line is aligned in
+                                                       memory */
 
    HYPRE_BigInt          global_size;               /* Total number of nonzero coeffs */
 
@@ -1493,12 +1502,16 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixStencilData(matrix)         ((matrix) -> stencil_data)
 #define hypre_StructMatrixDataAlloced(matrix)         ((matrix) -> data_alloced)
 #define hypre_StructMatrixDataSize(matrix)            ((matrix) -> data_size)
+#define hypre_StructMatrixDataShift(matrix)           ((matrix) -> data_shift)
+#define hypre_StructMatrixDataUsedSize(matrix) \
+(hypre_StructMatrixDataSize(matrix) - hypre_StructMatrixDataAlignment(matrix) + 1)
 #define hypre_StructMatrixDataConstSize(matrix)       ((matrix) -> data_const_size)
 #define hypre_StructMatrixDataIndices(matrix)         ((matrix) -> data_indices)
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
+#define hypre_StructMatrixDataAlignment(matrix)       ((matrix) -> data_alignment)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
@@ -1551,7 +1564,10 @@ typedef struct hypre_StructVector_struct
 
    HYPRE_Complex        *data;         /* Pointer to vector data on device*/
    HYPRE_Int             data_alloced; /* Boolean used for freeing data */
-   HYPRE_Int             data_size;    /* Size of vector data */
+   HYPRE_Int             data_shift;   /* Offset of data from the allocated
+                                          memory (see data_alignment) */
+   HYPRE_Int             data_size;    /* Size of vector data, including
+                                          data_alignment-1 values of slack */
    HYPRE_Int            *data_indices; /* num-boxes array of indices into
                                           the data array.  data_indices[b]
                                           is the starting index of vector
@@ -1559,6 +1575,11 @@ typedef struct hypre_StructVector_struct
 
    HYPRE_Int             num_ghost[2*HYPRE_MAXDIM]; /* Num ghost layers in each
                                                      * direction */
+   HYPRE_Int             data_alignment;   /* Data lines are padded to a
+                                            multiple of this many values,
+                                            and data is placed so that the
+                                            first grid point of each line
+                                            is aligned in memory */
    HYPRE_Int             bghost_not_clear; /* Are boundary ghosts clear? */
 
    HYPRE_BigInt          global_size;  /* Total number coefficients */
@@ -1577,8 +1598,12 @@ typedef struct hypre_StructVector_struct
 #define hypre_StructVectorData(vector)          ((vector) -> data)
 #define hypre_StructVectorDataAlloced(vector)   ((vector) -> data_alloced)
 #define hypre_StructVectorDataSize(vector)      ((vector) -> data_size)
+#define hypre_StructVectorDataShift(vector)     ((vector) -> data_shift)
+#define hypre_StructVectorDataUsedSize(vector) \
+(hypre_StructVectorDataSize(vector) - hypre_StructVectorDataAlignment(vector) + 1)
 #define hypre_StructVectorDataIndices(vector)   ((vector) -> data_indices)
 #define hypre_StructVectorNumGhost(vector)      ((vector) -> num_ghost)
+#define hypre_StructVectorDataAlignment(vector) ((vector) -> data_alignment)
 #define hypre_StructVectorBGhostNotClear(vector)((vector) -> bghost_not_clear)
 #define hypre_StructVectorGlobalSize(vector)    ((vector) -> global_size)
 #define hypre_StructVectorRefCount(vector)      ((vector) -> ref_count)
@@ -1660,6 +1685,8 @@ HYPRE_Int hypre_BoxShiftNeg( hypre_Box *box , hypre_Index shift );
 HYPRE_Int hypre_BoxGrowByIndex( hypre_Box *box , hypre_Index  index );
 HYPRE_Int hypre_BoxGrowByValue( hypre_Box *box , HYPRE_Int val );
 HYPRE_Int hypre_BoxGrowByArray ( hypre_Box *box , HYPRE_Int *array );
+HYPRE_Int hypre_BoxAlignDataBox ( hypre_Box *data_box , HYPRE_Int alignment );
+HYPRE_Int hypre_BoxAlignDataShift ( HYPRE_Complex *data , hypre_Box *box , hypre_Box *data_box , HYPRE_Int alignment );
 hypre_BoxArray *hypre_BoxArrayCreate ( HYPRE_Int size , HYPRE_Int ndim );
 HYPRE_Int hypre_BoxArrayDestroy ( hypre_BoxArray *box_array );
 HYPRE_Int hypre_BoxArraySetSize ( hypre_BoxArray *box_array , HYPRE_Int size );
@@ -1736,6 +1763,7 @@ HYPRE_Int HYPRE_StructGridSetNumGhost ( HYPRE_StructGrid grid , HYPRE_Int *num_g
 HYPRE_Int HYPRE_StructMatrixCreate ( MPI_Comm comm , HYPRE_StructGrid grid , HYPRE_StructStencil stencil , HYPRE_StructMatrix *matrix );
 HYPRE_Int HYPRE_StructMatrixDestroy ( HYPRE_StructMatrix matrix );
 HYPRE_Int HYPRE_StructMatrixInitialize ( HYPRE_StructMatrix matrix );
+HYPRE_Int HYPRE_StructMatrixInitializeAligned ( HYPRE_StructMatrix matrix , HYPRE_Int alignment );
 HYPRE_Int HYPRE_StructMatrixSetValues ( HYPRE_StructMatrix matrix , HYPRE_Int *grid_index , HYPRE_Int num_stencil_indices , HYPRE_Int *stencil_indices , HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructMatrixGetValues ( HYPRE_StructMatrix matrix , HYPRE_Int *grid_index , HYPRE_Int num_stencil_indices , HYPRE_Int *stencil_indices , HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructMatrixSetBoxValues ( HYPRE_StructMatrix matrix , HYPRE_Int *ilower , HYPRE_Int *iupper , HYPRE_Int num_stencil_indices , HYPRE_Int *stencil_indices , HYPRE_Complex *values );
@@ -1750,6 +1778,8 @@ HYPRE_Int HYPRE_StructMatrixGetGrid ( HYPRE_StructMatrix matrix , HYPRE_StructGr
 HYPRE_Int HYPRE_StructMatrixSetSymmetric ( HYPRE_StructMatrix matrix , HYPRE_Int symmetric );
 HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix , HYPRE_Int nentries , HYPRE_Int *entries );
 HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename , HYPRE_StructMatrix matrix , HYPRE_Int all );
+HYPRE_Int HYPRE_StructMatrixPrintBinary ( const char *filename , HYPRE_StructMatrix matrix );
+HYPRE_Int HYPRE_StructMatrixReadBinary ( MPI_Comm comm , const char *filename , HYPRE_StructMatrix *matrix );
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha , HYPRE_StructMatrix A , HYPRE_StructVector x , HYPRE_Complex beta , HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
 
@@ -1762,6 +1792,7 @@ HYPRE_Int HYPRE_StructStencilDestroy ( HYPRE_StructStencil stencil );
 HYPRE_Int HYPRE_StructVectorCreate ( MPI_Comm comm , HYPRE_StructGrid grid , HYPRE_StructVector *vector );
 HYPRE_Int HYPRE_StructVectorDestroy ( HYPRE_StructVector struct_vector );
 HYPRE_Int HYPRE_StructVectorInitialize ( HYPRE_StructVector vector );
+HYPRE_Int HYPRE_StructVectorInitializeAligned ( HYPRE_StructVector vector , HYPRE_Int alignment );
 HYPRE_Int HYPRE_StructVectorSetValues ( HYPRE_StructVector vector , HYPRE_Int *grid_index , HYPRE_Complex values );
 HYPRE_Int HYPRE_StructVectorSetBoxValues ( HYPRE_StructVector vector , HYPRE_Int *ilower , HYPRE_Int *iupper , HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructVectorAddToValues ( HYPRE_StructVector vector , HYPRE_Int *grid_index , HYPRE_Complex values );
@@ -1771,6 +1802,8 @@ HYPRE_Int HYPRE_StructVectorGetValues ( HYPRE_StructVector vector , HYPRE_Int *g
 HYPRE_Int HYPRE_StructVectorGetBoxValues ( HYPRE_StructVector vector , HYPRE_Int *ilower , HYPRE_Int *iupper , HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructVectorAssemble ( HYPRE_StructVector vector );
 HYPRE_Int HYPRE_StructVectorPrint ( const char *filename , HYPRE_StructVector vector , HYPRE_Int all );
+HYPRE_Int HYPRE_StructVectorPrintBinary ( const char *filename , HYPRE_StructVector vector );
+HYPRE_Int HYPRE_StructVectorReadBinary ( MPI_Comm comm , const char *filename , HYPRE_StructVector *vector );
 HYPRE_Int HYPRE_StructVectorSetNumGhost ( HYPRE_StructVector vector , HYPRE_Int *num_ghost );
 HYPRE_Int HYPRE_StructVectorCopy ( HYPRE_StructVector x , HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructVectorSetConstantValues ( HYPRE_StructVector vector , HYPRE_Complex values );
@@ -1785,6 +1818,9 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array , hy
 
 /* struct_axpy.c */
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha , hypre_StructVector *x , hypre_StructVector *y );
+HYPRE_Real hypre_StructAxpyInnerProdLocal ( HYPRE_Complex alpha , hypre_StructVector *x , hypre_StructVector *y , hypre_StructVector *z );
+HYPRE_Real hypre_StructAxpyInnerProd ( HYPRE_Complex alpha , hypre_StructVector *x , hypre_StructVector *y , hypre_StructVector *z );
+HYPRE_Int hypre_StructAxpby ( HYPRE_Complex alpha , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
 
 /* struct_communication.c */
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info , hypre_BoxArray *send_data_space , hypre_BoxArray *recv_data_space , HYPRE_Int num_values , HYPRE_Int **orders , HYPRE_Int reverse , MPI_Comm comm , hypre_CommPkg **comm_pkg_ptr );
@@ -1815,13 +1851,17 @@ HYPRE_Int hypre_GatherAllBoxes ( MPI_Comm comm , hypre_BoxArray *boxes , HYPRE_I
 HYPRE_Int hypre_ComputeBoxnums ( hypre_BoxArray *boxes , HYPRE_Int *procs , HYPRE_Int **boxnums_ptr );
 HYPRE_Int hypre_StructGridPrint ( FILE *file , hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridRead ( MPI_Comm comm , FILE *file , hypre_StructGrid **grid_ptr );
+HYPRE_Int hypre_StructGridPrintBinary ( FILE *file , hypre_StructGrid *grid );
+HYPRE_Int hypre_StructGridReadBinary ( MPI_Comm comm , hypre_BinaryReader *reader , hypre_StructGrid **grid_ptr );
 HYPRE_Int hypre_StructGridSetNumGhost ( hypre_StructGrid *grid , HYPRE_Int *num_ghost );
 #if defined(HYPRE_USING_CUDA)
 HYPRE_Int hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid);
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x , hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x , hypre_StructVector *y );
+HYPRE_Int hypre_StructInnerProd2 ( hypre_StructVector *x , hypre_StructVector *y , hypre_StructVector *z , HYPRE_Real *result );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data );
@@ -1845,12 +1885,15 @@ HYPRE_Int hypre_StructMatrixClearValues ( hypre_StructMatrix *matrix , hypre_Ind
 HYPRE_Int hypre_StructMatrixClearBoxValues ( hypre_StructMatrix *matrix , hypre_Box *clear_box , HYPRE_Int num_stencil_indices , HYPRE_Int *stencil_indices , HYPRE_Int boxnum , HYPRE_Int outside );
 HYPRE_Int hypre_StructMatrixAssemble ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixSetNumGhost ( hypre_StructMatrix *matrix , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixSetDataAlignment ( hypre_StructMatrix *matrix , HYPRE_Int alignment );
 HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix , HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix , HYPRE_Int nentries , HYPRE_Int *entries );
 HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrint ( const char *filename , hypre_StructMatrix *matrix , HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix , hypre_StructMatrix *to_matrix );
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixPrintBinary ( const char *filename , hypre_StructMatrix *matrix );
+hypre_StructMatrix *hypre_StructMatrixReadBinary ( MPI_Comm comm , const char *filename );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
 
 /* struct_matrix_mask.c */
@@ -1863,6 +1906,8 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata , HYPRE_Complex alpha ,
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFixedStencilSupported ( hypre_StructMatrix *A , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFixedStencil ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
 
@@ -1889,6 +1934,7 @@ HYPRE_Int hypre_StructVectorClearValues ( hypre_StructVector *vector , hypre_Ind
 HYPRE_Int hypre_StructVectorClearBoxValues ( hypre_StructVector *vector , hypre_Box *clear_box , HYPRE_Int boxnum , HYPRE_Int outside );
 HYPRE_Int hypre_StructVectorClearAllValues ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorSetNumGhost ( hypre_StructVector *vector , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorSetDataAlignment ( hypre_StructVector *vector , HYPRE_Int alignment );
 HYPRE_Int hypre_StructVectorSetDataSize(hypre_StructVector *vector , HYPRE_Int *data_size, HYPRE_Int *data_host_size);
 HYPRE_Int hypre_StructVectorAssemble ( hypre_StructVector *vector );
 HYPRE_Int hypre_StructVectorCopy ( hypre_StructVector *x , hypre_StructVector *y );
@@ -1901,6 +1947,8 @@ hypre_CommPkg *hypre_StructVectorGetMigrateCommPkg ( hypre_StructVector *from_ve
 HYPRE_Int hypre_StructVectorMigrate ( hypre_CommPkg *comm_pkg , hypre_StructVector *from_vector , hypre_StructVector *to_vector );
 HYPRE_Int hypre_StructVectorPrint ( const char *filename , hypre_StructVector *vector , HYPRE_Int all );
 hypre_StructVector *hypre_StructVectorRead ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorPrintBinary ( const char *filename , hypre_StructVector *vector );
+hypre_StructVector *hypre_StructVectorReadBinary ( MPI_Comm comm , const char *filename );
 hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
 
 #if defined(HYPRE_USING_DEVICE_OPENMP)
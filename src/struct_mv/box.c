@@ -585,6 +585,50 @@ hypre_BoxGrowByArray( hypre_Box  *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Grow data_box at its upper end in the first dimension so that the length
+ * of its lines is a multiple of alignment.  The volume of data_box is then a
+ * multiple of alignment too, so lines stay aligned from one box (and one
+ * stencil entry) to the next.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxAlignDataBox( hypre_Box  *data_box,
+                       HYPRE_Int   alignment )
+{
+   HYPRE_Int  size;
+
+   if (alignment > 1)
+   {
+      size = hypre_BoxSizeD(data_box, 0);
+      hypre_BoxIMaxD(data_box, 0) += (alignment - size % alignment) % alignment;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns the shift, less than alignment, that moves data to where the first
+ * point of box in data_box (the data box that data starts with) lies at a
+ * multiple of alignment values in memory.  With data boxes grown by
+ * hypre_BoxAlignDataBox, the first point of every line of every box is then
+ * aligned too.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxAlignDataShift( HYPRE_Complex  *data,
+                         hypre_Box      *box,
+                         hypre_Box      *data_box,
+                         HYPRE_Int       alignment )
+{
+   size_t  pos;
+
+   pos = ((size_t) data) / sizeof(HYPRE_Complex) +
+         (size_t) (hypre_BoxIMinD(box, 0) - hypre_BoxIMinD(data_box, 0));
+
+   return (HYPRE_Int) ((alignment - pos % alignment) % alignment);
+}
+
 /*==========================================================================
  * Member functions: hypre_BoxArray
  *==========================================================================*/
@@ -561,11 +561,12 @@ hypre_BoxManIncSize ( hypre_BoxManager *manager,
 HYPRE_Int
 hypre_BoxManDestroy( hypre_BoxManager *manager )
 {
-   HYPRE_Int ndim = hypre_BoxManNDim(manager);
+   HYPRE_Int ndim;
    HYPRE_Int d;
 
    if (manager)
    {
+      ndim = hypre_BoxManNDim(manager);
       for (d = 0; d < ndim; d++)
       {
          hypre_TFree(hypre_BoxManIndexesD(manager,  d), HYPRE_MEMORY_HOST);
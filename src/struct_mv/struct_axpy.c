@@ -66,3 +66,196 @@ hypre_StructAxpy( HYPRE_Complex       alpha,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpyInnerProdLocal
+ *
+ * y = y + alpha*x, and returns the contribution of this process to <z, y>.
+ * When z is y, the update and the inner product are done in the same pass
+ * over y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructAxpyInnerProdLocal( HYPRE_Complex       alpha,
+                                hypre_StructVector *x,
+                                hypre_StructVector *y,
+                                hypre_StructVector *z )
+{
+   HYPRE_Real        process_result;
+
+   hypre_Box        *x_data_box;
+   hypre_Box        *y_data_box;
+
+   HYPRE_Complex    *xp;
+   HYPRE_Complex    *yp;
+
+   hypre_BoxArray   *boxes;
+   hypre_Box        *box;
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       unit_stride;
+
+   HYPRE_Int         ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int         i;
+
+   if (z != y)
+   {
+      hypre_StructAxpy(alpha, x, y);
+      process_result = hypre_StructInnerProdLocal(z, y);
+   }
+   else
+   {
+      process_result = 0.0;
+
+      hypre_SetIndex(unit_stride, 1);
+
+      boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+      hypre_ForBoxI(i, boxes)
+      {
+         box   = hypre_BoxArrayBox(boxes, i);
+         start = hypre_BoxIMin(box);
+
+         x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+         xp = hypre_StructVectorBoxData(x, i);
+         yp = hypre_StructVectorBoxData(y, i);
+
+         hypre_BoxGetSize(box, loop_size);
+
+#if defined(HYPRE_USING_KOKKOS)
+         HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+         ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA)
+         ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+         HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+         hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                      x_data_box, start, unit_stride, xi,
+                                      y_data_box, start, unit_stride, yi,
+                                      box_sum)
+         {
+            yp[yi] += alpha * xp[xi];
+            HYPRE_Real tmp = yp[yi] * hypre_conj(yp[yi]);
+            box_sum += tmp;
+         }
+         hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+#undef DEVICE_VAR
+
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+
+         process_result += (HYPRE_Real) box_sum;
+      }
+   }
+
+   return process_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpyInnerProd
+ *
+ * y = y + alpha*x, and returns <z, y>.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructAxpyInnerProd( HYPRE_Complex       alpha,
+                           hypre_StructVector *x,
+                           hypre_StructVector *y,
+                           hypre_StructVector *z )
+{
+   HYPRE_Real        final_innerprod_result;
+   HYPRE_Real        process_result;
+
+   process_result = hypre_StructAxpyInnerProdLocal(alpha, x, y, z);
+
+   hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
+
+   hypre_IncFLOPCount(4*hypre_StructVectorGlobalSize(x));
+
+   return final_innerprod_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpby
+ *
+ * y = alpha*x + beta*y (y is not read if beta is zero)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructAxpby( HYPRE_Complex       alpha,
+                   hypre_StructVector *x,
+                   HYPRE_Complex       beta,
+                   hypre_StructVector *y     )
+{
+   hypre_Box        *x_data_box;
+   hypre_Box        *y_data_box;
+
+   HYPRE_Complex    *xp;
+   HYPRE_Complex    *yp;
+
+   hypre_BoxArray   *boxes;
+   hypre_Box        *box;
+   hypre_Index       loop_size;
+   hypre_IndexRef    start;
+   hypre_Index       unit_stride;
+
+   HYPRE_Int         i;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(yp,xp)
+      if (beta == 0.0)
+      {
+         hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                             x_data_box, start, unit_stride, xi,
+                             y_data_box, start, unit_stride, yi);
+         {
+            yp[yi] = alpha * xp[xi];
+         }
+         hypre_BoxLoop2End(xi, yi);
+      }
+      else
+      {
+         hypre_BoxLoop2Begin(hypre_StructVectorNDim(x), loop_size,
+                             x_data_box, start, unit_stride, xi,
+                             y_data_box, start, unit_stride, yi);
+         {
+            yp[yi] = alpha * xp[xi] + beta * yp[yi];
+         }
+         hypre_BoxLoop2End(xi, yi);
+      }
+#undef DEVICE_VAR
+   }
+
+   return hypre_error_flag;
+}
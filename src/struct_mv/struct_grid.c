@@ -835,6 +835,127 @@ hypre_StructGridRead( MPI_Comm           comm,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridPrintBinary
+ *
+ * Binary counterpart of hypre_StructGridPrint.  Writes ndim, the number of
+ * local boxes, the periodicity, and the imin/imax extents of each box as
+ * HYPRE_Int values.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridPrintBinary( FILE             *file,
+                             hypre_StructGrid *grid )
+{
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   HYPRE_Int       *info;
+   HYPRE_Int        ndim, num_boxes, size;
+   HYPRE_Int        i, d, k;
+
+   ndim      = hypre_StructGridNDim(grid);
+   boxes     = hypre_StructGridBoxes(grid);
+   num_boxes = hypre_BoxArraySize(boxes);
+   size      = 2 + ndim + 2*ndim*num_boxes;
+
+   info = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+   k = 0;
+   info[k++] = ndim;
+   info[k++] = num_boxes;
+   for (d = 0; d < ndim; d++)
+   {
+      info[k++] = hypre_IndexD(hypre_StructGridPeriodic(grid), d);
+   }
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      for (d = 0; d < ndim; d++)
+      {
+         info[k++] = hypre_BoxIMinD(box, d);
+      }
+      for (d = 0; d < ndim; d++)
+      {
+         info[k++] = hypre_BoxIMaxD(box, d);
+      }
+   }
+
+   hypre_BinaryWrite(file, info, size*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+
+   hypre_TFree(info, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructGridReadBinary
+ *
+ * Reads a grid written by hypre_StructGridPrintBinary and assembles it.  All
+ * processes of comm must call this, including those that failed to open their
+ * file (pass NULL as the reader).  If any process fails to read its grid, no
+ * grid is assembled, *grid_ptr is set to NULL on all processes, and an error
+ * is returned.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridReadBinary( MPI_Comm             comm,
+                            hypre_BinaryReader  *reader,
+                            hypre_StructGrid   **grid_ptr )
+{
+   hypre_StructGrid *grid = NULL;
+
+   hypre_Index       ilower;
+   hypre_Index       iupper;
+   hypre_Index       periodic;
+
+   HYPRE_Int         ndim;
+   HYPRE_Int         num_boxes;
+   HYPRE_Int         ok = 0;
+
+   HYPRE_Int         i;
+
+   if (reader &&
+       !hypre_BinaryRead(reader, &ndim, sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) &&
+       !hypre_BinaryRead(reader, &num_boxes, sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) &&
+       ndim > 0 && ndim <= HYPRE_MAXDIM && num_boxes >= 0)
+   {
+      hypre_StructGridCreate(comm, ndim, &grid);
+
+      hypre_SetIndex(periodic, 0);
+      ok = !hypre_BinaryRead(reader, periodic, ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+      hypre_StructGridSetPeriodic(grid, periodic);
+
+      hypre_SetIndex(ilower, 0);
+      hypre_SetIndex(iupper, 0);
+      for (i = 0; (i < num_boxes) && ok; i++)
+      {
+         if (hypre_BinaryRead(reader, ilower, ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) ||
+             hypre_BinaryRead(reader, iupper, ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST))
+         {
+            ok = 0;
+         }
+         else
+         {
+            hypre_StructGridSetExtents(grid, ilower, iupper);
+         }
+      }
+   }
+
+   /* hypre_StructGridAssemble is collective */
+   if (!hypre_BinaryAllOK(comm, ok))
+   {
+      hypre_StructGridDestroy(grid);
+      *grid_ptr = NULL;
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't read binary struct grid\n");
+      return hypre_error_flag;
+   }
+
+   hypre_StructGridAssemble(grid);
+
+   *grid_ptr = grid;
+
+   return hypre_error_flag;
+}
+
 /*------------------------------------------------------------------------------
  * GEC0902  hypre_StructGridSetNumGhost
  *
@@ -15,16 +15,15 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Returns the contribution of this process to <x, y>.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -96,7 +95,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -105,3 +118,28 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd2
+ *
+ * result[0] = <x, y> and result[1] = <x, z> with a single reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructInnerProd2( hypre_StructVector *x,
+                        hypre_StructVector *y,
+                        hypre_StructVector *z,
+                        HYPRE_Real         *result )
+{
+   HYPRE_Real       process_result[2];
+
+   process_result[0] = hypre_StructInnerProdLocal(x, y);
+   process_result[1] = hypre_StructInnerProdLocal(x, z);
+
+   hypre_MPI_Allreduce(process_result, result, 2,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
+
+   hypre_IncFLOPCount(4*hypre_StructVectorGlobalSize(x));
+
+   return hypre_error_flag;
+}
@@ -70,6 +70,7 @@ hypre_StructMatrixCreate( MPI_Comm             comm,
    {
       hypre_StructMatrixNumGhost(matrix)[i] = hypre_StructGridNumGhost(grid)[i];
    }
+   hypre_StructMatrixDataAlignment(matrix) = 1;
 
    return matrix;
 }
@@ -100,6 +101,8 @@ hypre_StructMatrixDestroy( hypre_StructMatrix *matrix )
       {
          if (hypre_StructMatrixDataAlloced(matrix))
          {
+            /* free from the start of the allocation (see InitializeData) */
+            hypre_StructMatrixData(matrix) -= hypre_StructMatrixDataShift(matrix);
             hypre_TFree(hypre_StructMatrixData(matrix),HYPRE_MEMORY_DEVICE);
             hypre_TFree(hypre_StructMatrixDataConst(matrix),HYPRE_MEMORY_HOST);
          }
@@ -153,6 +156,7 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
    HYPRE_Int             data_size;
    HYPRE_Int             data_const_size;
    HYPRE_Int             data_box_volume;
+   HYPRE_Int             alignment = hypre_StructMatrixDataAlignment(matrix);
 
    HYPRE_Int             i, j, d;
 
@@ -256,6 +260,7 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
             hypre_BoxIMinD(data_box, d) -= num_ghost[2*d];
             hypre_BoxIMaxD(data_box, d) += num_ghost[2*d + 1];
          }
+         hypre_BoxAlignDataBox(data_box, alignment);
       }
 
       hypre_StructMatrixDataSpace(matrix) = data_space;
@@ -410,6 +415,9 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
          data_size       = 0;
       }
 #endif
+      /* room for the shift that aligns the data */
+      data_size += alignment - 1;
+
       hypre_StructMatrixDataSize(matrix)      = data_size;
       hypre_StructMatrixDataConstSize(matrix) = data_const_size;
 
@@ -438,6 +446,10 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
 
 /*--------------------------------------------------------------------------
  * hypre_StructMatrixInitializeData
+ *
+ * With a data alignment a > 1, the variable coefficients are placed at the
+ * first position within the first a values of data at which the grid points
+ * that start the lines are aligned in memory.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -454,6 +466,13 @@ hypre_StructMatrixInitializeData( hypre_StructMatrix *matrix,
 #if defined(HYPRE_USING_CUDA)
    hypre_StructGrid     *grid = hypre_StructMatrixGrid(matrix);
 #endif
+   if (hypre_StructMatrixDataAlignment(matrix) > 1 && data != NULL &&
+       hypre_BoxArraySize(hypre_StructMatrixDataSpace(matrix)) > 0)
+   {
+      data += hypre_BoxAlignDataShift(
+         data, hypre_BoxArrayBox(hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix)), 0),
+         hypre_StructMatrixBox(matrix, 0), hypre_StructMatrixDataAlignment(matrix));
+   }
    hypre_StructMatrixData(matrix) = data;
    hypre_StructMatrixDataConst(matrix) = data_const;
    hypre_StructMatrixDataAlloced(matrix) = 0;
@@ -538,6 +557,7 @@ hypre_StructMatrixInitialize( hypre_StructMatrix *matrix )
 
    hypre_StructMatrixInitializeData(matrix, data, data_const);
    hypre_StructMatrixDataAlloced(matrix) = 1;
+   hypre_StructMatrixDataShift(matrix) = (HYPRE_Int) (hypre_StructMatrixData(matrix) - data);
 
    return hypre_error_flag;
 }
@@ -1447,6 +1467,30 @@ hypre_StructMatrixSetNumGhost( hypre_StructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixSetDataAlignment
+ *
+ * Pads the data boxes in the first dimension so that every line of grid
+ * points, and every box of coefficients, starts at a multiple of alignment
+ * coefficients from the beginning of the data array.  The ghost layers grow
+ * accordingly.  Must be called before the matrix is initialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetDataAlignment( hypre_StructMatrix *matrix,
+                                    HYPRE_Int           alignment )
+{
+   if (alignment < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_StructMatrixDataAlignment(matrix) = alignment;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatrixSetConstantCoefficient
  * deprecated in user interface, in favor of SetConstantEntries.
@@ -1960,6 +2004,235 @@ hypre_StructMatrixRead( MPI_Comm    comm,
 
    return matrix;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixPrintBinary
+ *
+ * Writes the local part of the matrix to "<filename>.bin.<myid>" in the
+ * binary format described in hypre_binary_io.h.  Unlike
+ * hypre_StructMatrixPrint, the complete data arrays (including ghost layers
+ * and padding) are written, so hypre_StructMatrixReadBinary restores the
+ * matrix exactly.  After the header, the file contains:
+ *
+ *    grid           (see hypre_StructGridPrintBinary)
+ *    HYPRE_Int      symmetric, constant_coefficient, data_alignment,
+ *                   data_size, data_const_size, stencil_size
+ *    HYPRE_Int      num_ghost[2*ndim]
+ *    HYPRE_Int      data_space imin/imax extents[num_boxes][2][ndim]
+ *    HYPRE_Int      user stencil shape[stencil_size][ndim]
+ *    HYPRE_Complex  data_const[data_const_size], data[data_size]
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixPrintBinary( const char         *filename,
+                               hypre_StructMatrix *matrix )
+{
+   FILE                 *file;
+   char                  new_filename[255];
+
+   hypre_BoxArray       *data_space;
+   hypre_Box            *data_box;
+   hypre_StructStencil  *stencil;
+   hypre_Index          *stencil_shape;
+   HYPRE_Int             stencil_size;
+   HYPRE_Int             info[6];
+   HYPRE_Int             ndim, i;
+   HYPRE_Int             myid, num_procs;
+
+   ndim          = hypre_StructMatrixNDim(matrix);
+   data_space    = hypre_StructMatrixDataSpace(matrix);
+   stencil       = hypre_StructMatrixUserStencil(matrix);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
+   /*----------------------------------------
+    * Open file
+    *----------------------------------------*/
+
+   hypre_MPI_Comm_rank(hypre_StructMatrixComm(matrix), &myid);
+   hypre_MPI_Comm_size(hypre_StructMatrixComm(matrix), &num_procs);
+
+   hypre_sprintf(new_filename, "%s.bin.%05d", filename, myid);
+
+   if ((file = fopen(new_filename, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------
+    * Write header info, grid, and stencil
+    *----------------------------------------*/
+
+   info[0] = hypre_StructMatrixSymmetric(matrix);
+   info[1] = hypre_StructMatrixConstantCoefficient(matrix);
+   info[2] = hypre_StructMatrixDataAlignment(matrix);
+   info[3] = hypre_StructMatrixDataUsedSize(matrix);
+   info[4] = hypre_StructMatrixDataConstSize(matrix);
+   info[5] = stencil_size;
+
+   hypre_BinaryWriteHeader(file, hypre_BINARY_STRUCT_MATRIX, num_procs);
+   hypre_StructGridPrintBinary(file, hypre_StructMatrixGrid(matrix));
+   hypre_BinaryWrite(file, info, 6*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+   hypre_BinaryWrite(file, hypre_StructMatrixNumGhost(matrix),
+                     2*ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, data_space)
+   {
+      data_box = hypre_BoxArrayBox(data_space, i);
+      hypre_BinaryWrite(file, hypre_BoxIMin(data_box), ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+      hypre_BinaryWrite(file, hypre_BoxIMax(data_box), ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < stencil_size; i++)
+   {
+      hypre_BinaryWrite(file, stencil_shape[i], ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+   }
+
+   /*----------------------------------------
+    * Write data
+    *----------------------------------------*/
+
+   hypre_BinaryWrite(file, hypre_StructMatrixDataConst(matrix),
+                     info[4]*sizeof(HYPRE_Complex), HYPRE_MEMORY_HOST);
+   hypre_BinaryWrite(file, hypre_StructMatrixData(matrix),
+                     info[3]*sizeof(HYPRE_Complex), HYPRE_MEMORY_DEVICE);
+
+   fclose(file);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixReadBinary
+ *
+ * Reads a matrix written by hypre_StructMatrixPrintBinary.  The number of
+ * ghost layers, the data alignment, and the data space are taken from the
+ * file.  The data space is set before initialization because the ghost
+ * layers of symmetric matrices already include the stencil extents.  If any
+ * process fails to read its file, all processes return NULL.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixReadBinary( MPI_Comm    comm,
+                              const char *filename )
+{
+   char                  new_filename[255];
+   hypre_BinaryReader    reader;
+
+   hypre_StructMatrix   *matrix = NULL;
+   hypre_StructGrid     *grid;
+   hypre_BoxArray       *data_space;
+   hypre_Box            *data_box;
+   hypre_StructStencil  *stencil;
+   hypre_Index          *stencil_shape;
+   HYPRE_Int             stencil_size;
+   HYPRE_Int             num_ghost[2*HYPRE_MAXDIM];
+   HYPRE_Int             info[6];
+   HYPRE_Int             ndim, i;
+   HYPRE_Int             myid, num_procs;
+   HYPRE_Int             ok;
+
+   /*----------------------------------------
+    * Open file and read the grid
+    *----------------------------------------*/
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   hypre_sprintf(new_filename, "%s.bin.%05d", filename, myid);
+
+   ok = !hypre_BinaryReaderOpen(&reader, new_filename, hypre_BINARY_STRUCT_MATRIX, num_procs);
+   hypre_StructGridReadBinary(comm, ok ? &reader : NULL, &grid);
+   if (!grid)
+   {
+      hypre_BinaryReaderClose(&reader);
+      return NULL;
+   }
+   ndim = hypre_StructGridNDim(grid);
+
+   /*----------------------------------------
+    * Read header info and stencil
+    *----------------------------------------*/
+
+   if (hypre_BinaryRead(&reader, info, 6*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) ||
+       hypre_BinaryRead(&reader, num_ghost, 2*ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) ||
+       info[2] < 1 || info[5] < 0)
+   {
+      ok = 0;
+   }
+
+   data_space = hypre_BoxArrayCreate(hypre_BoxArraySize(hypre_StructGridBoxes(grid)), ndim);
+   hypre_ForBoxI(i, data_space)
+   {
+      data_box = hypre_BoxArrayBox(data_space, i);
+      if (ok &&
+          (hypre_BinaryRead(&reader, hypre_BoxIMin(data_box), ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) ||
+           hypre_BinaryRead(&reader, hypre_BoxIMax(data_box), ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST)))
+      {
+         ok = 0;
+      }
+   }
+
+   stencil_size  = ok ? info[5] : 0;
+   stencil_shape = hypre_CTAlloc(hypre_Index, stencil_size, HYPRE_MEMORY_HOST);
+   for (i = 0; (i < stencil_size) && ok; i++)
+   {
+      if (hypre_BinaryRead(&reader, stencil_shape[i], ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST))
+      {
+         ok = 0;
+      }
+   }
+   stencil = hypre_StructStencilCreate(ndim, stencil_size, stencil_shape);
+
+   /*----------------------------------------
+    * Initialize the matrix and read data
+    *----------------------------------------*/
+
+   if (ok)
+   {
+      matrix = hypre_StructMatrixCreate(comm, grid, stencil);
+      hypre_StructMatrixSymmetric(matrix) = info[0];
+      hypre_StructMatrixConstantCoefficient(matrix) = info[1];
+      hypre_StructMatrixSetDataAlignment(matrix, info[2]);
+      hypre_StructMatrixDataSpace(matrix) = data_space;
+      hypre_StructMatrixInitialize(matrix);
+      hypre_StructMatrixSetNumGhost(matrix, num_ghost);
+
+      if (hypre_StructMatrixDataUsedSize(matrix) != info[3] ||
+          hypre_StructMatrixDataConstSize(matrix) != info[4])
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary matrix data does not match its grid\n");
+         ok = 0;
+      }
+      else if (hypre_BinaryRead(&reader, hypre_StructMatrixDataConst(matrix),
+                                info[4]*sizeof(HYPRE_Complex), HYPRE_MEMORY_HOST) ||
+               hypre_BinaryRead(&reader, hypre_StructMatrixData(matrix),
+                                info[3]*sizeof(HYPRE_Complex), HYPRE_MEMORY_DEVICE))
+      {
+         ok = 0;
+      }
+   }
+   else
+   {
+      hypre_BoxArrayDestroy(data_space);
+   }
+   hypre_StructGridDestroy(grid);
+   hypre_StructStencilDestroy(stencil);
+   hypre_BinaryReaderClose(&reader);
+
+   /*----------------------------------------
+    * Assemble the matrix (collective)
+    *----------------------------------------*/
+
+   if (!hypre_BinaryAllOK(comm, ok))
+   {
+      hypre_StructMatrixDestroy(matrix);
+      return NULL;
+   }
+
+   hypre_StructMatrixAssemble(matrix);
+
+   return matrix;
+}
 /*--------------------------------------------------------------------------
  * clears matrix stencil coefficients reaching outside of the physical boundaries
  *--------------------------------------------------------------------------*/
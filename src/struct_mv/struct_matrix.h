@@ -33,7 +33,11 @@ typedef struct hypre_StructMatrix_struct
    HYPRE_Complex        *data_const;                /* Pointer to constant matrix data */
    HYPRE_Complex       **stencil_data;              /* Pointer for each stencil */
    HYPRE_Int             data_alloced;              /* Boolean used for freeing data */
-   HYPRE_Int             data_size;                 /* Size of variable matrix data */
+   HYPRE_Int             data_shift;                /* Offset of data from the allocated
+                                                       memory (see data_alignment) */
+   HYPRE_Int             data_size;                 /* Size of variable matrix data,
+                                                       including data_alignment-1
+                                                       coefficients of slack */
    HYPRE_Int             data_const_size;           /* Size of constant matrix data */
    HYPRE_Int           **data_indices;              /* num-boxes by stencil-size array
                                                        of indices into the data array.
@@ -48,6 +52,11 @@ typedef struct hypre_StructMatrix_struct
    HYPRE_Int             symmetric;                 /* Is the matrix symmetric */
    HYPRE_Int            *symm_elements;             /* Which elements are "symmetric" */
    HYPRE_Int             num_ghost[2*HYPRE_MAXDIM]; /* Num ghost layers in each direction */
+   HYPRE_Int             data_alignment;            /* Data lines are padded to a multiple
+                                                       of this many coefficients, and data
+                                                       is placed so that the first grid
+                                                       point of each line is aligned in
+                                                       memory */
 
    HYPRE_BigInt          global_size;               /* Total number of nonzero coeffs */
 
@@ -72,12 +81,16 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixStencilData(matrix)         ((matrix) -> stencil_data)
 #define hypre_StructMatrixDataAlloced(matrix)         ((matrix) -> data_alloced)
 #define hypre_StructMatrixDataSize(matrix)            ((matrix) -> data_size)
+#define hypre_StructMatrixDataShift(matrix)           ((matrix) -> data_shift)
+#define hypre_StructMatrixDataUsedSize(matrix) \
+(hypre_StructMatrixDataSize(matrix) - hypre_StructMatrixDataAlignment(matrix) + 1)
 #define hypre_StructMatrixDataConstSize(matrix)       ((matrix) -> data_const_size)
 #define hypre_StructMatrixDataIndices(matrix)         ((matrix) -> data_indices)
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
+#define hypre_StructMatrixDataAlignment(matrix)       ((matrix) -> data_alignment)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
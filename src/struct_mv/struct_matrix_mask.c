@@ -126,6 +126,8 @@ hypre_StructMatrixCreateMask( hypre_StructMatrix *matrix,
       hypre_StructMatrixNumGhost(mask)[i] =
          hypre_StructMatrixNumGhost(matrix)[i];
    }
+   hypre_StructMatrixDataAlignment(mask) =
+      hypre_StructMatrixDataAlignment(matrix);
 
    hypre_StructMatrixGlobalSize(mask) =
       hypre_StructGridGlobalSize(hypre_StructMatrixGrid(mask)) *
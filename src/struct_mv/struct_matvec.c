@@ -20,6 +20,13 @@
 #endif
 #define MAX_DEPTH 7
 
+/* The fixed stencil kernels below work on whole x-lines of a box, so they are
+   only used with the host BoxLoops */
+#if !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS) && \
+    !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_MATVEC_FIXED_STENCIL
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecData data structure
  *--------------------------------------------------------------------------*/
@@ -115,6 +122,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    hypre_IndexRef           stride;
 
    HYPRE_Int                constant_coefficient;
+   HYPRE_Int                fixed_stencil;
 
    HYPRE_Complex            temp;
    HYPRE_Int                compute_i, i;
@@ -132,6 +140,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
 
    stride = hypre_ComputePkgStride(compute_pkg);
 
+   fixed_stencil = hypre_StructMatvecFixedStencilSupported(A, stride);
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation
     *-----------------------------------------------------------------------*/
@@ -184,7 +194,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
             /*--------------------------------------------------------------
              * initialize y= (beta/alpha)*y normally (where everything
              * is multiplied by alpha at the end),
-             * beta*y for constant coefficient (where only Ax gets multiplied by alpha)
+             * beta*y for constant coefficient (where only Ax gets multiplied by alpha).
+             * The fixed stencil kernels scale y as they go.
              *--------------------------------------------------------------*/
 
             if ( constant_coefficient==1 )
@@ -195,7 +206,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
             {
                temp = beta / alpha;
             }
-            if (temp != 1.0)
+            if (temp != 1.0 && !fixed_stencil)
             {
                boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
                hypre_ForBoxI(i, boxes)
@@ -248,6 +259,13 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
        * y += A*x
        *--------------------------------------------------------------------*/
 
+      if (fixed_stencil)
+      {
+         hypre_StructMatvecFixedStencil( alpha, A, x, beta, y,
+                                         compute_box_aa, stride );
+         continue;
+      }
+
       switch( constant_coefficient )
       {
          case 0:
@@ -1373,6 +1391,291 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * Fixed stencil kernels
+ *
+ * For the common stencil sizes (5, 7, 9, 19 and 27 entries) the sum over the
+ * stencil is written out, so every point of y is read and written once per
+ * matvec and the inner loop over an x-line has unit stride in A, x and y.
+ * The sum is accumulated in a local buffer, which lets the compiler vectorize
+ * the loop without having to check for aliasing between y and the inputs.
+ *--------------------------------------------------------------------------*/
+
+#ifdef HYPRE_MATVEC_FIXED_STENCIL
+
+#define hypre_MatvecLineChunk 128
+
+#define hypre_MatvecSum5(T)  T(0) + T(1) + T(2) + T(3) + T(4)
+#define hypre_MatvecSum7(T)  hypre_MatvecSum5(T) + T(5) + T(6)
+#define hypre_MatvecSum9(T)  hypre_MatvecSum7(T) + T(7) + T(8)
+#define hypre_MatvecSum19(T) hypre_MatvecSum9(T) + T(9) + T(10) + T(11) + \
+   T(12) + T(13) + T(14) + T(15) + T(16) + T(17) + T(18)
+#define hypre_MatvecSum27(T) hypre_MatvecSum19(T) + T(19) + T(20) + T(21) + \
+   T(22) + T(23) + T(24) + T(25) + T(26)
+
+/* variable and constant coefficient terms */
+#define hypre_MatvecTermV(s) Ap[s][ak + k] * xk[k + xoff[s]]
+#define hypre_MatvecTermC(s) Ac[s] * xk[k + xoff[s]]
+
+#define hypre_MatvecLineLoop(sum, term)         \
+   for (k = 0; k < kn; k++)                     \
+   {                                            \
+      t[k] = sum(term);                         \
+   }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFixedStencilLine
+ *
+ * y = beta*y + alpha*A*x on one x-line of n points.  Either Ap (variable
+ * coefficients, row index Ai) or Ac (constant coefficients) is used.  If Ad
+ * is given, it is the variable diagonal that is added to the constant part.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_StructMatvecFixedStencilLine( HYPRE_Int       stencil_size,
+                                    HYPRE_Int       n,
+                                    HYPRE_Complex **Ap,
+                                    HYPRE_Complex  *Ac,
+                                    HYPRE_Complex  *Ad,
+                                    HYPRE_Int       Ai,
+                                    HYPRE_Int      *xoff,
+                                    HYPRE_Complex  *xp,
+                                    HYPRE_Complex   alpha,
+                                    HYPRE_Complex   beta,
+                                    HYPRE_Complex  *yp )
+{
+   HYPRE_Complex  t[hypre_MatvecLineChunk];
+   HYPRE_Complex *xk, *yk;
+   HYPRE_Int      k0, k, kn, ak;
+
+   for (k0 = 0; k0 < n; k0 += hypre_MatvecLineChunk)
+   {
+      kn = hypre_min(hypre_MatvecLineChunk, n - k0);
+      ak = Ai + k0;
+      xk = xp + k0;
+      yk = yp + k0;
+
+      if (Ap)
+      {
+         switch (stencil_size)
+         {
+            case 5:  hypre_MatvecLineLoop(hypre_MatvecSum5,  hypre_MatvecTermV); break;
+            case 7:  hypre_MatvecLineLoop(hypre_MatvecSum7,  hypre_MatvecTermV); break;
+            case 9:  hypre_MatvecLineLoop(hypre_MatvecSum9,  hypre_MatvecTermV); break;
+            case 19: hypre_MatvecLineLoop(hypre_MatvecSum19, hypre_MatvecTermV); break;
+            case 27: hypre_MatvecLineLoop(hypre_MatvecSum27, hypre_MatvecTermV); break;
+         }
+      }
+      else
+      {
+         switch (stencil_size)
+         {
+            case 5:  hypre_MatvecLineLoop(hypre_MatvecSum5,  hypre_MatvecTermC); break;
+            case 7:  hypre_MatvecLineLoop(hypre_MatvecSum7,  hypre_MatvecTermC); break;
+            case 9:  hypre_MatvecLineLoop(hypre_MatvecSum9,  hypre_MatvecTermC); break;
+            case 19: hypre_MatvecLineLoop(hypre_MatvecSum19, hypre_MatvecTermC); break;
+            case 27: hypre_MatvecLineLoop(hypre_MatvecSum27, hypre_MatvecTermC); break;
+         }
+         if (Ad)
+         {
+            for (k = 0; k < kn; k++)
+            {
+               t[k] += Ad[ak + k] * xk[k];
+            }
+         }
+      }
+
+      if (beta == 0.0)
+      {
+         for (k = 0; k < kn; k++)
+         {
+            yk[k] = alpha * t[k];
+         }
+      }
+      else if (beta == 1.0)
+      {
+         for (k = 0; k < kn; k++)
+         {
+            yk[k] += alpha * t[k];
+         }
+      }
+      else
+      {
+         for (k = 0; k < kn; k++)
+         {
+            yk[k] = beta * yk[k] + alpha * t[k];
+         }
+      }
+   }
+}
+
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFixedStencilSupported
+ *
+ * Returns 1 if hypre_StructMatvecFixedStencil can be used for A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFixedStencilSupported( hypre_StructMatrix *A,
+                                         hypre_IndexRef      stride )
+{
+#ifdef HYPRE_MATVEC_FIXED_STENCIL
+   hypre_StructStencil  *stencil      = hypre_StructMatrixStencil(A);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(stencil);
+   hypre_Index           center_index;
+
+   if (stride[0] != 1)
+   {
+      return 0;
+   }
+
+   switch (stencil_size)
+   {
+      case 5: case 7: case 9: case 19: case 27:
+         break;
+      default:
+         return 0;
+   }
+
+   if (hypre_StructMatrixConstantCoefficient(A) == 2)
+   {
+      hypre_SetIndex(center_index, 0);
+      if (hypre_StructStencilElementRank(stencil, center_index) < 0)
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+#else
+   return 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFixedStencil
+ *
+ * y = beta*y + alpha*A*x on the compute boxes, for any constant_coefficient.
+ * Unlike hypre_StructMatvecCC0/1/2, y is not expected to be pre-scaled.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFixedStencil( HYPRE_Complex        alpha,
+                                hypre_StructMatrix  *A,
+                                hypre_StructVector  *x,
+                                HYPRE_Complex        beta,
+                                hypre_StructVector  *y,
+                                hypre_BoxArrayArray *compute_box_aa,
+                                hypre_IndexRef       stride )
+{
+#ifdef HYPRE_MATVEC_FIXED_STENCIL
+   HYPRE_Int                constant_coefficient;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+   HYPRE_Int                center_rank;
+   hypre_Index              center_index;
+
+   HYPRE_Complex           *Ap[27];
+   HYPRE_Complex            Ac[27];
+   HYPRE_Complex           *Ad;
+   HYPRE_Int                xoff[27];
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim, n;
+   HYPRE_Int                i, j, si;
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_SetIndex(center_index, 0);
+   center_rank = hypre_StructStencilElementRank(stencil, center_index);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      Ad = NULL;
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+         if (constant_coefficient == 0)
+         {
+            Ap[si] = hypre_StructMatrixBoxData(A, i, si);
+         }
+         else
+         {
+            Ac[si] = hypre_StructMatrixBoxData(A, i, si)[hypre_CCBoxIndexRank_noargs()];
+         }
+      }
+      if (constant_coefficient == 2)
+      {
+         Ad = hypre_StructMatrixBoxData(A, i, center_rank);
+         Ac[center_rank] = 0.0;
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         /* loop over the x-lines of the box */
+         n = loop_size[0];
+         loop_size[0] = 1;
+
+         if (constant_coefficient == 0)
+         {
+            hypre_BoxLoop3Begin(ndim, loop_size,
+                                A_data_box, start, stride, Ai,
+                                x_data_box, start, stride, xi,
+                                y_data_box, start, stride, yi);
+            {
+               hypre_StructMatvecFixedStencilLine(stencil_size, n, Ap, NULL, NULL, Ai,
+                                                  xoff, xp + xi, alpha, beta, yp + yi);
+            }
+            hypre_BoxLoop3End(Ai, xi, yi);
+         }
+         else
+         {
+            hypre_BoxLoop3Begin(ndim, loop_size,
+                                A_data_box, start, stride, Ai,
+                                x_data_box, start, stride, xi,
+                                y_data_box, start, stride, yi);
+            {
+               hypre_StructMatvecFixedStencilLine(stencil_size, n, NULL, Ac, Ad, Ai,
+                                                  xoff, xp + xi, alpha, beta, yp + yi);
+            }
+            hypre_BoxLoop3End(Ai, xi, yi);
+         }
+      }
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecDestroy
  *--------------------------------------------------------------------------*/
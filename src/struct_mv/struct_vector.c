@@ -38,6 +38,7 @@ hypre_StructVectorCreate( MPI_Comm          comm,
    {
       hypre_StructVectorNumGhost(vector)[i] = hypre_StructGridNumGhost(grid)[i];
    }
+   hypre_StructVectorDataAlignment(vector) = 1;
 
    return vector;
 }
@@ -66,6 +67,8 @@ hypre_StructVectorDestroy( hypre_StructVector *vector )
       {
          if (hypre_StructVectorDataAlloced(vector))
          {
+            /* free from the start of the allocation (see InitializeData) */
+            hypre_StructVectorData(vector) -= hypre_StructVectorDataShift(vector);
 #if defined(HYPRE_USING_CUDA)
             hypre_StructGrid     *grid = hypre_StructVectorGrid(vector);
             if (hypre_StructGridDataLocation(grid) != HYPRE_MEMORY_HOST)
@@ -108,6 +111,7 @@ hypre_StructVectorInitializeShell( hypre_StructVector *vector )
 
    HYPRE_Int            *data_indices;
    HYPRE_Int             data_size;
+   HYPRE_Int             alignment = hypre_StructVectorDataAlignment(vector);
 
    HYPRE_Int             i, d;
 
@@ -135,6 +139,7 @@ hypre_StructVectorInitializeShell( hypre_StructVector *vector )
             hypre_BoxIMinD(data_box, d) -= num_ghost[2*d];
             hypre_BoxIMaxD(data_box, d) += num_ghost[2*d + 1];
          }
+         hypre_BoxAlignDataBox(data_box, alignment);
       }
 
       hypre_StructVectorDataSpace(vector) = data_space;
@@ -158,6 +163,9 @@ hypre_StructVectorInitializeShell( hypre_StructVector *vector )
          data_size += hypre_BoxVolume(data_box);
       }
 
+      /* room for the shift that aligns the data */
+      data_size += alignment - 1;
+
       hypre_StructVectorDataIndices(vector) = data_indices;
 
       hypre_StructVectorDataSize(vector)    = data_size;
@@ -174,12 +182,26 @@ hypre_StructVectorInitializeShell( hypre_StructVector *vector )
 }
 
 /*--------------------------------------------------------------------------
+ * hypre_StructVectorInitializeData
+ *
+ * With a data alignment a > 1, the data is placed at the first position
+ * within the first a values of the given memory at which the grid points that
+ * start the lines are aligned in memory.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
 hypre_StructVectorInitializeData( hypre_StructVector *vector,
                                   HYPRE_Complex      *data)
 {
+   HYPRE_Int  alignment = hypre_StructVectorDataAlignment(vector);
+
+   if (alignment > 1 && data != NULL &&
+       hypre_BoxArraySize(hypre_StructVectorDataSpace(vector)) > 0)
+   {
+      data += hypre_BoxAlignDataShift(
+         data, hypre_BoxArrayBox(hypre_StructGridBoxes(hypre_StructVectorGrid(vector)), 0),
+         hypre_StructVectorBox(vector, 0), alignment);
+   }
    hypre_StructVectorData(vector) = data;
    hypre_StructVectorDataAlloced(vector) = 0;
 
@@ -211,6 +233,7 @@ hypre_StructVectorInitialize( hypre_StructVector *vector )
 
    hypre_StructVectorInitializeData(vector, data);
    hypre_StructVectorDataAlloced(vector) = 1;
+   hypre_StructVectorDataShift(vector) = (HYPRE_Int) (hypre_StructVectorData(vector) - data);
 
    return hypre_error_flag;
 }
@@ -568,7 +591,7 @@ HYPRE_Int
 hypre_StructVectorClearAllValues( hypre_StructVector *vector )
 {
    HYPRE_Complex *data      = hypre_StructVectorData(vector);
-   HYPRE_Int      data_size = hypre_StructVectorDataSize(vector);
+   HYPRE_Int      data_size = hypre_StructVectorDataUsedSize(vector);
    hypre_Index    imin, imax;
    hypre_Box     *box;
 
@@ -609,6 +632,27 @@ hypre_StructVectorSetNumGhost( hypre_StructVector *vector,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Pads the data boxes in the first dimension so that every line of grid
+ * points, and every box, starts at a multiple of alignment values from the
+ * beginning of the data array.  Must be called before initialization.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorSetDataAlignment( hypre_StructVector *vector,
+                                    HYPRE_Int           alignment )
+{
+   if (alignment < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_StructVectorDataAlignment(vector) = alignment;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -962,7 +1006,7 @@ hypre_StructVectorScaleValues( hypre_StructVector *vector, HYPRE_Complex factor
    box = hypre_BoxCreate(hypre_StructVectorNDim(vector));
    hypre_SetIndex(imin, 1);
    hypre_SetIndex(imax, 1);
-   hypre_IndexD(imax, 0) = hypre_StructVectorDataSize(vector);
+   hypre_IndexD(imax, 0) = hypre_StructVectorDataUsedSize(vector);
    hypre_BoxSetExtents(box, imin, imax);
    data = hypre_StructVectorData(vector);
    hypre_BoxGetSize(box, loop_size);
@@ -1180,6 +1224,161 @@ hypre_StructVectorRead( MPI_Comm    comm,
    return vector;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorPrintBinary
+ *
+ * Writes the local part of the vector to "<filename>.bin.<myid>" in the
+ * binary format described in hypre_binary_io.h.  The complete data array
+ * (including ghost layers and padding) is written.  After the header, the
+ * file contains:
+ *
+ *    grid           (see hypre_StructGridPrintBinary)
+ *    HYPRE_Int      data_alignment, data_size
+ *    HYPRE_Int      num_ghost[2*ndim]
+ *    HYPRE_Complex  data[data_size]
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorPrintBinary( const char         *filename,
+                               hypre_StructVector *vector )
+{
+   FILE              *file;
+   char               new_filename[255];
+
+   HYPRE_Int          info[2];
+   HYPRE_Int          ndim;
+   HYPRE_Int          myid, num_procs;
+
+   ndim = hypre_StructGridNDim(hypre_StructVectorGrid(vector));
+
+   /*----------------------------------------
+    * Open file
+    *----------------------------------------*/
+
+   hypre_MPI_Comm_rank(hypre_StructVectorComm(vector), &myid);
+   hypre_MPI_Comm_size(hypre_StructVectorComm(vector), &num_procs);
+
+   hypre_sprintf(new_filename, "%s.bin.%05d", filename, myid);
+
+   if ((file = fopen(new_filename, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------
+    * Write header info and grid
+    *----------------------------------------*/
+
+   info[0] = hypre_StructVectorDataAlignment(vector);
+   info[1] = hypre_StructVectorDataUsedSize(vector);
+
+   hypre_BinaryWriteHeader(file, hypre_BINARY_STRUCT_VECTOR, num_procs);
+   hypre_StructGridPrintBinary(file, hypre_StructVectorGrid(vector));
+   hypre_BinaryWrite(file, info, 2*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+   hypre_BinaryWrite(file, hypre_StructVectorNumGhost(vector),
+                     2*ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST);
+
+   /*----------------------------------------
+    * Write data
+    *----------------------------------------*/
+
+   hypre_BinaryWrite(file, hypre_StructVectorData(vector),
+                     info[1]*sizeof(HYPRE_Complex), HYPRE_MEMORY_DEVICE);
+
+   fclose(file);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorReadBinary
+ *
+ * Reads a vector written by hypre_StructVectorPrintBinary.  The number of
+ * ghost layers and the data alignment are taken from the file.  If any
+ * process fails to read its file, all processes return NULL.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructVector *
+hypre_StructVectorReadBinary( MPI_Comm    comm,
+                              const char *filename )
+{
+   char                  new_filename[255];
+   hypre_BinaryReader    reader;
+
+   hypre_StructVector   *vector = NULL;
+   hypre_StructGrid     *grid;
+   HYPRE_Int             num_ghost[2*HYPRE_MAXDIM];
+   HYPRE_Int             info[2];
+   HYPRE_Int             ndim;
+   HYPRE_Int             myid, num_procs;
+   HYPRE_Int             ok;
+
+   /*----------------------------------------
+    * Open file and read the grid
+    *----------------------------------------*/
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   hypre_sprintf(new_filename, "%s.bin.%05d", filename, myid);
+
+   ok = !hypre_BinaryReaderOpen(&reader, new_filename, hypre_BINARY_STRUCT_VECTOR, num_procs);
+   hypre_StructGridReadBinary(comm, ok ? &reader : NULL, &grid);
+   if (!grid)
+   {
+      hypre_BinaryReaderClose(&reader);
+      return NULL;
+   }
+   ndim = hypre_StructGridNDim(grid);
+
+   /*----------------------------------------
+    * Read header info, initialize the vector, and read data
+    *----------------------------------------*/
+
+   if (hypre_BinaryRead(&reader, info, 2*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) ||
+       hypre_BinaryRead(&reader, num_ghost, 2*ndim*sizeof(HYPRE_Int), HYPRE_MEMORY_HOST) ||
+       info[0] < 1)
+   {
+      ok = 0;
+   }
+
+   if (ok)
+   {
+      vector = hypre_StructVectorCreate(comm, grid);
+      hypre_StructVectorSetNumGhost(vector, num_ghost);
+      hypre_StructVectorSetDataAlignment(vector, info[0]);
+      hypre_StructVectorInitialize(vector);
+
+      if (hypre_StructVectorDataUsedSize(vector) != info[1])
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary vector data does not match its grid\n");
+         ok = 0;
+      }
+      else if (hypre_BinaryRead(&reader, hypre_StructVectorData(vector),
+                                info[1]*sizeof(HYPRE_Complex), HYPRE_MEMORY_DEVICE))
+      {
+         ok = 0;
+      }
+   }
+   hypre_StructGridDestroy(grid);
+   hypre_BinaryReaderClose(&reader);
+
+   /*----------------------------------------
+    * Assemble the vector (collective)
+    *----------------------------------------*/
+
+   if (!hypre_BinaryAllOK(comm, ok))
+   {
+      hypre_StructVectorDestroy(vector);
+      return NULL;
+   }
+
+   hypre_StructVectorAssemble(vector);
+
+   return vector;
+}
+
 /*--------------------------------------------------------------------------
  * The following is used only as a debugging aid.
  *
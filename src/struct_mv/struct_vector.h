@@ -28,7 +28,10 @@ typedef struct hypre_StructVector_struct
 
    HYPRE_Complex        *data;         /* Pointer to vector data on device*/
    HYPRE_Int             data_alloced; /* Boolean used for freeing data */
-   HYPRE_Int             data_size;    /* Size of vector data */
+   HYPRE_Int             data_shift;   /* Offset of data from the allocated
+                                          memory (see data_alignment) */
+   HYPRE_Int             data_size;    /* Size of vector data, including
+                                          data_alignment-1 values of slack */
    HYPRE_Int            *data_indices; /* num-boxes array of indices into
                                           the data array.  data_indices[b]
                                           is the starting index of vector
@@ -36,6 +39,11 @@ typedef struct hypre_StructVector_struct
 
    HYPRE_Int             num_ghost[2*HYPRE_MAXDIM]; /* Num ghost layers in each
                                                      * direction */
+   HYPRE_Int             data_alignment;   /* Data lines are padded to a
+                                            multiple of this many values,
+                                            and data is placed so that the
+                                            first grid point of each line
+                                            is aligned in memory */
    HYPRE_Int             bghost_not_clear; /* Are boundary ghosts clear? */
 
    HYPRE_BigInt          global_size;  /* Total number coefficients */
@@ -54,8 +62,12 @@ typedef struct hypre_StructVector_struct
 #define hypre_StructVectorData(vector)          ((vector) -> data)
 #define hypre_StructVectorDataAlloced(vector)   ((vector) -> data_alloced)
 #define hypre_StructVectorDataSize(vector)      ((vector) -> data_size)
+#define hypre_StructVectorDataShift(vector)     ((vector) -> data_shift)
+#define hypre_StructVectorDataUsedSize(vector) \
+(hypre_StructVectorDataSize(vector) - hypre_StructVectorDataAlignment(vector) + 1)
 #define hypre_StructVectorDataIndices(vector)   ((vector) -> data_indices)
 #define hypre_StructVectorNumGhost(vector)      ((vector) -> num_ghost)
+#define hypre_StructVectorDataAlignment(vector) ((vector) -> data_alignment)
 #define hypre_StructVectorBGhostNotClear(vector)((vector) -> bghost_not_clear)
 #define hypre_StructVectorGlobalSize(vector)    ((vector) -> global_size)
 #define hypre_StructVectorRefCount(vector)      ((vector) -> ref_count)
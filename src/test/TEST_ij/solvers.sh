@@ -179,6 +179,9 @@ FILES="\
  ${TNAME}.out.322\
  ${TNAME}.out.323\
  ${TNAME}.out.324\
+ ${TNAME}.out.325\
+ ${TNAME}.out.326\
+ ${TNAME}.out.327\
 "
 
 for i in $FILES
@@ -81,6 +81,10 @@ extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int
 extern HYPRE_Int hypre_FlexGMRESModifyPCDefault(void *precond_data, HYPRE_Int iteration,
                                                 HYPRE_Real rel_residual_norm);
 
+extern HYPRE_Int hypre_BoomerAMGCreateS(hypre_ParCSRMatrix *A, HYPRE_Real strength_threshold,
+                                        HYPRE_Real max_row_sum, HYPRE_Int num_functions,
+                                        HYPRE_Int *dof_func, hypre_ParCSRMatrix **S_ptr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -98,6 +102,8 @@ main( hypre_int argc,
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
+   HYPRE_Int           thread_stash = 0;
+   HYPRE_Int           reassemble = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
    HYPRE_Int           build_rhs_type;
@@ -114,8 +120,10 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           rr_period = 0;       /* residual replacement, pipelined PCG */
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
+   HYPRE_Int           amg_perf = 0;
    HYPRE_Int           debug_flag;
    HYPRE_Int           ierr = 0;
    HYPRE_Int           i,j;
@@ -241,6 +249,10 @@ main( hypre_int argc,
 #else
    HYPRE_Int    keepTranspose = 0;
 #endif
+   HYPRE_Int    mixed_precision = 0;
+   HYPRE_Int    refresh_values = 0;
+   HYPRE_Int    resetup = 0;
+   HYPRE_Int    num_rhs = 1;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -259,6 +271,7 @@ main( hypre_int argc,
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
+   HYPRE_Int  cheby_eig_refresh = 1;
 
    /* for CGC BM Aug 25, 2006 */
    HYPRE_Int      cgcits = 1;
@@ -290,6 +303,7 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 1;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -307,6 +321,7 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   HYPRE_Int    print_binary = 0;
    HYPRE_Int    rel_change = 0;
 
    /* begin lobpcg */
@@ -383,6 +398,9 @@ main( hypre_int argc,
    HYPRE_Int ilu_max_row_nnz = 1000;
    HYPRE_Int ilu_schur_max_iter = 3;
    HYPRE_Real ilu_nsh_droptol = 1.0e-02;
+   HYPRE_Int ilu_tri_solve = 1;
+   HYPRE_Int ilu_lower_jacobi_iters = 5;
+   HYPRE_Int ilu_upper_jacobi_iters = 5;
    /* end hypre ILU options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -414,6 +432,9 @@ main( hypre_int argc,
    HYPRE_Int amgdd_fac_cycle_type = 1;
    HYPRE_Int amgdd_num_ghost_layers = 1;
 
+   HYPRE_Int spmv_use_sell = 0;
+   HYPRE_Int spmv_halo_overlap = 0;
+   HYPRE_Int comm_node_aware = 0;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Int spgemm_use_cusparse = 1;
    HYPRE_ExecutionPolicy default_exec_policy = HYPRE_EXEC_HOST;
@@ -476,6 +497,12 @@ main( hypre_int argc,
          build_matrix_type      = 0;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-fromparcsrbin") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = 8;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-fromonecsrfile") == 0 )
       {
          arg_index++;
@@ -565,6 +592,16 @@ main( hypre_int argc,
          arg_index++;
          omp_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-thread_stash") == 0 )
+      {
+         arg_index++;
+         thread_stash = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-reassemble") == 0 )
+      {
+         arg_index++;
+         reassemble = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_constant") == 0 )
       {
          arg_index++;
@@ -613,6 +650,12 @@ main( hypre_int argc,
          build_rhs_type      = 7;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsparcsrbin") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsisone") == 0 )
       {
          arg_index++;
@@ -1094,6 +1137,21 @@ main( hypre_int argc,
          arg_index++;
          ilu_nsh_droptol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_tri_solve") == 0 )
+      {                /* direct (1) or Jacobi (0) triangular solves */
+         arg_index++;
+         ilu_tri_solve = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ljac_iters") == 0 )
+      {                /* Jacobi iterations for the L solve */
+         arg_index++;
+         ilu_lower_jacobi_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ujac_iters") == 0 )
+      {                /* Jacobi iterations for the U solve */
+         arg_index++;
+         ilu_upper_jacobi_iters = atoi(argv[arg_index++]);
+      }
       /* end ilu options */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
@@ -1113,6 +1171,21 @@ main( hypre_int argc,
          spgemm_use_cusparse = atoi(argv[arg_index++]);
       }
 #endif
+      else if ( strcmp(argv[arg_index], "-spmv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-spmv_halo") == 0 )
+      {
+         arg_index++;
+         spmv_halo_overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-comm_node_aware") == 0 )
+      {
+         arg_index++;
+         comm_node_aware = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-mempool_growth") == 0 )
       {
          arg_index++;
@@ -1175,9 +1248,9 @@ main( hypre_int argc,
    if (solver_id == 0 || solver_id == 1 || solver_id == 3 || solver_id == 5
        || solver_id == 9 || solver_id == 13 || solver_id == 14
        || solver_id == 15 || solver_id == 20 || solver_id == 51 || solver_id == 61
-       || solver_id == 16
+       || solver_id == 16 || solver_id == 19
        || solver_id == 70 || solver_id == 71 || solver_id == 72
-       || solver_id == 90 || solver_id == 91)
+       || solver_id == 90 || solver_id == 91 || solver_id == -2)
    {
       strong_threshold = 0.25;
       strong_thresholdR = 0.25;
@@ -1209,6 +1282,7 @@ main( hypre_int argc,
    k_dim = 5;
    cgs = 1;
    unroll = 0;
+   s_step = 1;
 
    /* defaults for LGMRES - should use a larger k_dim, though*/
    aug_dim = 2;
@@ -1231,6 +1305,11 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1443,6 +1522,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-rrperiod") == 0 )
+      {
+         arg_index++;
+         rr_period = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1453,6 +1537,11 @@ main( hypre_int argc,
          arg_index++;
          poutdat  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-amg_perf") == 0 )
+      {
+         arg_index++;
+         amg_perf = 1;
+      }
       else if ( strcmp(argv[arg_index], "-var") == 0 )
       {
          arg_index++;
@@ -1571,6 +1660,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_fraction = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_eig_refresh") == 0 )
+      {
+         arg_index++;
+         cheby_eig_refresh = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-additive") == 0 )
       {
          arg_index++;
@@ -1626,6 +1720,26 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mixedprec") == 0 )
+      {
+         arg_index++;
+         mixed_precision = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-refresh") == 0 )
+      {
+         arg_index++;
+         refresh_values = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-resetup") == 0 )
+      {
+         arg_index++;
+         resetup = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-numrhs") == 0 )
+      {
+         arg_index++;
+         num_rhs = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1648,6 +1762,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printbin") == 0 )
+      {
+         arg_index++;
+         print_binary = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1763,6 +1882,8 @@ main( hypre_int argc,
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
+         hypre_printf("  -fromparcsrbin <filename>  : ");
+         hypre_printf("matrix read from multiple files (ParCSR binary format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
          hypre_printf("\n");
@@ -1789,6 +1910,8 @@ main( hypre_int argc,
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
          hypre_printf("rhs read from multiple files (ParCSR format)\n");
+         hypre_printf("  -rhsparcsrbin          : ");
+         hypre_printf("rhs read from multiple files (ParCSR binary format)\n");
          hypre_printf("  -Ffromonefile          : ");
          hypre_printf("list of F points from a single file\n");
          hypre_printf("  -SFfromonefile          : ");
@@ -1824,7 +1947,7 @@ main( hypre_int argc,
          hypre_printf("       12=Schwarz-PCG     13=GSMG           \n");
          hypre_printf("       14=GSMG-PCG        15=GSMG-GMRES\n");
          hypre_printf("       16=AMG-COGMRES     17=DIAG-COGMRES\n");
-         hypre_printf("       18=ParaSails-GMRES\n");
+         hypre_printf("       18=ParaSails-GMRES 19=AMG-PipelinedPCG\n");
          hypre_printf("       20=Hybrid solver/ DiagScale, AMG \n");
          hypre_printf("       43=Euclid-PCG      44=Euclid-GMRES   \n");
          hypre_printf("       45=Euclid-BICGSTAB 46=Euclid-COGMRES\n");
@@ -1837,6 +1960,7 @@ main( hypre_int argc,
          hypre_printf("       80=ILU      81=ILU-GMRES  \n");
          hypre_printf("       82=ILU-FlexGMRES  \n");
          hypre_printf("       90=AMG-DD          91=AMG-DD-GMRES  \n");
+         hypre_printf("       -1=MatVec test     -2=Strength test  \n");
          hypre_printf("\n");
          hypre_printf("  -cljp                 : CLJP coarsening \n");
          hypre_printf("  -cljp1                : CLJP coarsening, fixed random \n");
@@ -1895,6 +2019,7 @@ main( hypre_int argc,
          hypre_printf("       4=Hybrid backward Gauss-Seidel  \n");
          hypre_printf("       6=Hybrid symmetric Gauss-Seidel  \n");
          hypre_printf("       8= symmetric L1-Gauss-Seidel  \n");
+         hypre_printf("       11= multicolor symmetric Gauss-Seidel  \n");
          hypre_printf("       13= forward L1-Gauss-Seidel  \n");
          hypre_printf("       14= backward L1-Gauss-Seidel  \n");
          hypre_printf("       15=CG  \n");
@@ -1912,6 +2037,8 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_eig_refresh <val> : recompute Chebyshev eigenvalue estimates every <val> setups\n");
+         hypre_printf("                             (0 = only once, default is 1)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -1937,6 +2064,10 @@ main( hypre_int argc,
          hypre_printf("  -tr   <val>            : set AMG interpolation truncation factor = val \n");
          hypre_printf("  -Pmx  <val>            : set maximal no. of elmts per row for AMG interpolation (default: 4)\n");
          hypre_printf("  -jtr  <val>            : set truncation threshold for Jacobi interpolation = val \n");
+         hypre_printf("  -mixedprec <val>       : store AMG coarse operators in single precision (0/1)\n");
+         hypre_printf("  -refresh <val>         : numeric-only AMG re-setup for new values of A (0/1)\n");
+         hypre_printf("  -resetup               : change the diagonal of A, then setup and solve again (AMG)\n");
+         hypre_printf("  -numrhs <val>          : also solve for a block of val right-hand sides (AMG)\n");
          hypre_printf("  -Ssw  <val>            : set S-commpkg-switch = val \n");
          hypre_printf("  -mxrs <val>            : set AMG maximum row sum threshold for dependency weakening \n");
          hypre_printf("  -nf <val>              : set number of functions for systems AMG\n");
@@ -1953,11 +2084,13 @@ main( hypre_int argc,
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
+         hypre_printf("  -sstep <val>           : block size of s-step COGMRES (default:1)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -rrperiod  <val>       : residual replacement period for pipelined PCG (default:0)\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
@@ -1978,11 +2111,17 @@ main( hypre_int argc,
          hypre_printf("  -iout <val>            : set output flag\n");
          hypre_printf("       0=no output    1=matrix stats\n");
          hypre_printf("       2=cycle stats  3=matrix & cycle stats\n");
+         hypre_printf("  -amg_perf              : per-level performance report of BoomerAMG\n");
+         hypre_printf("                           (as preconditioner: add 4 to -pout)\n");
          hypre_printf("\n");
          hypre_printf("  -dbg <val>             : set debug flag\n");
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printbin              : write A and b as ParCSR binary files\n");
+         hypre_printf("  -spmv_sell <val>       : use SELL-C-sigma format in host matvec (0/1)\n");
+         hypre_printf("  -spmv_halo <val>       : use persistent halo plans in ParCSR matvec (0/1)\n");
+         hypre_printf("  -comm_node_aware <val> : use node-aware exchanges (0/1)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2093,6 +2232,10 @@ main( hypre_int argc,
          hypre_printf("  -ilu_max_row_nnz   <val>         : set max. num of nonzeros to keep per row = val \n");
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
+         hypre_printf("  -ilu_tri_solve   <val>           : 1 = direct (level-scheduled) triangular solves (default) \n");
+         hypre_printf("                                     0 = Jacobi iterations for the triangular solves \n");
+         hypre_printf("  -ilu_ljac_iters   <val>          : set num. of Jacobi iterations for the L solve = val \n");
+         hypre_printf("  -ilu_ujac_iters   <val>          : set num. of Jacobi iterations for the U solve = val \n");
          /* end ILU options */
          /* hypre AMG-DD options */
          hypre_printf("  -amgdd_start_level   <val>       : set AMG-DD start level = val\n");
@@ -2143,6 +2286,9 @@ main( hypre_int argc,
                             mempool_max_bin, mempool_max_cached_bytes );
 
    hypre_HandleMemoryLocation(hypre_handle())    = memory_location;
+   HYPRE_SetSpMVUseSELL(spmv_use_sell);
+   HYPRE_SetSpMVHaloOverlap(spmv_halo_overlap);
+   HYPRE_SetCommNodeAware(comm_node_aware);
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle()) = default_exec_policy;
    hypre_HandleSpgemmUseCusparse(hypre_handle()) = spgemm_use_cusparse;
@@ -2205,6 +2351,20 @@ main( hypre_int argc,
    {
       BuildParRotate7pt(argc, argv, build_matrix_arg_index, &parcsr_A);
    }
+   else if ( build_matrix_type == 8 )
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  FromBinaryFile: %s\n", argv[build_matrix_arg_index]);
+      }
+      HYPRE_ParCSRMatrixReadBinary(hypre_MPI_COMM_WORLD,
+                                   argv[build_matrix_arg_index], &parcsr_A);
+      if (!parcsr_A)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         exit(1);
+      }
+   }
 
    else
    {
@@ -2385,6 +2545,11 @@ main( hypre_int argc,
          ierr = HYPRE_IJMatrixSetRowSizes ( ij_A, (const HYPRE_Int *) row_sizes );
       }
 
+      if (thread_stash)
+      {
+         HYPRE_IJMatrixSetThreadStash(ij_A, 1);
+      }
+
       ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
 
       if (omp_flag)
@@ -2425,12 +2590,43 @@ main( hypre_int argc,
                                             (const HYPRE_Real *) data);
          }
       }
+      else if (thread_stash)
+      {
+         /* rows set or added concurrently by all threads */
+         HYPRE_Int *row_ptr = hypre_CTAlloc(HYPRE_Int, num_rows+1, HYPRE_MEMORY_HOST);
+         for (i=0; i < num_rows; i++)
+         {
+            row_ptr[i+1] = row_ptr[i] + num_cols_h[i];
+         }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i=0; i < num_rows; i++)
+         {
+            /* -add 2: set the own rows, add to the rows of other processors */
+            if (add == 1 || (add == 2 && (row_nums[i] < first_local_row ||
+                                          row_nums[i] > last_local_row)))
+            {
+               HYPRE_IJMatrixAddToValues( ij_A, 1, &num_cols[i], &row_nums[i],
+                                          (const HYPRE_BigInt *) &col_nums[row_ptr[i]],
+                                          (const HYPRE_Real *) &data[row_ptr[i]] );
+            }
+            else
+            {
+               HYPRE_IJMatrixSetValues( ij_A, 1, &num_cols[i], &row_nums[i],
+                                        (const HYPRE_BigInt *) &col_nums[row_ptr[i]],
+                                        (const HYPRE_Real *) &data[row_ptr[i]] );
+            }
+         }
+         hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      }
       else
       {
          j_indx = 0;
          for (i=0; i < num_rows; i++)
          {
-            if (add)
+            if (add == 1 || (add == 2 && (row_nums[i] < first_local_row ||
+                                          row_nums[i] > last_local_row)))
             {
                ierr += HYPRE_IJMatrixAddToValues( ij_A, 1, &num_cols[i], &row_nums[i],
                                                   (const HYPRE_BigInt *) &col_nums[j_indx],
@@ -2445,18 +2641,6 @@ main( hypre_int argc,
             j_indx += num_cols_h[i];
          }
       }
-      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
-      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
-      {
-         hypre_TFree(col_nums, memory_location);
-         hypre_TFree(data,     memory_location);
-         hypre_TFree(row_nums, memory_location);
-         hypre_TFree(num_cols, memory_location);
-      }
-
       if (sparsity_known == 1)
       {
          hypre_TFree(diag_sizes,    HYPRE_MEMORY_HOST);
@@ -2474,6 +2658,97 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      /* assemble again with a frozen pattern, as done in every time step of
+         a time-dependent problem: all but the last re-assembly use other
+         values (every other coefficient doubled) and are followed by a
+         matvec, the last one restores the original values */
+      if (reassemble && hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST)
+      {
+         time_index = hypre_InitializeTiming("IJ Matrix Re-assembly");
+         hypre_BeginTiming(time_index);
+
+         ierr += HYPRE_IJMatrixFreezePattern( ij_A );
+         for (j = 0; j < reassemble; j++)
+         {
+            if (reassemble > 1 && (j == 0 || j == reassemble-1))
+            {
+               HYPRE_Real scale = (j == 0) ? 2.0 : 0.5;
+
+               for (i = 0, j_indx = 0; i < num_rows; i++)
+               {
+                  j_indx += num_cols[i];
+               }
+               for (i = 0; i < j_indx; i += 2)
+               {
+                  data[i] *= scale;
+               }
+            }
+            ierr += HYPRE_IJMatrixInitialize( ij_A );
+            if (add)
+            {
+               ierr += HYPRE_IJMatrixSetConstantValues( ij_A, 0.0 );
+            }
+            j_indx = 0;
+            for (i=0; i < num_rows; i++)
+            {
+               if (add)
+               {
+                  ierr += HYPRE_IJMatrixAddToValues( ij_A, 1, &num_cols[i], &row_nums[i],
+                                                     (const HYPRE_BigInt *) &col_nums[j_indx],
+                                                     (const HYPRE_Real *) &data[j_indx] );
+               }
+               else
+               {
+                  ierr += HYPRE_IJMatrixSetValues( ij_A, 1, &num_cols[i], &row_nums[i],
+                                                   (const HYPRE_BigInt *) &col_nums[j_indx],
+                                                   (const HYPRE_Real *) &data[j_indx] );
+               }
+               j_indx += num_cols[i];
+            }
+            ierr += HYPRE_IJMatrixAssemble( ij_A );
+
+            if (j < reassemble-1)
+            {
+               hypre_ParCSRMatrix *A_step;
+               hypre_ParVector    *x_step, *y_step;
+
+               HYPRE_IJMatrixGetObject(ij_A, &object);
+               A_step = (hypre_ParCSRMatrix *) object;
+               x_step = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                                              hypre_ParCSRMatrixGlobalNumRows(A_step),
+                                              hypre_ParCSRMatrixRowStarts(A_step));
+               y_step = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                                              hypre_ParCSRMatrixGlobalNumRows(A_step),
+                                              hypre_ParCSRMatrixRowStarts(A_step));
+               hypre_ParVectorSetPartitioningOwner(x_step, 0);
+               hypre_ParVectorSetPartitioningOwner(y_step, 0);
+               hypre_ParVectorInitialize(x_step);
+               hypre_ParVectorInitialize(y_step);
+               hypre_ParVectorSetConstantValues(x_step, 1.0);
+               hypre_ParCSRMatrixMatvec(1.0, A_step, x_step, 0.0, y_step);
+               hypre_ParVectorDestroy(x_step);
+               hypre_ParVectorDestroy(y_step);
+            }
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("IJ Matrix Re-assembly", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+      }
+
+      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
+      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+      {
+         hypre_TFree(col_nums, memory_location);
+         hypre_TFree(data,     memory_location);
+         hypre_TFree(row_nums, memory_location);
+         hypre_TFree(num_cols, memory_location);
+      }
+
       if (ierr)
       {
          hypre_printf("Error in driver building IJMatrix from parcsr matrix. \n");
@@ -2701,6 +2976,31 @@ main( hypre_int argc,
       ierr = HYPRE_IJVectorGetObject( ij_x, &object );
       x = (HYPRE_ParVector) object;
    }
+   else if (build_rhs_type == 8)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("  RHS vector read from binary file %s\n", argv[build_rhs_arg_index]);
+         hypre_printf("  Initial guess is 0\n");
+      }
+
+      ij_b = NULL;
+      HYPRE_ParVectorReadBinary(hypre_MPI_COMM_WORLD, argv[build_rhs_arg_index], &b);
+      if (!b)
+      {
+         hypre_printf("ERROR: Problem reading in the right-hand side!\n");
+         exit(1);
+      }
+
+      /* initial guess */
+      HYPRE_IJVectorCreate(hypre_MPI_COMM_WORLD, first_local_col, last_local_col, &ij_x);
+      HYPRE_IJVectorSetObjectType(ij_x, HYPRE_PARCSR);
+      HYPRE_IJVectorInitialize(ij_x);
+      HYPRE_IJVectorAssemble(ij_x);
+
+      ierr = HYPRE_IJVectorGetObject( ij_x, &object );
+      x = (HYPRE_ParVector) object;
+   }
    else if ( build_rhs_type == 2 )
    {
       if (myid == 0)
@@ -3178,6 +3478,11 @@ main( hypre_int argc,
       }
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x0");
    }
+   if (print_binary)
+   {
+      HYPRE_ParCSRMatrixPrintBinary(parcsr_A, "ParCSR.out.A");
+      HYPRE_ParVectorPrintBinary(b, "ParVec.out.b");
+   }
 
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
@@ -3236,6 +3541,54 @@ main( hypre_int argc,
       goto final;
    }
 
+   /*-----------------------------------------------------------
+    * Time the construction of the strength matrix alone
+    *-----------------------------------------------------------*/
+
+   if (solver_id == -2)
+   {
+      HYPRE_Int           nstr = 100;
+      HYPRE_Int           num_threads = hypre_NumThreads();
+      HYPRE_BigInt        S_nnz;
+      hypre_ParCSRMatrix *S;
+
+      if (myid == 0)
+      {
+         hypre_printf("Building the strength matrix of A %d times\n", nstr);
+         hypre_printf("\n\n Num MPI tasks = %d\n\n",num_procs);
+         hypre_printf(" Num OpenMP threads = %d\n\n",num_threads);
+      }
+
+      time_index = hypre_InitializeTiming("Strength Test");
+      hypre_BeginTiming(time_index);
+
+      for (i = 0; i < nstr; i++)
+      {
+         hypre_BoomerAMGCreateS(parcsr_A, strong_threshold, max_row_sum,
+                                (num_functions > 1 && dof_func) ? num_functions : 1,
+                                (num_functions > 1) ? dof_func : NULL, &S);
+         if (i < nstr-1)
+         {
+            hypre_ParCSRMatrixDestroy(S);
+         }
+      }
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Strength Test", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      hypre_ParCSRMatrixSetDNumNonzeros(S);
+      S_nnz = (HYPRE_BigInt) hypre_ParCSRMatrixDNumNonzeros(S);
+      if (myid == 0)
+      {
+         hypre_printf("Strength matrix nonzeros %b\n", S_nnz);
+      }
+      hypre_ParCSRMatrixDestroy(S);
+
+      goto final;
+   }
+
    if (solver_id == 20)
    {
       if (myid == 0) hypre_printf("Solver:  AMG\n");
@@ -3419,7 +3772,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetJacobiTruncThreshold(amg_solver, jacobi_trunc_threshold);
       HYPRE_BoomerAMGSetSCommPkgSwitch(amg_solver, S_commpkg_switch);
       /* note: log is written to standard output, not to file */
-      HYPRE_BoomerAMGSetPrintLevel(amg_solver, 3);
+      HYPRE_BoomerAMGSetPrintLevel(amg_solver, 3 + 4*amg_perf);
       //HYPRE_BoomerAMGSetLogging(amg_solver, 2);
       HYPRE_BoomerAMGSetPrintFileName(amg_solver, "driver.out.log");
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
@@ -3444,6 +3797,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyEigRefresh(amg_solver, cheby_eig_refresh);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -3499,6 +3853,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
+      HYPRE_BoomerAMGSetRefreshValues(amg_solver, refresh_values);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3616,6 +3972,112 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (resetup && solver_id == 0)
+      {
+         /* change the values of A but not its pattern, then setup again
+            (a numeric-only setup with -refresh 1) */
+         hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(parcsr_A);
+         HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+         HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+         HYPRE_BigInt     first_row = hypre_ParCSRMatrixFirstRowIndex(parcsr_A);
+
+         for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+         {
+            A_diag_data[A_diag_i[i]] *= (first_row + i) % 2 ? 1.5 : 1.1;
+         }
+
+         time_index = hypre_InitializeTiming("BoomerAMG Setup");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_ParVectorSetConstantValues(x, 0.0);
+         HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Setup phase times (new values of A)", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         time_index = hypre_InitializeTiming("BoomerAMG Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times (new values of A)", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("BoomerAMG Iterations = %d\n", num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+      }
+
+      if (num_rhs > 1 && solver_id == 0)
+      {
+         /* solve for a block of right-hand sides, stored row-wise; the first
+            one is b, the others are random */
+         hypre_ParVector *par_b = (hypre_ParVector *) b;
+         hypre_ParVector *b_block, *x_block;
+         HYPRE_Real      *b_data, *b_block_data;
+         HYPRE_Int        local_size = hypre_VectorSize(hypre_ParVectorLocalVector(par_b));
+
+         b_block = hypre_ParMultiVectorCreate(hypre_ParVectorComm(par_b),
+                                              hypre_ParVectorGlobalSize(par_b),
+                                              hypre_ParVectorPartitioning(par_b),
+                                              num_rhs);
+         hypre_ParVectorSetPartitioningOwner(b_block, 0);
+         hypre_ParVectorSetMultiVecStorageMethod(b_block, 1);
+         hypre_ParVectorInitialize(b_block);
+         hypre_ParVectorSetRandomValues(b_block, 22775);
+
+         b_data = hypre_VectorData(hypre_ParVectorLocalVector(par_b));
+         b_block_data = hypre_VectorData(hypre_ParVectorLocalVector(b_block));
+         for (i = 0; i < local_size; i++)
+         {
+            b_block_data[i*num_rhs] = b_data[i];
+         }
+
+         x_block = hypre_ParMultiVectorCreate(hypre_ParVectorComm(par_b),
+                                              hypre_ParVectorGlobalSize(par_b),
+                                              hypre_ParVectorPartitioning(par_b),
+                                              num_rhs);
+         hypre_ParVectorSetPartitioningOwner(x_block, 0);
+         hypre_ParVectorSetMultiVecStorageMethod(x_block, 1);
+         hypre_ParVectorInitialize(x_block);
+         hypre_ParVectorSetConstantValues(x_block, 0.0);
+
+         time_index = hypre_InitializeTiming("BoomerAMG Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, (HYPRE_ParVector) b_block,
+                              (HYPRE_ParVector) x_block);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Solve phase times (block of right-hand sides)", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("Number of right-hand sides = %d\n", num_rhs);
+            hypre_printf("BoomerAMG Iterations = %d\n", num_iterations);
+            hypre_printf("Final Relative Residual Norm (max) = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+
+         hypre_ParVectorDestroy(b_block);
+         hypre_ParVectorDestroy(x_block);
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3739,7 +4201,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetJacobiTruncThreshold(amg_solver, jacobi_trunc_threshold);
       HYPRE_BoomerAMGSetSCommPkgSwitch(amg_solver, S_commpkg_switch);
       /* note: log is written to standard output, not to file */
-      HYPRE_BoomerAMGSetPrintLevel(amg_solver, 3);
+      HYPRE_BoomerAMGSetPrintLevel(amg_solver, 3 + 4*amg_perf);
       HYPRE_BoomerAMGSetPrintFileName(amg_solver, "driver.out.log");
       HYPRE_BoomerAMGSetMaxIter(amg_solver, mg_max_iter);
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
@@ -3759,6 +4221,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyEigRefresh(amg_solver, cheby_eig_refresh);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -3802,6 +4265,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetMixedPrecision(amg_solver, mixed_precision);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol-1]);
@@ -3934,6 +4398,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -3978,6 +4443,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4102,6 +4568,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -4144,6 +4611,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4388,6 +4856,96 @@ main( hypre_int argc,
 
    }
 
+   /*-----------------------------------------------------------
+    * Solve the system using pipelined PCG
+    *-----------------------------------------------------------*/
+
+   if (solver_id == 19)
+   {
+      time_index = hypre_InitializeTiming("Pipelined PCG Setup");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRPipelinedPCGCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      HYPRE_ParCSRPipelinedPCGSetMaxIter(pcg_solver, mg_max_iter);
+      HYPRE_ParCSRPipelinedPCGSetTol(pcg_solver, tol);
+      HYPRE_ParCSRPipelinedPCGSetAbsoluteTol(pcg_solver, atol);
+      HYPRE_ParCSRPipelinedPCGSetTwoNorm(pcg_solver, 1);
+      HYPRE_ParCSRPipelinedPCGSetResidualReplacement(pcg_solver, rr_period);
+      HYPRE_ParCSRPipelinedPCGSetPrintLevel(pcg_solver, ioutdat);
+
+      /* use BoomerAMG as preconditioner */
+      if (myid == 0) hypre_printf("Solver: AMG-PipelinedPCG\n");
+      HYPRE_BoomerAMGCreate(&pcg_precond);
+      HYPRE_BoomerAMGSetInterpType(pcg_precond, interp_type);
+      HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
+      HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
+      HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
+      HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
+      HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
+      HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
+      HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
+      HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+      HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
+      HYPRE_BoomerAMGSetPrintFileName(pcg_precond, "driver.out.log");
+      HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
+      HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
+      HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
+      if (relax_type > -1) HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
+      if (relax_down > -1)
+         HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_down, 1);
+      if (relax_up > -1)
+         HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_up, 2);
+      if (relax_coarse > -1)
+         HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_coarse, 3);
+      HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+      HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
+      HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
+      HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
+      HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
+      HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
+      if (num_functions > 1)
+         HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
+      HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+      HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
+      HYPRE_BoomerAMGSetNumPaths(pcg_precond, num_paths);
+      HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+      HYPRE_ParCSRPipelinedPCGSetPrecond(pcg_solver,
+                                         (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSolve,
+                                         (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSetup,
+                                         pcg_precond);
+
+      HYPRE_ParCSRPipelinedPCGSetup(pcg_solver, parcsr_A, b, x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      time_index = hypre_InitializeTiming("Pipelined PCG Solve");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRPipelinedPCGSolve(pcg_solver, parcsr_A, b, x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      HYPRE_ParCSRPipelinedPCGGetNumIterations(pcg_solver, &num_iterations);
+      HYPRE_ParCSRPipelinedPCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+
+      HYPRE_ParCSRPipelinedPCGDestroy(pcg_solver);
+      HYPRE_BoomerAMGDestroy(pcg_precond);
+
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("Iterations = %d\n", num_iterations);
+         hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+         hypre_printf("\n");
+      }
+   }
+
    /* begin lobpcg */
 
    /*-----------------------------------------------------------
@@ -5430,6 +5988,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(amg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -5554,6 +6113,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -5598,6 +6158,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5670,6 +6231,9 @@ main( hypre_int argc,
          HYPRE_ILUSetDropThreshold(pcg_precond,ilu_droptol);
          /* set max iterations for Schur system solve */
          HYPRE_ILUSetSchurMaxIter( pcg_precond, ilu_schur_max_iter );
+         HYPRE_ILUSetTriSolve( pcg_precond, ilu_tri_solve );
+         HYPRE_ILUSetLowerJacobiIters( pcg_precond, ilu_lower_jacobi_iters );
+         HYPRE_ILUSetUpperJacobiIters( pcg_precond, ilu_upper_jacobi_iters );
          if(ilu_type == 20 || ilu_type == 21)
          {
             HYPRE_ILUSetNSHDropThreshold( pcg_precond, ilu_nsh_droptol);
@@ -5854,6 +6418,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -5898,6 +6463,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6040,6 +6606,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6084,6 +6651,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6231,6 +6799,9 @@ main( hypre_int argc,
          HYPRE_ILUSetDropThreshold(pcg_precond,ilu_droptol);
          /* set max iterations for Schur system solve */
          HYPRE_ILUSetSchurMaxIter( pcg_precond, ilu_schur_max_iter );
+         HYPRE_ILUSetTriSolve( pcg_precond, ilu_tri_solve );
+         HYPRE_ILUSetLowerJacobiIters( pcg_precond, ilu_lower_jacobi_iters );
+         HYPRE_ILUSetUpperJacobiIters( pcg_precond, ilu_upper_jacobi_iters );
          if(ilu_type == 20 || ilu_type == 21)
          {
             HYPRE_ILUSetNSHDropThreshold( pcg_precond, ilu_nsh_droptol);
@@ -6407,6 +6978,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6452,6 +7024,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6700,6 +7273,7 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetSStep(pcg_solver, s_step);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -6756,6 +7330,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6801,6 +7376,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7066,6 +7642,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyEigRefresh(pcg_precond, cheby_eig_refresh);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7103,6 +7680,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetMixedPrecision(pcg_precond, mixed_precision);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7373,6 +7951,9 @@ main( hypre_int argc,
       HYPRE_ILUSetTol(ilu_solver, tol);
       /* set max iterations for Schur system solve */
       HYPRE_ILUSetSchurMaxIter( ilu_solver, ilu_schur_max_iter );
+      HYPRE_ILUSetTriSolve( ilu_solver, ilu_tri_solve );
+      HYPRE_ILUSetLowerJacobiIters( ilu_solver, ilu_lower_jacobi_iters );
+      HYPRE_ILUSetUpperJacobiIters( ilu_solver, ilu_upper_jacobi_iters );
 
       /* setting for NSH */
       if(ilu_type == 20 || ilu_type == 21)
@@ -7449,7 +8030,8 @@ main( hypre_int argc,
    }
 
    /* for build_rhs_type = 1, 6 or 7, we did not create ij_b  - just b*/
-   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7)
+   if (build_rhs_type == 1 || build_rhs_type == 6 || build_rhs_type == 7 ||
+       build_rhs_type == 8)
    {
       HYPRE_ParVectorDestroy(b);
    }
@@ -100,6 +100,8 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           tblock;
+   HYPRE_Int           align;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -133,11 +135,14 @@ main( hypre_int argc,
    HYPRE_Int           read_rhsfromfile_index;
    HYPRE_Int           read_x0fromfile_param;
    HYPRE_Int           read_x0fromfile_index;
+   HYPRE_Int           read_frombin_param;
+   HYPRE_Int           read_frombin_index;
    HYPRE_Int           periodx0[3] = {0,0,0};
    HYPRE_Int          *readperiodic;
    HYPRE_Int           sum;
 
    HYPRE_Int           print_system = 0;
+   HYPRE_Int           print_binary = 0;
 
    /* begin lobpcg */
 
@@ -202,6 +207,8 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   tblock = 0;
+   align = 1;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -252,6 +259,8 @@ main( hypre_int argc,
    read_rhsfromfile_index = argc;
    read_x0fromfile_param = 0;
    read_x0fromfile_index = argc;
+   read_frombin_param = 0;
+   read_frombin_index = argc;
    sum = 0;
 
    /* ghost defaults */
@@ -344,6 +353,12 @@ main( hypre_int argc,
          read_x0fromfile_param = 1;
          read_x0fromfile_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-frombin") == 0 )
+      {
+         arg_index++;
+         read_frombin_param = 1;
+         read_frombin_index = arg_index;
+      }
       else if (strcmp(argv[arg_index], "-repeats") == 0 )
       {
          arg_index++;
@@ -393,6 +408,16 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tblock") == 0 )
+      {
+         arg_index++;
+         tblock = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-align") == 0 )
+      {
+         arg_index++;
+         align = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -418,6 +443,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printbin") == 0 )
+      {
+         arg_index++;
+         print_binary = 1;
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -511,6 +541,12 @@ main( hypre_int argc,
    /*end lobpcg */
 
    sum = read_x0fromfile_param + read_rhsfromfile_param + read_fromfile_param;
+   if (read_frombin_param)
+   {
+      /* everything is read from binary files */
+      read_x0fromfile_param = read_rhsfromfile_param = read_fromfile_param = 0;
+      sum = 3;
+   }
 
    /*-----------------------------------------------------------
     * Print usage info
@@ -532,6 +568,7 @@ main( hypre_int argc,
       hypre_printf("  -fromfile <name>    : prefix name for matrixfiles\n");
       hypre_printf("  -rhsfromfile <name> : prefix name for rhsfiles\n");
       hypre_printf("  -x0fromfile <name>  : prefix name for firstguessfiles\n");
+      hypre_printf("  -frombin <name>     : read <name>.A, <name>.b, <name>.x0 binary files\n");
       hypre_printf("  -repeats <reps>     : number of times to repeat the run, default 1.  For solver 0,1,3\n");
       hypre_printf("  -solver <ID>        : solver ID\n");
       hypre_printf("                        0  - SMG (default)\n");
@@ -581,6 +618,9 @@ main( hypre_int argc,
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -tblock <d>         : temporal blocking depth for PFMG Jacobi\n");
+      hypre_printf("  -align <a>          : align struct data lines to multiples of a\n");
+      hypre_printf("  -printbin           : write A, b, x0 and x as binary struct.out.* files\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
@@ -685,6 +725,8 @@ main( hypre_int argc,
       hypre_printf("  (n_pre, n_post) = (%d, %d)\n", n_pre, n_post);
       hypre_printf("  dim             = %d\n", dim);
       hypre_printf("  skip            = %d\n", skip);
+      hypre_printf("  tblock          = %d\n", tblock);
+      hypre_printf("  align           = %d\n", align);
       hypre_printf("  sym             = %d\n", sym);
       hypre_printf("  rap             = %d\n", rap);
       hypre_printf("  relax           = %d\n", relax);
@@ -701,6 +743,8 @@ main( hypre_int argc,
       hypre_printf("  (n_pre, n_post) = (%d, %d)\n", n_pre, n_post);
       hypre_printf("  dim             = %d\n", dim);
       hypre_printf("  skip            = %d\n", skip);
+      hypre_printf("  tblock          = %d\n", tblock);
+      hypre_printf("  align           = %d\n", align);
       hypre_printf("  sym             = %d\n", sym);
       hypre_printf("  rap             = %d\n", rap);
       hypre_printf("  relax           = %d\n", relax);
@@ -929,6 +973,27 @@ main( hypre_int argc,
                                    argv[read_x0fromfile_index],v_num_ghost);
       }
 
+      if (read_frombin_param)
+      {
+         char  filename[255];
+
+         hypre_sprintf(filename, "%s.A", argv[read_frombin_index]);
+         HYPRE_StructMatrixReadBinary(hypre_MPI_COMM_WORLD, filename, &A);
+         hypre_sprintf(filename, "%s.b", argv[read_frombin_index]);
+         HYPRE_StructVectorReadBinary(hypre_MPI_COMM_WORLD, filename, &b);
+         hypre_sprintf(filename, "%s.x0", argv[read_frombin_index]);
+         HYPRE_StructVectorReadBinary(hypre_MPI_COMM_WORLD, filename, &x);
+         if (!A || !b || !x)
+         {
+            if (myid == 0)
+            {
+               hypre_printf("Error: can't read the binary files %s.*\n",
+                            argv[read_frombin_index]);
+            }
+            exit(1);
+         }
+      }
+
       /* beginning of sum == 0  */
       if (sum == 0)    /* no read from any file */
       {
@@ -1067,7 +1132,7 @@ main( hypre_int argc,
          }
 
          HYPRE_StructMatrixSetSymmetric(A, sym);
-         HYPRE_StructMatrixInitialize(A);
+         HYPRE_StructMatrixInitializeAligned(A, align);
 
          /*-----------------------------------------------------------
           * Fill in the matrix elements
@@ -1088,7 +1153,7 @@ main( hypre_int argc,
           *-----------------------------------------------------------*/
 
          HYPRE_StructVectorCreate(hypre_MPI_COMM_WORLD, grid, &b);
-         HYPRE_StructVectorInitialize(b);
+         HYPRE_StructVectorInitializeAligned(b, align);
 
          /*-----------------------------------------------------------
           * For periodic b.c. in all directions, need rhs to satisfy
@@ -1100,7 +1165,7 @@ main( hypre_int argc,
          HYPRE_StructVectorAssemble(b);
 
          HYPRE_StructVectorCreate(hypre_MPI_COMM_WORLD, grid, &x);
-         HYPRE_StructVectorInitialize(x);
+         HYPRE_StructVectorInitializeAligned(x, align);
 
          AddValuesVector(grid,x,periodx0,0.0);
          HYPRE_StructVectorAssemble(x);
@@ -1337,6 +1402,12 @@ main( hypre_int argc,
          HYPRE_StructVectorPrint("struct.out.b", b, 0);
          HYPRE_StructVectorPrint("struct.out.x0", x, 0);
       }
+      if (print_binary)
+      {
+         HYPRE_StructMatrixPrintBinary("struct.out.A", A);
+         HYPRE_StructVectorPrintBinary("struct.out.b", b);
+         HYPRE_StructVectorPrintBinary("struct.out.x0", x);
+      }
 
       /*-----------------------------------------------------------
        * Solve the system using SMG
@@ -1427,6 +1498,7 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetTemporalBlocking(solver, tblock);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1605,6 +1677,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1770,6 +1843,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2004,6 +2078,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2249,6 +2324,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2373,6 +2449,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2524,6 +2601,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2675,6 +2753,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2773,6 +2852,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2827,6 +2907,10 @@ main( hypre_int argc,
       {
          HYPRE_StructVectorPrint("struct.out.x", x, 0);
       }
+      if (print_binary)
+      {
+         HYPRE_StructVectorPrintBinary("struct.out.x", x);
+      }
 
       if (myid == 0 && rep==reps-1 /* begin lobpcg */ && !lobpcgFlag /* end lobpcg */)
       {
@@ -116,6 +116,26 @@ typedef HYPRE_Int MPI_Comm;
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 
+/*--------------------------------------------------------------------------
+ * HYPRE kernel selection
+ *--------------------------------------------------------------------------*/
+
+/* Use the SELL-C-sigma format in the host CSR matvec (default 0).
+ * The SELL copy of a matrix is built on first use and cached.  It is dropped
+ * by the HYPRE_IJMatrix value routines; values changed directly through the
+ * data arrays of a hypre_CSRMatrix require hypre_CSRMatrixSELLInvalidate. */
+HYPRE_Int HYPRE_SetSpMVUseSELL( HYPRE_Int use_sell );
+
+/* Use persistent halo-exchange plans cached in the communication package
+ * and overlap the exchange with the interior rows in the ParCSR matvec
+ * (default 0) */
+HYPRE_Int HYPRE_SetSpMVHaloOverlap( HYPRE_Int overlap );
+
+/* Use node-aware (shared memory plus aggregated inter-node messages)
+ * exchanges in communication packages created afterwards (default 0).
+ * Only has an effect if hypre was configured with node-aware MPI. */
+HYPRE_Int HYPRE_SetCommNodeAware( HYPRE_Int node_aware );
+
 /*--------------------------------------------------------------------------
  * HYPRE error user functions
  *--------------------------------------------------------------------------*/
@@ -39,6 +39,7 @@ typedef unsigned long long int hypre_ulonglongint;
 
 /* This allows us to consistently avoid 'double' throughout hypre */
 typedef double                 hypre_double;
+typedef float                  hypre_float;
 
 /*--------------------------------------------------------------------------
  * Define various functions
@@ -256,6 +257,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -269,6 +271,17 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Win             hypre_MPI_Win
+#define MPI_Win_allocate_shared hypre_MPI_Win_allocate_shared
+#define MPI_Win_shared_query hypre_MPI_Win_shared_query
+#define MPI_Win_free        hypre_MPI_Win_free
+#define MPI_Win_lock_all    hypre_MPI_Win_lock_all
+#define MPI_Win_unlock_all  hypre_MPI_Win_unlock_all
+#define MPI_Win_sync        hypre_MPI_Win_sync
+#define MPI_Comm_create_keyval hypre_MPI_Comm_create_keyval
+#define MPI_Comm_set_attr   hypre_MPI_Comm_set_attr
+#define MPI_Comm_get_attr   hypre_MPI_Comm_get_attr
+#define MPI_Comm_delete_attr hypre_MPI_Comm_delete_attr
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -290,12 +303,18 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef HYPRE_Int  hypre_MPI_Win;
+typedef hypre_int (hypre_MPI_Comm_copy_attr_function) (hypre_MPI_Comm, hypre_int, void *, void *,
+                                                       void *, hypre_int *);
+typedef hypre_int (hypre_MPI_Comm_delete_attr_function) (hypre_MPI_Comm, hypre_int, void *, void *);
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
 
 #define  hypre_MPI_COMM_TYPE_SHARED 0
+#define  hypre_MPI_KEYVAL_INVALID   -1
+#define  hypre_MPI_COMM_NULL_COPY_FN NULL
 
 #define  hypre_MPI_BOTTOM  0x0
 
@@ -337,13 +356,18 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_Win      hypre_MPI_Win;
 typedef MPI_User_function    hypre_MPI_User_function;
+typedef MPI_Comm_copy_attr_function   hypre_MPI_Comm_copy_attr_function;
+typedef MPI_Comm_delete_attr_function hypre_MPI_Comm_delete_attr_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
+#define  hypre_MPI_KEYVAL_INVALID     MPI_KEYVAL_INVALID
+#define  hypre_MPI_COMM_NULL_COPY_FN  MPI_COMM_NULL_COPY_FN
 
 #define  hypre_MPI_FLOAT   MPI_FLOAT
 #define  hypre_MPI_DOUBLE  MPI_DOUBLE
@@ -427,6 +451,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -438,11 +463,23 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP) || defined(HYPRE_USING_NODE_AWARE_MPI)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+HYPRE_Int hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size , HYPRE_Int disp_unit , hypre_MPI_Info info , hypre_MPI_Comm comm , void *baseptr , hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_shared_query( hypre_MPI_Win win , HYPRE_Int rank , hypre_MPI_Aint *size , HYPRE_Int *disp_unit , void *baseptr );
+HYPRE_Int hypre_MPI_Win_free( hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_lock_all( HYPRE_Int assert , hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_unlock_all( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_sync( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Comm_create_keyval( hypre_MPI_Comm_copy_attr_function *copy_fn , hypre_MPI_Comm_delete_attr_function *delete_fn , HYPRE_Int *keyval , void *extra_state );
+HYPRE_Int hypre_MPI_Comm_set_attr( hypre_MPI_Comm comm , HYPRE_Int keyval , void *attr_val );
+HYPRE_Int hypre_MPI_Comm_get_attr( hypre_MPI_Comm comm , HYPRE_Int keyval , void *attr_val , HYPRE_Int *flag );
+HYPRE_Int hypre_MPI_Comm_delete_attr( hypre_MPI_Comm comm , HYPRE_Int keyval );
+#endif
 
 #ifdef __cplusplus
 }
@@ -1225,6 +1262,9 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   HYPRE_Int              spmv_use_sell;
+   HYPRE_Int              spmv_halo_overlap;
+   HYPRE_Int              comm_node_aware;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_CudaData        *cuda_data;
 #endif
@@ -1234,6 +1274,9 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSELL(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleSpMVHaloOverlap(hypre_handle)                ((hypre_handle) -> spmv_halo_overlap)
+#define hypre_HandleCommNodeAware(hypre_handle)                  ((hypre_handle) -> comm_node_aware)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
@@ -1268,6 +1311,63 @@ typedef struct
 
 #endif
 
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header info for the binary (checkpoint/restart) file format
+ *
+ * Every binary file starts with a fixed 32-byte header:
+ *
+ *    char       magic[8]      "HYPREBIN"
+ *    hypre_int  version       hypre_BINARY_VERSION
+ *    hypre_int  object_type   one of the hypre_BINARY_* object types below
+ *    char       sizes[4]      sizeof HYPRE_Int, HYPRE_BigInt, HYPRE_Real, HYPRE_Complex
+ *    hypre_uint byte_order    hypre_BINARY_BYTE_ORDER as written by the producer
+ *    hypre_int  num_procs     number of processes that wrote the object
+ *    char       reserved[4]
+ *
+ * followed by the raw (native byte order) arrays of the object.  The sizes,
+ * byte order and number of processes are checked on read, so a file can only
+ * be read back by a hypre build with the same integer and floating point
+ * types on a machine with the same endianness, and with one process per file.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_BINARY_IO_HEADER
+#define hypre_BINARY_IO_HEADER
+
+#define hypre_BINARY_MAGIC          "HYPREBIN"
+#define hypre_BINARY_VERSION        2
+#define hypre_BINARY_BYTE_ORDER     0x01020304u
+#define hypre_BINARY_HEADER_SIZE    32
+
+#define hypre_BINARY_STRUCT_MATRIX  1
+#define hypre_BINARY_STRUCT_VECTOR  2
+#define hypre_BINARY_PARCSR_MATRIX  3
+#define hypre_BINARY_PAR_VECTOR     4
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReader:
+ *   A binary file that has been mapped (or, where mmap is not available,
+ *   read) into memory, together with a read position.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   char      *buffer;
+   size_t     size;
+   size_t     offset;
+   HYPRE_Int  mapped;
+
+} hypre_BinaryReader;
+
+#endif
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -1288,6 +1388,14 @@ HYPRE_Int hypre_BinarySearch2 ( HYPRE_Int *list , HYPRE_Int value , HYPRE_Int lo
 HYPRE_Int *hypre_LowerBound( HYPRE_Int *first, HYPRE_Int *last, HYPRE_Int value );
 HYPRE_BigInt *hypre_BigLowerBound( HYPRE_BigInt *first, HYPRE_BigInt *last, HYPRE_BigInt value );
 
+/* hypre_binary_io.c */
+HYPRE_Int hypre_BinaryWriteHeader ( FILE *file , HYPRE_Int object_type , HYPRE_Int num_procs );
+HYPRE_Int hypre_BinaryWrite ( FILE *file , void *data , size_t nbytes , HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_BinaryReaderOpen ( hypre_BinaryReader *reader , const char *filename , HYPRE_Int object_type , HYPRE_Int num_procs );
+HYPRE_Int hypre_BinaryRead ( hypre_BinaryReader *reader , void *data , size_t nbytes , HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_BinaryAllOK ( MPI_Comm comm , HYPRE_Int ok );
+HYPRE_Int hypre_BinaryReaderClose ( hypre_BinaryReader *reader );
+
 /* hypre_complex.c */
 #ifdef HYPRE_COMPLEX
 HYPRE_Complex hypre_conj( HYPRE_Complex value );
@@ -1308,6 +1416,9 @@ HYPRE_Int hypre_HandleDestroy(hypre_Handle *hypre_handle_);
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
+HYPRE_Int HYPRE_SetSpMVUseSELL( HYPRE_Int use_sell );
+HYPRE_Int HYPRE_SetSpMVHaloOverlap( HYPRE_Int overlap );
+HYPRE_Int HYPRE_SetCommNodeAware( HYPRE_Int node_aware );
 
 /* hypre_qsort.c */
 void hypre_swap ( HYPRE_Int *v , HYPRE_Int i , HYPRE_Int j );
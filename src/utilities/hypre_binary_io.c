@@ -0,0 +1,303 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Routines for writing and reading the binary checkpoint/restart format
+ * (see hypre_binary_io.h).  Files are read with mmap where available so that
+ * restarting from a large checkpoint is limited by the file system rather
+ * than by text parsing.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#include <string.h>
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryWriteHeader
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryWriteHeader( FILE      *file,
+                         HYPRE_Int  object_type,
+                         HYPRE_Int  num_procs )
+{
+   char        header[hypre_BINARY_HEADER_SIZE];
+   hypre_int   version = hypre_BINARY_VERSION;
+   hypre_int   type = (hypre_int) object_type;
+   hypre_uint  byte_order = hypre_BINARY_BYTE_ORDER;
+   hypre_int   nprocs = (hypre_int) num_procs;
+
+   memset(header, 0, hypre_BINARY_HEADER_SIZE);
+   memcpy(header, hypre_BINARY_MAGIC, 8);
+   memcpy(header + 8, &version, 4);
+   memcpy(header + 12, &type, 4);
+   header[16] = (char) sizeof(HYPRE_Int);
+   header[17] = (char) sizeof(HYPRE_BigInt);
+   header[18] = (char) sizeof(HYPRE_Real);
+   header[19] = (char) sizeof(HYPRE_Complex);
+   memcpy(header + 20, &byte_order, 4);
+   memcpy(header + 24, &nprocs, 4);
+
+   return hypre_BinaryWrite(file, header, hypre_BINARY_HEADER_SIZE, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryWrite
+ *   Write nbytes of raw data.  Data that does not live on the host is
+ *   staged through a temporary host buffer.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryWrite( FILE                 *file,
+                   void                 *data,
+                   size_t                nbytes,
+                   HYPRE_MemoryLocation  memory_location )
+{
+   char  *data_host = (char *) data;
+
+   if (nbytes == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      data_host = hypre_TAlloc(char, nbytes, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(data_host, data, char, nbytes, HYPRE_MEMORY_HOST, memory_location);
+   }
+
+   if (fwrite(data_host, 1, nbytes, file) != nbytes)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary file\n");
+   }
+
+   if (data_host != (char *) data)
+   {
+      hypre_TFree(data_host, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReaderOpen
+ *   Map the file into memory and check its header against object_type,
+ *   num_procs, and the type sizes and byte order of this build.  Returns 0
+ *   on success and 1 (after setting the hypre error) otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryReaderOpen( hypre_BinaryReader *reader,
+                        const char         *filename,
+                        HYPRE_Int           object_type,
+                        HYPRE_Int           num_procs )
+{
+   char        *header;
+   hypre_int    version, type, nprocs;
+   hypre_uint   byte_order;
+#ifndef WIN32
+   HYPRE_Int    fd;
+   struct stat  st;
+#else
+   FILE        *file;
+   long         size;
+#endif
+
+   reader -> buffer = NULL;
+   reader -> size   = 0;
+   reader -> offset = 0;
+   reader -> mapped = 0;
+
+#ifndef WIN32
+   if ((fd = open(filename, O_RDONLY)) < 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary input file\n");
+      return 1;
+   }
+   if (fstat(fd, &st) != 0 || st.st_size < hypre_BINARY_HEADER_SIZE)
+   {
+      close(fd);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary input file is truncated\n");
+      return 1;
+   }
+   reader -> size = (size_t) st.st_size;
+   reader -> buffer = (char *) mmap(NULL, reader -> size, PROT_READ, MAP_PRIVATE, fd, 0);
+   if (reader -> buffer != MAP_FAILED)
+   {
+      reader -> mapped = 1;
+#ifdef MADV_SEQUENTIAL
+      madvise(reader -> buffer, reader -> size, MADV_SEQUENTIAL);
+#endif
+   }
+   else
+   {
+      /* fall back to reading the whole file */
+      ssize_t  nread;
+      size_t   total = 0;
+
+      reader -> buffer = hypre_TAlloc(char, reader -> size, HYPRE_MEMORY_HOST);
+      while (total < reader -> size)
+      {
+         nread = read(fd, reader -> buffer + total, reader -> size - total);
+         if (nread <= 0)
+         {
+            break;
+         }
+         total += (size_t) nread;
+      }
+      if (total != reader -> size)
+      {
+         close(fd);
+         hypre_BinaryReaderClose(reader);
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary input file\n");
+         return 1;
+      }
+   }
+   close(fd);
+#else
+   if ((file = fopen(filename, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary input file\n");
+      return 1;
+   }
+   fseek(file, 0, SEEK_END);
+   size = ftell(file);
+   fseek(file, 0, SEEK_SET);
+   if (size < hypre_BINARY_HEADER_SIZE)
+   {
+      fclose(file);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary input file is truncated\n");
+      return 1;
+   }
+   reader -> size = (size_t) size;
+   reader -> buffer = hypre_TAlloc(char, reader -> size, HYPRE_MEMORY_HOST);
+   if (fread(reader -> buffer, 1, reader -> size, file) != reader -> size)
+   {
+      fclose(file);
+      hypre_BinaryReaderClose(reader);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary input file\n");
+      return 1;
+   }
+   fclose(file);
+#endif
+
+   /* check the header */
+   header = reader -> buffer;
+   memcpy(&version, header + 8, 4);
+   memcpy(&type, header + 12, 4);
+   memcpy(&byte_order, header + 20, 4);
+   memcpy(&nprocs, header + 24, 4);
+   if (memcmp(header, hypre_BINARY_MAGIC, 8) != 0 ||
+       version != hypre_BINARY_VERSION || type != (hypre_int) object_type)
+   {
+      hypre_BinaryReaderClose(reader);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: not a hypre binary file of the expected type\n");
+      return 1;
+   }
+   if (byte_order != hypre_BINARY_BYTE_ORDER ||
+       header[16] != (char) sizeof(HYPRE_Int)  || header[17] != (char) sizeof(HYPRE_BigInt) ||
+       header[18] != (char) sizeof(HYPRE_Real) || header[19] != (char) sizeof(HYPRE_Complex))
+   {
+      hypre_BinaryReaderClose(reader);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file was written with different type sizes or byte order\n");
+      return 1;
+   }
+   if (nprocs != (hypre_int) num_procs)
+   {
+      hypre_BinaryReaderClose(reader);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file was written by a different number of processes\n");
+      return 1;
+   }
+   reader -> offset = hypre_BINARY_HEADER_SIZE;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryRead
+ *   Copy the next nbytes of the file into data.  Returns 0 on success and 1
+ *   (after setting the hypre error) if the file is too short.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryRead( hypre_BinaryReader   *reader,
+                  void                 *data,
+                  size_t                nbytes,
+                  HYPRE_MemoryLocation  memory_location )
+{
+   if (nbytes == 0)
+   {
+      return 0;
+   }
+
+   if (reader -> buffer == NULL || nbytes > reader -> size - reader -> offset)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary input file is truncated\n");
+      return 1;
+   }
+
+   hypre_TMemcpy(data, reader -> buffer + reader -> offset, char, nbytes,
+                 memory_location, HYPRE_MEMORY_HOST);
+   reader -> offset += nbytes;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryAllOK
+ *   Returns 1 if ok is nonzero on every process in comm.  The readers call
+ *   this before each collective operation, so that a process that could not
+ *   read its file does not leave the others waiting.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryAllOK( MPI_Comm   comm,
+                   HYPRE_Int  ok )
+{
+   HYPRE_Int  all_ok;
+
+   ok = (ok != 0);
+   hypre_MPI_Allreduce(&ok, &all_ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   return all_ok;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReaderClose
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BinaryReaderClose( hypre_BinaryReader *reader )
+{
+   if (reader -> buffer)
+   {
+#ifndef WIN32
+      if (reader -> mapped)
+      {
+         munmap(reader -> buffer, reader -> size);
+      }
+      else
+#endif
+      {
+         hypre_TFree(reader -> buffer, HYPRE_MEMORY_HOST);
+      }
+   }
+   reader -> buffer = NULL;
+   reader -> size   = 0;
+   reader -> offset = 0;
+   reader -> mapped = 0;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header info for the binary (checkpoint/restart) file format
+ *
+ * Every binary file starts with a fixed 32-byte header:
+ *
+ *    char       magic[8]      "HYPREBIN"
+ *    hypre_int  version       hypre_BINARY_VERSION
+ *    hypre_int  object_type   one of the hypre_BINARY_* object types below
+ *    char       sizes[4]      sizeof HYPRE_Int, HYPRE_BigInt, HYPRE_Real, HYPRE_Complex
+ *    hypre_uint byte_order    hypre_BINARY_BYTE_ORDER as written by the producer
+ *    hypre_int  num_procs     number of processes that wrote the object
+ *    char       reserved[4]
+ *
+ * followed by the raw (native byte order) arrays of the object.  The sizes,
+ * byte order and number of processes are checked on read, so a file can only
+ * be read back by a hypre build with the same integer and floating point
+ * types on a machine with the same endianness, and with one process per file.
+ *
+ *****************************************************************************/
+
+#ifndef hypre_BINARY_IO_HEADER
+#define hypre_BINARY_IO_HEADER
+
+#define hypre_BINARY_MAGIC          "HYPREBIN"
+#define hypre_BINARY_VERSION        2
+#define hypre_BINARY_BYTE_ORDER     0x01020304u
+#define hypre_BINARY_HEADER_SIZE    32
+
+#define hypre_BINARY_STRUCT_MATRIX  1
+#define hypre_BINARY_STRUCT_VECTOR  2
+#define hypre_BINARY_PARCSR_MATRIX  3
+#define hypre_BINARY_PAR_VECTOR     4
+
+/*--------------------------------------------------------------------------
+ * hypre_BinaryReader:
+ *   A binary file that has been mapped (or, where mmap is not available,
+ *   read) into memory, together with a read position.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   char      *buffer;
+   size_t     size;
+   size_t     offset;
+   HYPRE_Int  mapped;
+
+} hypre_BinaryReader;
+
+#endif
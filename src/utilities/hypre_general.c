@@ -187,6 +187,36 @@ HYPRE_Init()
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ *
+ * hypre kernel selection
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+HYPRE_SetSpMVUseSELL( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSELL(hypre_handle()) = use_sell;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+HYPRE_SetSpMVHaloOverlap( HYPRE_Int overlap )
+{
+   hypre_HandleSpMVHaloOverlap(hypre_handle()) = overlap;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+HYPRE_SetCommNodeAware( HYPRE_Int node_aware )
+{
+   hypre_HandleCommNodeAware(hypre_handle()) = node_aware;
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * hypre finalization
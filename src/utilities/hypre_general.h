@@ -23,6 +23,7 @@ typedef unsigned long long int hypre_ulonglongint;
 
 /* This allows us to consistently avoid 'double' throughout hypre */
 typedef double                 hypre_double;
+typedef float                  hypre_float;
 
 /*--------------------------------------------------------------------------
  * Define various functions
@@ -27,6 +27,9 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   HYPRE_Int              spmv_use_sell;
+   HYPRE_Int              spmv_halo_overlap;
+   HYPRE_Int              comm_node_aware;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_CudaData        *cuda_data;
 #endif
@@ -36,6 +39,9 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSELL(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleSpMVHaloOverlap(hypre_handle)                ((hypre_handle) -> spmv_halo_overlap)
+#define hypre_HandleCommNodeAware(hypre_handle)                  ((hypre_handle) -> comm_node_aware)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
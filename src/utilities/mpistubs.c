@@ -553,6 +553,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+   return 0;
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -646,7 +659,7 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return(0);
 }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP) || defined(HYPRE_USING_NODE_AWARE_MPI)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
    return (0);
@@ -663,6 +676,75 @@ HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info )
 }
 #endif
 
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+HYPRE_Int
+hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size, HYPRE_Int disp_unit, hypre_MPI_Info info, hypre_MPI_Comm comm, void *baseptr, hypre_MPI_Win *win )
+{
+   *((void **) baseptr) = NULL;
+   *win = 0;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_shared_query( hypre_MPI_Win win, HYPRE_Int rank, hypre_MPI_Aint *size, HYPRE_Int *disp_unit, void *baseptr )
+{
+   *size = 0;
+   *disp_unit = 1;
+   *((void **) baseptr) = NULL;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_free( hypre_MPI_Win *win )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_lock_all( HYPRE_Int assert, hypre_MPI_Win win )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_unlock_all( hypre_MPI_Win win )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Win_sync( hypre_MPI_Win win )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Comm_create_keyval( hypre_MPI_Comm_copy_attr_function *copy_fn, hypre_MPI_Comm_delete_attr_function *delete_fn, HYPRE_Int *keyval, void *extra_state )
+{
+   *keyval = 0;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Comm_set_attr( hypre_MPI_Comm comm, HYPRE_Int keyval, void *attr_val )
+{
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Comm_get_attr( hypre_MPI_Comm comm, HYPRE_Int keyval, void *attr_val, HYPRE_Int *flag )
+{
+   *flag = 0;
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_Comm_delete_attr( hypre_MPI_Comm comm, HYPRE_Int keyval )
+{
+   return (0);
+}
+#endif
+
 /******************************************************************************
  * MPI stubs to do casting of HYPRE_Int and hypre_int correctly
  *****************************************************************************/
@@ -1181,6 +1263,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
                                     datatype, op, comm);
 }
 
+/* Falls back to a blocking reduction (and a null request) before MPI-3 */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1303,7 +1405,7 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP) || defined(HYPRE_USING_NODE_AWARE_MPI)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
@@ -1323,4 +1425,81 @@ hypre_MPI_Info_free( hypre_MPI_Info *info )
 }
 #endif
 
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+HYPRE_Int
+hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size, HYPRE_Int disp_unit, hypre_MPI_Info info, hypre_MPI_Comm comm, void *baseptr, hypre_MPI_Win *win )
+{
+   return (HYPRE_Int) MPI_Win_allocate_shared(size, (hypre_int) disp_unit, info, comm, baseptr, win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_shared_query( hypre_MPI_Win win, HYPRE_Int rank, hypre_MPI_Aint *size, HYPRE_Int *disp_unit, void *baseptr )
+{
+   hypre_int mpi_disp_unit;
+   HYPRE_Int ierr;
+
+   ierr = (HYPRE_Int) MPI_Win_shared_query(win, (hypre_int) rank, size, &mpi_disp_unit, baseptr);
+   *disp_unit = (HYPRE_Int) mpi_disp_unit;
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Win_free( hypre_MPI_Win *win )
+{
+   return (HYPRE_Int) MPI_Win_free(win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_lock_all( HYPRE_Int assert, hypre_MPI_Win win )
+{
+   return (HYPRE_Int) MPI_Win_lock_all((hypre_int) assert, win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_unlock_all( hypre_MPI_Win win )
+{
+   return (HYPRE_Int) MPI_Win_unlock_all(win);
+}
+
+HYPRE_Int
+hypre_MPI_Win_sync( hypre_MPI_Win win )
+{
+   return (HYPRE_Int) MPI_Win_sync(win);
+}
+
+HYPRE_Int
+hypre_MPI_Comm_create_keyval( hypre_MPI_Comm_copy_attr_function *copy_fn, hypre_MPI_Comm_delete_attr_function *delete_fn, HYPRE_Int *keyval, void *extra_state )
+{
+   hypre_int mpi_keyval;
+   HYPRE_Int ierr;
+
+   ierr = (HYPRE_Int) MPI_Comm_create_keyval(copy_fn, delete_fn, &mpi_keyval, extra_state);
+   *keyval = (HYPRE_Int) mpi_keyval;
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Comm_set_attr( hypre_MPI_Comm comm, HYPRE_Int keyval, void *attr_val )
+{
+   return (HYPRE_Int) MPI_Comm_set_attr(comm, (hypre_int) keyval, attr_val);
+}
+
+HYPRE_Int
+hypre_MPI_Comm_get_attr( hypre_MPI_Comm comm, HYPRE_Int keyval, void *attr_val, HYPRE_Int *flag )
+{
+   hypre_int mpi_flag;
+   HYPRE_Int ierr;
+
+   ierr = (HYPRE_Int) MPI_Comm_get_attr(comm, (hypre_int) keyval, attr_val, &mpi_flag);
+   *flag = (HYPRE_Int) mpi_flag;
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_Comm_delete_attr( hypre_MPI_Comm comm, HYPRE_Int keyval )
+{
+   return (HYPRE_Int) MPI_Comm_delete_attr(comm, (hypre_int) keyval);
+}
+#endif
+
 #endif
@@ -116,6 +116,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -129,6 +130,17 @@ extern "C" {
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_Win             hypre_MPI_Win
+#define MPI_Win_allocate_shared hypre_MPI_Win_allocate_shared
+#define MPI_Win_shared_query hypre_MPI_Win_shared_query
+#define MPI_Win_free        hypre_MPI_Win_free
+#define MPI_Win_lock_all    hypre_MPI_Win_lock_all
+#define MPI_Win_unlock_all  hypre_MPI_Win_unlock_all
+#define MPI_Win_sync        hypre_MPI_Win_sync
+#define MPI_Comm_create_keyval hypre_MPI_Comm_create_keyval
+#define MPI_Comm_set_attr   hypre_MPI_Comm_set_attr
+#define MPI_Comm_get_attr   hypre_MPI_Comm_get_attr
+#define MPI_Comm_delete_attr hypre_MPI_Comm_delete_attr
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -150,12 +162,18 @@ typedef struct
 typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
+typedef HYPRE_Int  hypre_MPI_Win;
+typedef hypre_int (hypre_MPI_Comm_copy_attr_function) (hypre_MPI_Comm, hypre_int, void *, void *,
+                                                       void *, hypre_int *);
+typedef hypre_int (hypre_MPI_Comm_delete_attr_function) (hypre_MPI_Comm, hypre_int, void *, void *);
 
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
 
 #define  hypre_MPI_COMM_TYPE_SHARED 0
+#define  hypre_MPI_KEYVAL_INVALID   -1
+#define  hypre_MPI_COMM_NULL_COPY_FN NULL
 
 #define  hypre_MPI_BOTTOM  0x0
 
@@ -197,13 +215,18 @@ typedef MPI_Status   hypre_MPI_Status;
 typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
+typedef MPI_Win      hypre_MPI_Win;
 typedef MPI_User_function    hypre_MPI_User_function;
+typedef MPI_Comm_copy_attr_function   hypre_MPI_Comm_copy_attr_function;
+typedef MPI_Comm_delete_attr_function hypre_MPI_Comm_delete_attr_function;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
 #define  hypre_MPI_BOTTOM             MPI_BOTTOM
 #define  hypre_MPI_COMM_SELF          MPI_COMM_SELF
 #define  hypre_MPI_COMM_TYPE_SHARED   MPI_COMM_TYPE_SHARED
+#define  hypre_MPI_KEYVAL_INVALID     MPI_KEYVAL_INVALID
+#define  hypre_MPI_COMM_NULL_COPY_FN  MPI_COMM_NULL_COPY_FN
 
 #define  hypre_MPI_FLOAT   MPI_FLOAT
 #define  hypre_MPI_DOUBLE  MPI_DOUBLE
@@ -287,6 +310,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -298,11 +322,23 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP) || defined(HYPRE_USING_NODE_AWARE_MPI)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
+#ifdef HYPRE_USING_NODE_AWARE_MPI
+HYPRE_Int hypre_MPI_Win_allocate_shared( hypre_MPI_Aint size , HYPRE_Int disp_unit , hypre_MPI_Info info , hypre_MPI_Comm comm , void *baseptr , hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_shared_query( hypre_MPI_Win win , HYPRE_Int rank , hypre_MPI_Aint *size , HYPRE_Int *disp_unit , void *baseptr );
+HYPRE_Int hypre_MPI_Win_free( hypre_MPI_Win *win );
+HYPRE_Int hypre_MPI_Win_lock_all( HYPRE_Int assert , hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_unlock_all( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Win_sync( hypre_MPI_Win win );
+HYPRE_Int hypre_MPI_Comm_create_keyval( hypre_MPI_Comm_copy_attr_function *copy_fn , hypre_MPI_Comm_delete_attr_function *delete_fn , HYPRE_Int *keyval , void *extra_state );
+HYPRE_Int hypre_MPI_Comm_set_attr( hypre_MPI_Comm comm , HYPRE_Int keyval , void *attr_val );
+HYPRE_Int hypre_MPI_Comm_get_attr( hypre_MPI_Comm comm , HYPRE_Int keyval , void *attr_val , HYPRE_Int *flag );
+HYPRE_Int hypre_MPI_Comm_delete_attr( hypre_MPI_Comm comm , HYPRE_Int keyval );
+#endif
 
 #ifdef __cplusplus
 }
@@ -18,6 +18,14 @@ HYPRE_Int hypre_BinarySearch2 ( HYPRE_Int *list , HYPRE_Int value , HYPRE_Int lo
 HYPRE_Int *hypre_LowerBound( HYPRE_Int *first, HYPRE_Int *last, HYPRE_Int value );
 HYPRE_BigInt *hypre_BigLowerBound( HYPRE_BigInt *first, HYPRE_BigInt *last, HYPRE_BigInt value );
 
+/* hypre_binary_io.c */
+HYPRE_Int hypre_BinaryWriteHeader ( FILE *file , HYPRE_Int object_type , HYPRE_Int num_procs );
+HYPRE_Int hypre_BinaryWrite ( FILE *file , void *data , size_t nbytes , HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_BinaryReaderOpen ( hypre_BinaryReader *reader , const char *filename , HYPRE_Int object_type , HYPRE_Int num_procs );
+HYPRE_Int hypre_BinaryRead ( hypre_BinaryReader *reader , void *data , size_t nbytes , HYPRE_MemoryLocation memory_location );
+HYPRE_Int hypre_BinaryAllOK ( MPI_Comm comm , HYPRE_Int ok );
+HYPRE_Int hypre_BinaryReaderClose ( hypre_BinaryReader *reader );
+
 /* hypre_complex.c */
 #ifdef HYPRE_COMPLEX
 HYPRE_Complex hypre_conj( HYPRE_Complex value );
@@ -38,6 +46,9 @@ HYPRE_Int hypre_HandleDestroy(hypre_Handle *hypre_handle_);
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
+HYPRE_Int HYPRE_SetSpMVUseSELL( HYPRE_Int use_sell );
+HYPRE_Int HYPRE_SetSpMVHaloOverlap( HYPRE_Int overlap );
+HYPRE_Int HYPRE_SetCommNodeAware( HYPRE_Int node_aware );
 
 /* hypre_qsort.c */
 void hypre_swap ( HYPRE_Int *v , HYPRE_Int i , HYPRE_Int j );